@@ -11,6 +11,7 @@
 #include <string>
 
 #include <dynarmic/A32/config.h>
+#include <dynarmic/code_cache_statistics.h>
 
 namespace Dynarmic {
 namespace A32 {
@@ -98,6 +99,9 @@ public:
         return is_executing;
     }
 
+    /// Returns statistics describing the usage of the code cache.
+    CodeCacheStatistics GetCodeCacheStatistics() const;
+
     /**
      * Debugging: Disassemble all of compiled code.
      * @return A string containing disassembly of all host machine code produced.
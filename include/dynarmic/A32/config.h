@@ -14,6 +14,8 @@
 
 namespace Dynarmic {
 class ExclusiveMonitor;
+class SharedCodeCache;
+class TranslationCache;
 } // namespace Dynarmic
 
 namespace Dynarmic {
@@ -103,6 +105,34 @@ struct UserConfig {
     size_t processor_id = 0;
     ExclusiveMonitor* global_monitor = nullptr;
 
+    /// When set, translated blocks are stored in and retrieved from this cache, which may
+    /// be shared with other Jit instances and persisted between runs.
+    /// If nullptr, every block is translated from guest code.
+    TranslationCache* translation_cache = nullptr;
+
+    /// When set to true, newly reached blocks are translated on a background thread instead
+    /// of stalling execution. Until a block has been translated, guest code at that location
+    /// is executed one instruction at a time.
+    /// In this mode MemoryReadCode may be called from the background thread, concurrently
+    /// with other callbacks.
+    bool background_compilation = false;
+
+    /// When set, emitted code is shared with the other Jit instances using this cache,
+    /// which must have the same configuration apart from processor_id. These Jits may execute
+    /// concurrently, so their callbacks must be thread-safe. The fast dispatch optimization is
+    /// disabled in this mode.
+    /// If nullptr, this Jit has its own code cache.
+    SharedCodeCache* shared_code_cache = nullptr;
+
+    /// Size in bytes of the memory allocated for emitted code. The code cache is split into
+    /// segments; when it fills up, the oldest segment is evicted and reused.
+    size_t code_cache_size = 128 * 1024 * 1024;
+    /// Offset in bytes from the start of the code cache to the region holding rarely executed
+    /// code. Must be less than code_cache_size.
+    size_t far_code_offset = 100 * 1024 * 1024;
+    /// Size in bytes of the pool of constants referenced by emitted code.
+    size_t constant_pool_size = 2 * 1024 * 1024;
+
     /// This selects other optimizations than can't otherwise be disabled by setting other
     /// configuration options. This includes:
     /// - IR optimizations
@@ -12,6 +12,7 @@
 #include <string>
 
 #include <dynarmic/A64/config.h>
+#include <dynarmic/code_cache_statistics.h>
 
 namespace Dynarmic {
 namespace A64 {
@@ -124,6 +125,9 @@ public:
      */
     bool IsExecuting() const;
 
+    /// Returns statistics describing the usage of the code cache.
+    CodeCacheStatistics GetCodeCacheStatistics() const;
+
     /**
      * Debugging: Disassemble all of compiled code.
      * @return A string containing disassembly of all host machine code produced.
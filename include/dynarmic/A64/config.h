@@ -14,6 +14,8 @@
 
 namespace Dynarmic {
 class ExclusiveMonitor;
+class SharedCodeCache;
+class TranslationCache;
 } // namespace Dynarmic
 
 namespace Dynarmic {
@@ -126,6 +128,42 @@ struct UserConfig {
     size_t processor_id = 0;
     ExclusiveMonitor* global_monitor = nullptr;
 
+    /// When set, translated blocks are stored in and retrieved from this cache, which may
+    /// be shared with other Jit instances and persisted between runs.
+    /// If nullptr, every block is translated from guest code.
+    TranslationCache* translation_cache = nullptr;
+
+    /// When set to true, newly reached blocks are translated on a background thread instead
+    /// of stalling execution. Until a block has been translated, guest code at that location
+    /// is executed one instruction at a time.
+    /// In this mode MemoryReadCode may be called from the background thread, concurrently
+    /// with other callbacks.
+    bool background_compilation = false;
+
+    /// When non-zero, newly reached blocks are first compiled quickly without IR optimizations
+    /// and count how often they are executed. Once a block has been executed this many times it
+    /// is recompiled with all enabled optimizations, and links to it are redirected to the new code.
+    /// Blocks executed one instruction at a time, and blocks found in translation_cache, are
+    /// always fully optimized.
+    /// If zero, every block is compiled with all enabled optimizations immediately.
+    std::uint32_t tiering_threshold = 0;
+
+    /// When set, emitted code is shared with the other Jit instances using this cache,
+    /// which must have the same configuration apart from processor_id. These Jits may execute
+    /// concurrently, so their callbacks must be thread-safe. The fast dispatch optimization is
+    /// disabled in this mode.
+    /// If nullptr, this Jit has its own code cache.
+    SharedCodeCache* shared_code_cache = nullptr;
+
+    /// Size in bytes of the memory allocated for emitted code. The code cache is split into
+    /// segments; when it fills up, the oldest segment is evicted and reused.
+    size_t code_cache_size = 128 * 1024 * 1024;
+    /// Offset in bytes from the start of the code cache to the region holding rarely executed
+    /// code. Must be less than code_cache_size.
+    size_t far_code_offset = 100 * 1024 * 1024;
+    /// Size in bytes of the pool of constants referenced by emitted code.
+    size_t constant_pool_size = 2 * 1024 * 1024;
+
     /// This selects other optimizations than can't otherwise be disabled by setting other
     /// configuration options. This includes:
     /// - IR optimizations
@@ -211,6 +249,35 @@ struct UserConfig {
     /// page boundary.
     bool only_detect_misalignment_via_page_table_on_page_boundary = false;
 
+    // Fastmem Pointer
+    // This should point to the beginning of a 2^fastmem_address_space_bits bytes address space
+    // which is in arranged just like what you wish for emulated memory to be. If the host page
+    // faults on an address, the JIT will fallback to calling the MemoryRead*/MemoryWrite* callbacks.
+    void* fastmem_pointer = nullptr;
+    /// Determines if instructions that pagefault should cause recompilation of that block
+    /// with fastmem disabled.
+    bool recompile_on_fastmem_failure = true;
+    /// Declares how many valid address bits are there in virtual addresses.
+    /// Determines the size of the fastmem arena. Valid values are between 12 and 64 inclusive.
+    /// This is only used if fastmem_pointer is not nullptr.
+    size_t fastmem_address_space_bits = 36;
+    /// Determines what happens if the guest accesses an address that is off the end of the
+    /// fastmem arena. If true, Dynarmic will silently mirror the fastmem arena's address space.
+    /// If false, accessing memory outside of the arena will result in a call to the relevant
+    /// memory callback.
+    /// This is only used if fastmem_pointer is not nullptr.
+    bool silently_mirror_fastmem = true;
+
+    /// Guest general-purpose registers to keep resident in callee-saved host registers across
+    /// linked blocks, instead of loading and storing them at every block boundary. Bit n
+    /// selects Xn. At most five registers are pinned (three if both page_table and
+    /// fastmem_pointer are set); the lowest-numbered selected registers are chosen.
+    /// Pinned registers are written back to the Jit's state when Run or Step returns and
+    /// around the CallSVC, ExceptionRaised, DataCacheOperationRaised and InterpreterFallback
+    /// callbacks. Other callbacks, notably the memory callbacks, observe stale values for
+    /// pinned registers.
+    std::uint32_t pinned_gpr_mask = 0;
+
     /// This option relates to translation. Generally when we run into an unpredictable
     /// instruction the ExceptionRaised callback is called. If this is true, we define
     /// definite behaviour for some unpredictable instructions.
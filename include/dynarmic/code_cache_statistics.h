@@ -0,0 +1,34 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Dynarmic {
+
+/// Describes the usage of a Jit's code cache. When the code cache is shared between Jits,
+/// these statistics cover all of them.
+struct CodeCacheStatistics {
+    /// Number of blocks which currently have emitted code.
+    std::size_t resident_blocks = 0;
+    /// Number of blocks emitted in total.
+    std::uint64_t emitted_blocks = 0;
+    /// Size in bytes of the code emitted for those blocks, excluding far code.
+    std::uint64_t emitted_code_size = 0;
+    /// Number of times emitted code had to spill a value from a host register to memory.
+    std::uint64_t register_spills = 0;
+    /// Number of blocks recompiled with all enabled optimizations after becoming hot.
+    std::uint64_t promoted_blocks = 0;
+    /// Number of times the oldest segment of the code cache was evicted to make space.
+    std::uint64_t evicted_segments = 0;
+    /// Number of blocks removed by segment evictions.
+    std::uint64_t evicted_blocks = 0;
+    /// Number of times the entire code cache was cleared.
+    std::uint64_t cache_clears = 0;
+};
+
+} // namespace Dynarmic
@@ -10,19 +10,31 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <vector>
 
 namespace Dynarmic {
 
+namespace Backend::X64 {
+struct ExclusiveMonitorFriend;
+} // namespace Backend::X64
+
 using VAddr = std::uint64_t;
 using Vector = std::array<std::uint64_t, 2>;
 
+/// The global exclusive monitor.
+///
+/// Reservations are held in per-processor slots. Rather than serialising every
+/// exclusive access behind a single lock, reservations are sharded by a hash of
+/// the reserved address: exclusive accesses to different addresses only contend
+/// if they happen to hash to the same shard.
 class ExclusiveMonitor {
 public:
     /// @param processor_count Maximum number of processors using this global
     ///                        exclusive monitor. Each processor must have a
     ///                        unique id.
     explicit ExclusiveMonitor(size_t processor_count);
+    ~ExclusiveMonitor();
 
     size_t GetProcessorCount() const;
 
@@ -33,11 +45,12 @@ public:
         static_assert(std::is_trivially_copyable_v<T>);
         const VAddr masked_address = address & RESERVATION_GRANULE_MASK;
 
-        Lock();
-        exclusive_addresses[processor_id] = masked_address;
+        Shard& shard = GetShard(masked_address);
+        Lock(shard);
+        Mark(shard, processor_id, masked_address);
         const T value = op();
-        std::memcpy(exclusive_values[processor_id].data(), &value, sizeof(T));
-        Unlock();
+        std::memcpy(processors[processor_id].value.data(), &value, sizeof(T));
+        Unlock(shard);
         return value;
     }
 
@@ -48,15 +61,20 @@ public:
     template <typename T, typename Function>
     bool DoExclusiveOperation(size_t processor_id, VAddr address, Function op) {
         static_assert(std::is_trivially_copyable_v<T>);
-        if (!CheckAndClear(processor_id, address)) {
+        const VAddr masked_address = address & RESERVATION_GRANULE_MASK;
+
+        Shard& shard = GetShard(masked_address);
+        Lock(shard);
+        if (!CheckAndClear(shard, processor_id, masked_address)) {
+            Unlock(shard);
             return false;
         }
 
         T saved_value;
-        std::memcpy(&saved_value, exclusive_values[processor_id].data(), sizeof(T));
+        std::memcpy(&saved_value, processors[processor_id].value.data(), sizeof(T));
         const bool result = op(saved_value);
 
-        Unlock();
+        Unlock(shard);
         return result;
     }
 
@@ -66,16 +84,41 @@ public:
     void ClearProcessor(size_t processor_id);
 
 private:
-    bool CheckAndClear(size_t processor_id, VAddr address);
+    friend struct Backend::X64::ExclusiveMonitorFriend;
+
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    static constexpr size_t SHARD_BITS = 6;
+    static constexpr size_t SHARD_COUNT = 1 << SHARD_BITS;
+    static constexpr std::uint64_t SHARD_HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        std::atomic<bool> is_locked{false};
+        /// Processors which may hold a reservation hashing to this shard.
+        /// Only accessed while this shard is locked.
+        std::uint64_t processor_mask = 0;
+    };
+
+    struct alignas(CACHE_LINE_SIZE) ProcessorSlot {
+        std::atomic<VAddr> address;
+        Vector value;
+    };
+
+    static size_t ShardIndex(VAddr masked_address);
+    Shard& GetShard(VAddr masked_address) {
+        return shards[ShardIndex(masked_address)];
+    }
+
+    void Mark(Shard& shard, size_t processor_id, VAddr masked_address);
+    bool CheckAndClear(Shard& shard, size_t processor_id, VAddr masked_address);
 
-    void Lock();
-    void Unlock();
+    static void Lock(Shard& shard);
+    static void Unlock(Shard& shard);
 
     static constexpr VAddr RESERVATION_GRANULE_MASK = 0xFFFF'FFFF'FFFF'FFFFull;
     static constexpr VAddr INVALID_EXCLUSIVE_ADDRESS = 0xDEAD'DEAD'DEAD'DEADull;
-    std::atomic_flag is_locked;
-    std::vector<VAddr> exclusive_addresses;
-    std::vector<Vector> exclusive_values;
+    size_t processor_count;
+    std::unique_ptr<ProcessorSlot[]> processors;
+    std::unique_ptr<Shard[]> shards;
 };
 
 } // namespace Dynarmic
@@ -32,6 +32,21 @@ enum class OptimizationFlag : std::uint32_t {
     ConstProp               = 0x00000010,
     /// This is enables miscellaneous safe IR optimizations.
     MiscIROpt               = 0x00000020,
+    /// This optimization continues translating a basic block at the target of an unconditional
+    /// direct branch instead of ending the block there. This avoids a block transition and allows
+    /// IR optimizations to operate across the branch.
+    /// This is a safe optimization.
+    BranchFollowing         = 0x00000040,
+    /// This optimization makes the register allocator take into account where values are next
+    /// used within a block when choosing a register to evict, and move values out of registers
+    /// clobbered by host calls into free callee-saved registers instead of spilling them.
+    /// This is a safe optimization.
+    RegAllocLookahead       = 0x00000080,
+    /// This optimization leaves the guest NZCV flags in the host flags after they are set, so that
+    /// conditional selects and conditional branches later in the same block can use them directly
+    /// instead of reloading them from the emulated CPU state.
+    /// This is a safe optimization.
+    HostFlags               = 0x00000100,
 
     /// This is an UNSAFE optimization that reduces accuracy of fused multiply-add operations.
     /// This unfuses fused instructions to improve performance on host CPUs without FMA support.
@@ -0,0 +1,47 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <memory>
+
+namespace Dynarmic {
+
+namespace Backend::X64 {
+struct SharedCodeCacheFriend;
+} // namespace Backend::X64
+
+/// Emitted code which is shared between Jit instances, typically one per emulated core.
+///
+/// Jits attached to the same SharedCodeCache reuse each other's compiled blocks instead of
+/// compiling them again, and all use a single code buffer. Per-core state remains private
+/// to each Jit.
+///
+/// All Jits sharing a cache must be of the same architecture and be constructed with the
+/// same UserConfig, except for processor_id. They may execute concurrently on different
+/// threads, in which case the callbacks they share must be thread-safe.
+///
+/// Cache invalidation requested through any of the Jits applies to all of them. Modifying
+/// code which may be executing is deferred until no Jit sharing the cache is executing:
+/// executing Jits are asked to halt, and Jit::Run and Jit::Step wait for them to stop before
+/// performing a pending invalidation. For this reason Jit::Run and Jit::Step must not be
+/// called from within a callback of another Jit sharing the cache. Links between blocks
+/// compiled while other Jits are executing are also only made once none are.
+class SharedCodeCache {
+public:
+    SharedCodeCache();
+    ~SharedCodeCache();
+
+    SharedCodeCache(const SharedCodeCache&) = delete;
+    SharedCodeCache& operator=(const SharedCodeCache&) = delete;
+
+private:
+    friend struct Backend::X64::SharedCodeCacheFriend;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace Dynarmic
@@ -0,0 +1,58 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace Dynarmic {
+
+namespace Backend::X64 {
+struct TranslationCacheFriend;
+} // namespace Backend::X64
+
+/// A persistent cache of translated guest code.
+///
+/// Blocks are stored as optimized IR, keyed by their location descriptor and by the parts
+/// of UserConfig that affect translation. Each entry records a hash of the guest code it
+/// was translated from and is only reused while the guest code still matches, so a cache
+/// saved by one run can be loaded by the next to avoid retranslating hot code.
+///
+/// A cache may be shared between multiple Jit instances, including instances on different
+/// threads. Calls to Jit::InvalidateCacheRange also drop the affected entries from any
+/// cache attached to that Jit.
+class TranslationCache {
+public:
+    TranslationCache();
+    ~TranslationCache();
+
+    TranslationCache(const TranslationCache&) = delete;
+    TranslationCache& operator=(const TranslationCache&) = delete;
+
+    /// Replaces the contents of this cache with those of a file previously written by Save.
+    /// @returns false if the file could not be read or was written by an incompatible
+    ///          version of dynarmic, in which case the cache is left empty.
+    bool Load(const std::string& path);
+
+    /// Writes the contents of this cache to a file.
+    /// @returns false if the file could not be written.
+    bool Save(const std::string& path) const;
+
+    /// The number of blocks in this cache.
+    std::size_t Size() const;
+
+    /// Removes all blocks from this cache.
+    void Clear();
+
+private:
+    friend struct Backend::X64::TranslationCacheFriend;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+} // namespace Dynarmic
@@ -20,6 +20,7 @@
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/devirtualize.h"
 #include "backend/x64/emit_x64.h"
+#include "backend/x64/exclusive_monitor_friend.h"
 #include "backend/x64/nzcv_util.h"
 #include "backend/x64/perf_map.h"
 #include "common/assert.h"
@@ -76,8 +77,15 @@ FP::FPCR A32EmitContext::FPCR(bool fpcr_controlled) const {
     return fpcr_controlled ? fpcr : fpcr.ASIMDStandardValue();
 }
 
-A32EmitX64::A32EmitX64(BlockOfCode& code, A32::UserConfig conf, A32::Jit* jit_interface)
-        : EmitX64(code), conf(std::move(conf)), jit_interface(jit_interface) {
+A32EmitX64::A32EmitX64(BlockOfCode& code, A32::UserConfig conf)
+        : EmitX64(code), conf(std::move(conf)) {
+    if (this->conf.shared_code_cache) {
+        // Entries of the fast dispatch table cannot be updated atomically, and patching code
+        // which may be executing on another thread has to wait until no Jit is executing.
+        this->conf.optimizations &= ~OptimizationFlag::FastDispatch;
+        defer_patching = true;
+    }
+
     GenFastmemFallbacks();
     GenTerminalHandlers();
     code.PreludeComplete();
@@ -94,7 +102,7 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
     code.EnableWriting();
     SCOPE_EXIT { code.DisableWriting(); };
 
-    static const std::vector<HostLoc> gpr_order = [this]{
+    const std::vector<HostLoc> gpr_order = [this]{
         std::vector<HostLoc> gprs{any_gpr};
         if (conf.page_table) {
             gprs.erase(std::find(gprs.begin(), gprs.end(), HostLoc::R14));
@@ -106,6 +114,9 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
     }();
 
     RegAlloc reg_alloc{code, A32JitState::SpillCount, SpillToOpArg<A32JitState>, gpr_order, any_xmm};
+    if (conf.HasOptimization(OptimizationFlag::RegAllocLookahead)) {
+        reg_alloc.AnalyzeUses(block);
+    }
     A32EmitContext ctx{conf, reg_alloc, block};
 
     // Start emitting.
@@ -116,6 +127,7 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
 
     for (auto iter = block.begin(); iter != block.end(); ++iter) {
         IR::Inst* inst = &*iter;
+        reg_alloc.SetCurrentInstruction(inst);
 
         // Call the relevant Emit* member function.
         switch (inst->GetOpcode()) {
@@ -140,9 +152,12 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
         }
 
         reg_alloc.EndOfAllocScope();
+        // Flags left in the host flags are not consumed across instructions here.
+        reg_alloc.SetHostFlagsValue(nullptr);
     }
 
     reg_alloc.AssertNoMoreUses();
+    statistics.register_spills += reg_alloc.SpillCount();
 
     EmitAddCycles(block.CycleCount());
     EmitX64::EmitTerminal(block.GetTerminal(), ctx.Location().SetSingleStepping(false), ctx.IsSingleStep());
@@ -151,10 +166,11 @@ A32EmitX64::BlockDescriptor A32EmitX64::Emit(IR::Block& block) {
     const size_t size = static_cast<size_t>(code.getCurr() - entrypoint);
 
     const A32::LocationDescriptor descriptor{block.Location()};
-    const A32::LocationDescriptor end_location{block.EndLocation()};
 
-    const auto range = boost::icl::discrete_interval<u32>::closed(descriptor.PC(), end_location.PC() - 1);
-    block_ranges.AddRange(range, descriptor);
+    for (const auto& [start, end] : block.CodeRanges()) {
+        const auto range = boost::icl::discrete_interval<u32>::closed(A32::LocationDescriptor{start}.PC(), A32::LocationDescriptor{end}.PC() - 1);
+        block_ranges.AddRange(range, descriptor);
+    }
 
     return RegisterBlock(descriptor, entrypoint, size);
 }
@@ -166,6 +182,19 @@ void A32EmitX64::ClearCache() {
     fastmem_patch_info.clear();
 }
 
+void A32EmitX64::EvictOldestSegment() {
+    EmitX64::EvictOldestSegment();
+
+    const size_t segment = code.CurrentSegment();
+    for (auto iter = fastmem_patch_info.begin(); iter != fastmem_patch_info.end();) {
+        if (code.IsInSegment(reinterpret_cast<CodePtr>(iter->first), segment)) {
+            iter = fastmem_patch_info.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
 void A32EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u32>& ranges) {
     InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
 }
@@ -204,6 +233,12 @@ void A32EmitX64::GenFastmemFallbacks() {
         {32, Devirtualize<&A32::UserCallbacks::MemoryWrite32>(conf.callbacks)},
         {64, Devirtualize<&A32::UserCallbacks::MemoryWrite64>(conf.callbacks)},
     }};
+    const std::array<std::pair<size_t, ArgCallback>, 4> exclusive_write_callbacks{{
+        {8, Devirtualize<&A32::UserCallbacks::MemoryWriteExclusive8>(conf.callbacks)},
+        {16, Devirtualize<&A32::UserCallbacks::MemoryWriteExclusive16>(conf.callbacks)},
+        {32, Devirtualize<&A32::UserCallbacks::MemoryWriteExclusive32>(conf.callbacks)},
+        {64, Devirtualize<&A32::UserCallbacks::MemoryWriteExclusive64>(conf.callbacks)},
+    }};
 
     for (int vaddr_idx : idxes) {
         for (int value_idx : idxes) {
@@ -247,6 +282,37 @@ void A32EmitX64::GenFastmemFallbacks() {
                 code.ret();
                 PerfMapRegister(write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)], code.getCurr(), fmt::format("a32_write_fallback_{}", bitsize));
             }
+
+            // Exclusive writes take the expected value in rax and return their result in rax.
+            if (!conf.global_monitor || vaddr_idx == 0 || value_idx == 0) {
+                continue;
+            }
+
+            for (const auto& [bitsize, callback] : exclusive_write_callbacks) {
+                code.align();
+                exclusive_write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
+                ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+                if (vaddr_idx == code.ABI_PARAM3.getIdx() && value_idx == code.ABI_PARAM2.getIdx()) {
+                    code.xchg(code.ABI_PARAM2, code.ABI_PARAM3);
+                } else if (vaddr_idx == code.ABI_PARAM3.getIdx()) {
+                    code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+                    if (value_idx != code.ABI_PARAM3.getIdx()) {
+                        code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
+                    }
+                } else {
+                    if (value_idx != code.ABI_PARAM3.getIdx()) {
+                        code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
+                    }
+                    if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+                        code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+                    }
+                }
+                code.mov(code.ABI_PARAM4, rax);
+                callback.EmitCall(code);
+                ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+                code.ret();
+                PerfMapRegister(exclusive_write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)], code.getCurr(), fmt::format("a32_exclusive_write_fallback_{}", bitsize));
+            }
         }
     }
 }
@@ -722,7 +788,7 @@ void A32EmitX64::EmitA32DataMemoryBarrier(A32EmitContext&, IR::Inst*) {
 void A32EmitX64::EmitA32InstructionSynchronizationBarrier(A32EmitContext& ctx, IR::Inst*) {
     ctx.reg_alloc.HostCall(nullptr);
 
-    code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(jit_interface));
+    code.mov(code.ABI_PARAM1, qword[r15 + offsetof(A32JitState, jit_interface)]);
     code.CallLambda([](A32::Jit* jit) { jit->ClearCache(); });
 }
 
@@ -730,7 +796,8 @@ void A32EmitX64::EmitA32BXWritePC(A32EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     auto& arg = args[0];
 
-    const u32 upper_without_t = (ctx.Location().SetSingleStepping(false).UniqueHash() >> 32) & 0xFFFFFFFE;
+    // Interworking branches also leave any IT block.
+    const u32 upper_without_t = (ctx.Location().SetSingleStepping(false).UniqueHash() >> 32) & 0xFFFF00FE;
 
     // Pseudocode:
     // if (new_pc & 1) {
@@ -764,6 +831,14 @@ void A32EmitX64::EmitA32BXWritePC(A32EmitContext& ctx, IR::Inst* inst) {
     }
 }
 
+void A32EmitX64::EmitA32SetITState(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[0].IsImmediate());
+
+    // IT state occupies bits 8 to 15 of the upper location descriptor.
+    code.mov(byte[r15 + offsetof(A32JitState, upper_location_descriptor) + 1], args[0].GetImmediateU8());
+}
+
 void A32EmitX64::EmitA32CallSupervisor(A32EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.HostCall(nullptr);
 
@@ -863,7 +938,13 @@ std::optional<A32EmitX64::DoNotFastmemMarker> A32EmitX64::ShouldFastmem(A32EmitC
     return marker;
 }
 
+bool A32EmitX64::ShouldInlineExclusiveAccess() const {
+    return conf.page_table && ExclusiveMonitorFriend::SupportsInlineAccess(conf.global_monitor);
+}
+
 FakeCall A32EmitX64::FastmemCallback(u64 rip_) {
+    std::lock_guard lock{code_mutex};
+
     const auto iter = fastmem_patch_info.find(rip_);
     ASSERT(iter != fastmem_patch_info.end());
     if (conf.recompile_on_fastmem_failure) {
@@ -985,6 +1066,27 @@ void EmitWriteMemoryMov(BlockOfCode& code, const Xbyak::RegExp& addr, const Xbya
     }
 }
 
+template<std::size_t bitsize>
+void EmitExclusiveWriteMemoryCmpxchg(BlockOfCode& code, const Xbyak::RegExp& addr, const Xbyak::Reg64& value) {
+    code.lock();
+    switch (bitsize) {
+    case 8:
+        code.cmpxchg(code.byte[addr], value.cvt8());
+        return;
+    case 16:
+        code.cmpxchg(word[addr], value.cvt16());
+        return;
+    case 32:
+        code.cmpxchg(dword[addr], value.cvt32());
+        return;
+    case 64:
+        code.cmpxchg(qword[addr], value);
+        return;
+    default:
+        ASSERT_FALSE("Invalid bitsize");
+    }
+}
+
 } // anonymous namespace
 
 template<std::size_t bitsize, auto callback>
@@ -1115,15 +1217,22 @@ void A32EmitX64::ExclusiveReadMemory(A32EmitContext& ctx, IR::Inst* inst) {
     using T = mp::unsigned_integer_of_size<bitsize>;
 
     ASSERT(conf.global_monitor != nullptr);
+
+    if (ShouldInlineExclusiveAccess()) {
+        ExclusiveReadMemoryInline<bitsize>(ctx, inst);
+        return;
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     ctx.reg_alloc.HostCall(inst, {}, args[0]);
 
     code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(1));
     code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+    code.mov(code.ABI_PARAM3, qword[r15 + offsetof(A32JitState, processor_id)]);
     code.CallLambda(
-        [](A32::UserConfig& conf, u32 vaddr) -> T {
-            return conf.global_monitor->ReadAndMark<T>(conf.processor_id, vaddr, [&]() -> T {
+        [](A32::UserConfig& conf, u32 vaddr, size_t processor_id) -> T {
+            return conf.global_monitor->ReadAndMark<T>(processor_id, vaddr, [&]() -> T {
                 return (conf.callbacks->*callback)(vaddr);
             });
         }
@@ -1135,6 +1244,12 @@ void A32EmitX64::ExclusiveWriteMemory(A32EmitContext& ctx, IR::Inst* inst) {
     using T = mp::unsigned_integer_of_size<bitsize>;
 
     ASSERT(conf.global_monitor != nullptr);
+
+    if (ShouldInlineExclusiveAccess()) {
+        ExclusiveWriteMemoryInline<bitsize>(ctx, inst);
+        return;
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     ctx.reg_alloc.HostCall(inst, {}, args[0], args[1]);
@@ -1146,9 +1261,10 @@ void A32EmitX64::ExclusiveWriteMemory(A32EmitContext& ctx, IR::Inst* inst) {
     code.je(end);
     code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(0));
     code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+    code.mov(code.ABI_PARAM4, qword[r15 + offsetof(A32JitState, processor_id)]);
     code.CallLambda(
-        [](A32::UserConfig& conf, u32 vaddr, T value) -> u32 {
-            return conf.global_monitor->DoExclusiveOperation<T>(conf.processor_id, vaddr,
+        [](A32::UserConfig& conf, u32 vaddr, T value, size_t processor_id) -> u32 {
+            return conf.global_monitor->DoExclusiveOperation<T>(processor_id, vaddr,
                 [&](T expected) -> bool {
                     return (conf.callbacks->*callback)(vaddr, value, expected);
                 }) ? 0 : 1;
@@ -1157,6 +1273,117 @@ void A32EmitX64::ExclusiveWriteMemory(A32EmitContext& ctx, IR::Inst* inst) {
     code.L(end);
 }
 
+template <size_t bitsize>
+void A32EmitX64::ExclusiveReadMemoryInline(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 shard = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+
+    const auto wrapped_fn = read_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
+
+    code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(1));
+    EmitExclusiveLock(conf.global_monitor, shard, vaddr, tmp);
+    EmitExclusiveMark(shard, vaddr, tmp);
+
+    if (const auto marker = ShouldFastmem(ctx, inst)) {
+        const auto location = code.getCurr();
+        EmitReadMemoryMov<bitsize>(code, value, r13 + vaddr);
+
+        fastmem_patch_info.emplace(
+            Common::BitCast<u64>(location),
+            FastmemPatchInfo{
+                Common::BitCast<u64>(code.getCurr()),
+                Common::BitCast<u64>(wrapped_fn),
+                *marker,
+            }
+        );
+    } else {
+        Xbyak::Label abort, end;
+
+        const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+        EmitReadMemoryMov<bitsize>(code, value, src_ptr);
+        code.L(end);
+
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.call(wrapped_fn);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+    }
+
+    code.mov(tmp, qword[r15 + offsetof(A32JitState, exclusive_slot)]);
+    EmitWriteMemoryMov<bitsize>(code, tmp + ExclusiveMonitorFriend::slot_value_offset, value);
+    EmitExclusiveUnlock(shard);
+
+    ctx.reg_alloc.DefineValue(inst, value);
+}
+
+template <size_t bitsize>
+void A32EmitX64::ExclusiveWriteMemoryInline(A32EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    // rax holds the expected value for cmpxchg
+    ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[1]);
+    const Xbyak::Reg32 status = ctx.reg_alloc.ScratchGpr().cvt32();
+    const Xbyak::Reg64 shard = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+
+    const auto wrapped_fn = exclusive_write_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
+
+    Xbyak::Label abort, unlock, end;
+
+    code.mov(status, u32(1));
+    code.cmp(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(0));
+    code.je(end, code.T_NEAR);
+    code.mov(code.byte[r15 + offsetof(A32JitState, exclusive_state)], u8(0));
+    EmitExclusiveLock(conf.global_monitor, shard, vaddr, tmp);
+    EmitExclusiveCheckAndClear(conf.global_monitor, shard, vaddr, tmp, rax, unlock);
+
+    code.mov(tmp, qword[r15 + offsetof(A32JitState, exclusive_slot)]);
+    EmitReadMemoryMov<bitsize>(code, rax, tmp + ExclusiveMonitorFriend::slot_value_offset);
+
+    if (const auto marker = ShouldFastmem(ctx, inst)) {
+        const auto location = code.getCurr();
+        EmitExclusiveWriteMemoryCmpxchg<bitsize>(code, r13 + vaddr, value);
+        code.setnz(status.cvt8());
+
+        // A faulting cmpxchg resumes after the fallback call in far code, which converts its result.
+        code.SwitchToFarCode();
+        code.call(wrapped_fn);
+        fastmem_patch_info.emplace(
+            Common::BitCast<u64>(location),
+            FastmemPatchInfo{
+                Common::BitCast<u64>(code.getCurr()),
+                Common::BitCast<u64>(wrapped_fn),
+                *marker,
+            }
+        );
+    } else {
+        const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+        EmitExclusiveWriteMemoryCmpxchg<bitsize>(code, dest_ptr, value);
+        code.setnz(status.cvt8());
+
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.call(wrapped_fn);
+    }
+    code.test(al, al);
+    code.setz(status.cvt8());
+    code.jmp(unlock, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    code.L(unlock);
+    EmitExclusiveUnlock(shard);
+    code.L(end);
+
+    ctx.reg_alloc.DefineValue(inst, status);
+}
+
 void A32EmitX64::EmitA32ExclusiveReadMemory8(A32EmitContext& ctx, IR::Inst* inst) {
     ExclusiveReadMemory<8, &A32::UserCallbacks::MemoryRead8>(ctx, inst);
 }
@@ -1193,13 +1420,12 @@ static void EmitCoprocessorException() {
     ASSERT_FALSE("Should raise coproc exception here");
 }
 
-static void CallCoprocCallback(BlockOfCode& code, RegAlloc& reg_alloc, A32::Jit* jit_interface,
-                              A32::Coprocessor::Callback callback, IR::Inst* inst = nullptr,
+static void CallCoprocCallback(BlockOfCode& code, RegAlloc& reg_alloc, A32::Coprocessor::Callback callback, IR::Inst* inst = nullptr,
                               std::optional<Argument::copyable_reference> arg0 = {},
                               std::optional<Argument::copyable_reference> arg1 = {}) {
     reg_alloc.HostCall(inst, {}, {}, arg0, arg1);
 
-    code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(jit_interface));
+    code.mov(code.ABI_PARAM1, qword[r15 + offsetof(A32JitState, jit_interface)]);
     if (callback.user_arg) {
         code.mov(code.ABI_PARAM2, reinterpret_cast<u64>(*callback.user_arg));
     }
@@ -1229,7 +1455,7 @@ void A32EmitX64::EmitA32CoprocInternalOperation(A32EmitContext& ctx, IR::Inst* i
         return;
     }
 
-    CallCoprocCallback(code, ctx.reg_alloc, jit_interface, *action);
+    CallCoprocCallback(code, ctx.reg_alloc, *action);
 }
 
 void A32EmitX64::EmitA32CoprocSendOneWord(A32EmitContext& ctx, IR::Inst* inst) {
@@ -1256,7 +1482,7 @@ void A32EmitX64::EmitA32CoprocSendOneWord(A32EmitContext& ctx, IR::Inst* inst) {
     }
 
     if (const auto cb = std::get_if<A32::Coprocessor::Callback>(&action)) {
-        CallCoprocCallback(code, ctx.reg_alloc, jit_interface, *cb, nullptr, args[1]);
+        CallCoprocCallback(code, ctx.reg_alloc, *cb, nullptr, args[1]);
         return;
     }
 
@@ -1296,7 +1522,7 @@ void A32EmitX64::EmitA32CoprocSendTwoWords(A32EmitContext& ctx, IR::Inst* inst)
     }
 
     if (const auto cb = std::get_if<A32::Coprocessor::Callback>(&action)) {
-        CallCoprocCallback(code, ctx.reg_alloc, jit_interface, *cb, nullptr, args[1], args[2]);
+        CallCoprocCallback(code, ctx.reg_alloc, *cb, nullptr, args[1], args[2]);
         return;
     }
 
@@ -1340,7 +1566,7 @@ void A32EmitX64::EmitA32CoprocGetOneWord(A32EmitContext& ctx, IR::Inst* inst) {
     }
 
     if (const auto cb = std::get_if<A32::Coprocessor::Callback>(&action)) {
-        CallCoprocCallback(code, ctx.reg_alloc, jit_interface, *cb, inst);
+        CallCoprocCallback(code, ctx.reg_alloc, *cb, inst);
         return;
     }
 
@@ -1380,7 +1606,7 @@ void A32EmitX64::EmitA32CoprocGetTwoWords(A32EmitContext& ctx, IR::Inst* inst) {
     }
 
     if (const auto cb = std::get_if<A32::Coprocessor::Callback>(&action)) {
-        CallCoprocCallback(code, ctx.reg_alloc, jit_interface, *cb, inst);
+        CallCoprocCallback(code, ctx.reg_alloc, *cb, inst);
         return;
     }
 
@@ -1431,7 +1657,7 @@ void A32EmitX64::EmitA32CoprocLoadWords(A32EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
-    CallCoprocCallback(code, ctx.reg_alloc, jit_interface, *action, nullptr, args[1]);
+    CallCoprocCallback(code, ctx.reg_alloc, *action, nullptr, args[1]);
 }
 
 void A32EmitX64::EmitA32CoprocStoreWords(A32EmitContext& ctx, IR::Inst* inst) {
@@ -1461,7 +1687,7 @@ void A32EmitX64::EmitA32CoprocStoreWords(A32EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
-    CallCoprocCallback(code, ctx.reg_alloc, jit_interface, *action, nullptr, args[1]);
+    CallCoprocCallback(code, ctx.reg_alloc, *action, nullptr, args[1]);
 }
 
 std::string A32EmitX64::LocationDescriptorToFriendlyName(const IR::LocationDescriptor& ir_descriptor) const {
@@ -1478,6 +1704,8 @@ void A32EmitX64::EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDesc
     ASSERT_MSG(A32::LocationDescriptor{terminal.next}.EFlag() == A32::LocationDescriptor{initial_location}.EFlag(), "Unimplemented");
     ASSERT_MSG(terminal.num_instructions == 1, "Unimplemented");
 
+    EmitSetUpperLocationDescriptor(terminal.next, initial_location);
+
     code.mov(code.ABI_PARAM2.cvt32(), A32::LocationDescriptor{terminal.next}.PC());
     code.mov(code.ABI_PARAM3.cvt32(), 1);
     code.mov(MJitStateReg(A32::Reg::PC), code.ABI_PARAM2.cvt32());
@@ -41,7 +41,7 @@ struct A32EmitContext final : public EmitContext {
 
 class A32EmitX64 final : public EmitX64 {
 public:
-    A32EmitX64(BlockOfCode& code, A32::UserConfig conf, A32::Jit* jit_interface);
+    A32EmitX64(BlockOfCode& code, A32::UserConfig conf);
     ~A32EmitX64() override;
 
     /**
@@ -52,15 +52,12 @@ public:
 
     void ClearCache() override;
 
-    void InvalidateCacheRanges(const boost::icl::interval_set<u32>& ranges);
+    void EvictOldestSegment() override;
 
-    void ChangeProcessorID(size_t value) {
-        conf.processor_id = value;
-    }
+    void InvalidateCacheRanges(const boost::icl::interval_set<u32>& ranges);
 
 protected:
     A32::UserConfig conf;
-    A32::Jit* jit_interface;
     BlockRangeInformation<u32> block_ranges;
 
     void EmitCondPrelude(const A32EmitContext& ctx);
@@ -77,6 +74,7 @@ protected:
 
     std::map<std::tuple<size_t, int, int>, void(*)()> read_fallbacks;
     std::map<std::tuple<size_t, int, int>, void(*)()> write_fallbacks;
+    std::map<std::tuple<size_t, int, int>, void(*)()> exclusive_write_fallbacks;
     void GenFastmemFallbacks();
 
     const void* terminal_handler_pop_rsb_hint;
@@ -106,6 +104,7 @@ protected:
     tsl::robin_map<u64, FastmemPatchInfo> fastmem_patch_info;
     std::set<DoNotFastmemMarker> do_not_fastmem;
     std::optional<DoNotFastmemMarker> ShouldFastmem(A32EmitContext& ctx, IR::Inst* inst) const;
+    bool ShouldInlineExclusiveAccess() const;
     FakeCall FastmemCallback(u64 rip);
 
     // Memory access helpers
@@ -117,6 +116,10 @@ protected:
     void ExclusiveReadMemory(A32EmitContext& ctx, IR::Inst* inst);
     template<std::size_t bitsize, auto callback>
     void ExclusiveWriteMemory(A32EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize>
+    void ExclusiveReadMemoryInline(A32EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize>
+    void ExclusiveWriteMemoryInline(A32EmitContext& ctx, IR::Inst* inst);
 
     // Terminal instruction emitters
     void EmitSetUpperLocationDescriptor(IR::LocationDescriptor new_location, IR::LocationDescriptor old_location);
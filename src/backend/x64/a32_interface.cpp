@@ -3,8 +3,14 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
 
 #include <boost/icl/interval_set.hpp>
 #include <fmt/format.h>
@@ -14,10 +20,14 @@
 
 #include "backend/x64/a32_emit_x64.h"
 #include "backend/x64/a32_jitstate.h"
+#include "backend/x64/background_compiler.h"
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/callback.h"
 #include "backend/x64/devirtualize.h"
+#include "backend/x64/exclusive_monitor_friend.h"
 #include "backend/x64/jitstate_info.h"
+#include "backend/x64/shared_code_cache_friend.h"
+#include "backend/x64/translation_cache_friend.h"
 #include "common/assert.h"
 #include "common/cast_util.h"
 #include "common/common_types.h"
@@ -51,24 +61,145 @@ static std::function<void(BlockOfCode&)> GenRCP(const A32::UserConfig& conf) {
     };
 }
 
+/// Covers the configuration which affects the IR stored in a TranslationCache.
+static u64 GenTranslationCacheConfigHash(const A32::UserConfig& conf) {
+    return TranslationCacheFriend::HashConfig({
+        32,
+        conf.define_unpredictable_behaviour,
+        conf.hook_hint_instructions,
+        conf.HasOptimization(OptimizationFlag::GetSetElimination),
+    });
+}
+
 struct Jit::Impl {
+    /// Emitted code, and the state required to manage it. This is shared by all Jits
+    /// attached to the same SharedCodeCache.
+    struct CodeCache {
+        explicit CodeCache(const A32::UserConfig& conf)
+                : block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this), JitStateInfo{A32JitState{}}, conf.code_cache_size, conf.far_code_offset, conf.constant_pool_size, GenRCP(conf))
+                , emitter(block_of_code, conf)
+        {}
+
+        /// Must only be called while holding mutex.
+        bool OperationsRequested() const {
+            return invalidate_entire_cache || evict_oldest_segment || !invalid_cache_ranges.empty();
+        }
+
+        BlockOfCode block_of_code;
+        A32EmitX64 emitter;
+
+        /// Held shared by each Jit executing emitted code. Held exclusively to perform operations
+        /// which require that no emitted code is executing.
+        std::shared_mutex execution_mutex;
+
+        /// Protects the members below.
+        std::mutex mutex;
+        std::vector<Jit::Impl*> executing_jits;
+        std::vector<Jit::Impl*> jits;
+        // Operations requested while emitted code may be executing are queued up here.
+        boost::icl::interval_set<u32> invalid_cache_ranges;
+        bool invalidate_entire_cache = false;
+        bool evict_oldest_segment = false;
+    };
+
     Impl(Jit* jit, A32::UserConfig conf)
-            : block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this), JitStateInfo{jit_state}, GenRCP(conf))
-            , emitter(block_of_code, conf, jit)
+            : code_cache(MakeCodeCache(conf))
+            , block_of_code(code_cache->block_of_code)
+            , emitter(code_cache->emitter)
             , conf(std::move(conf))
+            , translation_cache_config_hash(GenTranslationCacheConfigHash(this->conf))
             , jit_interface(jit)
-    {}
+    {
+        SetJitStateIdentity();
+
+        {
+            std::lock_guard lock{code_cache->mutex};
+            code_cache->jits.push_back(this);
+        }
+
+        if (this->conf.background_compilation) {
+            background_compiler = std::make_unique<BackgroundCompiler>([this](IR::LocationDescriptor descriptor) { return LookupOrTranslateBlock(descriptor); });
+        }
+    }
+
+    ~Impl() {
+        std::lock_guard lock{code_cache->mutex};
+        auto& jits = code_cache->jits;
+        jits.erase(std::remove(jits.begin(), jits.end(), this), jits.end());
+    }
 
     A32JitState jit_state;
-    BlockOfCode block_of_code;
-    A32EmitX64 emitter;
+    std::shared_ptr<CodeCache> code_cache;
+    BlockOfCode& block_of_code;
+    A32EmitX64& emitter;
 
     A32::UserConfig conf;
+    const u64 translation_cache_config_hash;
 
-    // Requests made during execution to invalidate the cache are queued up here.
     size_t invalid_cache_generation = 0;
-    boost::icl::interval_set<u32> invalid_cache_ranges;
-    bool invalidate_entire_cache = false;
+
+    /// Identifies this Jit and its processor to emitted code, which reads these at runtime.
+    void SetJitStateIdentity() {
+        jit_state.jit_interface = jit_interface;
+        jit_state.processor_id = conf.processor_id;
+        if (conf.global_monitor && conf.processor_id < conf.global_monitor->GetProcessorCount()) {
+            jit_state.exclusive_slot = ExclusiveMonitorFriend::SlotPointer(conf.global_monitor, conf.processor_id);
+            jit_state.exclusive_processor_mask = conf.processor_id < ExclusiveMonitorFriend::max_inline_processor_count ? u64(1) << conf.processor_id : 0;
+        }
+    }
+
+    void BeginExecution() {
+        previous_jit = std::exchange(current_jit, this);
+
+        // Opportunistically apply patches deferred while other Jits sharing the code cache were executing.
+        {
+            std::unique_lock execution_lock{code_cache->execution_mutex, std::try_to_lock};
+            if (execution_lock) {
+                PerformRequestedCacheOperations();
+            }
+        }
+
+        while (true) {
+            code_cache->execution_mutex.lock_shared();
+            {
+                std::lock_guard lock{code_cache->mutex};
+                if (!code_cache->OperationsRequested()) {
+                    code_cache->executing_jits.push_back(this);
+                    break;
+                }
+            }
+            code_cache->execution_mutex.unlock_shared();
+
+            // Executing Jits have been asked to halt, after which the requested operations are performed.
+            std::lock_guard execution_lock{code_cache->execution_mutex};
+            PerformRequestedCacheOperations();
+        }
+        jit_interface->is_executing = true;
+    }
+
+    void EndExecution() {
+        if (!jit_interface->is_executing) {
+            return;
+        }
+
+        jit_interface->is_executing = false;
+        {
+            std::lock_guard lock{code_cache->mutex};
+            auto& executing_jits = code_cache->executing_jits;
+            executing_jits.erase(std::remove(executing_jits.begin(), executing_jits.end(), this), executing_jits.end());
+        }
+        code_cache->execution_mutex.unlock_shared();
+
+        // If this fails, another Jit is executing and performs requested operations once it stops.
+        {
+            std::unique_lock execution_lock{code_cache->execution_mutex, std::try_to_lock};
+            if (execution_lock) {
+                PerformRequestedCacheOperations();
+            }
+        }
+
+        current_jit = previous_jit;
+    }
 
     void Execute() {
         const CodePtr current_codeptr = [this]{
@@ -94,12 +225,28 @@ struct Jit::Impl {
             const s64 ticks = jit_state.cycles_to_run - jit_state.cycles_remaining;
             conf.callbacks->AddTicks(ticks);
         }
-        PerformCacheInvalidation();
+        EndExecution();
     }
 
     void ChangeProcessorID(size_t value) {
         conf.processor_id = value;
-        emitter.ChangeProcessorID(value);
+        SetJitStateIdentity();
+    }
+
+    void ClearCache() {
+        {
+            std::lock_guard lock{code_cache->mutex};
+            code_cache->invalidate_entire_cache = true;
+        }
+        RequestCacheOperations();
+    }
+
+    void InvalidateCacheRange(u32 start_address, std::size_t length) {
+        {
+            std::lock_guard lock{code_cache->mutex};
+            code_cache->invalid_cache_ranges.add(boost::icl::discrete_interval<u32>::closed(start_address, static_cast<u32>(start_address + length - 1)));
+        }
+        RequestCacheOperations();
     }
 
     void ClearExclusiveState() {
@@ -113,80 +260,200 @@ struct Jit::Impl {
         return result;
     }
 
-    void PerformCacheInvalidation() {
-        if (invalidate_entire_cache) {
-            jit_state.ResetRSB();
-            block_of_code.ClearCache();
-            emitter.ClearCache();
+    void Reset() {
+        jit_state = {};
+        SetJitStateIdentity();
+    }
 
-            invalid_cache_ranges.clear();
-            invalidate_entire_cache = false;
-            invalid_cache_generation++;
-            return;
+    void HaltExecution() {
+        jit_state.halt_requested = true;
+    }
+
+    /// Must only be called while no emitted code is executing, except for that of this Jit if
+    /// it does not share its code cache.
+    void EvictOldestCodeSegment() {
+        emitter.EvictOldestSegment();
+
+        // Return stack buffers may refer to evicted code.
+        std::lock_guard lock{code_cache->mutex};
+        for (Jit::Impl* jit : code_cache->jits) {
+            jit->jit_state.ResetRSB();
+            jit->invalid_cache_generation++;
         }
+    }
 
-        if (invalid_cache_ranges.empty()) {
-            return;
+    void RequestCacheOperations() {
+        {
+            std::lock_guard lock{code_cache->mutex};
+            if (!code_cache->executing_jits.empty()) {
+                // Jits sharing the code cache, possibly including this one, are executing.
+                // The operations are performed once all of them have stopped.
+                for (Jit::Impl* jit : code_cache->executing_jits) {
+                    jit->HaltExecution();
+                }
+                return;
+            }
         }
 
-        jit_state.ResetRSB();
-        emitter.InvalidateCacheRanges(invalid_cache_ranges);
-        invalid_cache_ranges.clear();
-        invalid_cache_generation++;
+        // If this fails, another Jit is starting or stopping execution and performs the operations.
+        std::unique_lock execution_lock{code_cache->execution_mutex, std::try_to_lock};
+        if (execution_lock) {
+            PerformRequestedCacheOperations();
+        }
     }
 
-    void RequestCacheInvalidation() {
-        if (jit_interface->is_executing) {
-            jit_state.halt_requested = true;
-            return;
+    /// Must only be called while holding the code cache's execution_mutex exclusively.
+    void PerformRequestedCacheOperations() {
+        std::lock_guard code_lock{emitter.CodeMutex()};
+
+        bool invalidate_entire_cache;
+        bool evict_oldest_segment;
+        boost::icl::interval_set<u32> invalid_cache_ranges;
+        {
+            std::lock_guard lock{code_cache->mutex};
+            invalidate_entire_cache = std::exchange(code_cache->invalidate_entire_cache, false);
+            evict_oldest_segment = std::exchange(code_cache->evict_oldest_segment, false);
+            invalid_cache_ranges = std::exchange(code_cache->invalid_cache_ranges, {});
+
+            if (invalidate_entire_cache || !invalid_cache_ranges.empty()) {
+                // No Jit sharing the code cache is executing, so their state may be reset here.
+                for (Jit::Impl* jit : code_cache->jits) {
+                    jit->jit_state.ResetRSB();
+                    jit->invalid_cache_generation++;
+                    if (jit->background_compiler) {
+                        jit->background_compiler->Discard();
+                    }
+                }
+            }
         }
 
-        PerformCacheInvalidation();
+        if (conf.translation_cache) {
+            TranslationCacheFriend::InvalidateRanges(*conf.translation_cache, invalid_cache_ranges);
+        }
+        if (invalidate_entire_cache) {
+            block_of_code.ClearCache();
+            emitter.ClearCache();
+        } else {
+            if (evict_oldest_segment) {
+                EvictOldestCodeSegment();
+            }
+            if (!invalid_cache_ranges.empty()) {
+                emitter.InvalidateCacheRanges(invalid_cache_ranges);
+            }
+        }
+        emitter.ApplyDeferredPatches();
     }
 
 private:
     Jit* jit_interface;
+    Jit::Impl* previous_jit = nullptr;
 
-    static CodePtr GetCurrentBlockThunk(void* this_voidptr) {
-        Jit::Impl& this_ = *static_cast<Jit::Impl*>(this_voidptr);
-        return this_.GetCurrentBlock();
+    // Declared last so that the compilation thread is stopped before anything it uses is destroyed.
+    std::unique_ptr<BackgroundCompiler> background_compiler;
+
+    static std::shared_ptr<CodeCache> MakeCodeCache(const A32::UserConfig& conf) {
+        const auto make_code_cache = [&] { return std::make_shared<CodeCache>(conf); };
+        if (conf.shared_code_cache) {
+            return SharedCodeCacheFriend::GetOrCreate<CodeCache>(*conf.shared_code_cache, make_code_cache);
+        }
+        return make_code_cache();
     }
 
+    static CodePtr GetCurrentBlockThunk(void*) {
+        return current_jit->GetCurrentBlock();
+    }
+
+    /// The Jit executing emitted code on this thread.
+    static inline thread_local Jit::Impl* current_jit = nullptr;
+
     IR::LocationDescriptor GetCurrentLocation() const {
         return IR::LocationDescriptor{jit_state.GetUniqueHash()};
     }
 
     CodePtr GetCurrentBlock() {
+        std::lock_guard lock{emitter.CodeMutex()};
         return GetBasicBlock(GetCurrentLocation()).entrypoint;
     }
 
     CodePtr GetCurrentSingleStep() {
+        std::lock_guard lock{emitter.CodeMutex()};
         return GetBasicBlock(A32::LocationDescriptor{GetCurrentLocation()}.SetSingleStepping(true)).entrypoint;
     }
 
+    /// Must only be called while holding the emitter's CodeMutex.
     A32EmitX64::BlockDescriptor GetBasicBlock(IR::LocationDescriptor descriptor) {
         auto block = emitter.GetBasicBlock(descriptor);
         if (block)
             return *block;
 
-        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
-        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
-            invalidate_entire_cache = true;
-            PerformCacheInvalidation();
+        if (block_of_code.SpaceRemaining() < BlockOfCode::MINIMUM_REMAINING_CODESIZE) {
+            if (conf.shared_code_cache) {
+                // Other Jits may be executing code in the oldest segment, so it is evicted once all have stopped.
+                {
+                    std::lock_guard lock{code_cache->mutex};
+                    code_cache->evict_oldest_segment = true;
+                }
+                RequestCacheOperations();
+                return {block_of_code.GetForceReturnFromRunCodeAddress(), 0};
+            }
+            EvictOldestCodeSegment();
+        }
+
+        std::optional<IR::Block> ir_block;
+        if (background_compiler && !A32::LocationDescriptor{descriptor}.SingleStepping()) {
+            ir_block = background_compiler->Take(descriptor);
+            if (!ir_block) {
+                // Make progress one instruction at a time until this block has been translated.
+                background_compiler->RequestWhileStepping(descriptor, A32::LocationDescriptor{descriptor}.PC());
+                return GetBasicBlock(A32::LocationDescriptor{descriptor}.SetSingleStepping(true));
+            }
+        }
+
+        if (!ir_block) {
+            ir_block = LookupOrTranslateBlock(descriptor);
+        }
+
+        // These passes read guest data memory, so their results are not cached.
+        if (conf.HasOptimization(OptimizationFlag::ConstProp)) {
+            Optimization::A32ConstantMemoryReads(*ir_block, conf.callbacks);
+            Optimization::ConstantPropagation(*ir_block);
+            Optimization::DeadCodeElimination(*ir_block);
         }
+        Optimization::VerificationPass(*ir_block);
+        return emitter.Emit(*ir_block);
+    }
+
+    /// Retrieves a block from the translation cache, translating it if it is not present.
+    /// When background compilation is enabled, this is called from the compilation thread.
+    IR::Block LookupOrTranslateBlock(IR::LocationDescriptor descriptor) {
+        if (conf.translation_cache) {
+            const auto read_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(static_cast<u32>(vaddr)); };
+            if (auto cached_block = TranslationCacheFriend::Lookup(*conf.translation_cache, translation_cache_config_hash, descriptor, read_code)) {
+                return std::move(*cached_block);
+            }
+        }
+        return TranslateBlock(descriptor);
+    }
 
-        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, [this](u32 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); }, {conf.define_unpredictable_behaviour, conf.hook_hint_instructions});
+    /// Translates a block and applies the optimizations which only depend on guest code and configuration.
+    IR::Block TranslateBlock(IR::LocationDescriptor descriptor) {
+        const u64 generation = conf.translation_cache ? TranslationCacheFriend::Generation(*conf.translation_cache) : 0;
+        TranslationCacheFriend::TranslatedCode code;
+        const auto get_code = [&](u32 vaddr) {
+            const u32 word = conf.callbacks->MemoryReadCode(vaddr);
+            TranslationCacheFriend::AddCodeWord(code, vaddr, word);
+            return word;
+        };
+        IR::Block ir_block = A32::Translate(A32::LocationDescriptor{descriptor}, get_code, {conf.define_unpredictable_behaviour, conf.hook_hint_instructions, conf.HasOptimization(OptimizationFlag::BranchFollowing)});
         if (conf.HasOptimization(OptimizationFlag::GetSetElimination)) {
             Optimization::A32GetSetElimination(ir_block);
             Optimization::DeadCodeElimination(ir_block);
         }
-        if (conf.HasOptimization(OptimizationFlag::ConstProp)) {
-            Optimization::A32ConstantMemoryReads(ir_block, conf.callbacks);
-            Optimization::ConstantPropagation(ir_block);
-            Optimization::DeadCodeElimination(ir_block);
+
+        if (conf.translation_cache) {
+            TranslationCacheFriend::Insert(*conf.translation_cache, translation_cache_config_hash, ir_block, code, generation);
         }
-        Optimization::VerificationPass(ir_block);
-        return emitter.Emit(ir_block);
+        return ir_block;
     }
 };
 
@@ -196,50 +463,43 @@ Jit::~Jit() = default;
 
 void Jit::Run() {
     ASSERT(!is_executing);
-    is_executing = true;
-    SCOPE_EXIT { this->is_executing = false; };
-
     impl->jit_state.halt_requested = false;
 
-    impl->Execute();
+    impl->BeginExecution();
+    SCOPE_EXIT { impl->EndExecution(); };
 
-    impl->PerformCacheInvalidation();
+    impl->Execute();
 }
 
 void Jit::Step() {
     ASSERT(!is_executing);
-    is_executing = true;
-    SCOPE_EXIT { this->is_executing = false; };
-
     impl->jit_state.halt_requested = true;
 
-    impl->Step();
+    impl->BeginExecution();
+    SCOPE_EXIT { impl->EndExecution(); };
 
-    impl->PerformCacheInvalidation();
+    impl->Step();
 }
 
 void Jit::ClearCache() {
-    impl->invalidate_entire_cache = true;
-    impl->RequestCacheInvalidation();
+    impl->ClearCache();
 }
 
 void Jit::InvalidateCacheRange(std::uint32_t start_address, std::size_t length) {
-    impl->invalid_cache_ranges.add(boost::icl::discrete_interval<u32>::closed(start_address, static_cast<u32>(start_address + length - 1)));
-    impl->RequestCacheInvalidation();
+    impl->InvalidateCacheRange(start_address, length);
 }
 
 void Jit::Reset() {
     ASSERT(!is_executing);
-    impl->jit_state = {};
+    impl->Reset();
 }
 
 void Jit::HaltExecution() {
-    impl->jit_state.halt_requested = true;
+    impl->HaltExecution();
 }
 
 void Jit::ExceptionalExit() {
     impl->ExceptionalExit();
-    is_executing = false;
 }
 
 void Jit::ClearExclusiveState() {
@@ -342,6 +602,10 @@ void Jit::LoadContext(const Context& ctx) {
     impl->jit_state.TransferJitState(ctx.impl->jit_state, reset_rsb);
 }
 
+CodeCacheStatistics Jit::GetCodeCacheStatistics() const {
+    return impl->emitter.GetStatistics();
+}
+
 std::string Jit::Disassemble() const {
     return Common::DisassembleX64(impl->block_of_code.GetCodeBegin(), impl->block_of_code.getCurr());
 }
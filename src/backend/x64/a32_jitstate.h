@@ -11,6 +11,10 @@
 
 #include "common/common_types.h"
 
+namespace Dynarmic::A32 {
+class Jit;
+} // namespace Dynarmic::A32
+
 namespace Dynarmic::Backend::X64 {
 
 class BlockOfCode;
@@ -58,6 +62,14 @@ struct A32JitState {
     // Exclusive state
     u32 exclusive_state = 0;
 
+    // The Jit executing this state, and its processor id. These are read at runtime as
+    // emitted code may be shared between Jits (See: SharedCodeCache).
+    A32::Jit* jit_interface = nullptr;
+    u64 processor_id = 0;
+    // This processor's reservation slot in the global monitor and its bit in the monitor's shard masks.
+    void* exclusive_slot = nullptr;
+    u64 exclusive_processor_mask = 0;
+
     static constexpr size_t RSBSize = 8; // MUST be a power of 2.
     static constexpr size_t RSBPtrMask = RSBSize - 1;
     u32 rsb_ptr = 0;
@@ -3,7 +3,13 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
 #include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -17,6 +23,7 @@
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/devirtualize.h"
 #include "backend/x64/emit_x64.h"
+#include "backend/x64/exclusive_monitor_friend.h"
 #include "backend/x64/nzcv_util.h"
 #include "backend/x64/perf_map.h"
 #include "common/assert.h"
@@ -52,30 +59,79 @@ FP::FPCR A64EmitContext::FPCR(bool fpcr_controlled) const {
     return fpcr_controlled ? Location().FPCR() : Location().FPCR().ASIMDStandardValue();
 }
 
-A64EmitX64::A64EmitX64(BlockOfCode& code, A64::UserConfig conf, A64::Jit* jit_interface)
-        : EmitX64(code), conf(conf), jit_interface{jit_interface} {
+A64EmitX64::A64EmitX64(BlockOfCode& code, A64::UserConfig conf)
+        : EmitX64(code), conf(conf), pinned_registers(GetPinnedRegisters(conf)) {
+    if (conf.shared_code_cache) {
+        // Entries of the fast dispatch table cannot be updated atomically, and patching code
+        // which may be executing on another thread has to wait until no Jit is executing.
+        this->conf.optimizations &= ~OptimizationFlag::FastDispatch;
+        defer_patching = true;
+    }
+
     GenMemory128Accessors();
     GenFastmemFallbacks();
+    GenAtomicFallbacks();
     GenTerminalHandlers();
     code.PreludeComplete();
     ClearFastDispatchTable();
+
+    exception_handler.SetFastmemCallback([this](u64 rip_){
+        return FastmemCallback(rip_);
+    });
 }
 
 A64EmitX64::~A64EmitX64() = default;
 
-A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) {
+/// Returns true if the emitted code for opcode leaves the host flags unmodified when the guest
+/// NZCV flags are held in them. Any other instruction is assumed to clobber the host flags.
+static bool PreservesHostFlags(IR::Opcode opcode) {
+    switch (opcode) {
+    case IR::Opcode::A64GetCFlag:
+    case IR::Opcode::A64SetNZCV:
+    case IR::Opcode::A64GetW:
+    case IR::Opcode::A64GetX:
+    case IR::Opcode::A64GetSP:
+    case IR::Opcode::A64SetW:
+    case IR::Opcode::A64SetX:
+    case IR::Opcode::A64SetSP:
+    case IR::Opcode::A64SetPC:
+    case IR::Opcode::ConditionalSelect32:
+    case IR::Opcode::ConditionalSelect64:
+    case IR::Opcode::ConditionalSelectNZCV:
+        return true;
+    default:
+        return false;
+    }
+}
+
+A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block, bool first_tier) {
+    if (!first_tier && first_tier_blocks.count(block.Location())) {
+        // Links to the first tier block are redirected to the new code when it is registered.
+        InvalidateBasicBlocks({block.Location()});
+        statistics.promoted_blocks++;
+    }
+
     code.EnableWriting();
     SCOPE_EXIT { code.DisableWriting(); };
 
-    static const std::vector<HostLoc> gpr_order = [this]{
+    const std::vector<HostLoc> gpr_order = [this]{
         std::vector<HostLoc> gprs{any_gpr};
         if (conf.page_table) {
             gprs.erase(std::find(gprs.begin(), gprs.end(), HostLoc::R14));
         }
+        if (conf.fastmem_pointer) {
+            gprs.erase(std::find(gprs.begin(), gprs.end(), HostLoc::R13));
+        }
+        for (const auto& [guest_reg, host_loc] : pinned_registers) {
+            gprs.erase(std::find(gprs.begin(), gprs.end(), host_loc));
+        }
         return gprs;
     }();
 
     RegAlloc reg_alloc{code, A64JitState::SpillCount, SpillToOpArg<A64JitState>, gpr_order, any_xmm};
+    if (conf.HasOptimization(OptimizationFlag::RegAllocLookahead) && !first_tier) {
+        reg_alloc.AnalyzeUses(block);
+    }
     A64EmitContext ctx{conf, reg_alloc, block};
 
     // Start emitting.
@@ -84,8 +140,36 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) {
 
     ASSERT(block.GetCondition() == IR::Cond::AL);
 
+    if (first_tier) {
+        s64* counter;
+        if (free_execution_counters.empty()) {
+            counter = &execution_counters.emplace_back(conf.tiering_threshold);
+        } else {
+            counter = free_execution_counters.back();
+            free_execution_counters.pop_back();
+            *counter = conf.tiering_threshold;
+        }
+        first_tier_blocks.emplace(block.Location(), counter);
+
+        Xbyak::Label hot;
+        code.mov(rax, reinterpret_cast<u64>(counter));
+        code.sub(qword[rax], 1);
+        code.jle(hot, code.T_NEAR);
+
+        code.SwitchToFarCode();
+        code.L(hot);
+        code.mov(rax, A64::LocationDescriptor{block.Location()}.PC());
+        code.mov(qword[r15 + offsetof(A64JitState, pc)], rax);
+        code.ReturnFromRunCode();
+        code.SwitchToNearCode();
+    }
+
+    const bool host_flags = conf.HasOptimization(OptimizationFlag::HostFlags);
+
     for (auto iter = block.begin(); iter != block.end(); ++iter) {
         IR::Inst* inst = &*iter;
+        reg_alloc.SetCurrentInstruction(inst);
+        const IR::Inst* const host_flags_value = reg_alloc.GetHostFlagsValue();
 
         // Call the relevant Emit* member function.
         switch (inst->GetOpcode()) {
@@ -110,21 +194,36 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) {
         }
 
         ctx.reg_alloc.EndOfAllocScope();
+
+        if (!host_flags) {
+            reg_alloc.SetHostFlagsValue(nullptr);
+        } else if (!PreservesHostFlags(inst->GetOpcode())) {
+            // Instructions which produce flags record them; everything else is assumed to clobber them.
+            ctx.nzcv_in_host_flags = false;
+            if (reg_alloc.GetHostFlagsValue() == host_flags_value) {
+                reg_alloc.SetHostFlagsValue(nullptr);
+            }
+        }
     }
 
     reg_alloc.AssertNoMoreUses();
+    statistics.register_spills += reg_alloc.SpillCount();
 
-    EmitAddCycles(block.CycleCount());
-    EmitX64::EmitTerminal(block.GetTerminal(), ctx.Location().SetSingleStepping(false), ctx.IsSingleStep());
+    // A conditional branch at the end of the block can test the guest flags directly if they are still in the host flags.
+    const IR::Terminal terminal = block.GetTerminal();
+    nzcv_in_host_flags_at_terminal = ctx.nzcv_in_host_flags && boost::get<IR::Term::If>(&terminal) != nullptr;
+    EmitAddCycles(block.CycleCount(), nzcv_in_host_flags_at_terminal);
+    EmitX64::EmitTerminal(terminal, ctx.Location().SetSingleStepping(false), ctx.IsSingleStep());
     code.int3();
 
     const size_t size = static_cast<size_t>(code.getCurr() - entrypoint);
 
     const A64::LocationDescriptor descriptor{block.Location()};
-    const A64::LocationDescriptor end_location{block.EndLocation()};
 
-    const auto range = boost::icl::discrete_interval<u64>::closed(descriptor.PC(), end_location.PC() - 1);
-    block_ranges.AddRange(range, descriptor);
+    for (const auto& [start, end] : block.CodeRanges()) {
+        const auto range = boost::icl::discrete_interval<u64>::closed(A64::LocationDescriptor{start}.PC(), A64::LocationDescriptor{end}.PC() - 1);
+        block_ranges.AddRange(range, descriptor);
+    }
 
     return RegisterBlock(descriptor, entrypoint, size);
 }
@@ -133,12 +232,93 @@ void A64EmitX64::ClearCache() {
     EmitX64::ClearCache();
     block_ranges.ClearCache();
     ClearFastDispatchTable();
+    fastmem_patch_info.clear();
+    first_tier_blocks.clear();
+    free_execution_counters.clear();
+    execution_counters.clear();
+}
+
+void A64EmitX64::InvalidateBasicBlocks(const tsl::robin_set<IR::LocationDescriptor>& locations) {
+    for (const auto& descriptor : locations) {
+        if (const auto iter = first_tier_blocks.find(descriptor); iter != first_tier_blocks.end()) {
+            free_execution_counters.push_back(iter->second);
+            first_tier_blocks.erase(iter);
+        }
+    }
+
+    EmitX64::InvalidateBasicBlocks(locations);
+}
+
+bool A64EmitX64::IsHot(IR::LocationDescriptor descriptor) const {
+    const auto iter = first_tier_blocks.find(descriptor);
+    return iter != first_tier_blocks.end() && *iter->second <= 0;
+}
+
+void A64EmitX64::ResetExecutionCount(IR::LocationDescriptor descriptor) {
+    if (const auto iter = first_tier_blocks.find(descriptor); iter != first_tier_blocks.end()) {
+        *iter->second = conf.tiering_threshold;
+    }
+}
+
+void A64EmitX64::EvictOldestSegment() {
+    EmitX64::EvictOldestSegment();
+
+    const size_t segment = code.CurrentSegment();
+    for (auto iter = fastmem_patch_info.begin(); iter != fastmem_patch_info.end();) {
+        if (code.IsInSegment(reinterpret_cast<CodePtr>(iter->first), segment)) {
+            iter = fastmem_patch_info.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
 }
 
 void A64EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges) {
     InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
 }
 
+A64EmitX64::PinnedRegisters A64EmitX64::GetPinnedRegisters(const A64::UserConfig& conf) {
+    // r13 and r14 are only available when they do not hold the fastmem and page table pointers.
+    // rbx is chosen last as 128-bit compare-and-swap requires it.
+    std::vector<HostLoc> available{HostLoc::RBP, HostLoc::R12};
+    if (!conf.fastmem_pointer) {
+        available.push_back(HostLoc::R13);
+    }
+    if (!conf.page_table) {
+        available.push_back(HostLoc::R14);
+    }
+    available.push_back(HostLoc::RBX);
+
+    PinnedRegisters pinned;
+    for (size_t i = 0; i < 31 && pinned.size() < available.size(); i++) {
+        if (Common::Bit(i, conf.pinned_gpr_mask)) {
+            pinned.emplace_back(static_cast<A64::Reg>(i), available[pinned.size()]);
+        }
+    }
+    return pinned;
+}
+
+void A64EmitX64::EmitSpillPinnedRegisters(BlockOfCode& code, const PinnedRegisters& pinned) {
+    for (const auto& [guest_reg, host_loc] : pinned) {
+        code.mov(qword[r15 + offsetof(A64JitState, reg) + sizeof(u64) * static_cast<size_t>(guest_reg)], HostLocToReg64(host_loc));
+    }
+}
+
+void A64EmitX64::EmitFillPinnedRegisters(BlockOfCode& code, const PinnedRegisters& pinned) {
+    for (const auto& [guest_reg, host_loc] : pinned) {
+        code.mov(HostLocToReg64(host_loc), qword[r15 + offsetof(A64JitState, reg) + sizeof(u64) * static_cast<size_t>(guest_reg)]);
+    }
+}
+
+std::optional<Xbyak::Reg64> A64EmitX64::PinnedRegister(A64::Reg reg) const {
+    for (const auto& [guest_reg, host_loc] : pinned_registers) {
+        if (guest_reg == reg) {
+            return HostLocToReg64(host_loc);
+        }
+    }
+    return std::nullopt;
+}
+
 void A64EmitX64::ClearFastDispatchTable() {
     if (conf.HasOptimization(OptimizationFlag::FastDispatch)) {
         fast_dispatch_table.fill({});
@@ -212,6 +392,12 @@ void A64EmitX64::GenFastmemFallbacks() {
         {32, Devirtualize<&A64::UserCallbacks::MemoryWrite32>(conf.callbacks)},
         {64, Devirtualize<&A64::UserCallbacks::MemoryWrite64>(conf.callbacks)},
     }};
+    const std::array<std::pair<size_t, ArgCallback>, 4> exclusive_write_callbacks{{
+        {8, Devirtualize<&A64::UserCallbacks::MemoryWriteExclusive8>(conf.callbacks)},
+        {16, Devirtualize<&A64::UserCallbacks::MemoryWriteExclusive16>(conf.callbacks)},
+        {32, Devirtualize<&A64::UserCallbacks::MemoryWriteExclusive32>(conf.callbacks)},
+        {64, Devirtualize<&A64::UserCallbacks::MemoryWriteExclusive64>(conf.callbacks)},
+    }};
 
     for (int vaddr_idx : idxes) {
         if (vaddr_idx == 4 || vaddr_idx == 15) {
@@ -291,22 +477,253 @@ void A64EmitX64::GenFastmemFallbacks() {
                 code.ret();
                 PerfMapRegister(write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)], code.getCurr(), fmt::format("a64_write_fallback_{}", bitsize));
             }
+
+            // Exclusive writes take the expected value in rax and return their result in rax.
+            if (!conf.global_monitor || vaddr_idx == 0 || value_idx == 0) {
+                continue;
+            }
+
+            for (const auto& [bitsize, callback] : exclusive_write_callbacks) {
+                code.align();
+                exclusive_write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)] = code.getCurr<void(*)()>();
+                ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+                if (vaddr_idx == code.ABI_PARAM3.getIdx() && value_idx == code.ABI_PARAM2.getIdx()) {
+                    code.xchg(code.ABI_PARAM2, code.ABI_PARAM3);
+                } else if (vaddr_idx == code.ABI_PARAM3.getIdx()) {
+                    code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+                    if (value_idx != code.ABI_PARAM3.getIdx()) {
+                        code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
+                    }
+                } else {
+                    if (value_idx != code.ABI_PARAM3.getIdx()) {
+                        code.mov(code.ABI_PARAM3, Xbyak::Reg64{value_idx});
+                    }
+                    if (vaddr_idx != code.ABI_PARAM2.getIdx()) {
+                        code.mov(code.ABI_PARAM2, Xbyak::Reg64{vaddr_idx});
+                    }
+                }
+                code.mov(code.ABI_PARAM4, rax);
+                callback.EmitCall(code);
+                ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+                code.ret();
+                PerfMapRegister(exclusive_write_fallbacks[std::make_tuple(bitsize, vaddr_idx, value_idx)], code.getCurr(), fmt::format("a64_exclusive_write_fallback_{}", bitsize));
+            }
+        }
+    }
+}
+
+namespace {
+
+template<typename T>
+T ReadMemoryViaCallbacks(A64::UserCallbacks* callbacks, u64 vaddr) {
+    if constexpr (std::is_same_v<T, u8>) {
+        return callbacks->MemoryRead8(vaddr);
+    } else if constexpr (std::is_same_v<T, u16>) {
+        return callbacks->MemoryRead16(vaddr);
+    } else if constexpr (std::is_same_v<T, u32>) {
+        return callbacks->MemoryRead32(vaddr);
+    } else if constexpr (std::is_same_v<T, u64>) {
+        return callbacks->MemoryRead64(vaddr);
+    } else {
+        return callbacks->MemoryRead128(vaddr);
+    }
+}
+
+template<typename T>
+void WriteMemoryViaCallbacks(A64::UserCallbacks* callbacks, u64 vaddr, T value) {
+    if constexpr (std::is_same_v<T, u8>) {
+        callbacks->MemoryWrite8(vaddr, value);
+    } else if constexpr (std::is_same_v<T, u16>) {
+        callbacks->MemoryWrite16(vaddr, value);
+    } else if constexpr (std::is_same_v<T, u32>) {
+        callbacks->MemoryWrite32(vaddr, value);
+    } else if constexpr (std::is_same_v<T, u64>) {
+        callbacks->MemoryWrite64(vaddr, value);
+    } else {
+        callbacks->MemoryWrite128(vaddr, value);
+    }
+}
+
+template<typename T>
+bool WriteMemoryExclusiveViaCallbacks(A64::UserCallbacks* callbacks, u64 vaddr, T value, T expected) {
+    if constexpr (std::is_same_v<T, u8>) {
+        return callbacks->MemoryWriteExclusive8(vaddr, value, expected);
+    } else if constexpr (std::is_same_v<T, u16>) {
+        return callbacks->MemoryWriteExclusive16(vaddr, value, expected);
+    } else if constexpr (std::is_same_v<T, u32>) {
+        return callbacks->MemoryWriteExclusive32(vaddr, value, expected);
+    } else if constexpr (std::is_same_v<T, u64>) {
+        return callbacks->MemoryWriteExclusive64(vaddr, value, expected);
+    } else {
+        return callbacks->MemoryWriteExclusive128(vaddr, value, expected);
+    }
+}
+
+/// Atomically replaces the value at vaddr with op(old_value) using the memory callbacks.
+/// If op returns std::nullopt memory is left unmodified. Returns the old value.
+/// With a global monitor other processors may be accessing memory concurrently, so the
+/// update is retried with MemoryWriteExclusive until it is observed to be atomic.
+template<typename T, typename Operation>
+T ReadModifyWriteViaCallbacks(A64::UserConfig& conf, u64 vaddr, Operation op) {
+    while (true) {
+        const T old_value = ReadMemoryViaCallbacks<T>(conf.callbacks, vaddr);
+        const std::optional<T> new_value = op(old_value);
+        if (!new_value) {
+            return old_value;
+        }
+        if (!conf.global_monitor) {
+            WriteMemoryViaCallbacks<T>(conf.callbacks, vaddr, *new_value);
+            return old_value;
+        }
+        if (WriteMemoryExclusiveViaCallbacks<T>(conf.callbacks, vaddr, *new_value, old_value)) {
+            return old_value;
+        }
+    }
+}
+
+template<typename T>
+T PerformAtomicOp(IR::AtomicOp op, T old_value, T operand) {
+    using S = std::make_signed_t<T>;
+    switch (op) {
+    case IR::AtomicOp::Add:
+        return static_cast<T>(old_value + operand);
+    case IR::AtomicOp::Clear:
+        return static_cast<T>(old_value & ~operand);
+    case IR::AtomicOp::Eor:
+        return static_cast<T>(old_value ^ operand);
+    case IR::AtomicOp::Set:
+        return static_cast<T>(old_value | operand);
+    case IR::AtomicOp::SMax:
+        return static_cast<S>(old_value) > static_cast<S>(operand) ? old_value : operand;
+    case IR::AtomicOp::SMin:
+        return static_cast<S>(old_value) < static_cast<S>(operand) ? old_value : operand;
+    case IR::AtomicOp::UMax:
+        return old_value > operand ? old_value : operand;
+    case IR::AtomicOp::UMin:
+        return old_value < operand ? old_value : operand;
+    case IR::AtomicOp::Swap:
+        return operand;
+    }
+    UNREACHABLE();
+}
+
+template<typename T>
+u64 AtomicMemoryOperationFallback(A64::UserConfig& conf, u64 vaddr, u64 operand, u64 op) {
+    return ReadModifyWriteViaCallbacks<T>(conf, vaddr, [&](T old_value) -> std::optional<T> {
+        return PerformAtomicOp<T>(static_cast<IR::AtomicOp>(op), old_value, static_cast<T>(operand));
+    });
+}
+
+template<typename T>
+u64 CompareAndSwapFallback(A64::UserConfig& conf, u64 vaddr, u64 expected, u64 desired) {
+    return ReadModifyWriteViaCallbacks<T>(conf, vaddr, [&](T old_value) -> std::optional<T> {
+        if (old_value != static_cast<T>(expected)) {
+            return std::nullopt;
+        }
+        return static_cast<T>(desired);
+    });
+}
+
+void CompareAndSwap128Fallback(A64::UserConfig& conf, u64 vaddr, A64::Vector& expected_and_result, const A64::Vector& desired) {
+    expected_and_result = ReadModifyWriteViaCallbacks<A64::Vector>(conf, vaddr, [&](A64::Vector old_value) -> std::optional<A64::Vector> {
+        if (old_value != expected_and_result) {
+            return std::nullopt;
+        }
+        return desired;
+    });
+}
+
+} // anonymous namespace
+
+void A64EmitX64::GenAtomicFallbacks() {
+    using FallbackFn = u64(*)(A64::UserConfig&, u64, u64, u64);
+
+    const std::array<std::pair<size_t, FallbackFn>, 4> operation_fns{{
+        {8, &AtomicMemoryOperationFallback<u8>},
+        {16, &AtomicMemoryOperationFallback<u16>},
+        {32, &AtomicMemoryOperationFallback<u32>},
+        {64, &AtomicMemoryOperationFallback<u64>},
+    }};
+    const std::array<std::pair<size_t, FallbackFn>, 4> compare_and_swap_fns{{
+        {8, &CompareAndSwapFallback<u8>},
+        {16, &CompareAndSwapFallback<u16>},
+        {32, &CompareAndSwapFallback<u32>},
+        {64, &CompareAndSwapFallback<u64>},
+    }};
+    const std::initializer_list<IR::AtomicOp> ops{
+        IR::AtomicOp::Add, IR::AtomicOp::Clear, IR::AtomicOp::Eor, IR::AtomicOp::Set,
+        IR::AtomicOp::SMax, IR::AtomicOp::SMin, IR::AtomicOp::UMax, IR::AtomicOp::UMin,
+        IR::AtomicOp::Swap,
+    };
+
+    // Atomic operations take vaddr in ABI_PARAM2 and the operand in ABI_PARAM3, and return the old value in rax.
+    for (const auto& [bitsize, fn] : operation_fns) {
+        for (const IR::AtomicOp op : ops) {
+            code.align();
+            atomic_memory_operation_fallbacks[std::make_tuple(bitsize, op)] = code.getCurr<void(*)()>();
+            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+            code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+            code.mov(code.ABI_PARAM4, static_cast<u32>(op));
+            code.CallFunction(fn);
+            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+            code.ret();
+            PerfMapRegister(atomic_memory_operation_fallbacks[std::make_tuple(bitsize, op)], code.getCurr(), fmt::format("a64_atomic_memory_operation_fallback_{}", bitsize));
         }
     }
+
+    // Compare-and-swap takes vaddr in ABI_PARAM2, the expected value in rax and the desired value in ABI_PARAM3,
+    // and returns the old value in rax.
+    for (const auto& [bitsize, fn] : compare_and_swap_fns) {
+        code.align();
+        compare_and_swap_fallbacks[bitsize] = code.getCurr<void(*)()>();
+        ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+        code.mov(code.ABI_PARAM4, code.ABI_PARAM3);
+        code.mov(code.ABI_PARAM3, rax);
+        code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+        code.CallFunction(fn);
+        ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLoc::RAX);
+        code.ret();
+        PerfMapRegister(compare_and_swap_fallbacks[bitsize], code.getCurr(), fmt::format("a64_compare_and_swap_fallback_{}", bitsize));
+    }
+
+    // The 128-bit compare-and-swap follows cmpxchg16b: vaddr is in rsi, the expected value in rdx:rax and
+    // the desired value in rcx:rbx. The old value is returned in rdx:rax.
+    code.align();
+    compare_and_swap_fallbacks[128] = code.getCurr<void(*)()>();
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, {HostLoc::RAX, HostLoc::RDX});
+    code.sub(rsp, 32 + ABI_SHADOW_SPACE);
+    code.mov(qword[rsp + ABI_SHADOW_SPACE + 0], rax);
+    code.mov(qword[rsp + ABI_SHADOW_SPACE + 8], rdx);
+    code.mov(qword[rsp + ABI_SHADOW_SPACE + 16], rbx);
+    code.mov(qword[rsp + ABI_SHADOW_SPACE + 24], rcx);
+    if (code.ABI_PARAM2 != rsi) {
+        code.mov(code.ABI_PARAM2, rsi);
+    }
+    code.lea(code.ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE]);
+    code.lea(code.ABI_PARAM4, ptr[rsp + ABI_SHADOW_SPACE + 16]);
+    code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+    code.CallFunction(&CompareAndSwap128Fallback);
+    code.mov(rax, qword[rsp + ABI_SHADOW_SPACE + 0]);
+    code.mov(rdx, qword[rsp + ABI_SHADOW_SPACE + 8]);
+    code.add(rsp, 32 + ABI_SHADOW_SPACE);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, {HostLoc::RAX, HostLoc::RDX});
+    code.ret();
+    PerfMapRegister(compare_and_swap_fallbacks[128], code.getCurr(), "a64_compare_and_swap_fallback_128");
 }
 
 void A64EmitX64::GenTerminalHandlers() {
-    // PC ends up in rbp, location_descriptor ends up in rbx
+    // PC ends up in rsi, location_descriptor ends up in rdi.
+    // Only caller-saved registers are used, as callee-saved registers may hold pinned guest registers.
     const auto calculate_location_descriptor = [this] {
         // This calculation has to match up with A64::LocationDescriptor::UniqueHash
         // TODO: Optimization is available here based on known state of fpcr.
-        code.mov(rbp, qword[r15 + offsetof(A64JitState, pc)]);
+        code.mov(rsi, qword[r15 + offsetof(A64JitState, pc)]);
         code.mov(rcx, A64::LocationDescriptor::pc_mask);
-        code.and_(rcx, rbp);
-        code.mov(ebx, dword[r15 + offsetof(A64JitState, fpcr)]);
-        code.and_(ebx, A64::LocationDescriptor::fpcr_mask);
-        code.shl(rbx, A64::LocationDescriptor::fpcr_shift);
-        code.or_(rbx, rcx);
+        code.and_(rcx, rsi);
+        code.mov(edi, dword[r15 + offsetof(A64JitState, fpcr)]);
+        code.and_(edi, A64::LocationDescriptor::fpcr_mask);
+        code.shl(rdi, A64::LocationDescriptor::fpcr_shift);
+        code.or_(rdi, rcx);
     };
 
     Xbyak::Label fast_dispatch_cache_miss, rsb_cache_miss;
@@ -318,7 +735,7 @@ void A64EmitX64::GenTerminalHandlers() {
     code.sub(eax, 1);
     code.and_(eax, u32(A64JitState::RSBPtrMask));
     code.mov(dword[r15 + offsetof(A64JitState, rsb_ptr)], eax);
-    code.cmp(rbx, qword[r15 + offsetof(A64JitState, rsb_location_descriptors) + rax * sizeof(u64)]);
+    code.cmp(rdi, qword[r15 + offsetof(A64JitState, rsb_location_descriptors) + rax * sizeof(u64)]);
     if (conf.HasOptimization(OptimizationFlag::FastDispatch)) {
         code.jne(rsb_cache_miss);
     } else {
@@ -333,19 +750,24 @@ void A64EmitX64::GenTerminalHandlers() {
         terminal_handler_fast_dispatch_hint = code.getCurr<const void*>();
         calculate_location_descriptor();
         code.L(rsb_cache_miss);
-        code.mov(r12, reinterpret_cast<u64>(fast_dispatch_table.data()));
+        code.mov(rdx, reinterpret_cast<u64>(fast_dispatch_table.data()));
         if (code.HasSSE42()) {
-            code.crc32(rbx, r12d);
+            code.crc32(rdi, edx);
         }
-        code.and_(ebp, fast_dispatch_table_mask);
-        code.lea(rbp, ptr[r12 + rbp]);
-        code.cmp(rbx, qword[rbp + offsetof(FastDispatchEntry, location_descriptor)]);
+        code.and_(esi, fast_dispatch_table_mask);
+        code.lea(rsi, ptr[rdx + rsi]);
+        code.cmp(rdi, qword[rsi + offsetof(FastDispatchEntry, location_descriptor)]);
         code.jne(fast_dispatch_cache_miss);
-        code.jmp(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)]);
+        code.jmp(ptr[rsi + offsetof(FastDispatchEntry, code_ptr)]);
         code.L(fast_dispatch_cache_miss);
-        code.mov(qword[rbp + offsetof(FastDispatchEntry, location_descriptor)], rbx);
+        code.mov(qword[rsi + offsetof(FastDispatchEntry, location_descriptor)], rdi);
+        // Keep the entry across the call; the extra slot keeps the stack aligned.
+        code.push(rsi);
+        code.sub(rsp, 8);
         code.LookupBlock();
-        code.mov(ptr[rbp + offsetof(FastDispatchEntry, code_ptr)], rax);
+        code.add(rsp, 8);
+        code.pop(rsi);
+        code.mov(ptr[rsi + offsetof(FastDispatchEntry, code_ptr)], rax);
         code.jmp(rax);
         PerfMapRegister(terminal_handler_fast_dispatch_hint, code.getCurr(), "a64_terminal_handler_fast_dispatch_hint");
 
@@ -377,6 +799,14 @@ void A64EmitX64::EmitA64SetCheckBit(A64EmitContext& ctx, IR::Inst* inst) {
 
 void A64EmitX64::EmitA64GetCFlag(A64EmitContext& ctx, IR::Inst* inst) {
     const Xbyak::Reg32 result = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    if (ctx.nzcv_in_host_flags) {
+        code.setc(result.cvt8());
+        code.movzx(result, result.cvt8());
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     code.mov(result, dword[r15 + offsetof(A64JitState, cpsr_nzcv)]);
     code.shr(result, NZCV::x64_c_flag_bit);
     code.and_(result, 1);
@@ -422,12 +852,19 @@ void A64EmitX64::EmitA64SetNZCV(A64EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const Xbyak::Reg32 to_store = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
     code.mov(dword[r15 + offsetof(A64JitState, cpsr_nzcv)], to_store);
+    ctx.nzcv_in_host_flags = !args[0].IsImmediate() && ctx.reg_alloc.GetHostFlagsValue() == inst->GetArg(0).GetInst();
 }
 
 void A64EmitX64::EmitA64GetW(A64EmitContext& ctx, IR::Inst* inst) {
     const A64::Reg reg = inst->GetArg(0).GetA64RegRef();
     const Xbyak::Reg32 result = ctx.reg_alloc.ScratchGpr().cvt32();
 
+    if (const auto pinned = PinnedRegister(reg)) {
+        code.mov(result, pinned->cvt32());
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     code.mov(result, dword[r15 + offsetof(A64JitState, reg) + sizeof(u64) * static_cast<size_t>(reg)]);
     ctx.reg_alloc.DefineValue(inst, result);
 }
@@ -436,6 +873,12 @@ void A64EmitX64::EmitA64GetX(A64EmitContext& ctx, IR::Inst* inst) {
     const A64::Reg reg = inst->GetArg(0).GetA64RegRef();
     const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr();
 
+    if (const auto pinned = PinnedRegister(reg)) {
+        code.mov(result, *pinned);
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     code.mov(result, qword[r15 + offsetof(A64JitState, reg) + sizeof(u64) * static_cast<size_t>(reg)]);
     ctx.reg_alloc.DefineValue(inst, result);
 }
@@ -493,6 +936,17 @@ void A64EmitX64::EmitA64GetFPSR(A64EmitContext& ctx, IR::Inst* inst) {
 void A64EmitX64::EmitA64SetW(A64EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const A64::Reg reg = inst->GetArg(0).GetA64RegRef();
+
+    if (const auto pinned = PinnedRegister(reg)) {
+        if (args[1].IsImmediate()) {
+            code.mov(pinned->cvt32(), args[1].GetImmediateU32());
+        } else {
+            const Xbyak::Reg32 to_store = ctx.reg_alloc.UseGpr(args[1]).cvt32();
+            code.mov(pinned->cvt32(), to_store);
+        }
+        return;
+    }
+
     const auto addr = qword[r15 + offsetof(A64JitState, reg) + sizeof(u64) * static_cast<size_t>(reg)];
     if (args[1].FitsInImmediateS32()) {
         code.mov(addr, args[1].GetImmediateS32());
@@ -507,6 +961,20 @@ void A64EmitX64::EmitA64SetW(A64EmitContext& ctx, IR::Inst* inst) {
 void A64EmitX64::EmitA64SetX(A64EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const A64::Reg reg = inst->GetArg(0).GetA64RegRef();
+
+    if (const auto pinned = PinnedRegister(reg)) {
+        if (args[1].IsImmediate()) {
+            code.mov(*pinned, args[1].GetImmediateU64());
+        } else if (args[1].IsInXmm()) {
+            const Xbyak::Xmm to_store = ctx.reg_alloc.UseXmm(args[1]);
+            code.movq(*pinned, to_store);
+        } else {
+            const Xbyak::Reg64 to_store = ctx.reg_alloc.UseGpr(args[1]);
+            code.mov(*pinned, to_store);
+        }
+        return;
+    }
+
     const auto addr = qword[r15 + offsetof(A64JitState, reg) + sizeof(u64) * static_cast<size_t>(reg)];
     if (args[1].FitsInImmediateS32()) {
         code.mov(addr, args[1].GetImmediateS32());
@@ -624,10 +1092,12 @@ void A64EmitX64::EmitA64CallSupervisor(A64EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     ASSERT(args[0].IsImmediate());
     const u32 imm = args[0].GetImmediateU32();
+    EmitSpillPinnedRegisters(code, pinned_registers);
     Devirtualize<&A64::UserCallbacks::CallSVC>(conf.callbacks).EmitCall(code,
         [&](RegList param) {
             code.mov(param[0], imm);
         });
+    EmitFillPinnedRegisters(code, pinned_registers);
     // The kernel would have to execute ERET to get here, which would clear exclusive state.
     code.mov(code.byte[r15 + offsetof(A64JitState, exclusive_state)], u8(0));
 }
@@ -638,17 +1108,21 @@ void A64EmitX64::EmitA64ExceptionRaised(A64EmitContext& ctx, IR::Inst* inst) {
     ASSERT(args[0].IsImmediate() && args[1].IsImmediate());
     const u64 pc = args[0].GetImmediateU64();
     const u64 exception = args[1].GetImmediateU64();
+    EmitSpillPinnedRegisters(code, pinned_registers);
     Devirtualize<&A64::UserCallbacks::ExceptionRaised>(conf.callbacks).EmitCall(code,
         [&](RegList param) {
             code.mov(param[0], pc);
             code.mov(param[1], exception);
         });
+    EmitFillPinnedRegisters(code, pinned_registers);
 }
 
 void A64EmitX64::EmitA64DataCacheOperationRaised(A64EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     ctx.reg_alloc.HostCall(nullptr, args[0], args[1]);
+    EmitSpillPinnedRegisters(code, pinned_registers);
     Devirtualize<&A64::UserCallbacks::DataCacheOperationRaised>(conf.callbacks).EmitCall(code);
+    EmitFillPinnedRegisters(code, pinned_registers);
 }
 
 void A64EmitX64::EmitA64DataSynchronizationBarrier(A64EmitContext&, IR::Inst*) {
@@ -662,7 +1136,7 @@ void A64EmitX64::EmitA64DataMemoryBarrier(A64EmitContext&, IR::Inst*) {
 void A64EmitX64::EmitA64InstructionSynchronizationBarrier(A64EmitContext& ctx, IR::Inst* ) {
     ctx.reg_alloc.HostCall(nullptr);
 
-    code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(jit_interface));
+    code.mov(code.ABI_PARAM1, qword[r15 + offsetof(A64JitState, jit_interface)]);
     code.CallLambda([](A64::Jit* jit) { jit->ClearCache(); });
 }
 
@@ -825,241 +1299,313 @@ Xbyak::RegExp EmitVAddrLookup(BlockOfCode& code, A64EmitContext& ctx, size_t bit
     return page + tmp;
 }
 
+Xbyak::RegExp EmitFastmemVAddr(BlockOfCode& code, A64EmitContext& ctx, Xbyak::Label& abort, Xbyak::Reg64 vaddr, bool& require_abort_handling) {
+    const size_t unused_top_bits = 64 - ctx.conf.fastmem_address_space_bits;
+
+    if (unused_top_bits == 0) {
+        return r13 + vaddr;
+    } else if (ctx.conf.silently_mirror_fastmem) {
+        const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+        if (unused_top_bits < 32) {
+            code.mov(tmp, vaddr);
+            code.shl(tmp, int(unused_top_bits));
+            code.shr(tmp, int(unused_top_bits));
+        } else if (unused_top_bits == 32) {
+            code.mov(tmp.cvt32(), vaddr.cvt32());
+        } else {
+            code.mov(tmp.cvt32(), vaddr.cvt32());
+            code.and_(tmp, u32((1 << ctx.conf.fastmem_address_space_bits) - 1));
+        }
+        return r13 + tmp;
+    } else {
+        if (ctx.conf.fastmem_address_space_bits < 32) {
+            code.test(vaddr, u32(-(1 << ctx.conf.fastmem_address_space_bits)));
+        } else {
+            const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+            code.mov(tmp, vaddr);
+            code.shr(tmp, int(ctx.conf.fastmem_address_space_bits));
+        }
+        code.jnz(abort, code.T_NEAR);
+        require_abort_handling = true;
+        return r13 + vaddr;
+    }
+}
+
 template<std::size_t bitsize>
-void EmitReadMemoryMov(BlockOfCode& code, const Xbyak::Reg64& value, const Xbyak::RegExp& addr) {
+const void* EmitReadMemoryMov(BlockOfCode& code, int value_idx, const Xbyak::RegExp& addr) {
+    const void* location = code.getCurr();
     switch (bitsize) {
     case 8:
-        code.movzx(value.cvt32(), code.byte[addr]);
-        return;
+        code.movzx(Xbyak::Reg32{value_idx}, code.byte[addr]);
+        break;
     case 16:
-        code.movzx(value.cvt32(), word[addr]);
-        return;
+        code.movzx(Xbyak::Reg32{value_idx}, word[addr]);
+        break;
     case 32:
-        code.mov(value.cvt32(), dword[addr]);
-        return;
+        code.mov(Xbyak::Reg32{value_idx}, dword[addr]);
+        break;
     case 64:
-        code.mov(value, qword[addr]);
-        return;
+        code.mov(Xbyak::Reg64{value_idx}, qword[addr]);
+        break;
+    case 128:
+        code.movups(Xbyak::Xmm{value_idx}, xword[addr]);
+        break;
     default:
         ASSERT_FALSE("Invalid bitsize");
     }
+    return location;
 }
 
 template<std::size_t bitsize>
-void EmitWriteMemoryMov(BlockOfCode& code, const Xbyak::RegExp& addr, const Xbyak::Reg64& value) {
+const void* EmitWriteMemoryMov(BlockOfCode& code, const Xbyak::RegExp& addr, int value_idx) {
+    const void* location = code.getCurr();
     switch (bitsize) {
     case 8:
-        code.mov(code.byte[addr], value.cvt8());
-        return;
+        code.mov(code.byte[addr], Xbyak::Reg64{value_idx}.cvt8());
+        break;
     case 16:
-        code.mov(word[addr], value.cvt16());
-        return;
+        code.mov(word[addr], Xbyak::Reg16{value_idx});
+        break;
     case 32:
-        code.mov(dword[addr], value.cvt32());
-        return;
+        code.mov(dword[addr], Xbyak::Reg32{value_idx});
+        break;
     case 64:
-        code.mov(qword[addr], value);
-        return;
+        code.mov(qword[addr], Xbyak::Reg64{value_idx});
+        break;
+    case 128:
+        code.movups(xword[addr], Xbyak::Xmm{value_idx});
+        break;
     default:
         ASSERT_FALSE("Invalid bitsize");
     }
+    return location;
 }
 
-} // anonymous namepsace
-
 template<std::size_t bitsize>
-void A64EmitX64::EmitDirectPageTableMemoryRead(A64EmitContext& ctx, IR::Inst* inst) {
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+const void* EmitExclusiveWriteMemoryCmpxchg(BlockOfCode& code, const Xbyak::RegExp& addr, int value_idx) {
+    const void* location = code.getCurr();
+    code.lock();
+    switch (bitsize) {
+    case 8:
+        code.cmpxchg(code.byte[addr], Xbyak::Reg64{value_idx}.cvt8());
+        break;
+    case 16:
+        code.cmpxchg(word[addr], Xbyak::Reg16{value_idx});
+        break;
+    case 32:
+        code.cmpxchg(dword[addr], Xbyak::Reg32{value_idx});
+        break;
+    case 64:
+        code.cmpxchg(qword[addr], Xbyak::Reg64{value_idx});
+        break;
+    default:
+        ASSERT_FALSE("Invalid bitsize");
+    }
+    return location;
+}
 
-    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
-    const Xbyak::Reg64 value = ctx.reg_alloc.ScratchGpr();
+} // anonymous namepsace
 
-    const auto wrapped_fn = read_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
+std::optional<A64EmitX64::DoNotFastmemMarker> A64EmitX64::ShouldFastmem(A64EmitContext& ctx, IR::Inst* inst) const {
+    if (!conf.fastmem_pointer || !exception_handler.SupportsFastmem()) {
+        return std::nullopt;
+    }
 
-    Xbyak::Label abort, end;
+    const auto marker = std::make_tuple(ctx.Location(), ctx.GetInstOffset(inst));
+    if (do_not_fastmem.count(marker) > 0) {
+        return std::nullopt;
+    }
+    return marker;
+}
 
-    const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
-    EmitReadMemoryMov<bitsize>(code, value, src_ptr);
-    code.L(end);
+bool A64EmitX64::ShouldInlineExclusiveAccess(A64EmitContext& ctx, IR::Inst* inst) const {
+    if (!ExclusiveMonitorFriend::SupportsInlineAccess(conf.global_monitor)) {
+        return false;
+    }
+    return conf.page_table || ShouldFastmem(ctx, inst);
+}
 
-    code.SwitchToFarCode();
-    code.L(abort);
-    code.call(wrapped_fn);
-    code.jmp(end, code.T_NEAR);
-    code.SwitchToNearCode();
+FakeCall A64EmitX64::FastmemCallback(u64 rip_) {
+    std::lock_guard lock{code_mutex};
 
-    ctx.reg_alloc.DefineValue(inst, value);
+    const auto iter = fastmem_patch_info.find(rip_);
+    ASSERT(iter != fastmem_patch_info.end());
+    if (conf.recompile_on_fastmem_failure) {
+        const auto marker = iter->second.marker;
+        do_not_fastmem.emplace(marker);
+        InvalidateBasicBlocks({std::get<0>(marker)});
+    }
+    FakeCall ret;
+    ret.call_rip = iter->second.callback;
+    ret.ret_rip = iter->second.resume_rip;
+    return ret;
 }
 
-template<std::size_t bitsize>
-void A64EmitX64::EmitDirectPageTableMemoryWrite(A64EmitContext& ctx, IR::Inst* inst) {
+template<std::size_t bitsize, auto callback>
+void A64EmitX64::EmitMemoryRead(A64EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const auto fastmem_marker = ShouldFastmem(ctx, inst);
+
+    if (!conf.page_table && !fastmem_marker) {
+        if constexpr (bitsize == 128) {
+            ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
+            code.CallFunction(memory_read_128);
+            ctx.reg_alloc.DefineValue(inst, xmm1);
+        } else {
+            ctx.reg_alloc.HostCall(inst, {}, args[0]);
+            Devirtualize<callback>(conf.callbacks).EmitCall(code);
+        }
+        return;
+    }
 
     const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
-    const Xbyak::Reg64 value = ctx.reg_alloc.UseGpr(args[1]);
+    const int value_idx = bitsize == 128 ? ctx.reg_alloc.ScratchXmm().getIdx() : ctx.reg_alloc.ScratchGpr().getIdx();
 
-    const auto wrapped_fn = write_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value.getIdx())];
+    const auto wrapped_fn = read_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value_idx)];
 
     Xbyak::Label abort, end;
-
-    const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
-    EmitWriteMemoryMov<bitsize>(code, dest_ptr, value);
+    bool require_abort_handling = false;
+
+    if (fastmem_marker) {
+        const auto src_ptr = EmitFastmemVAddr(code, ctx, abort, vaddr, require_abort_handling);
+        const auto location = EmitReadMemoryMov<bitsize>(code, value_idx, src_ptr);
+
+        fastmem_patch_info.emplace(
+            Common::BitCast<u64>(location),
+            FastmemPatchInfo{
+                Common::BitCast<u64>(code.getCurr()),
+                Common::BitCast<u64>(wrapped_fn),
+                *fastmem_marker,
+            }
+        );
+    } else {
+        const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+        require_abort_handling = true;
+        EmitReadMemoryMov<bitsize>(code, value_idx, src_ptr);
+    }
     code.L(end);
 
-    code.SwitchToFarCode();
-    code.L(abort);
-    code.call(wrapped_fn);
-    code.jmp(end, code.T_NEAR);
-    code.SwitchToNearCode();
-}
-
-void A64EmitX64::EmitA64ReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        EmitDirectPageTableMemoryRead<8>(ctx, inst);
-        return;
+    if (require_abort_handling) {
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.call(wrapped_fn);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
     }
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, {}, args[0]);
-    Devirtualize<&A64::UserCallbacks::MemoryRead8>(conf.callbacks).EmitCall(code);
+    if constexpr (bitsize == 128) {
+        ctx.reg_alloc.DefineValue(inst, Xbyak::Xmm{value_idx});
+    } else {
+        ctx.reg_alloc.DefineValue(inst, Xbyak::Reg64{value_idx});
+    }
 }
 
-void A64EmitX64::EmitA64ReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        EmitDirectPageTableMemoryRead<16>(ctx, inst);
+template<std::size_t bitsize, auto callback>
+void A64EmitX64::EmitMemoryWrite(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const auto fastmem_marker = ShouldFastmem(ctx, inst);
+
+    if (!conf.page_table && !fastmem_marker) {
+        if constexpr (bitsize == 128) {
+            ctx.reg_alloc.Use(args[0], ABI_PARAM2);
+            ctx.reg_alloc.Use(args[1], HostLoc::XMM1);
+            ctx.reg_alloc.EndOfAllocScope();
+            ctx.reg_alloc.HostCall(nullptr);
+            code.CallFunction(memory_write_128);
+        } else {
+            ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
+            Devirtualize<callback>(conf.callbacks).EmitCall(code);
+        }
         return;
     }
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, {}, args[0]);
-    Devirtualize<&A64::UserCallbacks::MemoryRead16>(conf.callbacks).EmitCall(code);
-}
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const int value_idx = bitsize == 128 ? ctx.reg_alloc.UseXmm(args[1]).getIdx() : ctx.reg_alloc.UseGpr(args[1]).getIdx();
 
-void A64EmitX64::EmitA64ReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        EmitDirectPageTableMemoryRead<32>(ctx, inst);
-        return;
-    }
+    const auto wrapped_fn = write_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value_idx)];
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, {}, args[0]);
-    Devirtualize<&A64::UserCallbacks::MemoryRead32>(conf.callbacks).EmitCall(code);
-}
-
-void A64EmitX64::EmitA64ReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        EmitDirectPageTableMemoryRead<64>(ctx, inst);
-        return;
+    Xbyak::Label abort, end;
+    bool require_abort_handling = false;
+
+    if (fastmem_marker) {
+        const auto dest_ptr = EmitFastmemVAddr(code, ctx, abort, vaddr, require_abort_handling);
+        const auto location = EmitWriteMemoryMov<bitsize>(code, dest_ptr, value_idx);
+
+        fastmem_patch_info.emplace(
+            Common::BitCast<u64>(location),
+            FastmemPatchInfo{
+                Common::BitCast<u64>(code.getCurr()),
+                Common::BitCast<u64>(wrapped_fn),
+                *fastmem_marker,
+            }
+        );
+    } else {
+        const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+        require_abort_handling = true;
+        EmitWriteMemoryMov<bitsize>(code, dest_ptr, value_idx);
     }
+    code.L(end);
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(inst, {}, args[0]);
-    Devirtualize<&A64::UserCallbacks::MemoryRead64>(conf.callbacks).EmitCall(code);
-}
-
-void A64EmitX64::EmitA64ReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        Xbyak::Label abort, end;
-
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
-        const Xbyak::Xmm value = ctx.reg_alloc.ScratchXmm();
-
-        const auto src_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr);
-        code.movups(value, xword[src_ptr]);
-        code.L(end);
-
+    if (require_abort_handling) {
         code.SwitchToFarCode();
         code.L(abort);
-        code.call(read_fallbacks[std::make_tuple(128, vaddr.getIdx(), value.getIdx())]);
+        code.call(wrapped_fn);
         code.jmp(end, code.T_NEAR);
         code.SwitchToNearCode();
-
-        ctx.reg_alloc.DefineValue(inst, value);
-        return;
     }
+}
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0]);
-    code.CallFunction(memory_read_128);
-    ctx.reg_alloc.DefineValue(inst, xmm1);
+void A64EmitX64::EmitA64ReadMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitMemoryRead<8, &A64::UserCallbacks::MemoryRead8>(ctx, inst);
 }
 
-void A64EmitX64::EmitA64WriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        EmitDirectPageTableMemoryWrite<8>(ctx, inst);
-        return;
-    }
+void A64EmitX64::EmitA64ReadMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitMemoryRead<16, &A64::UserCallbacks::MemoryRead16>(ctx, inst);
+}
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
-    Devirtualize<&A64::UserCallbacks::MemoryWrite8>(conf.callbacks).EmitCall(code);
+void A64EmitX64::EmitA64ReadMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitMemoryRead<32, &A64::UserCallbacks::MemoryRead32>(ctx, inst);
 }
 
-void A64EmitX64::EmitA64WriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        EmitDirectPageTableMemoryWrite<16>(ctx, inst);
-        return;
-    }
+void A64EmitX64::EmitA64ReadMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitMemoryRead<64, &A64::UserCallbacks::MemoryRead64>(ctx, inst);
+}
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
-    Devirtualize<&A64::UserCallbacks::MemoryWrite16>(conf.callbacks).EmitCall(code);
+void A64EmitX64::EmitA64ReadMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitMemoryRead<128, &A64::UserCallbacks::MemoryRead128>(ctx, inst);
 }
 
-void A64EmitX64::EmitA64WriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        EmitDirectPageTableMemoryWrite<32>(ctx, inst);
-        return;
-    }
+void A64EmitX64::EmitA64WriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitMemoryWrite<8, &A64::UserCallbacks::MemoryWrite8>(ctx, inst);
+}
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
-    Devirtualize<&A64::UserCallbacks::MemoryWrite32>(conf.callbacks).EmitCall(code);
+void A64EmitX64::EmitA64WriteMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitMemoryWrite<16, &A64::UserCallbacks::MemoryWrite16>(ctx, inst);
 }
 
-void A64EmitX64::EmitA64WriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        EmitDirectPageTableMemoryWrite<64>(ctx, inst);
-        return;
-    }
+void A64EmitX64::EmitA64WriteMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitMemoryWrite<32, &A64::UserCallbacks::MemoryWrite32>(ctx, inst);
+}
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.HostCall(nullptr, {}, args[0], args[1]);
-    Devirtualize<&A64::UserCallbacks::MemoryWrite64>(conf.callbacks).EmitCall(code);
+void A64EmitX64::EmitA64WriteMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitMemoryWrite<64, &A64::UserCallbacks::MemoryWrite64>(ctx, inst);
 }
 
 void A64EmitX64::EmitA64WriteMemory128(A64EmitContext& ctx, IR::Inst* inst) {
-    if (conf.page_table) {
-        Xbyak::Label abort, end;
-
-        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-        const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
-        const Xbyak::Xmm value = ctx.reg_alloc.UseXmm(args[1]);
-
-        const auto dest_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr);
-        code.movups(xword[dest_ptr], value);
-        code.L(end);
-
-        code.SwitchToFarCode();
-        code.L(abort);
-        code.call(write_fallbacks[std::make_tuple(128, vaddr.getIdx(), value.getIdx())]);
-        code.jmp(end, code.T_NEAR);
-        code.SwitchToNearCode();
-        return;
-    }
-
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    ctx.reg_alloc.Use(args[0], ABI_PARAM2);
-    ctx.reg_alloc.Use(args[1], HostLoc::XMM1);
-    ctx.reg_alloc.EndOfAllocScope();
-    ctx.reg_alloc.HostCall(nullptr);
-    code.CallFunction(memory_write_128);
+    EmitMemoryWrite<128, &A64::UserCallbacks::MemoryWrite128>(ctx, inst);
 }
 
 template<std::size_t bitsize, auto callback>
 void A64EmitX64::EmitExclusiveReadMemory(A64EmitContext& ctx, IR::Inst* inst) {
     ASSERT(conf.global_monitor != nullptr);
+
+    if constexpr (bitsize != 128) {
+        if (ShouldInlineExclusiveAccess(ctx, inst)) {
+            EmitExclusiveReadMemoryInline<bitsize>(ctx, inst);
+            return;
+        }
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     if constexpr (bitsize != 128) {
@@ -1069,9 +1615,10 @@ void A64EmitX64::EmitExclusiveReadMemory(A64EmitContext& ctx, IR::Inst* inst) {
 
         code.mov(code.byte[r15 + offsetof(A64JitState, exclusive_state)], u8(1));
         code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+        code.mov(code.ABI_PARAM3, qword[r15 + offsetof(A64JitState, processor_id)]);
         code.CallLambda(
-            [](A64::UserConfig& conf, u64 vaddr) -> T {
-                return conf.global_monitor->ReadAndMark<T>(conf.processor_id, vaddr, [&]() -> T {
+            [](A64::UserConfig& conf, u64 vaddr, size_t processor_id) -> T {
+                return conf.global_monitor->ReadAndMark<T>(processor_id, vaddr, [&]() -> T {
                     return (conf.callbacks->*callback)(vaddr);
                 });
             }
@@ -1084,11 +1631,12 @@ void A64EmitX64::EmitExclusiveReadMemory(A64EmitContext& ctx, IR::Inst* inst) {
 
         code.mov(code.byte[r15 + offsetof(A64JitState, exclusive_state)], u8(1));
         code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+        code.mov(code.ABI_PARAM4, qword[r15 + offsetof(A64JitState, processor_id)]);
         code.sub(rsp, 16 + ABI_SHADOW_SPACE);
         code.lea(code.ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE]);
         code.CallLambda(
-            [](A64::UserConfig& conf, u64 vaddr, A64::Vector& ret) {
-                ret = conf.global_monitor->ReadAndMark<A64::Vector>(conf.processor_id, vaddr, [&]() -> A64::Vector {
+            [](A64::UserConfig& conf, u64 vaddr, A64::Vector& ret, size_t processor_id) {
+                ret = conf.global_monitor->ReadAndMark<A64::Vector>(processor_id, vaddr, [&]() -> A64::Vector {
                     return (conf.callbacks->*callback)(vaddr);
                 });
             }
@@ -1123,6 +1671,14 @@ void A64EmitX64::EmitA64ExclusiveReadMemory128(A64EmitContext& ctx, IR::Inst* in
 template<std::size_t bitsize, auto callback>
 void A64EmitX64::EmitExclusiveWriteMemory(A64EmitContext& ctx, IR::Inst* inst) {
     ASSERT(conf.global_monitor != nullptr);
+
+    if constexpr (bitsize != 128) {
+        if (ShouldInlineExclusiveAccess(ctx, inst)) {
+            EmitExclusiveWriteMemoryInline<bitsize>(ctx, inst);
+            return;
+        }
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     if constexpr (bitsize != 128) {
@@ -1141,12 +1697,13 @@ void A64EmitX64::EmitExclusiveWriteMemory(A64EmitContext& ctx, IR::Inst* inst) {
     code.je(end);
     code.mov(code.byte[r15 + offsetof(A64JitState, exclusive_state)], u8(0));
     code.mov(code.ABI_PARAM1, reinterpret_cast<u64>(&conf));
+    code.mov(code.ABI_PARAM4, qword[r15 + offsetof(A64JitState, processor_id)]);
     if constexpr (bitsize != 128) {
         using T = mp::unsigned_integer_of_size<bitsize>;
 
         code.CallLambda(
-            [](A64::UserConfig& conf, u64 vaddr, T value) -> u32 {
-                return conf.global_monitor->DoExclusiveOperation<T>(conf.processor_id, vaddr,
+            [](A64::UserConfig& conf, u64 vaddr, T value, size_t processor_id) -> u32 {
+                return conf.global_monitor->DoExclusiveOperation<T>(processor_id, vaddr,
                     [&](T expected) -> bool {
                         return (conf.callbacks->*callback)(vaddr, value, expected);
                     }) ? 0 : 1;
@@ -1157,8 +1714,8 @@ void A64EmitX64::EmitExclusiveWriteMemory(A64EmitContext& ctx, IR::Inst* inst) {
         code.lea(code.ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE]);
         code.movaps(xword[code.ABI_PARAM3], xmm1);
         code.CallLambda(
-            [](A64::UserConfig& conf, u64 vaddr, A64::Vector& value) -> u32 {
-                return conf.global_monitor->DoExclusiveOperation<A64::Vector>(conf.processor_id, vaddr,
+            [](A64::UserConfig& conf, u64 vaddr, A64::Vector& value, size_t processor_id) -> u32 {
+                return conf.global_monitor->DoExclusiveOperation<A64::Vector>(processor_id, vaddr,
                     [&](A64::Vector expected) -> bool {
                         return (conf.callbacks->*callback)(vaddr, value, expected);
                     }) ? 0 : 1;
@@ -1169,6 +1726,125 @@ void A64EmitX64::EmitExclusiveWriteMemory(A64EmitContext& ctx, IR::Inst* inst) {
     code.L(end);
 }
 
+template<std::size_t bitsize>
+void A64EmitX64::EmitExclusiveReadMemoryInline(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const auto fastmem_marker = ShouldFastmem(ctx, inst);
+
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const int value_idx = ctx.reg_alloc.ScratchGpr().getIdx();
+    const Xbyak::Reg64 shard = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+
+    const auto wrapped_fn = read_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value_idx)];
+
+    Xbyak::Label abort, end;
+    bool require_abort_handling = false;
+
+    code.mov(code.byte[r15 + offsetof(A64JitState, exclusive_state)], u8(1));
+    EmitExclusiveLock(conf.global_monitor, shard, vaddr, tmp);
+    EmitExclusiveMark(shard, vaddr, tmp);
+
+    if (fastmem_marker) {
+        const auto src_ptr = EmitFastmemVAddr(code, ctx, abort, vaddr, require_abort_handling);
+        const auto location = EmitReadMemoryMov<bitsize>(code, value_idx, src_ptr);
+
+        fastmem_patch_info.emplace(
+            Common::BitCast<u64>(location),
+            FastmemPatchInfo{
+                Common::BitCast<u64>(code.getCurr()),
+                Common::BitCast<u64>(wrapped_fn),
+                *fastmem_marker,
+            }
+        );
+    } else {
+        const auto src_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+        require_abort_handling = true;
+        EmitReadMemoryMov<bitsize>(code, value_idx, src_ptr);
+    }
+    code.L(end);
+
+    if (require_abort_handling) {
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.call(wrapped_fn);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+    }
+
+    code.mov(tmp, qword[r15 + offsetof(A64JitState, exclusive_slot)]);
+    EmitWriteMemoryMov<bitsize>(code, tmp + ExclusiveMonitorFriend::slot_value_offset, value_idx);
+    EmitExclusiveUnlock(shard);
+
+    ctx.reg_alloc.DefineValue(inst, Xbyak::Reg64{value_idx});
+}
+
+template<std::size_t bitsize>
+void A64EmitX64::EmitExclusiveWriteMemoryInline(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const auto fastmem_marker = ShouldFastmem(ctx, inst);
+
+    // rax holds the expected value for cmpxchg
+    ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+    const Xbyak::Reg64 vaddr = ctx.reg_alloc.UseGpr(args[0]);
+    const int value_idx = ctx.reg_alloc.UseGpr(args[1]).getIdx();
+    const Xbyak::Reg32 status = ctx.reg_alloc.ScratchGpr().cvt32();
+    const Xbyak::Reg64 shard = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 tmp = ctx.reg_alloc.ScratchGpr();
+
+    const auto wrapped_fn = exclusive_write_fallbacks[std::make_tuple(bitsize, vaddr.getIdx(), value_idx)];
+
+    Xbyak::Label abort, unlock, end;
+    bool require_abort_handling = false;
+
+    code.mov(status, u32(1));
+    code.cmp(code.byte[r15 + offsetof(A64JitState, exclusive_state)], u8(0));
+    code.je(end, code.T_NEAR);
+    code.mov(code.byte[r15 + offsetof(A64JitState, exclusive_state)], u8(0));
+    EmitExclusiveLock(conf.global_monitor, shard, vaddr, tmp);
+    EmitExclusiveCheckAndClear(conf.global_monitor, shard, vaddr, tmp, rax, unlock);
+
+    code.mov(tmp, qword[r15 + offsetof(A64JitState, exclusive_slot)]);
+    EmitReadMemoryMov<bitsize>(code, rax.getIdx(), tmp + ExclusiveMonitorFriend::slot_value_offset);
+
+    if (fastmem_marker) {
+        const auto dest_ptr = EmitFastmemVAddr(code, ctx, abort, vaddr, require_abort_handling);
+        const auto location = EmitExclusiveWriteMemoryCmpxchg<bitsize>(code, dest_ptr, value_idx);
+        code.setnz(status.cvt8());
+
+        // A faulting cmpxchg resumes after the fallback call in far code, which converts its result.
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.call(wrapped_fn);
+        fastmem_patch_info.emplace(
+            Common::BitCast<u64>(location),
+            FastmemPatchInfo{
+                Common::BitCast<u64>(code.getCurr()),
+                Common::BitCast<u64>(wrapped_fn),
+                *fastmem_marker,
+            }
+        );
+    } else {
+        const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+        EmitExclusiveWriteMemoryCmpxchg<bitsize>(code, dest_ptr, value_idx);
+        code.setnz(status.cvt8());
+
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.call(wrapped_fn);
+    }
+    code.test(al, al);
+    code.setz(status.cvt8());
+    code.jmp(unlock, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    code.L(unlock);
+    EmitExclusiveUnlock(shard);
+    code.L(end);
+
+    ctx.reg_alloc.DefineValue(inst, status);
+}
+
 void A64EmitX64::EmitA64ExclusiveWriteMemory8(A64EmitContext& ctx, IR::Inst* inst) {
     EmitExclusiveWriteMemory<8, &A64::UserCallbacks::MemoryWriteExclusive8>(ctx, inst);
 }
@@ -1189,6 +1865,347 @@ void A64EmitX64::EmitA64ExclusiveWriteMemory128(A64EmitContext& ctx, IR::Inst* i
     EmitExclusiveWriteMemory<128, &A64::UserCallbacks::MemoryWriteExclusive128>(ctx, inst);
 }
 
+namespace {
+
+template<std::size_t bitsize>
+Xbyak::Address AtomicOperand(BlockOfCode& code, const Xbyak::RegExp& addr) {
+    switch (bitsize) {
+    case 8:
+        return code.byte[addr];
+    case 16:
+        return word[addr];
+    case 32:
+        return dword[addr];
+    case 64:
+        return qword[addr];
+    }
+    UNREACHABLE();
+}
+
+template<std::size_t bitsize>
+Xbyak::Reg AtomicOperand(Xbyak::Reg64 reg) {
+    switch (bitsize) {
+    case 8:
+        return reg.cvt8();
+    case 16:
+        return reg.cvt16();
+    case 32:
+        return reg.cvt32();
+    case 64:
+        return reg;
+    }
+    UNREACHABLE();
+}
+
+} // anonymous namespace
+
+template<std::size_t bitsize>
+void A64EmitX64::EmitAtomicMemoryOperation(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const auto op = static_cast<IR::AtomicOp>(args[2].GetImmediateU8());
+    const auto fastmem_marker = ShouldFastmem(ctx, inst);
+
+    const auto wrapped_fn = atomic_memory_operation_fallbacks[std::make_tuple(bitsize, op)];
+
+    ctx.reg_alloc.Use(args[0], ABI_PARAM2);
+    ctx.reg_alloc.Use(args[1], ABI_PARAM3);
+    ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+    const Xbyak::Reg64 vaddr = code.ABI_PARAM2;
+    const Xbyak::Reg64 value = code.ABI_PARAM3;
+
+    if (!conf.page_table && !fastmem_marker) {
+        code.call(wrapped_fn);
+        ctx.reg_alloc.DefineValue(inst, rax);
+        return;
+    }
+
+    const bool uses_cmpxchg_loop = op != IR::AtomicOp::Add && op != IR::AtomicOp::Swap;
+    const Xbyak::Reg64 tmp = uses_cmpxchg_loop ? ctx.reg_alloc.ScratchGpr() : rax;
+
+    Xbyak::Label abort, end;
+    bool require_abort_handling = false;
+
+    const Xbyak::RegExp addr = [&] {
+        if (fastmem_marker) {
+            return EmitFastmemVAddr(code, ctx, abort, vaddr, require_abort_handling);
+        }
+        require_abort_handling = true;
+        return EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+    }();
+
+    // Any of these accesses may fault. The fallback redoes the whole operation and resumes at end.
+    std::vector<const void*> locations;
+
+    switch (op) {
+    case IR::AtomicOp::Add:
+        code.mov(rax, value);
+        locations.emplace_back(code.getCurr());
+        code.lock();
+        code.xadd(AtomicOperand<bitsize>(code, addr), AtomicOperand<bitsize>(rax));
+        break;
+    case IR::AtomicOp::Swap:
+        code.mov(rax, value);
+        locations.emplace_back(code.getCurr());
+        code.xchg(AtomicOperand<bitsize>(code, addr), AtomicOperand<bitsize>(rax));
+        break;
+    default: {
+        Xbyak::Label loop;
+
+        locations.emplace_back(EmitReadMemoryMov<bitsize>(code, rax.getIdx(), addr));
+        code.L(loop);
+        switch (op) {
+        case IR::AtomicOp::Clear:
+            code.mov(tmp, value);
+            code.not_(tmp);
+            code.and_(tmp, rax);
+            break;
+        case IR::AtomicOp::Eor:
+            code.mov(tmp, rax);
+            code.xor_(tmp, value);
+            break;
+        case IR::AtomicOp::Set:
+            code.mov(tmp, rax);
+            code.or_(tmp, value);
+            break;
+        case IR::AtomicOp::SMax:
+            code.mov(tmp, value);
+            code.cmp(AtomicOperand<bitsize>(rax), AtomicOperand<bitsize>(value));
+            code.cmovg(tmp, rax);
+            break;
+        case IR::AtomicOp::SMin:
+            code.mov(tmp, value);
+            code.cmp(AtomicOperand<bitsize>(rax), AtomicOperand<bitsize>(value));
+            code.cmovl(tmp, rax);
+            break;
+        case IR::AtomicOp::UMax:
+            code.mov(tmp, value);
+            code.cmp(AtomicOperand<bitsize>(rax), AtomicOperand<bitsize>(value));
+            code.cmova(tmp, rax);
+            break;
+        case IR::AtomicOp::UMin:
+            code.mov(tmp, value);
+            code.cmp(AtomicOperand<bitsize>(rax), AtomicOperand<bitsize>(value));
+            code.cmovb(tmp, rax);
+            break;
+        default:
+            UNREACHABLE();
+        }
+        locations.emplace_back(EmitExclusiveWriteMemoryCmpxchg<bitsize>(code, addr, tmp.getIdx()));
+        code.jnz(loop);
+        break;
+    }
+    }
+    code.L(end);
+
+    if (fastmem_marker) {
+        for (const void* location : locations) {
+            fastmem_patch_info.emplace(
+                Common::BitCast<u64>(location),
+                FastmemPatchInfo{
+                    Common::BitCast<u64>(code.getCurr()),
+                    Common::BitCast<u64>(wrapped_fn),
+                    *fastmem_marker,
+                }
+            );
+        }
+    }
+
+    if (require_abort_handling) {
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.call(wrapped_fn);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+    }
+
+    if constexpr (bitsize == 8) {
+        code.movzx(eax, al);
+    } else if constexpr (bitsize == 16) {
+        code.movzx(eax, ax);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, rax);
+}
+
+void A64EmitX64::EmitA64AtomicMemoryOperation8(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitAtomicMemoryOperation<8>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64AtomicMemoryOperation16(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitAtomicMemoryOperation<16>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64AtomicMemoryOperation32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitAtomicMemoryOperation<32>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64AtomicMemoryOperation64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitAtomicMemoryOperation<64>(ctx, inst);
+}
+
+template<std::size_t bitsize>
+void A64EmitX64::EmitCompareAndSwapMemory(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const auto fastmem_marker = ShouldFastmem(ctx, inst);
+
+    const auto wrapped_fn = compare_and_swap_fallbacks[bitsize];
+
+    // rax holds the expected value for cmpxchg
+    ctx.reg_alloc.Use(args[0], ABI_PARAM2);
+    ctx.reg_alloc.UseScratch(args[1], HostLoc::RAX);
+    ctx.reg_alloc.Use(args[2], ABI_PARAM3);
+    const Xbyak::Reg64 vaddr = code.ABI_PARAM2;
+    const Xbyak::Reg64 desired = code.ABI_PARAM3;
+
+    if (!conf.page_table && !fastmem_marker) {
+        code.call(wrapped_fn);
+        ctx.reg_alloc.DefineValue(inst, rax);
+        return;
+    }
+
+    Xbyak::Label abort, end;
+    bool require_abort_handling = false;
+
+    if (fastmem_marker) {
+        const auto dest_ptr = EmitFastmemVAddr(code, ctx, abort, vaddr, require_abort_handling);
+        const auto location = EmitExclusiveWriteMemoryCmpxchg<bitsize>(code, dest_ptr, desired.getIdx());
+
+        fastmem_patch_info.emplace(
+            Common::BitCast<u64>(location),
+            FastmemPatchInfo{
+                Common::BitCast<u64>(code.getCurr()),
+                Common::BitCast<u64>(wrapped_fn),
+                *fastmem_marker,
+            }
+        );
+    } else {
+        const auto dest_ptr = EmitVAddrLookup(code, ctx, bitsize, abort, vaddr);
+        require_abort_handling = true;
+        EmitExclusiveWriteMemoryCmpxchg<bitsize>(code, dest_ptr, desired.getIdx());
+    }
+    code.L(end);
+
+    if (require_abort_handling) {
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.call(wrapped_fn);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+    }
+
+    if constexpr (bitsize == 8) {
+        code.movzx(eax, al);
+    } else if constexpr (bitsize == 16) {
+        code.movzx(eax, ax);
+    }
+
+    ctx.reg_alloc.DefineValue(inst, rax);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory8(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareAndSwapMemory<8>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory16(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareAndSwapMemory<16>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory32(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareAndSwapMemory<32>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory64(A64EmitContext& ctx, IR::Inst* inst) {
+    EmitCompareAndSwapMemory<64>(ctx, inst);
+}
+
+void A64EmitX64::EmitA64CompareAndSwapMemory128(A64EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const auto fastmem_marker = ShouldFastmem(ctx, inst);
+
+    const auto wrapped_fn = compare_and_swap_fallbacks[128];
+
+    // cmpxchg16b compares rdx:rax and conditionally stores rcx:rbx
+    ctx.reg_alloc.Use(args[0], HostLoc::RSI);
+    const Xbyak::Xmm expected = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm desired = ctx.reg_alloc.UseXmm(args[2]);
+    ctx.reg_alloc.ScratchGpr(HostLoc::RAX);
+    ctx.reg_alloc.ScratchGpr(HostLoc::RDX);
+    ctx.reg_alloc.ScratchGpr(HostLoc::RBX);
+    ctx.reg_alloc.ScratchGpr(HostLoc::RCX);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = code.HasSSE41() ? result : ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg64 vaddr = rsi;
+
+    const auto split = [&](Xbyak::Reg64 lo, Xbyak::Reg64 hi, Xbyak::Xmm value) {
+        code.movq(lo, value);
+        if (code.HasSSE41()) {
+            code.pextrq(hi, value, 1);
+        } else {
+            code.movaps(tmp, value);
+            code.punpckhqdq(tmp, tmp);
+            code.movq(hi, tmp);
+        }
+    };
+    // rbx may hold a pinned guest register.
+    PinnedRegisters clobbered_pinned_registers;
+    std::copy_if(pinned_registers.begin(), pinned_registers.end(), std::back_inserter(clobbered_pinned_registers),
+                 [](const auto& pinned) { return pinned.second == HostLoc::RBX; });
+    EmitSpillPinnedRegisters(code, clobbered_pinned_registers);
+
+    split(rax, rdx, expected);
+    split(rbx, rcx, desired);
+
+    if (!conf.page_table && !fastmem_marker) {
+        code.call(wrapped_fn);
+    } else {
+        Xbyak::Label abort, end;
+        bool require_abort_handling = true;
+
+        // cmpxchg16b requires its operand to be 16-byte aligned.
+        code.test(vaddr, 0b1111);
+        code.jnz(abort, code.T_NEAR);
+
+        if (fastmem_marker) {
+            const auto dest_ptr = EmitFastmemVAddr(code, ctx, abort, vaddr, require_abort_handling);
+            const void* location = code.getCurr();
+            code.lock();
+            code.cmpxchg16b(ptr[dest_ptr]);
+
+            fastmem_patch_info.emplace(
+                Common::BitCast<u64>(location),
+                FastmemPatchInfo{
+                    Common::BitCast<u64>(code.getCurr()),
+                    Common::BitCast<u64>(wrapped_fn),
+                    *fastmem_marker,
+                }
+            );
+        } else {
+            const auto dest_ptr = EmitVAddrLookup(code, ctx, 128, abort, vaddr);
+            code.lock();
+            code.cmpxchg16b(ptr[dest_ptr]);
+        }
+        code.L(end);
+
+        code.SwitchToFarCode();
+        code.L(abort);
+        code.call(wrapped_fn);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+    }
+
+    code.movq(result, rax);
+    if (code.HasSSE41()) {
+        code.pinsrq(result, rdx, 1);
+    } else {
+        code.movq(tmp, rdx);
+        code.punpcklqdq(result, tmp);
+    }
+
+    EmitFillPinnedRegisters(code, clobbered_pinned_registers);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 std::string A64EmitX64::LocationDescriptorToFriendlyName(const IR::LocationDescriptor& ir_descriptor) const {
     const A64::LocationDescriptor descriptor{ir_descriptor};
     return fmt::format("a64_{:016X}_fpcr{:08X}",
@@ -1198,12 +2215,14 @@ std::string A64EmitX64::LocationDescriptorToFriendlyName(const IR::LocationDescr
 
 void A64EmitX64::EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDescriptor, bool) {
     code.SwitchMxcsrOnExit();
+    EmitSpillPinnedRegisters(code, pinned_registers);
     Devirtualize<&A64::UserCallbacks::InterpreterFallback>(conf.callbacks).EmitCall(code,
         [&](RegList param) {
             code.mov(param[0], A64::LocationDescriptor{terminal.next}.PC());
             code.mov(qword[r15 + offsetof(A64JitState, pc)], param[0]);
             code.mov(param[1].cvt32(), terminal.num_instructions);
         });
+    EmitFillPinnedRegisters(code, pinned_registers);
     code.ReturnFromRunCode(true); // TODO: Check cycles
 }
 
@@ -1273,7 +2292,7 @@ void A64EmitX64::EmitTerminalImpl(IR::Term::If terminal, IR::LocationDescriptor
         EmitTerminal(terminal.then_, initial_location, is_single_step);
         break;
     default:
-        Xbyak::Label pass = EmitCond(terminal.if_);
+        Xbyak::Label pass = EmitCond(terminal.if_, std::exchange(nzcv_in_host_flags_at_terminal, false));
         EmitTerminal(terminal.else_, initial_location, is_single_step);
         code.L(pass);
         EmitTerminal(terminal.then_, initial_location, is_single_step);
@@ -6,8 +6,15 @@
 #pragma once
 
 #include <array>
+#include <deque>
 #include <map>
+#include <optional>
+#include <set>
 #include <tuple>
+#include <utility>
+#include <vector>
+
+#include <tsl/robin_map.h>
 
 #include <dynarmic/A64/a64.h>
 #include <dynarmic/A64/config.h>
@@ -16,6 +23,8 @@
 #include "backend/x64/block_range_information.h"
 #include "backend/x64/emit_x64.h"
 #include "frontend/A64/location_descriptor.h"
+#include "frontend/A64/types.h"
+#include "frontend/ir/atomic_op.h"
 #include "frontend/ir/terminal.h"
 
 namespace Dynarmic::Backend::X64 {
@@ -38,27 +47,54 @@ struct A64EmitContext final : public EmitContext {
 
 class A64EmitX64 final : public EmitX64 {
 public:
-    A64EmitX64(BlockOfCode& code, A64::UserConfig conf, A64::Jit* jit_interface);
+    A64EmitX64(BlockOfCode& code, A64::UserConfig conf);
     ~A64EmitX64() override;
 
     /**
      * Emit host machine code for a basic block with intermediate representation `block`.
+     * First tier blocks count their executions and return to the dispatcher once they are hot.
+     * Emitting a block that is not first tier replaces any first tier block at the same location.
      * @note block is modified.
      */
-    BlockDescriptor Emit(IR::Block& block);
+    BlockDescriptor Emit(IR::Block& block, bool first_tier = false);
+
+    /// Returns true if the block at descriptor is a first tier block which has become hot.
+    bool IsHot(IR::LocationDescriptor descriptor) const;
+    /// Restarts the execution count of the first tier block at descriptor.
+    void ResetExecutionCount(IR::LocationDescriptor descriptor);
 
     void ClearCache() override;
 
+    void InvalidateBasicBlocks(const tsl::robin_set<IR::LocationDescriptor>& locations) override;
+
+    void EvictOldestSegment() override;
+
     void InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges);
 
-    void ChangeProcessorID(size_t value) {
-        conf.processor_id = value;
-    }
+    /// Guest registers held in callee-saved host registers across blocks, as selected by
+    /// UserConfig::pinned_gpr_mask.
+    using PinnedRegisters = std::vector<std::pair<A64::Reg, HostLoc>>;
+    static PinnedRegisters GetPinnedRegisters(const A64::UserConfig& conf);
+    /// Writes pinned registers back to the A64JitState.
+    static void EmitSpillPinnedRegisters(BlockOfCode& code, const PinnedRegisters& pinned);
+    /// Reloads pinned registers from the A64JitState.
+    static void EmitFillPinnedRegisters(BlockOfCode& code, const PinnedRegisters& pinned);
 
 protected:
     A64::UserConfig conf;
-    A64::Jit* jit_interface;
     BlockRangeInformation<u64> block_ranges;
+    const PinnedRegisters pinned_registers;
+    std::optional<Xbyak::Reg64> PinnedRegister(A64::Reg reg) const;
+
+    /// Execution counters of first tier blocks. Their addresses are stable until the cache is cleared.
+    /// Counters of invalidated blocks are reused. Stale code that still refers to one can at worst
+    /// make the block that reuses it hot early.
+    std::deque<s64> execution_counters;
+    std::vector<s64*> free_execution_counters;
+    tsl::robin_map<IR::LocationDescriptor, s64*> first_tier_blocks;
+
+    /// Set while emitting a block's If terminal if the guest NZCV flags are still in the host flags.
+    bool nzcv_in_host_flags_at_terminal = false;
 
     struct FastDispatchEntry {
         u64 location_descriptor = 0xFFFF'FFFF'FFFF'FFFFull;
@@ -76,21 +112,34 @@ protected:
 
     std::map<std::tuple<size_t, int, int>, void(*)()> read_fallbacks;
     std::map<std::tuple<size_t, int, int>, void(*)()> write_fallbacks;
+    std::map<std::tuple<size_t, int, int>, void(*)()> exclusive_write_fallbacks;
     void GenFastmemFallbacks();
 
+    std::map<std::tuple<size_t, IR::AtomicOp>, void(*)()> atomic_memory_operation_fallbacks;
+    std::map<size_t, void(*)()> compare_and_swap_fallbacks;
+    void GenAtomicFallbacks();
+
     const void* terminal_handler_pop_rsb_hint;
     const void* terminal_handler_fast_dispatch_hint = nullptr;
     FastDispatchEntry& (*fast_dispatch_table_lookup)(u64) = nullptr;
     void GenTerminalHandlers();
 
-    template<std::size_t bitsize>
-    void EmitDirectPageTableMemoryRead(A64EmitContext& ctx, IR::Inst* inst);
-    template<std::size_t bitsize>
-    void EmitDirectPageTableMemoryWrite(A64EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize, auto callback>
+    void EmitMemoryRead(A64EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize, auto callback>
+    void EmitMemoryWrite(A64EmitContext& ctx, IR::Inst* inst);
     template<std::size_t bitsize, auto callback>
     void EmitExclusiveReadMemory(A64EmitContext& ctx, IR::Inst* inst);
     template<std::size_t bitsize, auto callback>
     void EmitExclusiveWriteMemory(A64EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize>
+    void EmitExclusiveReadMemoryInline(A64EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize>
+    void EmitExclusiveWriteMemoryInline(A64EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize>
+    void EmitAtomicMemoryOperation(A64EmitContext& ctx, IR::Inst* inst);
+    template<std::size_t bitsize>
+    void EmitCompareAndSwapMemory(A64EmitContext& ctx, IR::Inst* inst);
 
     // Microinstruction emitters
     void EmitPushRSB(EmitContext& ctx, IR::Inst* inst);
@@ -105,6 +154,19 @@ protected:
     // Helpers
     std::string LocationDescriptorToFriendlyName(const IR::LocationDescriptor&) const override;
 
+    // Fastmem information
+    using DoNotFastmemMarker = std::tuple<IR::LocationDescriptor, std::ptrdiff_t>;
+    struct FastmemPatchInfo {
+        u64 resume_rip;
+        u64 callback;
+        DoNotFastmemMarker marker;
+    };
+    tsl::robin_map<u64, FastmemPatchInfo> fastmem_patch_info;
+    std::set<DoNotFastmemMarker> do_not_fastmem;
+    std::optional<DoNotFastmemMarker> ShouldFastmem(A64EmitContext& ctx, IR::Inst* inst) const;
+    bool ShouldInlineExclusiveAccess(A64EmitContext& ctx, IR::Inst* inst) const;
+    FakeCall FastmemCallback(u64 rip);
+
     // Terminal instruction emitters
     void EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDescriptor initial_location, bool is_single_step) override;
     void EmitTerminalImpl(IR::Term::ReturnToDispatch terminal, IR::LocationDescriptor initial_location, bool is_single_step) override;
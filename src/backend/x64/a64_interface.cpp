@@ -3,17 +3,27 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
 
 #include <boost/icl/interval_set.hpp>
 #include <dynarmic/A64/a64.h>
 
 #include "backend/x64/a64_emit_x64.h"
 #include "backend/x64/a64_jitstate.h"
+#include "backend/x64/background_compiler.h"
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/devirtualize.h"
+#include "backend/x64/exclusive_monitor_friend.h"
 #include "backend/x64/jitstate_info.h"
+#include "backend/x64/shared_code_cache_friend.h"
+#include "backend/x64/translation_cache_friend.h"
 #include "common/assert.h"
 #include "common/llvm_disassemble.h"
 #include "common/scope_exit.h"
@@ -38,26 +48,69 @@ static std::function<void(BlockOfCode&)> GenRCP(const A64::UserConfig& conf) {
         if (conf.page_table) {
             code.mov(code.r14, Common::BitCast<u64>(conf.page_table));
         }
+        if (conf.fastmem_pointer) {
+            code.mov(code.r13, Common::BitCast<u64>(conf.fastmem_pointer));
+        }
+        A64EmitX64::EmitFillPinnedRegisters(code, A64EmitX64::GetPinnedRegisters(conf));
+    };
+}
+
+static std::function<void(BlockOfCode&)> GenRCE(const A64::UserConfig& conf) {
+    return [conf](BlockOfCode& code) {
+        A64EmitX64::EmitSpillPinnedRegisters(code, A64EmitX64::GetPinnedRegisters(conf));
     };
 }
 
+/// Covers the configuration which affects the IR stored in a TranslationCache.
+static u64 GenTranslationCacheConfigHash(const A64::UserConfig& conf) {
+    return TranslationCacheFriend::HashConfig({
+        64,
+        conf.define_unpredictable_behaviour,
+        conf.wall_clock_cntpct,
+        conf.hook_data_cache_operations,
+        conf.dczid_el0,
+        conf.HasOptimization(OptimizationFlag::GetSetElimination),
+        conf.HasOptimization(OptimizationFlag::ConstProp),
+        conf.HasOptimization(OptimizationFlag::BranchFollowing),
+    });
+}
+
 struct Jit::Impl final {
 public:
     Impl(Jit* jit, UserConfig conf)
         : conf(conf)
-        , block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this), JitStateInfo{jit_state}, GenRCP(conf))
-        , emitter(block_of_code, conf, jit)
+        , jit_interface(jit)
+        , code_cache(MakeCodeCache(conf))
+        , block_of_code(code_cache->block_of_code)
+        , emitter(code_cache->emitter)
+        , translation_cache_config_hash(GenTranslationCacheConfigHash(conf))
     {
         ASSERT(conf.page_table_address_space_bits >= 12 && conf.page_table_address_space_bits <= 64);
+        ASSERT(conf.fastmem_address_space_bits >= 12 && conf.fastmem_address_space_bits <= 64);
+
+        SetJitStateIdentity();
+
+        {
+            std::lock_guard lock{code_cache->mutex};
+            code_cache->jits.push_back(this);
+        }
+
+        if (conf.background_compilation) {
+            background_compiler = std::make_unique<BackgroundCompiler>([this](IR::LocationDescriptor location) { return LookupOrTranslateBlock(location); });
+        }
     }
 
-    ~Impl() = default;
+    ~Impl() {
+        std::lock_guard lock{code_cache->mutex};
+        auto& jits = code_cache->jits;
+        jits.erase(std::remove(jits.begin(), jits.end(), this), jits.end());
+    }
 
     void Run() {
         ASSERT(!is_executing);
-        is_executing = true;
-        SCOPE_EXIT { this->is_executing = false; };
         jit_state.halt_requested = false;
+        BeginExecution();
+        SCOPE_EXIT { this->EndExecution(); };
 
         // TODO: Check code alignment
 
@@ -72,19 +125,15 @@ public:
             return GetCurrentBlock();
         }();
         block_of_code.RunCode(&jit_state, current_code_ptr);
-
-        PerformRequestedCacheInvalidation();
     }
 
     void Step() {
         ASSERT(!is_executing);
-        is_executing = true;
-        SCOPE_EXIT { this->is_executing = false; };
         jit_state.halt_requested = true;
+        BeginExecution();
+        SCOPE_EXIT { this->EndExecution(); };
 
         block_of_code.StepCode(&jit_state, GetCurrentSingleStep());
-
-        PerformRequestedCacheInvalidation();
     }
 
     void ExceptionalExit() {
@@ -92,30 +141,36 @@ public:
             const s64 ticks = jit_state.cycles_to_run - jit_state.cycles_remaining;
             conf.callbacks->AddTicks(ticks);
         }
-        PerformRequestedCacheInvalidation();
-        is_executing = false;
+        EndExecution();
     }
 
     void ChangeProcessorID(size_t value) {
         conf.processor_id = value;
-        emitter.ChangeProcessorID(value);
+        SetJitStateIdentity();
     }
 
     void ClearCache() {
-        invalidate_entire_cache = true;
-        RequestCacheInvalidation();
+        {
+            std::lock_guard lock{code_cache->mutex};
+            code_cache->invalidate_entire_cache = true;
+        }
+        RequestCacheOperations();
     }
 
     void InvalidateCacheRange(u64 start_address, size_t length) {
         const auto end_address = static_cast<u64>(start_address + length - 1);
         const auto range = boost::icl::discrete_interval<u64>::closed(start_address, end_address);
-        invalid_cache_ranges.add(range);
-        RequestCacheInvalidation();
+        {
+            std::lock_guard lock{code_cache->mutex};
+            code_cache->invalid_cache_ranges.add(range);
+        }
+        RequestCacheOperations();
     }
 
     void Reset() {
         ASSERT(!is_executing);
         jit_state = {};
+        SetJitStateIdentity();
     }
 
     void HaltExecution() {
@@ -211,14 +266,121 @@ public:
         return is_executing;
     }
 
+    CodeCacheStatistics GetCodeCacheStatistics() const {
+        return emitter.GetStatistics();
+    }
+
     std::string Disassemble() const {
         return Common::DisassembleX64(block_of_code.GetCodeBegin(), block_of_code.getCurr());
     }
 
 private:
-    static CodePtr GetCurrentBlockThunk(void* thisptr) {
-        Jit::Impl* this_ = static_cast<Jit::Impl*>(thisptr);
-        return this_->GetCurrentBlock();
+    /// Emitted code, and the state required to manage it. This is shared by all Jits
+    /// attached to the same SharedCodeCache.
+    struct CodeCache {
+        explicit CodeCache(const UserConfig& conf)
+            : block_of_code(GenRunCodeCallbacks(conf.callbacks, &GetCurrentBlockThunk, this), JitStateInfo{A64JitState{}}, conf.code_cache_size, conf.far_code_offset, conf.constant_pool_size, GenRCP(conf), GenRCE(conf))
+            , emitter(block_of_code, conf)
+        {}
+
+        /// Must only be called while holding mutex.
+        bool OperationsRequested() const {
+            return invalidate_entire_cache || evict_oldest_segment || !invalid_cache_ranges.empty();
+        }
+
+        BlockOfCode block_of_code;
+        A64EmitX64 emitter;
+
+        /// Held shared by each Jit executing emitted code. Held exclusively to perform operations
+        /// which require that no emitted code is executing.
+        std::shared_mutex execution_mutex;
+
+        /// Protects the members below.
+        std::mutex mutex;
+        std::vector<Jit::Impl*> executing_jits;
+        std::vector<Jit::Impl*> jits;
+        // Operations requested while emitted code may be executing are queued up here.
+        bool invalidate_entire_cache = false;
+        bool evict_oldest_segment = false;
+        boost::icl::interval_set<u64> invalid_cache_ranges;
+    };
+
+    static std::shared_ptr<CodeCache> MakeCodeCache(const UserConfig& conf) {
+        const auto make_code_cache = [&] { return std::make_shared<CodeCache>(conf); };
+        if (conf.shared_code_cache) {
+            return SharedCodeCacheFriend::GetOrCreate<CodeCache>(*conf.shared_code_cache, make_code_cache);
+        }
+        return make_code_cache();
+    }
+
+    static CodePtr GetCurrentBlockThunk(void*) {
+        return current_jit->GetCurrentBlock();
+    }
+
+    /// The Jit executing emitted code on this thread.
+    static inline thread_local Jit::Impl* current_jit = nullptr;
+
+    /// Identifies this Jit and its processor to emitted code, which reads these at runtime.
+    void SetJitStateIdentity() {
+        jit_state.jit_interface = jit_interface;
+        jit_state.processor_id = conf.processor_id;
+        if (conf.global_monitor && conf.processor_id < conf.global_monitor->GetProcessorCount()) {
+            jit_state.exclusive_slot = ExclusiveMonitorFriend::SlotPointer(conf.global_monitor, conf.processor_id);
+            jit_state.exclusive_processor_mask = conf.processor_id < ExclusiveMonitorFriend::max_inline_processor_count ? u64(1) << conf.processor_id : 0;
+        }
+    }
+
+    void BeginExecution() {
+        previous_jit = std::exchange(current_jit, this);
+
+        // Opportunistically apply patches deferred while other Jits sharing the code cache were executing.
+        {
+            std::unique_lock execution_lock{code_cache->execution_mutex, std::try_to_lock};
+            if (execution_lock) {
+                PerformRequestedCacheOperations();
+            }
+        }
+
+        while (true) {
+            code_cache->execution_mutex.lock_shared();
+            {
+                std::lock_guard lock{code_cache->mutex};
+                if (!code_cache->OperationsRequested()) {
+                    code_cache->executing_jits.push_back(this);
+                    break;
+                }
+            }
+            code_cache->execution_mutex.unlock_shared();
+
+            // Executing Jits have been asked to halt, after which the requested operations are performed.
+            std::lock_guard execution_lock{code_cache->execution_mutex};
+            PerformRequestedCacheOperations();
+        }
+        is_executing = true;
+    }
+
+    void EndExecution() {
+        if (!is_executing) {
+            return;
+        }
+
+        is_executing = false;
+        {
+            std::lock_guard lock{code_cache->mutex};
+            auto& executing_jits = code_cache->executing_jits;
+            executing_jits.erase(std::remove(executing_jits.begin(), executing_jits.end(), this), executing_jits.end());
+        }
+        code_cache->execution_mutex.unlock_shared();
+
+        // If this fails, another Jit is executing and performs requested operations once it stops.
+        {
+            std::unique_lock execution_lock{code_cache->execution_mutex, std::try_to_lock};
+            if (execution_lock) {
+                PerformRequestedCacheOperations();
+            }
+        }
+
+        current_jit = previous_jit;
     }
 
     IR::LocationDescriptor GetCurrentLocation() const {
@@ -226,28 +388,118 @@ private:
     }
 
     CodePtr GetCurrentBlock() {
+        std::lock_guard lock{emitter.CodeMutex()};
         return GetBlock(GetCurrentLocation());
     }
 
     CodePtr GetCurrentSingleStep() {
+        std::lock_guard lock{emitter.CodeMutex()};
         return GetBlock(A64::LocationDescriptor{GetCurrentLocation()}.SetSingleStepping(true));
     }
 
+    /// Must only be called while holding the emitter's CodeMutex.
     CodePtr GetBlock(IR::LocationDescriptor current_location) {
-        if (auto block = emitter.GetBasicBlock(current_location))
+        const bool single_stepping = A64::LocationDescriptor{current_location}.SingleStepping();
+        const bool first_tier = conf.tiering_threshold != 0 && !single_stepping;
+
+        const auto block = emitter.GetBasicBlock(current_location);
+        const bool promote = block && emitter.IsHot(current_location);
+        if (block && !promote) {
             return block->entrypoint;
+        }
 
-        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
-        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
-            // Immediately evacuate cache
-            invalidate_entire_cache = true;
-            PerformRequestedCacheInvalidation();
+        std::optional<IR::Block> ir_block;
+        if (background_compiler && !single_stepping && (promote || !first_tier)) {
+            ir_block = background_compiler->Take(current_location);
+            if (!ir_block) {
+                if (promote) {
+                    background_compiler->Request(current_location);
+                    // Keep executing the first tier block until this block has been translated.
+                    emitter.ResetExecutionCount(current_location);
+                    return block->entrypoint;
+                }
+                // Make progress one instruction at a time until this block has been translated.
+                background_compiler->RequestWhileStepping(current_location, A64::LocationDescriptor{current_location}.PC());
+                return GetBlock(A64::LocationDescriptor{current_location}.SetSingleStepping(true));
+            }
+        }
+
+        if (block_of_code.SpaceRemaining() < BlockOfCode::MINIMUM_REMAINING_CODESIZE) {
+            if (conf.shared_code_cache) {
+                // Other Jits may be executing code in the oldest segment, so it is evicted once all have stopped.
+                {
+                    std::lock_guard lock{code_cache->mutex};
+                    code_cache->evict_oldest_segment = true;
+                }
+                RequestCacheOperations();
+                return block_of_code.GetForceReturnFromRunCodeAddress();
+            }
+            EvictOldestCodeSegment();
+        }
+
+        if (first_tier && !promote) {
+            // A block which was optimised before, possibly by another Jit, has no need for a first tier.
+            ir_block = LookupCachedBlock(current_location);
+            if (!ir_block) {
+                IR::Block first_tier_block = TranslateFirstTierBlock(current_location);
+                Optimization::VerificationPass(first_tier_block);
+                return emitter.Emit(first_tier_block, true).entrypoint;
+            }
         }
 
         // JIT Compile
+        if (!ir_block) {
+            ir_block = LookupOrTranslateBlock(current_location);
+        }
+
+        // This pass reads guest memory beyond the block, so its results are not cached.
+        if (conf.HasOptimization(OptimizationFlag::MiscIROpt)) {
+            Optimization::A64MergeInterpretBlocksPass(*ir_block, conf.callbacks);
+        }
+        Optimization::VerificationPass(*ir_block);
+        return emitter.Emit(*ir_block).entrypoint;
+    }
+
+    /// Retrieves a block from the translation cache, translating it if it is not present.
+    /// When background compilation is enabled, this is called from the compilation thread.
+    IR::Block LookupOrTranslateBlock(IR::LocationDescriptor current_location) {
+        if (auto cached_block = LookupCachedBlock(current_location)) {
+            return std::move(*cached_block);
+        }
+        return TranslateBlock(current_location);
+    }
+
+    /// Retrieves a block from the translation cache, if there is one and the block is present.
+    std::optional<IR::Block> LookupCachedBlock(IR::LocationDescriptor current_location) {
+        if (!conf.translation_cache) {
+            return std::nullopt;
+        }
+        const auto read_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
+        return TranslationCacheFriend::Lookup(*conf.translation_cache, translation_cache_config_hash, current_location, read_code);
+    }
+
+    /// Translates a block with only the passes required for correctness. Such blocks are not
+    /// stored in the translation cache, as they are recompiled once they are hot.
+    IR::Block TranslateFirstTierBlock(IR::LocationDescriptor current_location) {
         const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
-        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code,
-                                                {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
+        const A64::TranslationOptions options{conf.define_unpredictable_behaviour, conf.wall_clock_cntpct};
+        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code, options);
+        Optimization::A64CallbackConfigPass(ir_block, conf);
+        return ir_block;
+    }
+
+    /// Translates a block and applies the optimizations which only depend on guest code and configuration.
+    IR::Block TranslateBlock(IR::LocationDescriptor current_location) {
+        const u64 generation = conf.translation_cache ? TranslationCacheFriend::Generation(*conf.translation_cache) : 0;
+        TranslationCacheFriend::TranslatedCode code;
+        const auto get_code = [&](u64 vaddr) {
+            const u32 word = conf.callbacks->MemoryReadCode(vaddr);
+            TranslationCacheFriend::AddCodeWord(code, vaddr, word);
+            return word;
+        };
+        A64::TranslationOptions options{conf.define_unpredictable_behaviour, conf.wall_clock_cntpct};
+        options.follow_direct_branches = conf.HasOptimization(OptimizationFlag::BranchFollowing);
+        IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code, options);
         Optimization::A64CallbackConfigPass(ir_block, conf);
         if (conf.HasOptimization(OptimizationFlag::GetSetElimination)) {
             Optimization::A64GetSetElimination(ir_block);
@@ -257,47 +509,99 @@ private:
             Optimization::ConstantPropagation(ir_block);
             Optimization::DeadCodeElimination(ir_block);
         }
-        if (conf.HasOptimization(OptimizationFlag::MiscIROpt)) {
-            Optimization::A64MergeInterpretBlocksPass(ir_block, conf.callbacks);
+
+        if (conf.translation_cache) {
+            TranslationCacheFriend::Insert(*conf.translation_cache, translation_cache_config_hash, ir_block, code, generation);
         }
-        Optimization::VerificationPass(ir_block);
-        return emitter.Emit(ir_block).entrypoint;
+        return ir_block;
     }
 
-    void RequestCacheInvalidation() {
-        if (is_executing) {
-            jit_state.halt_requested = true;
-            return;
+    /// Must only be called while no emitted code is executing, except for that of this Jit if
+    /// it does not share its code cache.
+    void EvictOldestCodeSegment() {
+        emitter.EvictOldestSegment();
+
+        // Return stack buffers may refer to evicted code.
+        std::lock_guard lock{code_cache->mutex};
+        for (Jit::Impl* jit : code_cache->jits) {
+            jit->jit_state.ResetRSB();
         }
+    }
 
-        PerformRequestedCacheInvalidation();
+    void RequestCacheOperations() {
+        {
+            std::lock_guard lock{code_cache->mutex};
+            if (!code_cache->executing_jits.empty()) {
+                // Jits sharing the code cache, possibly including this one, are executing.
+                // The operations are performed once all of them have stopped.
+                for (Jit::Impl* jit : code_cache->executing_jits) {
+                    jit->HaltExecution();
+                }
+                return;
+            }
+        }
+
+        // If this fails, another Jit is starting or stopping execution and performs the operations.
+        std::unique_lock execution_lock{code_cache->execution_mutex, std::try_to_lock};
+        if (execution_lock) {
+            PerformRequestedCacheOperations();
+        }
     }
 
-    void PerformRequestedCacheInvalidation() {
-        if (!invalidate_entire_cache && invalid_cache_ranges.empty()) {
-            return;
+    /// Must only be called while holding the code cache's execution_mutex exclusively.
+    void PerformRequestedCacheOperations() {
+        std::lock_guard code_lock{emitter.CodeMutex()};
+
+        bool invalidate_entire_cache;
+        bool evict_oldest_segment;
+        boost::icl::interval_set<u64> invalid_cache_ranges;
+        {
+            std::lock_guard lock{code_cache->mutex};
+            invalidate_entire_cache = std::exchange(code_cache->invalidate_entire_cache, false);
+            evict_oldest_segment = std::exchange(code_cache->evict_oldest_segment, false);
+            invalid_cache_ranges = std::exchange(code_cache->invalid_cache_ranges, {});
+
+            if (invalidate_entire_cache || !invalid_cache_ranges.empty()) {
+                // No Jit sharing the code cache is executing, so their state may be reset here.
+                for (Jit::Impl* jit : code_cache->jits) {
+                    jit->jit_state.ResetRSB();
+                    if (jit->background_compiler) {
+                        jit->background_compiler->Discard();
+                    }
+                }
+            }
         }
 
-        jit_state.ResetRSB();
+        if (conf.translation_cache) {
+            TranslationCacheFriend::InvalidateRanges(*conf.translation_cache, invalid_cache_ranges);
+        }
         if (invalidate_entire_cache) {
             block_of_code.ClearCache();
             emitter.ClearCache();
         } else {
-            emitter.InvalidateCacheRanges(invalid_cache_ranges);
+            if (evict_oldest_segment) {
+                EvictOldestCodeSegment();
+            }
+            if (!invalid_cache_ranges.empty()) {
+                emitter.InvalidateCacheRanges(invalid_cache_ranges);
+            }
         }
-        invalid_cache_ranges.clear();
-        invalidate_entire_cache = false;
+        emitter.ApplyDeferredPatches();
     }
 
     bool is_executing = false;
+    Jit::Impl* previous_jit = nullptr;
 
     UserConfig conf;
+    Jit* jit_interface;
     A64JitState jit_state;
-    BlockOfCode block_of_code;
-    A64EmitX64 emitter;
+    std::shared_ptr<CodeCache> code_cache;
+    BlockOfCode& block_of_code;
+    A64EmitX64& emitter;
+    const u64 translation_cache_config_hash;
 
-    bool invalidate_entire_cache = false;
-    boost::icl::interval_set<u64> invalid_cache_ranges;
+    // Declared last so that the compilation thread is stopped before anything it uses is destroyed.
+    std::unique_ptr<BackgroundCompiler> background_compiler;
 };
 
 Jit::Jit(UserConfig conf)
@@ -417,6 +721,10 @@ bool Jit::IsExecuting() const {
     return impl->IsExecuting();
 }
 
+CodeCacheStatistics Jit::GetCodeCacheStatistics() const {
+    return impl->GetCodeCacheStatistics();
+}
+
 std::string Jit::Disassemble() const {
     return impl->Disassemble();
 }
@@ -13,6 +13,10 @@
 #include "common/common_types.h"
 #include "frontend/A64/location_descriptor.h"
 
+namespace Dynarmic::A64 {
+class Jit;
+} // namespace Dynarmic::A64
+
 namespace Dynarmic::Backend::X64 {
 
 class BlockOfCode;
@@ -62,6 +66,14 @@ struct A64JitState {
     static constexpr u64 RESERVATION_GRANULE_MASK = 0xFFFF'FFFF'FFFF'FFF0ull;
     u8 exclusive_state = 0;
 
+    // The Jit executing this state, and its processor id. These are read at runtime as
+    // emitted code may be shared between Jits (See: SharedCodeCache).
+    A64::Jit* jit_interface = nullptr;
+    u64 processor_id = 0;
+    // This processor's reservation slot in the global monitor and its bit in the monitor's shard masks.
+    void* exclusive_slot = nullptr;
+    u64 exclusive_processor_mask = 0;
+
     static constexpr size_t RSBSize = 8; // MUST be a power of 2.
     static constexpr size_t RSBPtrMask = RSBSize - 1;
     u32 rsb_ptr = 0;
@@ -4,6 +4,7 @@
  */
 
 #include <algorithm>
+#include <initializer_list>
 #include <vector>
 
 #include <xbyak.h>
@@ -120,15 +121,27 @@ void ABI_PopCallerSaveRegistersAndAdjustStack(BlockOfCode& code, size_t frame_si
 }
 
 void ABI_PushCallerSaveRegistersAndAdjustStackExcept(BlockOfCode& code, HostLoc exception) {
-    std::vector<HostLoc> regs;
-    std::remove_copy(ABI_ALL_CALLER_SAVE.begin(), ABI_ALL_CALLER_SAVE.end(), std::back_inserter(regs), exception);
-    ABI_PushRegistersAndAdjustStack(code, 0, regs);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, {exception});
 }
 
 void ABI_PopCallerSaveRegistersAndAdjustStackExcept(BlockOfCode& code, HostLoc exception) {
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, {exception});
+}
+
+static std::vector<HostLoc> CallerSaveRegistersExcept(std::initializer_list<HostLoc> exceptions) {
     std::vector<HostLoc> regs;
-    std::remove_copy(ABI_ALL_CALLER_SAVE.begin(), ABI_ALL_CALLER_SAVE.end(), std::back_inserter(regs), exception);
-    ABI_PopRegistersAndAdjustStack(code, 0, regs);
+    std::remove_copy_if(ABI_ALL_CALLER_SAVE.begin(), ABI_ALL_CALLER_SAVE.end(), std::back_inserter(regs), [exceptions](HostLoc loc) {
+        return std::find(exceptions.begin(), exceptions.end(), loc) != exceptions.end();
+    });
+    return regs;
+}
+
+void ABI_PushCallerSaveRegistersAndAdjustStackExcept(BlockOfCode& code, std::initializer_list<HostLoc> exceptions) {
+    ABI_PushRegistersAndAdjustStack(code, 0, CallerSaveRegistersExcept(exceptions));
+}
+
+void ABI_PopCallerSaveRegistersAndAdjustStackExcept(BlockOfCode& code, std::initializer_list<HostLoc> exceptions) {
+    ABI_PopRegistersAndAdjustStack(code, 0, CallerSaveRegistersExcept(exceptions));
 }
 
 } // namespace Dynarmic::Backend::X64
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <initializer_list>
 
 #include "backend/x64/hostloc.h"
 
@@ -119,5 +120,7 @@ void ABI_PopCallerSaveRegistersAndAdjustStack(BlockOfCode& code, size_t frame_si
 
 void ABI_PushCallerSaveRegistersAndAdjustStackExcept(BlockOfCode& code, HostLoc exception);
 void ABI_PopCallerSaveRegistersAndAdjustStackExcept(BlockOfCode& code, HostLoc exception);
+void ABI_PushCallerSaveRegistersAndAdjustStackExcept(BlockOfCode& code, std::initializer_list<HostLoc> exceptions);
+void ABI_PopCallerSaveRegistersAndAdjustStackExcept(BlockOfCode& code, std::initializer_list<HostLoc> exceptions);
 
 } // namespace Dynarmic::Backend::X64
@@ -0,0 +1,113 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <algorithm>
+
+#include "backend/x64/background_compiler.h"
+
+namespace Dynarmic::Backend::X64 {
+
+BackgroundCompiler::BackgroundCompiler(TranslateFunction translate)
+        : translate(std::move(translate))
+        , worker([this] { WorkerThread(); })
+{}
+
+BackgroundCompiler::~BackgroundCompiler() {
+    {
+        std::lock_guard lock{mutex};
+        stop_requested = true;
+    }
+    queue_not_empty.notify_one();
+    worker.join();
+}
+
+void BackgroundCompiler::Request(IR::LocationDescriptor location) {
+    {
+        std::lock_guard lock{mutex};
+        if (!requested.insert(location).second) {
+            return;
+        }
+        queue.push_back(location);
+    }
+    queue_not_empty.notify_one();
+}
+
+void BackgroundCompiler::RequestWhileStepping(IR::LocationDescriptor location, u64 pc) {
+    {
+        std::lock_guard lock{mutex};
+
+        const bool sequential = last_stepped_pc && pc > *last_stepped_pc && pc - *last_stepped_pc <= 4;
+        last_stepped_pc = pc;
+        if (sequential && stepping_block && requested.count(*stepping_block)) {
+            return;
+        }
+
+        stepping_block = location;
+        if (!requested.insert(location).second) {
+            return;
+        }
+        queue.push_back(location);
+    }
+    queue_not_empty.notify_one();
+}
+
+std::optional<IR::Block> BackgroundCompiler::Take(IR::LocationDescriptor location) {
+    std::lock_guard lock{mutex};
+
+    const auto iter = completed.find(location);
+    if (iter == completed.end()) {
+        return std::nullopt;
+    }
+
+    IR::Block block = std::move(iter->second.block);
+    completed.erase(iter);
+    requested.erase(location);
+    return block;
+}
+
+void BackgroundCompiler::Discard() {
+    std::lock_guard lock{mutex};
+    queue.clear();
+    requested.clear();
+    completed.clear();
+    generation++;
+    stepping_block.reset();
+    last_stepped_pc.reset();
+}
+
+void BackgroundCompiler::WorkerThread() {
+    std::unique_lock lock{mutex};
+    while (true) {
+        queue_not_empty.wait(lock, [this] { return stop_requested || !queue.empty(); });
+        if (stop_requested) {
+            return;
+        }
+
+        const IR::LocationDescriptor location = queue.front();
+        queue.pop_front();
+        const u64 current_generation = generation;
+
+        lock.unlock();
+        IR::Block block = translate(location);
+        lock.lock();
+
+        // Guest code may have been modified while this block was being translated.
+        if (generation != current_generation) {
+            continue;
+        }
+
+        // Blocks may never be taken, e.g. if execution does not return to them.
+        if (completed.size() >= max_completed) {
+            const auto oldest = std::min_element(completed.begin(), completed.end(), [](const auto& a, const auto& b) {
+                return a.second.sequence < b.second.sequence;
+            });
+            requested.erase(oldest->first);
+            completed.erase(oldest);
+        }
+        completed.insert_or_assign(location, CompletedBlock{std::move(block), completed_sequence++});
+    }
+}
+
+} // namespace Dynarmic::Backend::X64
@@ -0,0 +1,79 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/location_descriptor.h"
+
+namespace Dynarmic::Backend::X64 {
+
+/// Translates blocks on a worker thread, so that the emulation thread does not have to wait
+/// for translation of newly reached code. Translated blocks are retrieved by the emulation
+/// thread, which emits them at a point where no emitted code is running.
+class BackgroundCompiler {
+public:
+    using TranslateFunction = std::function<IR::Block(IR::LocationDescriptor)>;
+
+    explicit BackgroundCompiler(TranslateFunction translate);
+    ~BackgroundCompiler();
+
+    BackgroundCompiler(const BackgroundCompiler&) = delete;
+    BackgroundCompiler& operator=(const BackgroundCompiler&) = delete;
+
+    /// Queues a block for translation, unless it is already queued or has been translated.
+    void Request(IR::LocationDescriptor location);
+
+    /// Called whenever execution is about to step a single instruction at location, whose guest
+    /// PC is pc, because no block has been translated there yet. Translation is only requested
+    /// where execution enters code: instructions stepped through sequentially after a requested
+    /// location are assumed to belong to the block starting there.
+    void RequestWhileStepping(IR::LocationDescriptor location, u64 pc);
+
+    /// Removes and returns a block whose translation has completed.
+    std::optional<IR::Block> Take(IR::LocationDescriptor location);
+
+    /// Discards all queued and translated blocks. A block which is being translated when
+    /// this is called is discarded once its translation completes.
+    void Discard();
+
+private:
+    /// Translated blocks which have not been taken. Once there are this many, the oldest is discarded.
+    static constexpr size_t max_completed = 1024;
+
+    struct CompletedBlock {
+        IR::Block block;
+        u64 sequence;
+    };
+
+    void WorkerThread();
+
+    TranslateFunction translate;
+
+    std::mutex mutex;
+    std::condition_variable queue_not_empty;
+    std::deque<IR::LocationDescriptor> queue;
+    std::unordered_set<IR::LocationDescriptor> requested;
+    std::unordered_map<IR::LocationDescriptor, CompletedBlock> completed;
+    u64 completed_sequence = 0;
+    u64 generation = 0;
+    std::optional<IR::LocationDescriptor> stepping_block;
+    std::optional<u64> last_stepped_pc;
+    bool stop_requested = false;
+
+    std::thread worker;
+};
+
+} // namespace Dynarmic::Backend::X64
@@ -43,10 +43,6 @@ const std::array<Xbyak::Reg64, 6> BlockOfCode::ABI_PARAMS = {BlockOfCode::ABI_PA
 
 namespace {
 
-constexpr size_t TOTAL_CODE_SIZE = 128 * 1024 * 1024;
-constexpr size_t FAR_CODE_OFFSET = 100 * 1024 * 1024;
-constexpr size_t CONSTANT_POOL_SIZE = 2 * 1024 * 1024;
-
 class CustomXbyakAllocator : public Xbyak::Allocator {
 public:
 #ifdef DYNARMIC_ENABLE_NO_EXECUTE_SUPPORT
@@ -74,20 +70,31 @@ void ProtectMemory(const void* base, size_t size, bool is_executable) {
 
 } // anonymous namespace
 
-BlockOfCode::BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi, std::function<void(BlockOfCode&)> rcp)
-        : Xbyak::CodeGenerator(TOTAL_CODE_SIZE, nullptr, &s_allocator)
+BlockOfCode::BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi, size_t total_code_size, size_t far_code_offset, size_t constant_pool_size,
+                         std::function<void(BlockOfCode&)> rcp, std::function<void(BlockOfCode&)> rce)
+        : Xbyak::CodeGenerator(total_code_size, nullptr, &s_allocator)
         , cb(std::move(cb))
         , jsi(jsi)
-        , constant_pool(*this, CONSTANT_POOL_SIZE)
+        , total_code_size(total_code_size)
+        , far_code_offset(far_code_offset)
+        , constant_pool(*this, constant_pool_size)
 {
+    ASSERT_MSG(far_code_offset < total_code_size, "Far code must be within the code cache");
     EnableWriting();
-    GenRunCode(rcp);
+    GenRunCode(rcp, rce);
 }
 
 void BlockOfCode::PreludeComplete() {
     prelude_complete = true;
     near_code_begin = getCurr();
-    far_code_begin = getCurr() + FAR_CODE_OFFSET;
+    far_code_begin = getCode() + far_code_offset;
+    ASSERT_MSG(near_code_begin < far_code_begin, "Prelude has overwritten far code!");
+
+    near_segment_size = static_cast<size_t>(static_cast<const u8*>(far_code_begin) - static_cast<const u8*>(near_code_begin)) / SEGMENT_COUNT;
+    far_segment_size = (total_code_size - far_code_offset) / SEGMENT_COUNT;
+    ASSERT_MSG(near_segment_size > MINIMUM_REMAINING_CODESIZE && far_segment_size > MINIMUM_REMAINING_CODESIZE,
+               "Code cache is too small: each segment requires more than {} bytes of near and far code", MINIMUM_REMAINING_CODESIZE);
+
     ClearCache();
     DisableWriting();
 }
@@ -106,30 +113,37 @@ void BlockOfCode::DisableWriting() {
 
 void BlockOfCode::ClearCache() {
     ASSERT(prelude_complete);
-    in_far_code = false;
-    near_code_ptr = near_code_begin;
-    far_code_ptr = far_code_begin;
-    SetCodePtr(near_code_begin);
+    current_segment = SEGMENT_COUNT - 1;
+    SwitchToNextSegment();
 }
 
 size_t BlockOfCode::SpaceRemaining() const {
     ASSERT(prelude_complete);
-    // This function provides an underestimate of near-code-size but that's okay.
-    // (Why? The maximum size of near code should be measured from near_code_begin, not top_.)
-    // These are offsets from Xbyak::CodeArray::top_.
-    std::size_t far_code_offset, near_code_offset;
-    if (in_far_code) {
-        near_code_offset = static_cast<const u8*>(near_code_ptr) - getCode();
-        far_code_offset = getCurr() - getCode();
-    } else {
-        near_code_offset = getCurr() - getCode();
-        far_code_offset = static_cast<const u8*>(far_code_ptr) - getCode();
-    }
-    if (far_code_offset > TOTAL_CODE_SIZE)
-        return 0;
-    if (near_code_offset > FAR_CODE_OFFSET)
+    const u8* near_code_end = static_cast<const u8*>(near_code_begin) + (current_segment + 1) * near_segment_size;
+    const u8* far_code_end = static_cast<const u8*>(far_code_begin) + (current_segment + 1) * far_segment_size;
+    const u8* near_code_current = in_far_code ? static_cast<const u8*>(near_code_ptr) : getCurr();
+    const u8* far_code_current = in_far_code ? getCurr() : static_cast<const u8*>(far_code_ptr);
+    if (near_code_current > near_code_end || far_code_current > far_code_end)
         return 0;
-    return std::min(TOTAL_CODE_SIZE - far_code_offset, FAR_CODE_OFFSET - near_code_offset);
+    return std::min(static_cast<size_t>(near_code_end - near_code_current), static_cast<size_t>(far_code_end - far_code_current));
+}
+
+size_t BlockOfCode::SwitchToNextSegment() {
+    ASSERT(prelude_complete);
+    current_segment = (current_segment + 1) % SEGMENT_COUNT;
+    in_far_code = false;
+    near_code_ptr = static_cast<const u8*>(near_code_begin) + current_segment * near_segment_size;
+    far_code_ptr = static_cast<const u8*>(far_code_begin) + current_segment * far_segment_size;
+    SetCodePtr(near_code_ptr);
+    return current_segment;
+}
+
+bool BlockOfCode::IsInSegment(CodePtr ptr, size_t segment) const {
+    const u8* p = static_cast<const u8*>(ptr);
+    const u8* near_segment_begin = static_cast<const u8*>(near_code_begin) + segment * near_segment_size;
+    const u8* far_segment_begin = static_cast<const u8*>(far_code_begin) + segment * far_segment_size;
+    return (p >= near_segment_begin && p < near_segment_begin + near_segment_size)
+        || (p >= far_segment_begin && p < far_segment_begin + far_segment_size);
 }
 
 void BlockOfCode::RunCode(void* jit_state, CodePtr code_ptr) const {
@@ -154,7 +168,7 @@ void BlockOfCode::ForceReturnFromRunCode(bool mxcsr_already_exited) {
     jmp(return_from_run_code[index]);
 }
 
-void BlockOfCode::GenRunCode(std::function<void(BlockOfCode&)> rcp) {
+void BlockOfCode::GenRunCode(std::function<void(BlockOfCode&)> rcp, std::function<void(BlockOfCode&)> rce) {
     Xbyak::Label loop, enter_mxcsr_then_loop;
 
     align();
@@ -173,10 +187,12 @@ void BlockOfCode::GenRunCode(std::function<void(BlockOfCode&)> rcp) {
     mov(qword[r15 + jsi.offsetof_cycles_to_run], ABI_RETURN);
     mov(qword[r15 + jsi.offsetof_cycles_remaining], ABI_RETURN);
 
+    // rcp may load guest state into non-volatile registers.
+    mov(ABI_PARAM2, rbx);
     rcp(*this);
 
     SwitchMxcsrOnEntry();
-    jmp(rbx);
+    jmp(ABI_PARAM2);
 
     align();
     step_code = getCurr<RunCodeFuncType>();
@@ -226,6 +242,10 @@ void BlockOfCode::GenRunCode(std::function<void(BlockOfCode&)> rcp) {
     return_from_run_code[MXCSR_ALREADY_EXITED | FORCE_RETURN] = getCurr<const void*>();
     L(return_to_caller_mxcsr_already_exited);
 
+    if (rce) {
+        rce(*this);
+    }
+
     cb.AddTicks->EmitCall(*this, [this](RegList param) {
         mov(param[0], qword[r15 + jsi.offsetof_cycles_to_run]);
         sub(param[0], qword[r15 + jsi.offsetof_cycles_remaining]);
@@ -353,6 +373,14 @@ bool BlockOfCode::HasAESNI() const {
     return DoesCpuSupport(Xbyak::util::Cpu::tAESNI);
 }
 
+bool BlockOfCode::HasSHA() const {
+    return DoesCpuSupport(Xbyak::util::Cpu::tSHA);
+}
+
+bool BlockOfCode::HasGFNI() const {
+    return DoesCpuSupport(Xbyak::util::Cpu::tGFNI);
+}
+
 bool BlockOfCode::HasLZCNT() const {
     return DoesCpuSupport(Xbyak::util::Cpu::tLZCNT);
 }
@@ -390,6 +418,10 @@ bool BlockOfCode::HasAVX512_BITALG() const {
     return DoesCpuSupport(Xbyak::util::Cpu::tAVX512_BITALG);
 }
 
+bool BlockOfCode::HasAVX512_VBMI() const {
+    return DoesCpuSupport(Xbyak::util::Cpu::tAVX512_VBMI);
+}
+
 bool BlockOfCode::DoesCpuSupport([[maybe_unused]] Xbyak::util::Cpu::Type type) const {
 #ifdef DYNARMIC_ENABLE_CPU_FEATURE_DETECTION
     return cpu_info.has(type);
@@ -31,7 +31,15 @@ struct RunCodeCallbacks {
 
 class BlockOfCode final : public Xbyak::CodeGenerator {
 public:
-    BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi, std::function<void(BlockOfCode&)> rcp);
+    /// Space which must remain in the current segment before a block is emitted.
+    static constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
+    /// Number of segments the code cache is divided into. Each segment has its own near and far code.
+    static constexpr size_t SEGMENT_COUNT = 4;
+
+    /// rcp is emitted on entry to emitted code, once r15 holds the JitState pointer. It must preserve ABI_PARAM2.
+    /// rce, if provided, is emitted before returning to the caller.
+    BlockOfCode(RunCodeCallbacks cb, JitStateInfo jsi, size_t total_code_size, size_t far_code_offset, size_t constant_pool_size,
+                std::function<void(BlockOfCode&)> rcp, std::function<void(BlockOfCode&)> rce = nullptr);
     BlockOfCode(const BlockOfCode&) = delete;
 
     /// Call when external emitters have finished emitting their preludes.
@@ -44,8 +52,16 @@ public:
 
     /// Clears this block of code and resets code pointer to beginning.
     void ClearCache();
-    /// Calculates how much space is remaining to use. This is the minimum of near code and far code.
+    /// Calculates how much space is remaining to use in the current segment. This is the minimum of near code and far code.
     size_t SpaceRemaining() const;
+    /// Continues emission at the beginning of the next segment, wrapping around to the first segment
+    /// after the last. Returns the index of the new current segment, whose previous contents are
+    /// overwritten by subsequently emitted code.
+    size_t SwitchToNextSegment();
+    /// Index of the segment code is currently being emitted into.
+    size_t CurrentSegment() const { return current_segment; }
+    /// Returns true if ptr is within the near or far code of the given segment.
+    bool IsInSegment(CodePtr ptr, size_t segment) const;
 
     /// Runs emulated code from code_ptr.
     void RunCode(void* jit_state, CodePtr code_ptr) const;
@@ -151,6 +167,8 @@ public:
     bool HasAVX() const;
     bool HasF16C() const;
     bool HasAESNI() const;
+    bool HasSHA() const;
+    bool HasGFNI() const;
     bool HasLZCNT() const;
     bool HasBMI1() const;
     bool HasBMI2() const;
@@ -159,14 +177,21 @@ public:
     bool HasAVX2() const;
     bool HasAVX512_Skylake() const;
     bool HasAVX512_BITALG() const;
+    bool HasAVX512_VBMI() const;
 
 private:
     RunCodeCallbacks cb;
     JitStateInfo jsi;
 
+    const size_t total_code_size;
+    const size_t far_code_offset;
+
     bool prelude_complete = false;
     CodePtr near_code_begin;
     CodePtr far_code_begin;
+    size_t near_segment_size;
+    size_t far_segment_size;
+    size_t current_segment = 0;
 
     ConstantPool constant_pool;
 
@@ -180,7 +205,7 @@ private:
     static constexpr size_t MXCSR_ALREADY_EXITED = 1 << 0;
     static constexpr size_t FORCE_RETURN = 1 << 1;
     std::array<const void*, 4> return_from_run_code;
-    void GenRunCode(std::function<void(BlockOfCode&)> rcp);
+    void GenRunCode(std::function<void(BlockOfCode&)> rcp, std::function<void(BlockOfCode&)> rce);
 
     Xbyak::util::Cpu cpu_info;
     bool DoesCpuSupport(Xbyak::util::Cpu::Type type) const;
@@ -3,12 +3,16 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
 #include <iterator>
+#include <utility>
 
 #include <tsl/robin_set.h>
 
+#include "backend/x64/abi.h"
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/emit_x64.h"
+#include "backend/x64/exclusive_monitor_friend.h"
 #include "backend/x64/nzcv_util.h"
 #include "backend/x64/perf_map.h"
 #include "common/assert.h"
@@ -90,6 +94,80 @@ void EmitX64::PushRSBHelper(Xbyak::Reg64 loc_desc_reg, Xbyak::Reg64 index_reg, I
     code.mov(dword[r15 + code.GetJitStateInfo().offsetof_rsb_ptr], index_reg.cvt32());
 }
 
+void EmitX64::EmitExclusiveLock(ExclusiveMonitor* monitor, Xbyak::Reg64 shard, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp) {
+    using EMF = ExclusiveMonitorFriend;
+
+    // This calculation has to match up with ExclusiveMonitor::ShardIndex
+    code.mov(shard, EMF::shard_hash_multiplier);
+    code.imul(shard, vaddr);
+    code.shr(shard, int(64 - EMF::shard_bits));
+    code.shl(shard, int(Common::HighestSetBit(EMF::shard_size)));
+    code.mov(tmp, Common::BitCast<u64>(EMF::ShardsPointer(monitor)));
+    code.add(shard, tmp);
+
+    Xbyak::Label start, spin;
+
+    code.L(start);
+    code.mov(tmp.cvt32(), 1);
+    code.xchg(code.byte[shard + EMF::shard_lock_offset], tmp.cvt8());
+    code.test(tmp.cvt8(), tmp.cvt8());
+    code.jnz(spin, code.T_NEAR);
+
+    code.SwitchToFarCode();
+    code.L(spin);
+    code.pause();
+    code.cmp(code.byte[shard + EMF::shard_lock_offset], u8(0));
+    code.jne(spin, code.T_NEAR);
+    code.jmp(start, code.T_NEAR);
+    code.SwitchToNearCode();
+}
+
+void EmitX64::EmitExclusiveUnlock(Xbyak::Reg64 shard) {
+    code.mov(code.byte[shard + ExclusiveMonitorFriend::shard_lock_offset], u8(0));
+}
+
+void EmitX64::EmitExclusiveMark(Xbyak::Reg64 shard, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp) {
+    using EMF = ExclusiveMonitorFriend;
+
+    code.mov(tmp, qword[r15 + code.GetJitStateInfo().offsetof_exclusive_slot]);
+    code.mov(qword[tmp + EMF::slot_address_offset], vaddr);
+    code.mov(tmp, qword[r15 + code.GetJitStateInfo().offsetof_exclusive_processor_mask]);
+    code.or_(qword[shard + EMF::shard_processor_mask_offset], tmp);
+}
+
+void EmitX64::EmitExclusiveCheckAndClear(ExclusiveMonitor* monitor, Xbyak::Reg64 shard, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp, Xbyak::Reg64 tmp2, Xbyak::Label& fail) {
+    using EMF = ExclusiveMonitorFriend;
+
+    code.mov(tmp, qword[r15 + code.GetJitStateInfo().offsetof_exclusive_slot]);
+    code.cmp(qword[tmp + EMF::slot_address_offset], vaddr);
+    code.jne(fail, code.T_NEAR);
+
+    Xbyak::Label clear_others, end;
+
+    // Fast path: we are the only processor which may hold a reservation in this shard.
+    code.mov(tmp2, qword[r15 + code.GetJitStateInfo().offsetof_exclusive_processor_mask]);
+    code.cmp(qword[shard + EMF::shard_processor_mask_offset], tmp2);
+    code.jne(clear_others, code.T_NEAR);
+    code.mov(tmp2, EMF::invalid_exclusive_address);
+    code.mov(qword[tmp + EMF::slot_address_offset], tmp2);
+    code.mov(qword[shard + EMF::shard_processor_mask_offset], 0);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(clear_others);
+    // The stack adjustment below assumes a return address has been pushed.
+    code.sub(rsp, 8);
+    ABI_PushCallerSaveRegistersAndAdjustStack(code);
+    code.mov(code.ABI_PARAM3, vaddr);
+    code.mov(code.ABI_PARAM1, Common::BitCast<u64>(monitor));
+    code.mov(code.ABI_PARAM2, qword[r15 + code.GetJitStateInfo().offsetof_processor_id]);
+    code.CallFunction(&EMF::CheckAndClear);
+    ABI_PopCallerSaveRegistersAndAdjustStack(code);
+    code.add(rsp, 8);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+}
+
 void EmitX64::EmitPushRSB(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     ASSERT(args[0].IsImmediate());
@@ -146,6 +224,7 @@ void EmitX64::EmitGetNZCVFromOp(EmitContext& ctx, IR::Inst* inst) {
     code.lahf();
     code.seto(code.al);
     ctx.reg_alloc.DefineValue(inst, nzcv);
+    ctx.reg_alloc.SetHostFlagsValue(inst);
 }
 
 void EmitX64::EmitNZCVFromPackedFlags(EmitContext& ctx, IR::Inst* inst) {
@@ -180,14 +259,85 @@ void EmitX64::EmitNZCVFromPackedFlags(EmitContext& ctx, IR::Inst* inst) {
     }
 }
 
-void EmitX64::EmitAddCycles(size_t cycles) {
+void EmitX64::EmitAddCycles(size_t cycles, bool preserve_host_flags) {
     ASSERT(cycles < std::numeric_limits<u32>::max());
-    code.sub(qword[r15 + code.GetJitStateInfo().offsetof_cycles_remaining], static_cast<u32>(cycles));
+    const auto cycles_remaining = qword[r15 + code.GetJitStateInfo().offsetof_cycles_remaining];
+
+    if (preserve_host_flags) {
+        // lea does not modify the host flags.
+        code.mov(rcx, cycles_remaining);
+        code.lea(rcx, ptr[rcx - static_cast<u32>(cycles)]);
+        code.mov(cycles_remaining, rcx);
+        return;
+    }
+
+    code.sub(cycles_remaining, static_cast<u32>(cycles));
 }
 
-Xbyak::Label EmitX64::EmitCond(IR::Cond cond) {
+static void EmitCondFromHostFlags(BlockOfCode& code, IR::Cond cond, Xbyak::Label& pass) {
+    // SF, ZF, CF and OF already hold N, Z, C and V. They are left unmodified.
+    switch (cond) {
+    case IR::Cond::EQ: //z
+        code.jz(pass);
+        break;
+    case IR::Cond::NE: //!z
+        code.jnz(pass);
+        break;
+    case IR::Cond::CS: //c
+        code.jc(pass);
+        break;
+    case IR::Cond::CC: //!c
+        code.jnc(pass);
+        break;
+    case IR::Cond::MI: //n
+        code.js(pass);
+        break;
+    case IR::Cond::PL: //!n
+        code.jns(pass);
+        break;
+    case IR::Cond::VS: //v
+        code.jo(pass);
+        break;
+    case IR::Cond::VC: //!v
+        code.jno(pass);
+        break;
+    case IR::Cond::HI: { //c & !z
+        Xbyak::Label fail;
+        code.jnc(fail);
+        code.jnz(pass);
+        code.L(fail);
+        break;
+    }
+    case IR::Cond::LS: //!c | z
+        code.jnc(pass);
+        code.jz(pass);
+        break;
+    case IR::Cond::GE: // n == v
+        code.jge(pass);
+        break;
+    case IR::Cond::LT: // n != v
+        code.jl(pass);
+        break;
+    case IR::Cond::GT: // !z & (n == v)
+        code.jg(pass);
+        break;
+    case IR::Cond::LE: // z | (n != v)
+        code.jle(pass);
+        break;
+    default:
+        ASSERT_MSG(false, "Unknown cond {}", static_cast<size_t>(cond));
+        break;
+    }
+}
+
+Xbyak::Label EmitX64::EmitCond(IR::Cond cond, bool nzcv_in_host_flags) {
     Xbyak::Label pass;
 
+    if (nzcv_in_host_flags) {
+        EmitCondFromHostFlags(code, cond, pass);
+        return pass;
+    }
+
     code.mov(eax, dword[r15 + code.GetJitStateInfo().offsetof_cpsr_nzcv]);
 
     // sahf restores SF, ZF, CF
@@ -270,6 +420,8 @@ EmitX64::BlockDescriptor EmitX64::RegisterBlock(const IR::LocationDescriptor& de
 
     BlockDescriptor block_desc{entrypoint, size};
     block_descriptors.emplace(descriptor.Value(), block_desc);
+    statistics.emitted_blocks++;
+    statistics.emitted_code_size += size;
     return block_desc;
 }
 
@@ -285,6 +437,11 @@ void EmitX64::EmitTerminal(IR::Terminal terminal, IR::LocationDescriptor initial
 }
 
 void EmitX64::Patch(const IR::LocationDescriptor& target_desc, CodePtr target_code_ptr) {
+    if (defer_patching) {
+        deferred_patches.insert(target_desc);
+        return;
+    }
+
     const CodePtr save_code_ptr = code.getCurr();
     const PatchInformation& patch_info = patch_information[target_desc];
 
@@ -313,6 +470,8 @@ void EmitX64::Unpatch(const IR::LocationDescriptor& target_desc) {
 void EmitX64::ClearCache() {
     block_descriptors.clear();
     patch_information.clear();
+    deferred_patches.clear();
+    statistics.cache_clears++;
 
     PerfMapClear();
 }
@@ -334,4 +493,52 @@ void EmitX64::InvalidateBasicBlocks(const tsl::robin_set<IR::LocationDescriptor>
     }
 }
 
+void EmitX64::EvictOldestSegment() {
+    const size_t segment = code.SwitchToNextSegment();
+    const auto in_segment = [this, segment](CodePtr ptr) { return code.IsInSegment(ptr, segment); };
+
+    // Links from evicted blocks are about to be overwritten, so they must no longer be patched.
+    for (auto iter = patch_information.begin(); iter != patch_information.end(); ++iter) {
+        PatchInformation& patch_info = iter.value();
+        for (auto* locations : {&patch_info.jg, &patch_info.jmp, &patch_info.mov_rcx}) {
+            locations->erase(std::remove_if(locations->begin(), locations->end(), in_segment), locations->end());
+        }
+    }
+
+    tsl::robin_set<IR::LocationDescriptor> evicted_blocks;
+    for (const auto& [descriptor, block_desc] : block_descriptors) {
+        if (in_segment(block_desc.entrypoint)) {
+            evicted_blocks.insert(descriptor);
+        }
+    }
+
+    InvalidateBasicBlocks(evicted_blocks);
+
+    statistics.evicted_segments++;
+    statistics.evicted_blocks += evicted_blocks.size();
+}
+
+void EmitX64::ApplyDeferredPatches() {
+    if (deferred_patches.empty()) {
+        return;
+    }
+
+    code.EnableWriting();
+    SCOPE_EXIT { code.DisableWriting(); };
+
+    const bool defer = std::exchange(defer_patching, false);
+    for (const auto& descriptor : deferred_patches) {
+        const auto block = GetBasicBlock(descriptor);
+        Patch(descriptor, block ? block->entrypoint : nullptr);
+    }
+    deferred_patches.clear();
+    defer_patching = defer;
+}
+
+CodeCacheStatistics EmitX64::GetStatistics() const {
+    CodeCacheStatistics result = statistics;
+    result.resident_blocks = block_descriptors.size();
+    return result;
+}
+
 } // namespace Dynarmic::Backend::X64
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <array>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -16,6 +17,8 @@
 
 #include <xbyak_util.h>
 
+#include <dynarmic/code_cache_statistics.h>
+
 #include "backend/x64/exception_handler.h"
 #include "backend/x64/reg_alloc.h"
 #include "common/bit_util.h"
@@ -29,6 +32,7 @@ class Inst;
 } // namespace Dynarmic::IR
 
 namespace Dynarmic {
+class ExclusiveMonitor;
 enum class OptimizationFlag : u32;
 } // namespace Dynarmic
 
@@ -59,6 +63,9 @@ struct EmitContext {
 
     RegAlloc& reg_alloc;
     IR::Block& block;
+
+    /// True while the host's SF, ZF, CF and OF hold the guest's N, Z, C and V flags.
+    bool nzcv_in_host_flags = false;
 };
 
 class EmitX64 {
@@ -78,7 +85,24 @@ public:
     virtual void ClearCache();
 
     /// Invalidates a selection of basic blocks.
-    void InvalidateBasicBlocks(const tsl::robin_set<IR::LocationDescriptor>& locations);
+    virtual void InvalidateBasicBlocks(const tsl::robin_set<IR::LocationDescriptor>& locations);
+
+    /// Makes space for new code by evicting the blocks in the oldest segment of the code cache,
+    /// then continues emission in that segment. Links into evicted blocks are unpatched.
+    virtual void EvictOldestSegment();
+
+    /// Returns statistics describing the usage of the code cache.
+    CodeCacheStatistics GetStatistics() const;
+
+    /// Performs the patches of previously emitted code which were deferred while other threads
+    /// may have been executing it. No emitted code may be executing when this is called.
+    void ApplyDeferredPatches();
+
+    /// Must be held while emitting code or modifying the cache, if emitted code is shared
+    /// between threads. Also held by the fastmem fault handler.
+    std::mutex& CodeMutex() {
+        return code_mutex;
+    }
 
 protected:
     // Microinstruction emitters
@@ -92,11 +116,18 @@ protected:
 
     // Helpers
     virtual std::string LocationDescriptorToFriendlyName(const IR::LocationDescriptor&) const = 0;
-    void EmitAddCycles(size_t cycles);
-    Xbyak::Label EmitCond(IR::Cond cond);
+    void EmitAddCycles(size_t cycles, bool preserve_host_flags = false);
+    Xbyak::Label EmitCond(IR::Cond cond, bool nzcv_in_host_flags = false);
     BlockDescriptor RegisterBlock(const IR::LocationDescriptor& location_descriptor, CodePtr entrypoint, size_t size);
     void PushRSBHelper(Xbyak::Reg64 loc_desc_reg, Xbyak::Reg64 index_reg, IR::LocationDescriptor target);
 
+    // Exclusive monitor helpers (shard is a pointer to the monitor shard covering vaddr)
+    void EmitExclusiveLock(ExclusiveMonitor* monitor, Xbyak::Reg64 shard, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp);
+    void EmitExclusiveUnlock(Xbyak::Reg64 shard);
+    // The reservation slot and processor are read from the JitState, as the processor id may change.
+    void EmitExclusiveMark(Xbyak::Reg64 shard, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp);
+    void EmitExclusiveCheckAndClear(ExclusiveMonitor* monitor, Xbyak::Reg64 shard, Xbyak::Reg64 vaddr, Xbyak::Reg64 tmp, Xbyak::Reg64 tmp2, Xbyak::Label& fail);
+
     // Terminal instruction emitters
     void EmitTerminal(IR::Terminal terminal, IR::LocationDescriptor initial_location, bool is_single_step);
     virtual void EmitTerminalImpl(IR::Term::Interpret terminal, IR::LocationDescriptor initial_location, bool is_single_step) = 0;
@@ -126,6 +157,12 @@ protected:
     ExceptionHandler exception_handler;
     tsl::robin_map<IR::LocationDescriptor, BlockDescriptor> block_descriptors;
     tsl::robin_map<IR::LocationDescriptor, PatchInformation> patch_information;
+    CodeCacheStatistics statistics;
+
+    /// If set, Patch only records the locations whose links are to be updated by ApplyDeferredPatches.
+    bool defer_patching = false;
+    tsl::robin_set<IR::LocationDescriptor> deferred_patches;
+    std::mutex code_mutex;
 };
 
 } // namespace Dynarmic::Backend::X64
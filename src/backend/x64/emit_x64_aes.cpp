@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <array>
+
 #include "backend/x64/abi.h"
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/emit_x64.h"
@@ -37,6 +39,142 @@ static void EmitAESFunction(RegAlloc::ArgumentInfo args, EmitContext& ctx, Block
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+// Without AES-NI, SubBytes is computed with SSSE3 nibble lookups. Each byte is mapped into GF((2^4)^2)
+// (GF(2^4) = GF(2)[x]/(x^4+x+1), extended by Y^2+Y+8), where x = aY+b has the inverse (aY+(a+b))/d
+// with d = 8a^2+ab+b^2. Products and quotients in GF(2^4) are taken through 16-entry log and exp tables.
+// The change of basis and the affine transform of the forward or inverse S-box are folded into the
+// input and output tables.
+struct SubstitutionBoxTables {
+    // Indexed by the low and high nibbles of the input; their XOR gives a and b respectively.
+    std::array<u64, 2> a_low;
+    std::array<u64, 2> a_high;
+    std::array<u64, 2> b_low;
+    std::array<u64, 2> b_high;
+    // Indexed by a sum of two logarithms (0 to 28); give the output contributions of the high and low halves.
+    std::array<u64, 4> out_high;
+    std::array<u64, 4> out_low;
+    u64 out_constant;
+};
+
+constexpr SubstitutionBoxTables substitution_box_tables{
+    {0x0606040402020000, 0x0202000006060404},
+    {0x0D0E00030E0D0300, 0x03000E0D00030D0E},
+    {0x0706070601000100, 0x0B0A0B0A0D0C0D0C},
+    {0x0D01080409050C00, 0x08040D010C000905},
+    {0x0C055B6C60653E52, 0x523257693B095E37, 0x370C055B6C60653E, 0x00000057693B095E},
+    {0x9B9D19AD36ABB21F, 0x1F2982302F0684B4, 0xB49B9D19AD36ABB2, 0x00000082302F0684},
+    0x6363636363636363,
+};
+
+constexpr SubstitutionBoxTables inverse_substitution_box_tables{
+    {0x0104080D080D0104, 0x03060A0F0A0F0306},
+    {0x0F08080F00070700, 0x06010106090E0E09},
+    {0x0800070F00080F07, 0x00080F070800070F},
+    {0x06000F090F090600, 0x04020D0B0D0B0402},
+    {0x7B63BAA0DBB802A2, 0xA279C1C36118D91A, 0x1A7B63BAA0DBB802, 0x000000C1C36118D9},
+    {0x0DB0BC5D50E05C01, 0x0151B1EDECBD0CE1, 0xE10DB0BC5D50E05C, 0x000000B1EDECBD0C},
+    0,
+};
+
+// log(0) is represented by 0xE0 so that any sum involving it has the top bit set and looks up zero.
+constexpr std::array<u64, 2> log_table{0x0A050802040100E0, 0x0C0B0D0607090E03};
+constexpr std::array<u64, 2> negated_log_table{0x050A070D0B0E00E0, 0x030402090806010C};
+constexpr std::array<u64, 4> exp_table{0x0B0C060308040201, 0x01090D0F0E070A05, 0x050B0C0603080402, 0x0000000D0F0E070A};
+constexpr std::array<u64, 2> square_times_8_table{0x050D030B0E060800, 0x0F070901040C020A};
+constexpr std::array<u64, 2> square_table{0x0607020305040100, 0x0A0B0E0F09080D0C};
+
+static void EmitNibbleLookup(BlockOfCode& code, const Xbyak::Xmm& result, const Xbyak::Xmm& index, const std::array<u64, 2>& table) {
+    code.movdqa(result, code.MConst(xword, table[0], table[1]));
+    code.pshufb(result, index);
+}
+
+// result = table[sum], or zero if the top bit of sum is set. Clobbers sum.
+static void EmitLogSumLookup(BlockOfCode& code, const Xbyak::Xmm& result, const Xbyak::Xmm& sum, const Xbyak::Xmm& tmp, const std::array<u64, 4>& table) {
+    code.movdqa(tmp, sum);
+    code.paddusb(tmp, code.MConst(xword, 0x7070707070707070, 0x7070707070707070));
+    code.movdqa(result, code.MConst(xword, table[0], table[1]));
+    code.pshufb(result, tmp);
+    code.psubb(sum, code.MConst(xword, 0x1010101010101010, 0x1010101010101010));
+    code.movdqa(tmp, code.MConst(xword, table[2], table[3]));
+    code.pshufb(tmp, sum);
+    code.por(result, tmp);
+}
+
+static void EmitSubstituteBytes(BlockOfCode& code, EmitContext& ctx, const Xbyak::Xmm& data, const SubstitutionBoxTables& tables) {
+    const Xbyak::Xmm low = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm a = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm b = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm log_a = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm log_b = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm& high = data;
+
+    code.movdqa(low, data);
+    code.pand(low, code.MConst(xword, 0x0F0F0F0F0F0F0F0F, 0x0F0F0F0F0F0F0F0F));
+    code.psrlw(high, 4);
+    code.pand(high, code.MConst(xword, 0x0F0F0F0F0F0F0F0F, 0x0F0F0F0F0F0F0F0F));
+
+    EmitNibbleLookup(code, a, low, tables.a_low);
+    EmitNibbleLookup(code, tmp1, high, tables.a_high);
+    code.pxor(a, tmp1);
+    EmitNibbleLookup(code, b, low, tables.b_low);
+    EmitNibbleLookup(code, tmp1, high, tables.b_high);
+    code.pxor(b, tmp1);
+
+    // d = 8a^2 + b^2 + exp(log(a) + log(b))
+    EmitNibbleLookup(code, log_a, a, log_table);
+    EmitNibbleLookup(code, log_b, b, log_table);
+    code.paddb(log_b, log_a);
+    EmitLogSumLookup(code, tmp1, log_b, tmp2, exp_table);
+    EmitNibbleLookup(code, tmp2, a, square_times_8_table);
+    code.pxor(tmp1, tmp2);
+    EmitNibbleLookup(code, tmp2, b, square_table);
+    code.pxor(tmp1, tmp2);
+
+    // low = -log(d), tmp2 = log(a + b)
+    EmitNibbleLookup(code, low, tmp1, negated_log_table);
+    code.pxor(b, a);
+    EmitNibbleLookup(code, tmp2, b, log_table);
+
+    code.paddb(log_a, low);
+    code.paddb(tmp2, low);
+    EmitLogSumLookup(code, data, log_a, tmp1, tables.out_high);
+    EmitLogSumLookup(code, b, tmp2, tmp1, tables.out_low);
+    code.pxor(data, b);
+
+    if (tables.out_constant != 0) {
+        code.pxor(data, code.MConst(xword, tables.out_constant, tables.out_constant));
+    }
+}
+
+// Multiplies each byte by x in GF(2^8).
+static void EmitMultiplyByX(BlockOfCode& code, const Xbyak::Xmm& data, const Xbyak::Xmm& tmp) {
+    code.pxor(tmp, tmp);
+    code.pcmpgtb(tmp, data);
+    code.pand(tmp, code.MConst(xword, 0x1B1B1B1B1B1B1B1B, 0x1B1B1B1B1B1B1B1B));
+    code.paddb(data, data);
+    code.pxor(data, tmp);
+}
+
+// Each 32-bit element is a column a with a[i] in byte i. With t = a ^ ror(a, 8),
+// MixColumns(a) = 2t ^ ror(a, 8) ^ ror(t, 16).
+static void EmitMixColumns(BlockOfCode& code, const Xbyak::Xmm& data, const Xbyak::Xmm& rotated, const Xbyak::Xmm& tmp) {
+    code.movdqa(rotated, data);
+    code.psrld(rotated, 8);
+    code.movdqa(tmp, data);
+    code.pslld(tmp, 24);
+    code.por(rotated, tmp);
+
+    code.pxor(data, rotated);
+    code.pshuflw(tmp, data, 0b10110001);
+    code.pshufhw(tmp, tmp, 0b10110001);
+    code.pxor(rotated, tmp);
+
+    EmitMultiplyByX(code, data, tmp);
+    code.pxor(data, rotated);
+}
+
 void EmitX64::EmitAESDecryptSingleRound(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -51,6 +189,16 @@ void EmitX64::EmitAESDecryptSingleRound(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.HasSSSE3()) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+        code.pshufb(data, code.MConst(xword, 0x0B0E0104070A0D00, 0x0306090C0F020508));
+        EmitSubstituteBytes(code, ctx, data, inverse_substitution_box_tables);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
     EmitAESFunction(args, ctx, code, inst, AES::DecryptSingleRound);
 }
 
@@ -68,11 +216,21 @@ void EmitX64::EmitAESEncryptSingleRound(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.HasSSSE3()) {
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+        code.pshufb(data, code.MConst(xword, 0x030E09040F0A0500, 0x0B06010C07020D08));
+        EmitSubstituteBytes(code, ctx, data, substitution_box_tables);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
     EmitAESFunction(args, ctx, code, inst, AES::EncryptSingleRound);
 }
 
 void EmitX64::EmitAESInverseMixColumns(EmitContext& ctx, IR::Inst* inst) {
-     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     if (code.HasAESNI()) {
         const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -83,7 +241,20 @@ void EmitX64::EmitAESInverseMixColumns(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
-    EmitAESFunction(args, ctx, code, inst, AES::InverseMixColumns);
+    // InverseMixColumns(a) = MixColumns(a ^ 4(a ^ ror(a, 16)))
+    const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+
+    code.pshuflw(tmp1, data, 0b10110001);
+    code.pshufhw(tmp1, tmp1, 0b10110001);
+    code.pxor(tmp1, data);
+    EmitMultiplyByX(code, tmp1, tmp2);
+    EmitMultiplyByX(code, tmp1, tmp2);
+    code.pxor(data, tmp1);
+    EmitMixColumns(code, data, tmp1, tmp2);
+
+    ctx.reg_alloc.DefineValue(inst, data);
 }
 
 void EmitX64::EmitAESMixColumns(EmitContext& ctx, IR::Inst* inst) {
@@ -101,7 +272,13 @@ void EmitX64::EmitAESMixColumns(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
-    EmitAESFunction(args, ctx, code, inst, AES::MixColumns);
+    const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+
+    EmitMixColumns(code, data, tmp1, tmp2);
+
+    ctx.reg_alloc.DefineValue(inst, data);
 }
 
 } // namespace Dynarmic::Backend::X64
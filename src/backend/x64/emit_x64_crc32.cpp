@@ -3,9 +3,6 @@
  * SPDX-License-Identifier: 0BSD
  */
 
-#include <array>
-#include <climits>
-
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/emit_x64.h"
 #include "common/crypto/crc32.h"
@@ -16,6 +13,49 @@ namespace Dynarmic::Backend::X64 {
 using namespace Xbyak::util;
 namespace CRC32 = Common::Crypto::CRC32;
 
+// Byte-at-a-time table-driven update, used when the host lacks the relevant CRC instructions.
+// The data is folded into the CRC up front so that each step only needs the low byte of the CRC.
+static void EmitCRC32TableLookup(RegAlloc::ArgumentInfo args, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, const CRC32::CRC32Table& table, const int data_size) {
+    const Xbyak::Reg32 crc = ctx.reg_alloc.UseScratchGpr(args[0]).cvt32();
+    const Xbyak::Reg64 value = data_size == 64 ? ctx.reg_alloc.UseScratchGpr(args[1]) : ctx.reg_alloc.UseGpr(args[1]);
+    const Xbyak::Reg64 table_ptr = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg64 index = ctx.reg_alloc.ScratchGpr();
+
+    const auto emit_byte_steps = [&](int count) {
+        for (int i = 0; i < count; i++) {
+            code.movzx(index.cvt32(), crc.cvt8());
+            code.shr(crc, 8);
+            code.xor_(crc, dword[table_ptr + index * 4]);
+        }
+    };
+
+    code.mov(table_ptr, reinterpret_cast<u64>(table.data()));
+
+    switch (data_size) {
+    case 8:
+        code.xor_(crc.cvt8(), value.cvt8());
+        emit_byte_steps(1);
+        break;
+    case 16:
+        code.xor_(crc.cvt16(), value.cvt16());
+        emit_byte_steps(2);
+        break;
+    case 32:
+        code.xor_(crc, value.cvt32());
+        emit_byte_steps(4);
+        break;
+    case 64:
+        code.xor_(crc, value.cvt32());
+        emit_byte_steps(4);
+        code.shr(value, 32);
+        code.xor_(crc, value.cvt32());
+        emit_byte_steps(4);
+        break;
+    }
+
+    ctx.reg_alloc.DefineValue(inst, crc);
+}
+
 static void EmitCRC32Castagnoli(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, const int data_size) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -27,9 +67,7 @@ static void EmitCRC32Castagnoli(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
         return;
     }
 
-    ctx.reg_alloc.HostCall(inst, args[0], args[1], {});
-    code.mov(code.ABI_PARAM3, data_size / CHAR_BIT);
-    code.CallFunction(&CRC32::ComputeCRC32Castagnoli);
+    EmitCRC32TableLookup(args, code, ctx, inst, CRC32::castagnoli_table, data_size);
 }
 
 static void EmitCRC32ISO(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, const int data_size) {
@@ -108,9 +146,7 @@ static void EmitCRC32ISO(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, co
         return;
     }
 
-    ctx.reg_alloc.HostCall(inst, args[0], args[1], {});
-    code.mov(code.ABI_PARAM3, data_size / CHAR_BIT);
-    code.CallFunction(&CRC32::ComputeCRC32ISO);
+    EmitCRC32TableLookup(args, code, ctx, inst, CRC32::iso_table, data_size);
 }
 
 void EmitX64::EmitCRC32Castagnoli8(EmitContext& ctx, IR::Inst* inst) {
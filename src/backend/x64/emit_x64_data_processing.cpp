@@ -134,8 +134,75 @@ void EmitX64::EmitTestBit(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+static void EmitConditionalSelectFromHostFlags(BlockOfCode& code, IR::Cond cond, const Xbyak::Reg& else_, const Xbyak::Reg& then_) {
+    // SF, ZF, CF and OF already hold N, Z, C and V. They are left unmodified.
+    switch (cond) {
+    case IR::Cond::EQ: //z
+        code.cmovz(else_, then_);
+        break;
+    case IR::Cond::NE: //!z
+        code.cmovnz(else_, then_);
+        break;
+    case IR::Cond::CS: //c
+        code.cmovc(else_, then_);
+        break;
+    case IR::Cond::CC: //!c
+        code.cmovnc(else_, then_);
+        break;
+    case IR::Cond::MI: //n
+        code.cmovs(else_, then_);
+        break;
+    case IR::Cond::PL: //!n
+        code.cmovns(else_, then_);
+        break;
+    case IR::Cond::VS: //v
+        code.cmovo(else_, then_);
+        break;
+    case IR::Cond::VC: //!v
+        code.cmovno(else_, then_);
+        break;
+    case IR::Cond::HI: //c & !z
+        code.cmc();
+        code.cmova(else_, then_);
+        code.cmc();
+        break;
+    case IR::Cond::LS: //!c | z
+        code.cmc();
+        code.cmovna(else_, then_);
+        code.cmc();
+        break;
+    case IR::Cond::GE: // n == v
+        code.cmovge(else_, then_);
+        break;
+    case IR::Cond::LT: // n != v
+        code.cmovl(else_, then_);
+        break;
+    case IR::Cond::GT: // !z & (n == v)
+        code.cmovg(else_, then_);
+        break;
+    case IR::Cond::LE: // z | (n != v)
+        code.cmovle(else_, then_);
+        break;
+    case IR::Cond::AL:
+    case IR::Cond::NV:
+        code.mov(else_, then_);
+        break;
+    default:
+        ASSERT_MSG(false, "Invalid cond {}", static_cast<size_t>(cond));
+    }
+}
+
 static void EmitConditionalSelect(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bitsize) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (ctx.nzcv_in_host_flags) {
+        const Xbyak::Reg then_ = ctx.reg_alloc.UseGpr(args[1]).changeBit(bitsize);
+        const Xbyak::Reg else_ = ctx.reg_alloc.UseScratchGpr(args[2]).changeBit(bitsize);
+        EmitConditionalSelectFromHostFlags(code, args[0].GetImmediateCond(), else_, then_);
+        ctx.reg_alloc.DefineValue(inst, else_);
+        return;
+    }
+
     const Xbyak::Reg32 nzcv = ctx.reg_alloc.ScratchGpr(HostLoc::RAX).cvt32();
     const Xbyak::Reg then_ = ctx.reg_alloc.UseGpr(args[1]).changeBit(bitsize);
     const Xbyak::Reg else_ = ctx.reg_alloc.UseScratchGpr(args[2]).changeBit(bitsize);
@@ -216,6 +283,7 @@ static void EmitConditionalSelect(BlockOfCode& code, EmitContext& ctx, IR::Inst*
         ASSERT_MSG(false, "Invalid cond {}", static_cast<size_t>(args[0].GetImmediateCond()));
     }
 
+    ctx.reg_alloc.SetHostFlagsValue(nullptr);
     ctx.reg_alloc.DefineValue(inst, else_);
 }
 
@@ -961,6 +1029,7 @@ static void EmitAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bit
         code.lahf();
         code.seto(code.al);
         ctx.reg_alloc.DefineValue(nzcv_inst, nzcv);
+        ctx.reg_alloc.SetHostFlagsValue(nzcv_inst);
         ctx.EraseInstruction(nzcv_inst);
     }
     if (carry_inst) {
@@ -1038,6 +1107,7 @@ static void EmitSub(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, int bit
         code.lahf();
         code.seto(code.al);
         ctx.reg_alloc.DefineValue(nzcv_inst, nzcv);
+        ctx.reg_alloc.SetHostFlagsValue(nzcv_inst);
         ctx.EraseInstruction(nzcv_inst);
     }
     if (carry_inst) {
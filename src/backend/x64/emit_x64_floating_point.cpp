@@ -46,11 +46,17 @@ constexpr u64 f32_negative_zero = 0x80000000u;
 constexpr u64 f32_nan = 0x7fc00000u;
 constexpr u64 f32_non_sign_mask = 0x7fffffffu;
 constexpr u64 f32_smallest_normal = 0x00800000u;
+constexpr u64 f32_half = 0x3f000000u;
+constexpr u64 f32_one = 0x3f800000u;
+constexpr u64 f32_integral_limit = 0x4b000000u; // 2^23 as a float (all larger values are integral)
 
 constexpr u64 f64_negative_zero = 0x8000000000000000u;
 constexpr u64 f64_nan = 0x7ff8000000000000u;
 constexpr u64 f64_non_sign_mask = 0x7fffffffffffffffu;
 constexpr u64 f64_smallest_normal = 0x0010000000000000u;
+constexpr u64 f64_half = 0x3fe0000000000000u;
+constexpr u64 f64_one = 0x3ff0000000000000u;
+constexpr u64 f64_integral_limit = 0x4330000000000000u; // 2^52 as a double (all larger values are integral)
 
 constexpr u64 f64_min_s16 = 0xc0e0000000000000u; // -32768 as a double
 constexpr u64 f64_max_s16 = 0x40dfffc000000000u; // 32767 as a double
@@ -328,6 +334,232 @@ void FPThreeOp(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn)
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+// Rounds the scalar in value to an integral value, with ties rounded away from zero.
+// x64 has no such rounding mode, so we truncate and then step away from zero if the discarded fraction is at least one half.
+// When exact is set, the inexact exception is raised if value was not already integral.
+template<size_t fsize>
+void EmitRoundTiesAwayFromZero(BlockOfCode& code, Xbyak::Xmm value, Xbyak::Xmm truncated, Xbyak::Xmm tmp1, Xbyak::Xmm tmp2, bool exact) {
+    static_assert(fsize == 32 || fsize == 64, "fsize must be either 32 or 64");
+
+    FCODE(rounds)(truncated, value, static_cast<u8>(exact ? 0b0011 : 0b1011));
+
+    // tmp1 := mask of |value| < 2^mantissa_width (infinities, NaNs and large values are already integral)
+    // This is an integer comparison so that NaNs do not signal.
+    code.movaps(tmp2, value);
+    code.andps(tmp2, code.MConst(xword, fsize == 32 ? f32_non_sign_mask : f64_non_sign_mask));
+    code.movaps(tmp1, code.MConst(xword, fsize == 32 ? f32_integral_limit : f64_integral_limit));
+    code.pcmpgtd(tmp1, tmp2);
+    if constexpr (fsize == 64) {
+        // The lower word of the limit is zero, so comparing upper words suffices.
+        code.pshufd(tmp1, tmp1, 0b11110101);
+    }
+
+    // tmp2 := |value - truncated|, computed without subtracting infinities
+    code.movaps(tmp2, value);
+    code.andps(tmp2, tmp1);
+    FCODE(subs)(tmp2, truncated);
+    code.andps(tmp2, tmp1);
+    code.andps(tmp2, code.MConst(xword, fsize == 32 ? f32_non_sign_mask : f64_non_sign_mask));
+
+    // tmp2 := copysign(|value - truncated| >= 0.5 ? 1.0 : 0.0, value)
+    FCODE(cmpnlts)(tmp2, code.MConst(xword, fsize == 32 ? f32_half : f64_half));
+    code.andps(tmp2, code.MConst(xword, fsize == 32 ? f32_one : f64_one));
+    code.andps(value, code.MConst(xword, fsize == 32 ? f32_negative_zero : f64_negative_zero));
+    code.orps(tmp2, value);
+
+    FCODE(adds)(truncated, tmp2);
+    code.movaps(value, truncated);
+}
+
+// Converts the double in value to a single, rounding to odd. This is exact on any MXCSR rounding mode:
+// an upwards-rounded result is stepped back towards zero and the least significant bit records inexactness.
+// Rounding to odd followed by a second rounding is equivalent to a single rounding when the intermediate precision
+// is at least two bits wider than the final one. This function also trashes xmm0.
+void EmitConvertDoubleToSingleRoundToOdd(BlockOfCode& code, Xbyak::Xmm value, Xbyak::Xmm tmp1, Xbyak::Xmm tmp2, Xbyak::Xmm tmp3) {
+    code.movaps(tmp1, value);
+    code.cvtsd2ss(value, value);
+    code.cvtss2sd(tmp2, value);
+
+    // NaNs are zeroed here (so their payload is left untouched) and the ordered comparisons below do not signal
+    code.movaps(xmm0, tmp1);
+    code.cmpordsd(xmm0, xmm0);
+    code.andpd(xmm0, code.MConst(xword, f64_non_sign_mask));
+    code.andpd(tmp1, xmm0);
+    code.andpd(tmp2, xmm0);
+
+    code.movaps(tmp3, tmp2);
+    code.cmpltsd(tmp3, tmp1);
+    code.cmpltsd(tmp1, tmp2);
+    code.por(tmp3, tmp1);
+    code.pand(tmp3, code.MConst(xword, 1));
+    code.pand(tmp1, code.MConst(xword, 0xFFFF'FFFF));
+
+    code.paddd(value, tmp1);
+    code.por(value, tmp3);
+}
+
+using HalfFallbackFn = u16(u16, u16, FP::FPCR, FP::FPSR&);
+
+template<size_t nargs, typename FallbackFn>
+void EmitHalfFallbackCall(BlockOfCode& code, EmitContext& ctx, FallbackFn* fallback_fn) {
+    const Xbyak::Reg64 fpcr_param = nargs == 1 ? code.ABI_PARAM2 : code.ABI_PARAM3;
+    const Xbyak::Reg64 fpsr_param = nargs == 1 ? code.ABI_PARAM3 : code.ABI_PARAM4;
+
+    code.mov(fpcr_param.cvt32(), ctx.FPCR().Value());
+    code.lea(fpsr_param, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+    code.CallFunction(fallback_fn);
+}
+
+template<size_t nargs, typename FallbackFn>
+void EmitHalfFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, FallbackFn* fallback_fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    if constexpr (nargs == 1) {
+        ctx.reg_alloc.HostCall(inst, args[0]);
+    } else {
+        ctx.reg_alloc.HostCall(inst, args[0], args[1]);
+    }
+    EmitHalfFallbackCall<nargs>(code, ctx, fallback_fn);
+}
+
+template<size_t nargs, typename FallbackFn>
+void EmitHalfFallbackWithoutRegAlloc(BlockOfCode& code, EmitContext& ctx, Xbyak::Xmm result, Xbyak::Xmm operand1, Xbyak::Xmm operand2, FallbackFn* fallback_fn) {
+    code.sub(rsp, 8);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    code.movd(code.ABI_PARAM1.cvt32(), operand1);
+    code.movzx(code.ABI_PARAM1.cvt32(), code.ABI_PARAM1.cvt16());
+    if constexpr (nargs == 2) {
+        code.movd(code.ABI_PARAM2.cvt32(), operand2);
+        code.movzx(code.ABI_PARAM2.cvt32(), code.ABI_PARAM2.cvt16());
+    }
+    EmitHalfFallbackCall<nargs>(code, ctx, fallback_fn);
+    code.movd(result, code.ABI_RETURN.cvt32());
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    code.add(rsp, 8);
+}
+
+/// Half-precision arithmetic is performed in single-precision, which has more than twice the precision of
+/// half-precision; rounding the single-precision result to half-precision is therefore correctly rounded.
+/// NaNs and results of smallest-normal magnitude (which may have been tiny before rounding) use the soft-float
+/// implementation.
+template<size_t nargs, typename Function, typename FallbackFn>
+void FPHalfOp(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn, FallbackFn* fallback_fn) {
+    static_assert(nargs == 1 || nargs == 2);
+
+    if (!code.HasAVX() || !code.HasF16C() || ctx.FPCR().FZ16()) {
+        EmitHalfFallback<nargs>(code, ctx, inst, fallback_fn);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm operand1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm operand2 = nargs == 2 ? ctx.reg_alloc.UseXmm(args[1]) : operand1;
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg32 tmp_gpr = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    Xbyak::Label end, fallback;
+
+    // The other lanes are cleared so they don't raise spurious exceptions.
+    const Xbyak::Address lower_half_mask = code.MConst(xword, f16_non_sign_mask | f16_negative_zero);
+    code.vpand(result, operand1, lower_half_mask);
+    code.vcvtph2ps(result, result);
+    if constexpr (nargs == 2) {
+        code.vpand(tmp, operand2, lower_half_mask);
+        code.vcvtph2ps(tmp, tmp);
+        (code.*fn)(result, tmp);
+    } else {
+        (code.*fn)(result, result);
+    }
+    code.vcvtps2ph(result, result, 0b100);
+
+    code.movd(tmp_gpr, result);
+    code.and_(tmp_gpr, static_cast<u32>(f16_non_sign_mask));
+    code.cmp(tmp_gpr, static_cast<u32>(FP::FPInfo<u16>::Infinity(false)));
+    code.ja(fallback, code.T_NEAR);
+    code.cmp(tmp_gpr, static_cast<u32>(FP::FPInfo<u16>::implicit_leading_bit));
+    code.je(fallback, code.T_NEAR);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(fallback);
+    EmitHalfFallbackWithoutRegAlloc<nargs>(code, ctx, result, operand1, operand2, fallback_fn);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+/// Half-precision minimum and maximum are exact, so they are computed on integers that order in the same way as the
+/// values they encode. NaNs use the soft-float implementation.
+template<bool is_max>
+void FPHalfMinMax(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, HalfFallbackFn* fallback_fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm operand1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm operand2 = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg32 tmp_gpr = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    Xbyak::Label end, fallback;
+
+    const Xbyak::Address non_sign_mask = code.MConst(xword, f16_non_sign_mask);
+
+    code.movdqa(tmp1, operand1);
+    code.movdqa(tmp2, operand2);
+    code.pand(tmp1, non_sign_mask);
+    code.pand(tmp2, non_sign_mask);
+    code.pcmpgtw(tmp1, code.MConst(xword, FP::FPInfo<u16>::Infinity(false)));
+    code.pcmpgtw(tmp2, code.MConst(xword, FP::FPInfo<u16>::Infinity(false)));
+    code.por(tmp1, tmp2);
+    code.movd(tmp_gpr, tmp1);
+    code.test(tmp_gpr.cvt16(), tmp_gpr.cvt16());
+    code.jnz(fallback, code.T_NEAR);
+
+    const auto flush_denormal = [&](Xbyak::Xmm value, Xbyak::Xmm scratch) {
+        code.movdqa(scratch, value);
+        code.pand(scratch, code.MConst(xword, FP::FPInfo<u16>::exponent_mask));
+        code.pcmpeqw(scratch, code.MConst(xword, 0));
+        code.pand(scratch, non_sign_mask);
+        code.pandn(scratch, value);
+        code.movdqa(value, scratch);
+    };
+
+    // Maps sign-magnitude encodings to two's complement, where -0 orders below +0 as ARM requires.
+    const auto to_ordered = [&](Xbyak::Xmm value, Xbyak::Xmm scratch) {
+        code.movdqa(scratch, value);
+        code.psraw(scratch, 15);
+        code.pand(scratch, non_sign_mask);
+        code.pxor(value, scratch);
+    };
+
+    code.movdqa(result, operand1);
+    code.movdqa(tmp1, operand2);
+    if (ctx.FPCR().FZ16()) {
+        flush_denormal(result, tmp2);
+        flush_denormal(tmp1, tmp2);
+    }
+    to_ordered(result, tmp2);
+    to_ordered(tmp1, tmp2);
+    if constexpr (is_max) {
+        code.pmaxsw(result, tmp1);
+    } else {
+        code.pminsw(result, tmp1);
+    }
+    to_ordered(result, tmp2);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(fallback);
+    EmitHalfFallbackWithoutRegAlloc<2>(code, ctx, result, operand1, operand2, fallback_fn);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 } // anonymous namespace
 
 void EmitX64::EmitFPAbs16(EmitContext& ctx, IR::Inst* inst) {
@@ -384,6 +616,10 @@ void EmitX64::EmitFPNeg64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+void EmitX64::EmitFPAdd16(EmitContext& ctx, IR::Inst* inst) {
+    FPHalfOp<2>(code, ctx, inst, &Xbyak::CodeGenerator::addss, &FP::FPAdd<u16>);
+}
+
 void EmitX64::EmitFPAdd32(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::addss);
 }
@@ -392,6 +628,10 @@ void EmitX64::EmitFPAdd64(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp<64>(code, ctx, inst, &Xbyak::CodeGenerator::addsd);
 }
 
+void EmitX64::EmitFPDiv16(EmitContext& ctx, IR::Inst* inst) {
+    FPHalfOp<2>(code, ctx, inst, &Xbyak::CodeGenerator::divss, &FP::FPDiv<u16>);
+}
+
 void EmitX64::EmitFPDiv32(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::divss);
 }
@@ -545,6 +785,10 @@ static void EmitFPMinMaxNumeric(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
     ctx.reg_alloc.DefineValue(inst, op2);
 }
 
+void EmitX64::EmitFPMax16(EmitContext& ctx, IR::Inst* inst) {
+    FPHalfMinMax<true>(code, ctx, inst, &FP::FPMax<u16>);
+}
+
 void EmitX64::EmitFPMax32(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMinMax<32, true>(code, ctx, inst);
 }
@@ -553,6 +797,10 @@ void EmitX64::EmitFPMax64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMinMax<64, true>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPMaxNumeric16(EmitContext& ctx, IR::Inst* inst) {
+    FPHalfMinMax<true>(code, ctx, inst, &FP::FPMaxNumeric<u16>);
+}
+
 void EmitX64::EmitFPMaxNumeric32(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMinMaxNumeric<32, true>(code, ctx, inst);
 }
@@ -561,6 +809,10 @@ void EmitX64::EmitFPMaxNumeric64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMinMaxNumeric<64, true>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPMin16(EmitContext& ctx, IR::Inst* inst) {
+    FPHalfMinMax<false>(code, ctx, inst, &FP::FPMin<u16>);
+}
+
 void EmitX64::EmitFPMin32(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMinMax<32, false>(code, ctx, inst);
 }
@@ -569,6 +821,10 @@ void EmitX64::EmitFPMin64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMinMax<64, false>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPMinNumeric16(EmitContext& ctx, IR::Inst* inst) {
+    FPHalfMinMax<false>(code, ctx, inst, &FP::FPMinNumeric<u16>);
+}
+
 void EmitX64::EmitFPMinNumeric32(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMinMaxNumeric<32, false>(code, ctx, inst);
 }
@@ -577,6 +833,10 @@ void EmitX64::EmitFPMinNumeric64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPMinMaxNumeric<64, false>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPMul16(EmitContext& ctx, IR::Inst* inst) {
+    FPHalfOp<2>(code, ctx, inst, &Xbyak::CodeGenerator::mulss, &FP::FPMul<u16>);
+}
+
 void EmitX64::EmitFPMul32(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::mulss);
 }
@@ -589,12 +849,88 @@ template<size_t fsize>
 static void EmitFPMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     using FPT = mp::unsigned_integer_of_size<fsize>;
 
-    if constexpr (fsize != 16) {
-        if (code.HasFMA()) {
+    const auto emit_host_call = [&](Xbyak::Xmm result, Xbyak::Xmm operand1, Xbyak::Xmm operand2, Xbyak::Xmm operand3) {
+        code.sub(rsp, 8);
+        ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        code.movq(code.ABI_PARAM1, operand1);
+        code.movq(code.ABI_PARAM2, operand2);
+        code.movq(code.ABI_PARAM3, operand3);
+        code.mov(code.ABI_PARAM4.cvt32(), ctx.FPCR().Value());
+#ifdef _WIN32
+        code.sub(rsp, 16 + ABI_SHADOW_SPACE);
+        code.lea(rax, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+        code.mov(qword[rsp + ABI_SHADOW_SPACE], rax);
+        code.CallFunction(&FP::FPMulAdd<FPT>);
+        code.add(rsp, 16 + ABI_SHADOW_SPACE);
+#else
+        code.lea(code.ABI_PARAM5, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
+        code.CallFunction(&FP::FPMulAdd<FPT>);
+#endif
+        code.movq(result, code.ABI_RETURN);
+        ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+        code.add(rsp, 8);
+    };
+
+    if constexpr (fsize == 16) {
+        // Half-precision operands are widened to double-precision, where the product is exact and the sum is either
+        // exact or only rounded in bits that cannot affect the final result. Narrowing then rounds once, as the
+        // intermediate single-precision conversion rounds to odd.
+        if (code.HasFMA() && code.HasF16C() && !ctx.FPCR().FZ16()) {
             auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
             Xbyak::Label end, fallback;
 
+            const Xbyak::Xmm operand1 = ctx.reg_alloc.UseXmm(args[0]);
+            const Xbyak::Xmm operand2 = ctx.reg_alloc.UseXmm(args[1]);
+            const Xbyak::Xmm operand3 = ctx.reg_alloc.UseXmm(args[2]);
+            const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm tmp3 = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Reg32 tmp_gpr = ctx.reg_alloc.ScratchGpr().cvt32();
+
+            // The other lanes are cleared so they don't raise spurious exceptions.
+            const Xbyak::Address lower_half_mask = code.MConst(xword, f16_non_sign_mask | f16_negative_zero);
+            code.vpand(result, operand1, lower_half_mask);
+            code.vpand(tmp1, operand2, lower_half_mask);
+            code.vpand(tmp2, operand3, lower_half_mask);
+            code.vcvtph2ps(result, result);
+            code.vcvtph2ps(tmp1, tmp1);
+            code.vcvtph2ps(tmp2, tmp2);
+            code.vcvtss2sd(result, result, result);
+            code.vcvtss2sd(tmp1, tmp1, tmp1);
+            code.vcvtss2sd(tmp2, tmp2, tmp2);
+
+            code.vfmadd231sd(result, tmp1, tmp2);
+
+            EmitConvertDoubleToSingleRoundToOdd(code, result, tmp1, tmp2, tmp3);
+            code.pand(result, code.MConst(xword, f32_non_sign_mask | f32_negative_zero));
+            code.vcvtps2ph(result, result, 0b100);
+
+            // NaNs require ARM's NaN selection, and results of smallest-normal magnitude may have been tiny before rounding.
+            code.movd(tmp_gpr, result);
+            code.and_(tmp_gpr, static_cast<u32>(f16_non_sign_mask));
+            code.cmp(tmp_gpr, static_cast<u32>(FP::FPInfo<u16>::Infinity(false)));
+            code.ja(fallback, code.T_NEAR);
+            code.cmp(tmp_gpr, static_cast<u32>(FP::FPInfo<u16>::implicit_leading_bit));
+            code.je(fallback, code.T_NEAR);
+            code.L(end);
+
+            code.SwitchToFarCode();
+            code.L(fallback);
+            emit_host_call(result, operand1, operand2, operand3);
+            code.jmp(end, code.T_NEAR);
+            code.SwitchToNearCode();
+
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+    } else {
+        if (code.HasFMA()) {
+            auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+            Xbyak::Label end, fallback, nan;
+
             const Xbyak::Xmm operand1 = ctx.reg_alloc.UseXmm(args[0]);
             const Xbyak::Xmm operand2 = ctx.reg_alloc.UseXmm(args[1]);
             const Xbyak::Xmm operand3 = ctx.reg_alloc.UseXmm(args[2]);
@@ -613,26 +949,32 @@ static void EmitFPMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
             code.SwitchToFarCode();
             code.L(fallback);
 
+            code.jp(nan, code.T_NEAR);
+
+            // x64 detects tininess after rounding whereas ARM detects it before rounding. A result of smallest-normal
+            // magnitude was tiny before rounding iff the same operation rounded towards zero is subnormal.
             code.sub(rsp, 8);
-            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
-            code.movq(code.ABI_PARAM1, operand1);
-            code.movq(code.ABI_PARAM2, operand2);
-            code.movq(code.ABI_PARAM3, operand3);
-            code.mov(code.ABI_PARAM4.cvt32(), ctx.FPCR().Value());
-#ifdef _WIN32
-            code.sub(rsp, 16 + ABI_SHADOW_SPACE);
-            code.lea(rax, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
-            code.mov(qword[rsp + ABI_SHADOW_SPACE], rax);
-            code.CallFunction(&FP::FPMulAdd<FPT>);
-            code.add(rsp, 16 + ABI_SHADOW_SPACE);
-#else
-            code.lea(code.ABI_PARAM5, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
-            code.CallFunction(&FP::FPMulAdd<FPT>);
-#endif
-            code.movq(result, code.ABI_RETURN);
-            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            code.stmxcsr(dword[rsp]);
+            code.stmxcsr(dword[rsp + 4]);
+            code.or_(dword[rsp + 4], 0x6000);
+            code.ldmxcsr(dword[rsp + 4]);
+            code.movaps(tmp, operand1);
+            FCODE(vfmadd231s)(tmp, operand2, operand3);
+            code.ldmxcsr(dword[rsp]);
             code.add(rsp, 8);
 
+            code.andps(tmp, code.MConst(xword, fsize == 32 ? f32_non_sign_mask : f64_non_sign_mask));
+            FCODE(ucomis)(tmp, code.MConst(xword, fsize == 32 ? f32_smallest_normal : f64_smallest_normal));
+            code.jae(end, code.T_NEAR);
+
+            code.or_(dword[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc], 1 << 3); // UFC
+            if (ctx.FPCR().FZ()) {
+                code.andps(result, code.MConst(xword, fsize == 32 ? f32_negative_zero : f64_negative_zero));
+            }
+            code.jmp(end, code.T_NEAR);
+
+            code.L(nan);
+            emit_host_call(result, operand1, operand2, operand3);
             code.jmp(end, code.T_NEAR);
             code.SwitchToNearCode();
 
@@ -886,18 +1228,61 @@ static void EmitFPRound(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, siz
     const bool exact = inst->GetArg(2).GetU1();
     const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode);
 
-    if (fsize != 16 && code.HasSSE41() && round_imm && !exact) {
+    const bool ties_away = rounding_mode == FP::RoundingMode::ToNearest_TieAwayFromZero;
+
+    if (code.HasSSE41() && (round_imm || ties_away)) {
+        // The precision exception is only left unsuppressed when the instruction is required to raise it.
+        const u8 precision_mask = exact ? 0b0000 : 0b1000;
+
+        const auto round = [&](auto fsize_tag, Xbyak::Xmm result) {
+            constexpr size_t rsize = decltype(fsize_tag)::value;
+            if (ties_away) {
+                EmitRoundTiesAwayFromZero<rsize>(code, result, ctx.reg_alloc.ScratchXmm(), ctx.reg_alloc.ScratchXmm(), ctx.reg_alloc.ScratchXmm(), exact);
+            } else if constexpr (rsize == 64) {
+                code.roundsd(result, result, static_cast<u8>(*round_imm | precision_mask));
+            } else {
+                code.roundss(result, result, static_cast<u8>(*round_imm | precision_mask));
+            }
+        };
+
         if (fsize == 64) {
             FPTwoOp<64>(code, ctx, inst, [&](Xbyak::Xmm result) {
-                code.roundsd(result, result, *round_imm);
+                round(std::integral_constant<size_t, 64>{}, result);
             });
-        } else {
+            return;
+        }
+
+        if (fsize == 32) {
             FPTwoOp<32>(code, ctx, inst, [&](Xbyak::Xmm result) {
-                code.roundss(result, result, *round_imm);
+                round(std::integral_constant<size_t, 32>{}, result);
             });
+            return;
         }
 
-        return;
+        // Half-precision values are widened exactly to single-precision. Every integral result is representable in
+        // half-precision, so narrowing again is exact.
+        if (code.HasF16C() && !ctx.FPCR().FZ16()) {
+            auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+            const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+            Xbyak::Label end;
+
+            // Clear the other lanes so they don't raise spurious exceptions.
+            code.pand(result, code.MConst(xword, f16_non_sign_mask | f16_negative_zero));
+            code.vcvtph2ps(result, result);
+            if (!ctx.FPCR().DN()) {
+                end = ProcessNaN<32>(code, result);
+            }
+            round(std::integral_constant<size_t, 32>{}, result);
+            if (ctx.FPCR().DN()) {
+                ForceToDefaultNaN<32>(code, result);
+            }
+            code.L(end);
+            code.vcvtps2ph(result, result, 0b00);
+
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
     }
 
     using fsize_list = mp::list<mp::lift_value<size_t(16)>,
@@ -1082,6 +1467,10 @@ void EmitX64::EmitFPRSqrtStepFused64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPRSqrtStepFused<64>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPSqrt16(EmitContext& ctx, IR::Inst* inst) {
+    FPHalfOp<1>(code, ctx, inst, &Xbyak::CodeGenerator::sqrtss, &FP::FPSqrt<u16>);
+}
+
 void EmitX64::EmitFPSqrt32(EmitContext& ctx, IR::Inst* inst) {
     FPTwoOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::sqrtss);
 }
@@ -1090,6 +1479,10 @@ void EmitX64::EmitFPSqrt64(EmitContext& ctx, IR::Inst* inst) {
     FPTwoOp<64>(code, ctx, inst, &Xbyak::CodeGenerator::sqrtsd);
 }
 
+void EmitX64::EmitFPSub16(EmitContext& ctx, IR::Inst* inst) {
+    FPHalfOp<2>(code, ctx, inst, &Xbyak::CodeGenerator::subss, &FP::FPSub<u16>);
+}
+
 void EmitX64::EmitFPSub32(EmitContext& ctx, IR::Inst* inst) {
     FPThreeOp<32>(code, ctx, inst, &Xbyak::CodeGenerator::subss);
 }
@@ -1209,24 +1602,15 @@ void EmitX64::EmitFPHalfToSingle(EmitContext& ctx, IR::Inst* inst) {
 
 void EmitX64::EmitFPSingleToDouble(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    const auto rounding_mode = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
 
-    // We special-case the non-IEEE-defined ToOdd rounding mode.
-    if (rounding_mode == ctx.FPCR().RMode() && rounding_mode != FP::RoundingMode::ToOdd) {
-        const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    // Widening is exact, so the rounding mode is irrelevant.
+    const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
 
-        code.cvtss2sd(result, result);
-        if (ctx.FPCR().DN()) {
-            ForceToDefaultNaN<64>(code, result);
-        }
-        ctx.reg_alloc.DefineValue(inst, result);
-    } else {
-        ctx.reg_alloc.HostCall(inst, args[0]);
-        code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
-        code.mov(code.ABI_PARAM3.cvt32(), static_cast<u32>(rounding_mode));
-        code.lea(code.ABI_PARAM4, code.ptr[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc]);
-        code.CallFunction(&FP::FPConvert<u64, u32>);
+    code.cvtss2sd(result, result);
+    if (ctx.FPCR().DN()) {
+        ForceToDefaultNaN<64>(code, result);
     }
+    ctx.reg_alloc.DefineValue(inst, result);
 }
 
 void EmitX64::EmitFPSingleToHalf(EmitContext& ctx, IR::Inst* inst) {
@@ -1234,7 +1618,7 @@ void EmitX64::EmitFPSingleToHalf(EmitContext& ctx, IR::Inst* inst) {
     const auto rounding_mode = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
     const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode);
 
-    if (code.HasF16C() && !ctx.FPCR().AHP() && !ctx.FPCR().FZ16()) {
+    if (code.HasF16C() && !ctx.FPCR().AHP() && !ctx.FPCR().FZ16() && round_imm) {
         const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
 
         if (ctx.FPCR().DN()) {
@@ -1256,9 +1640,24 @@ void EmitX64::EmitFPSingleToHalf(EmitContext& ctx, IR::Inst* inst) {
 void EmitX64::EmitFPDoubleToHalf(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const auto rounding_mode = static_cast<FP::RoundingMode>(args[1].GetImmediateU8());
+    const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode);
 
-    // NOTE: Do not double-convert here as that is inaccurate.
-    //       To be accurate, the first conversion would need to be "round-to-odd", which x64 doesn't support.
+    // NOTE: A naive double-conversion here is inaccurate. The first conversion must round to odd, which x64 doesn't
+    //       support natively. Flush-to-zero would flush the single-precision intermediate, so leave that to the fallback.
+    if (code.HasF16C() && !ctx.FPCR().AHP() && !ctx.FPCR().FZ16() && !ctx.FPCR().FZ() && round_imm) {
+        const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+        EmitConvertDoubleToSingleRoundToOdd(code, result, ctx.reg_alloc.ScratchXmm(), ctx.reg_alloc.ScratchXmm(), ctx.reg_alloc.ScratchXmm());
+        if (ctx.FPCR().DN()) {
+            ForceToDefaultNaN<32>(code, result);
+        }
+        // Clear the other lanes so they don't raise spurious exceptions.
+        code.pand(result, code.MConst(xword, f32_non_sign_mask | f32_negative_zero));
+        code.vcvtps2ph(result, result, static_cast<u8>(*round_imm));
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
 
     ctx.reg_alloc.HostCall(inst, args[0]);
     code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
@@ -1280,6 +1679,14 @@ void EmitX64::EmitFPDoubleToSingle(EmitContext& ctx, IR::Inst* inst) {
             ForceToDefaultNaN<32>(code, result);
         }
         ctx.reg_alloc.DefineValue(inst, result);
+    } else if (rounding_mode == FP::RoundingMode::ToOdd && !ctx.FPCR().FZ()) {
+        const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+        EmitConvertDoubleToSingleRoundToOdd(code, result, ctx.reg_alloc.ScratchXmm(), ctx.reg_alloc.ScratchXmm(), ctx.reg_alloc.ScratchXmm());
+        if (ctx.FPCR().DN()) {
+            ForceToDefaultNaN<32>(code, result);
+        }
+        ctx.reg_alloc.DefineValue(inst, result);
     } else {
         ctx.reg_alloc.HostCall(inst, args[0]);
         code.mov(code.ABI_PARAM2.cvt32(), ctx.FPCR().Value());
@@ -1296,10 +1703,13 @@ static void EmitFPToFixed(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     const size_t fbits = args[1].GetImmediateU8();
     const auto rounding_mode = static_cast<FP::RoundingMode>(args[2].GetImmediateU8());
 
-    if constexpr (fsize != 16) {
+    {
         const auto round_imm = ConvertRoundingModeToX64Immediate(rounding_mode);
+        const bool ties_away = rounding_mode == FP::RoundingMode::ToNearest_TieAwayFromZero;
+        // Half-precision values are widened exactly to single-precision, and scaling them by up to 2^64 cannot overflow.
+        const bool supported_fsize = fsize != 16 || (code.HasF16C() && !ctx.FPCR().FZ16());
 
-        if (code.HasSSE41() && round_imm){
+        if (code.HasSSE41() && (round_imm || ties_away) && supported_fsize) {
             const Xbyak::Xmm src = ctx.reg_alloc.UseScratchXmm(args[0]);
             const Xbyak::Xmm scratch = ctx.reg_alloc.ScratchXmm();
             const Xbyak::Reg64 result = ctx.reg_alloc.ScratchGpr().cvt64();
@@ -1310,14 +1720,27 @@ static void EmitFPToFixed(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
                     code.mulsd(src, code.MConst(xword, scale_factor));
                 }
 
-                code.roundsd(src, src, *round_imm);
+                if (ties_away) {
+                    EmitRoundTiesAwayFromZero<64>(code, src, scratch, ctx.reg_alloc.ScratchXmm(), ctx.reg_alloc.ScratchXmm(), true);
+                } else {
+                    code.roundsd(src, src, *round_imm);
+                }
             } else {
+                if constexpr (fsize == 16) {
+                    code.pand(src, code.MConst(xword, f16_non_sign_mask | f16_negative_zero));
+                    code.vcvtph2ps(src, src);
+                }
+
                 if (fbits != 0) {
                     const u32 scale_factor = static_cast<u32>((fbits + 127) << 23);
                     code.mulss(src, code.MConst(xword, scale_factor));
                 }
 
-                code.roundss(src, src, *round_imm);
+                if (ties_away) {
+                    EmitRoundTiesAwayFromZero<32>(code, src, scratch, ctx.reg_alloc.ScratchXmm(), ctx.reg_alloc.ScratchXmm(), true);
+                } else {
+                    code.roundss(src, src, *round_imm);
+                }
                 code.cvtss2sd(src, src);
             }
 
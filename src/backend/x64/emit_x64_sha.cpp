@@ -0,0 +1,349 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2018 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "backend/x64/block_of_code.h"
+#include "backend/x64/emit_x64.h"
+#include "common/bit_util.h"
+#include "common/common_types.h"
+#include "frontend/ir/microinstruction.h"
+
+namespace Dynarmic::Backend::X64 {
+
+using namespace Xbyak::util;
+
+// Loads the four 32-bit elements of source into the low halves of words[0..3]. The upper halves are undefined.
+static void EmitLoadWords(BlockOfCode& code, const std::array<Xbyak::Reg64, 4>& words, const Xbyak::Xmm& source, const Xbyak::Xmm& tmp) {
+    code.movq(words[0], source);
+    code.mov(words[1], words[0]);
+    code.shr(words[1], 32);
+    code.pshufd(tmp, source, 0b11101110);
+    code.movq(words[2], tmp);
+    code.mov(words[3], words[2]);
+    code.shr(words[3], 32);
+}
+
+// Packs the low halves of words[0..3] into result. Clobbers words.
+static void EmitStoreWords(BlockOfCode& code, const Xbyak::Xmm& result, const std::array<Xbyak::Reg64, 4>& words, const Xbyak::Xmm& tmp) {
+    code.mov(words[0].cvt32(), words[0].cvt32());
+    code.shl(words[1], 32);
+    code.or_(words[1], words[0]);
+    code.movq(result, words[1]);
+    code.mov(words[2].cvt32(), words[2].cvt32());
+    code.shl(words[3], 32);
+    code.or_(words[3], words[2]);
+    code.movq(tmp, words[3]);
+    code.punpcklqdq(result, tmp);
+}
+
+// accumulator += the next 32-bit element of w, which is shifted down to expose the following element.
+static void EmitAddNextWord(BlockOfCode& code, const Xbyak::Reg32& accumulator, const Xbyak::Xmm& w, const Xbyak::Reg32& tmp) {
+    code.movd(tmp, w);
+    code.add(accumulator, tmp);
+    code.psrldq(w, 4);
+}
+
+// Majority(x, y, z) == (x & y) + (z & (x ^ y)), as the two terms have no bits in common.
+static void EmitAddMajority(BlockOfCode& code, const Xbyak::Reg32& accumulator, const Xbyak::Reg32& x, const Xbyak::Reg32& y, const Xbyak::Reg32& z, const Xbyak::Reg32& tmp) {
+    code.mov(tmp, x);
+    code.and_(tmp, y);
+    code.add(accumulator, tmp);
+    code.mov(tmp, x);
+    code.xor_(tmp, y);
+    code.and_(tmp, z);
+    code.add(accumulator, tmp);
+}
+
+// SHA1RNDS4 adds the round constant itself and expects the working variables with A in the uppermost word,
+// whereas the guest operands have A in the lowest word and the constant already folded into w.
+static void EmitSHA1HashUpdate(EmitContext& ctx, BlockOfCode& code, IR::Inst* inst, u8 function, u32 round_constant) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.HasSHA()) {
+        const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+        const Xbyak::Xmm w = ctx.reg_alloc.UseScratchXmm(args[2]);
+
+        const u64 k = Common::Replicate<u64>(round_constant, 32);
+
+        code.psubd(w, code.MConst(xword, k, k));
+        code.pshufd(w, w, 0b00011011);
+        code.pslldq(y, 12);
+        code.paddd(w, y);
+        code.pshufd(x, x, 0b00011011);
+        code.sha1rnds4(x, w, function);
+        code.pshufd(x, x, 0b00011011);
+
+        ctx.reg_alloc.DefineValue(inst, x);
+        return;
+    }
+
+    // Four rounds in general purpose registers. Rather than moving the working variables
+    // between rounds, the registers holding them are renamed.
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm w = ctx.reg_alloc.UseScratchXmm(args[2]);
+    std::array<Xbyak::Reg64, 4> words;
+    for (auto& word : words) {
+        word = ctx.reg_alloc.ScratchGpr();
+    }
+    Xbyak::Reg64 e = ctx.reg_alloc.ScratchGpr();
+    const Xbyak::Reg32 tmp = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    EmitLoadWords(code, words, x, x);
+    code.movd(e.cvt32(), y);
+
+    for (size_t i = 0; i < 4; i++) {
+        const Xbyak::Reg32 a = words[0].cvt32();
+        const Xbyak::Reg32 b = words[1].cvt32();
+        const Xbyak::Reg32 c = words[2].cvt32();
+        const Xbyak::Reg32 d = words[3].cvt32();
+
+        switch (function) {
+        case 0: // Choose
+            code.mov(tmp, c);
+            code.xor_(tmp, d);
+            code.and_(tmp, b);
+            code.xor_(tmp, d);
+            code.add(e.cvt32(), tmp);
+            break;
+        case 1: // Parity
+            code.mov(tmp, b);
+            code.xor_(tmp, c);
+            code.xor_(tmp, d);
+            code.add(e.cvt32(), tmp);
+            break;
+        case 2: // Majority
+            EmitAddMajority(code, e.cvt32(), b, c, d, tmp);
+            break;
+        }
+
+        code.mov(tmp, a);
+        code.rol(tmp, 5);
+        code.add(e.cvt32(), tmp);
+        EmitAddNextWord(code, e.cvt32(), w, tmp);
+        code.ror(b, 2);
+
+        // {a, b, c, d, e} becomes {e, a, b, c, d}
+        std::swap(e, words[3]);
+        std::rotate(words.begin(), words.begin() + 3, words.end());
+    }
+
+    EmitStoreWords(code, x, words, w);
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
+void EmitX64::EmitSHA1HashUpdateChoose(EmitContext& ctx, IR::Inst* inst) {
+    EmitSHA1HashUpdate(ctx, code, inst, 0, 0x5A827999);
+}
+
+void EmitX64::EmitSHA1HashUpdateParity(EmitContext& ctx, IR::Inst* inst) {
+    EmitSHA1HashUpdate(ctx, code, inst, 1, 0x6ED9EBA1);
+}
+
+void EmitX64::EmitSHA1HashUpdateMajority(EmitContext& ctx, IR::Inst* inst) {
+    EmitSHA1HashUpdate(ctx, code, inst, 2, 0x8F1BBCDC);
+}
+
+void EmitX64::EmitSHA256Hash(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const bool part1 = args[3].GetImmediateU1();
+
+    if (code.HasSHA()) {
+        //        3   2   1   0
+        // x    = d   c   b   a
+        // y    = h   g   f   e
+        // abef = a   b   e   f
+        // cdgh = c   d   g   h
+        const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm w = ctx.reg_alloc.UseXmm(args[2]);
+        const Xbyak::Xmm abef = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm cdgh = ctx.reg_alloc.ScratchXmm();
+
+        code.movaps(abef, y);
+        code.shufps(abef, x, 0b00010001);
+        code.movaps(cdgh, y);
+        code.shufps(cdgh, x, 0b10111011);
+
+        // Each SHA256RNDS2 performs two rounds with the schedule words taken from xmm0,
+        // leaving the previous abef as the new cdgh.
+        code.movaps(xmm0, w);
+        code.sha256rnds2(cdgh, abef);
+        code.pshufd(xmm0, w, 0b00001110);
+        code.sha256rnds2(abef, cdgh);
+
+        code.shufps(abef, cdgh, part1 ? 0b10111011 : 0b00010001);
+
+        ctx.reg_alloc.DefineValue(inst, abef);
+        return;
+    }
+
+    // Four rounds in general purpose registers, renaming rather than moving the working variables.
+    // The round temporary is accumulated in the register of the element of y each round discards,
+    // and the new element of y in that of the element of x each round discards.
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm w = ctx.reg_alloc.UseScratchXmm(args[2]);
+    std::array<Xbyak::Reg64, 4> x_words;
+    std::array<Xbyak::Reg64, 4> y_words;
+    for (auto& word : x_words) {
+        word = ctx.reg_alloc.ScratchGpr();
+    }
+    for (auto& word : y_words) {
+        word = ctx.reg_alloc.ScratchGpr();
+    }
+    const Xbyak::Reg32 tmp = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    EmitLoadWords(code, x_words, x, x);
+    EmitLoadWords(code, y_words, y, y);
+
+    for (size_t i = 0; i < 4; i++) {
+        const Xbyak::Reg32 t = y_words[3].cvt32();
+        const Xbyak::Reg32 e = y_words[0].cvt32();
+        const Xbyak::Reg32 a = x_words[0].cvt32();
+
+        // Sigma1(e) == ROR(e ^ ROR(e, 5) ^ ROR(e, 19), 6)
+        code.mov(tmp, e);
+        code.ror(tmp, 14);
+        code.xor_(tmp, e);
+        code.ror(tmp, 5);
+        code.xor_(tmp, e);
+        code.ror(tmp, 6);
+        code.add(t, tmp);
+
+        // Choose(e, f, g)
+        code.mov(tmp, y_words[1].cvt32());
+        code.xor_(tmp, y_words[2].cvt32());
+        code.and_(tmp, e);
+        code.xor_(tmp, y_words[2].cvt32());
+        code.add(t, tmp);
+
+        EmitAddNextWord(code, t, w, tmp);
+
+        code.add(x_words[3].cvt32(), t);
+
+        // Sigma0(a) == ROR(a ^ ROR(a, 11) ^ ROR(a, 20), 2)
+        code.mov(tmp, a);
+        code.ror(tmp, 9);
+        code.xor_(tmp, a);
+        code.ror(tmp, 11);
+        code.xor_(tmp, a);
+        code.ror(tmp, 2);
+        code.add(t, tmp);
+
+        EmitAddMajority(code, t, a, x_words[1].cvt32(), x_words[2].cvt32(), tmp);
+
+        // x becomes {t, a, b, c} and y becomes {d + t, e, f, g}
+        std::swap(x_words[3], y_words[3]);
+        std::rotate(x_words.begin(), x_words.begin() + 3, x_words.end());
+        std::rotate(y_words.begin(), y_words.begin() + 3, y_words.end());
+    }
+
+    EmitStoreWords(code, part1 ? x : y, part1 ? x_words : y_words, w);
+
+    ctx.reg_alloc.DefineValue(inst, part1 ? x : y);
+}
+
+// result = ROR(data, rotate1) ^ ROR(data, rotate2) ^ (data >> shift), for each 32-bit element
+static void EmitSHA256Sigma(BlockOfCode& code, const Xbyak::Xmm& result, const Xbyak::Xmm& data, const Xbyak::Xmm& tmp, u8 rotate1, u8 rotate2, u8 shift) {
+    code.movdqa(result, data);
+    code.psrld(result, shift);
+    code.movdqa(tmp, data);
+    code.psrld(tmp, rotate1);
+    code.pxor(result, tmp);
+    code.movdqa(tmp, data);
+    code.psrld(tmp, rotate2);
+    code.pxor(result, tmp);
+    code.movdqa(tmp, data);
+    code.pslld(tmp, 32 - rotate1);
+    code.pxor(result, tmp);
+    code.movdqa(tmp, data);
+    code.pslld(tmp, 32 - rotate2);
+    code.pxor(result, tmp);
+}
+
+void EmitX64::EmitSHA256MessageSchedule0(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.HasSHA()) {
+        const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+
+        code.sha256msg1(x, y);
+
+        ctx.reg_alloc.DefineValue(inst, x);
+        return;
+    }
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm t = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    // t = {x[1], x[2], x[3], y[0]}
+    code.movdqa(t, x);
+    code.psrldq(t, 4);
+    code.pslldq(y, 12);
+    code.por(t, y);
+
+    EmitSHA256Sigma(code, y, t, tmp, 7, 18, 3);
+    code.paddd(x, y);
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
+void EmitX64::EmitSHA256MessageSchedule1(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.HasSHA()) {
+        const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm z = ctx.reg_alloc.UseXmm(args[2]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+
+        code.movaps(result, z);
+        code.palignr(result, y, 4);
+        code.paddd(result, x);
+        code.sha256msg2(result, z);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm z = ctx.reg_alloc.UseScratchXmm(args[2]);
+    const Xbyak::Xmm lower_half = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm upper_half = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    // y = x + {y[1], y[2], y[3], z[0]}
+    code.psrldq(y, 4);
+    code.movdqa(tmp, z);
+    code.pslldq(tmp, 12);
+    code.por(y, tmp);
+    code.paddd(y, x);
+
+    // The lower two words depend only on z[2] and z[3]; the upper two depend on the lower two.
+    code.pshufd(z, z, 0b11111110);
+    EmitSHA256Sigma(code, lower_half, z, tmp, 17, 19, 10);
+    code.paddd(lower_half, y);
+
+    code.movdqa(z, lower_half);
+    code.pslldq(z, 8);
+    EmitSHA256Sigma(code, upper_half, z, tmp, 17, 19, 10);
+    code.paddd(upper_half, y);
+
+    code.movsd(upper_half, lower_half);
+
+    ctx.reg_alloc.DefineValue(inst, upper_half);
+}
+
+} // namespace Dynarmic::Backend::X64
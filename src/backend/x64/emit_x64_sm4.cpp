@@ -3,18 +3,57 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <array>
+
+#include "backend/x64/abi.h"
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/emit_x64.h"
+#include "common/common_types.h"
 #include "common/crypto/sm4.h"
 #include "frontend/ir/microinstruction.h"
 
 namespace Dynarmic::Backend::X64 {
 
+using namespace Xbyak::util;
+
 void EmitX64::EmitSM4AccessSubstitutionBox(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
-    ctx.reg_alloc.HostCall(inst, args[0]);
-    code.CallFunction(&Common::Crypto::SM4::AccessSubstitutionBox);
+    if (code.HasGFNI()) {
+        // The SM4 S-box is an affine transform of an inversion in GF(2^8). As all fields of that order are
+        // isomorphic, it can be evaluated with the AES-field inversion of GF2P8AFFINEINVQB by folding the
+        // change of basis into the affine transforms on either side.
+        const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+        code.gf2p8affineqb(data, code.MConst(xword, 0x4C287DB91A22505D, 0x4C287DB91A22505D), 0x3E);
+        code.gf2p8affineinvqb(data, code.MConst(xword, 0xF3AB34A974A6B589, 0xF3AB34A974A6B589), 0xD3);
+
+        ctx.reg_alloc.DefineValue(inst, data);
+        return;
+    }
+
+    constexpr u32 stack_space = 16;
+    const Xbyak::Xmm input = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+
+    ctx.reg_alloc.HostCall(nullptr);
+    code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE]);
+    code.movaps(xword[code.ABI_PARAM1], input);
+    code.CallLambda(
+        [](std::array<u8, 16>& data) {
+            for (u8& byte : data) {
+                byte = Common::Crypto::SM4::AccessSubstitutionBox(byte);
+            }
+        }
+    );
+    code.movaps(result, xword[rsp + ABI_SHADOW_SPACE]);
+
+    code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    ctx.reg_alloc.DefineValue(inst, result);
 }
 
 } // namespace Dynarmic::Backend::X64
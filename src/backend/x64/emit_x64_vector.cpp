@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <bitset>
 #include <cstdlib>
+#include <optional>
 #include <type_traits>
 
 #include <mp/traits/function_info.h>
@@ -41,12 +42,24 @@ template <typename Function>
 static void EmitAVXVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
-    const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseXmm(args[0]);
     const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
 
-    (code.*fn)(xmm_a, xmm_a, xmm_b);
+    (code.*fn)(result, xmm_a, xmm_b);
 
-    ctx.reg_alloc.DefineValue(inst, xmm_a);
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+// The three-operand VEX form leaves both sources intact, so no copy is needed when the first argument is still live.
+template <typename Function>
+static void EmitVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn, void (Xbyak::CodeGenerator::*avx_fn)(const Xbyak::Xmm&, const Xbyak::Xmm&, const Xbyak::Operand&)) {
+    if (code.HasAVX()) {
+        EmitAVXVectorOperation(code, ctx, inst, avx_fn);
+        return;
+    }
+
+    EmitVectorOperation(code, ctx, inst, fn);
 }
 
 template <typename Lambda>
@@ -151,6 +164,37 @@ static void EmitTwoArgumentFallback(BlockOfCode& code, EmitContext& ctx, IR::Ins
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+template <typename Lambda>
+static void EmitThreeArgumentFallbackWithSaturation(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lambda lambda) {
+    const auto fn = static_cast<mp::equivalent_function_type<Lambda>*>(lambda);
+    constexpr u32 stack_space = 4 * 16;
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const Xbyak::Xmm arg1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm arg2 = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm arg3 = ctx.reg_alloc.UseXmm(args[2]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+
+    ctx.reg_alloc.HostCall(nullptr);
+    code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
+    code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE + 0 * 16]);
+    code.lea(code.ABI_PARAM2, ptr[rsp + ABI_SHADOW_SPACE + 1 * 16]);
+    code.lea(code.ABI_PARAM3, ptr[rsp + ABI_SHADOW_SPACE + 2 * 16]);
+    code.lea(code.ABI_PARAM4, ptr[rsp + ABI_SHADOW_SPACE + 3 * 16]);
+
+    code.movaps(xword[code.ABI_PARAM2], arg1);
+    code.movaps(xword[code.ABI_PARAM3], arg2);
+    code.movaps(xword[code.ABI_PARAM4], arg3);
+    code.CallFunction(fn);
+    code.movaps(result, xword[rsp + ABI_SHADOW_SPACE + 0 * 16]);
+
+    code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+
+    code.or_(code.byte[code.r15 + code.GetJitStateInfo().offsetof_fpsr_qc], code.ABI_RETURN.cvt8());
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 void EmitX64::EmitVectorGetElement8(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     ASSERT(args[1].IsImmediate());
@@ -419,23 +463,23 @@ void EmitX64::EmitVectorAbs64(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorAdd8(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddb);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddb, &Xbyak::CodeGenerator::vpaddb);
 }
 
 void EmitX64::EmitVectorAdd16(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddw);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddw, &Xbyak::CodeGenerator::vpaddw);
 }
 
 void EmitX64::EmitVectorAdd32(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddd);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddd, &Xbyak::CodeGenerator::vpaddd);
 }
 
 void EmitX64::EmitVectorAdd64(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddq);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::paddq, &Xbyak::CodeGenerator::vpaddq);
 }
 
 void EmitX64::EmitVectorAnd(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pand);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pand, &Xbyak::CodeGenerator::vpand);
 }
 
 static void ArithmeticShiftRightByte(EmitContext& ctx, BlockOfCode& code, const Xbyak::Xmm& result, u8 shift_amount) {
@@ -533,7 +577,127 @@ static constexpr T VShift(T x, T y) {
     return static_cast<T>(static_cast<unsigned_type>(x) << static_cast<unsigned_type>(shift_amount));
 }
 
+// Variable shift of 8-bit (or 16-bit) elements, implemented with the variable shifts of AVX-512BW (or AVX2)
+// which operate on 16-bit (or 32-bit) lanes. Even and odd elements are each widened to fill a lane, shifted,
+// and then recombined.
+static void EmitVectorVShiftByWidening(size_t esize, bool is_signed, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    ASSERT(esize == 8 || esize == 16);
+
+    const u8 lane_size = static_cast<u8>(esize * 2);
+
+    const auto shift_left_imm = [esize, &code](const Xbyak::Xmm& dst, const Xbyak::Xmm& src, u8 amount) {
+        if (esize == 8) {
+            code.vpsllw(dst, src, amount);
+        } else {
+            code.vpslld(dst, src, amount);
+        }
+    };
+    const auto shift_right_imm = [esize, &code](const Xbyak::Xmm& dst, const Xbyak::Xmm& src, u8 amount, bool arithmetic) {
+        if (esize == 8) {
+            if (arithmetic) {
+                code.vpsraw(dst, src, amount);
+            } else {
+                code.vpsrlw(dst, src, amount);
+            }
+        } else {
+            if (arithmetic) {
+                code.vpsrad(dst, src, amount);
+            } else {
+                code.vpsrld(dst, src, amount);
+            }
+        }
+    };
+    const auto shift_left_var = [esize, &code](const Xbyak::Xmm& dst, const Xbyak::Xmm& src, const Xbyak::Xmm& amount) {
+        if (esize == 8) {
+            code.vpsllvw(dst, src, amount);
+        } else {
+            code.vpsllvd(dst, src, amount);
+        }
+    };
+    const auto shift_right_var = [esize, is_signed, &code](const Xbyak::Xmm& dst, const Xbyak::Xmm& src, const Xbyak::Xmm& amount) {
+        if (esize == 8) {
+            if (is_signed) {
+                code.vpsravw(dst, src, amount);
+            } else {
+                code.vpsrlvw(dst, src, amount);
+            }
+        } else {
+            if (is_signed) {
+                code.vpsravd(dst, src, amount);
+            } else {
+                code.vpsrlvd(dst, src, amount);
+            }
+        }
+    };
+
+    // The low byte of each lane, and the low element of each lane.
+    const Xbyak::Address amount_mask = esize == 8 ? code.MConst(xword, 0x00FF00FF00FF00FF, 0x00FF00FF00FF00FF)
+                                                  : code.MConst(xword, 0x000000FF000000FF, 0x000000FF000000FF);
+    const Xbyak::Address element_mask = esize == 8 ? code.MConst(xword, 0x00FF00FF00FF00FF, 0x00FF00FF00FF00FF)
+                                                   : code.MConst(xword, 0x0000FFFF0000FFFF, 0x0000FFFF0000FFFF);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm even = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm left_shift = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm right_shift = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm odd = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm left_amount = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm right_amount = ctx.reg_alloc.ScratchXmm();
+
+    // Only the bottom byte of each element of the shift operand is significant.
+    code.vpxor(right_shift, right_shift, right_shift);
+    code.vpsubb(right_shift, right_shift, left_shift);
+
+    shift_right_imm(odd, even, static_cast<u8>(esize), is_signed);
+    if (is_signed) {
+        shift_left_imm(even, even, static_cast<u8>(esize));
+        shift_right_imm(even, even, static_cast<u8>(esize), true);
+    } else {
+        code.vpand(even, even, element_mask);
+    }
+
+    const auto shift_elements = [&](const Xbyak::Xmm& value, u8 element_offset) {
+        if (element_offset == 0) {
+            code.vpand(left_amount, left_shift, amount_mask);
+            code.vpand(right_amount, right_shift, amount_mask);
+        } else {
+            shift_right_imm(left_amount, left_shift, element_offset, false);
+            shift_right_imm(right_amount, right_shift, element_offset, false);
+            code.vpand(left_amount, left_amount, amount_mask);
+            code.vpand(right_amount, right_amount, amount_mask);
+        }
+
+        shift_right_var(right_amount, value, right_amount);
+        shift_left_var(value, value, left_amount);
+
+        if (is_signed) {
+            // Out of range arithmetic right shifts produce sign bits instead of zero,
+            // so select the appropriate result based on the sign of the shift amount.
+            shift_left_imm(xmm0, left_shift, static_cast<u8>(lane_size - element_offset - 8));
+            shift_right_imm(xmm0, xmm0, static_cast<u8>(lane_size - 1), true);
+            code.pblendvb(value, right_amount);
+        } else {
+            code.vpor(value, value, right_amount);
+        }
+    };
+
+    shift_elements(even, 0);
+    shift_elements(odd, static_cast<u8>(esize));
+
+    code.vpand(even, even, element_mask);
+    shift_left_imm(odd, odd, static_cast<u8>(esize));
+    code.vpor(even, even, odd);
+
+    ctx.reg_alloc.DefineValue(inst, even);
+}
+
 void EmitX64::EmitVectorArithmeticVShift8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorVShiftByWidening(8, true, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& a, const VectorArray<s8>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<s8>);
     });
@@ -553,19 +717,24 @@ void EmitX64::EmitVectorArithmeticVShift16(EmitContext& ctx, IR::Inst* inst) {
         code.vpsubw(right_shift, right_shift, left_shift);
 
         code.vpsllw(xmm0, left_shift, 8);
-        code.vpsraw(xmm0, xmm0, 15);
+        code.vpmovw2m(k1, xmm0);
 
         code.vpand(right_shift, right_shift, tmp);
         code.vpand(left_shift, left_shift, tmp);
 
         code.vpsravw(tmp, result, right_shift);
         code.vpsllvw(result, result, left_shift);
-        code.pblendvb(result, tmp);
+        code.vmovdqu16(result | k1, tmp);
 
         ctx.reg_alloc.DefineValue(inst, result);
         return;
     }
 
+    if (code.HasAVX2()) {
+        EmitVectorVShiftByWidening(16, true, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& a, const VectorArray<s16>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<s16>);
     });
@@ -616,12 +785,44 @@ void EmitX64::EmitVectorArithmeticVShift64(EmitContext& ctx, IR::Inst* inst) {
         code.vpsubq(right_shift, right_shift, left_shift);
 
         code.vpsllq(xmm0, left_shift, 56);
+        code.vpmovq2m(k1, xmm0);
 
         code.vpand(right_shift, right_shift, tmp);
         code.vpand(left_shift, left_shift, tmp);
 
         code.vpsravq(tmp, result, right_shift);
         code.vpsllvq(result, result, left_shift);
+        code.vmovdqa64(result | k1, tmp);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
+    if (code.HasAVX2()) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm left_shift = ctx.reg_alloc.UseScratchXmm(args[1]);
+        const Xbyak::Xmm right_shift = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm sign = ctx.reg_alloc.ScratchXmm();
+
+        code.vmovdqa(tmp, code.MConst(xword, 0x00000000000000FF, 0x00000000000000FF));
+        code.vpxor(right_shift, right_shift, right_shift);
+        code.vpsubq(right_shift, right_shift, left_shift);
+
+        code.vpsllq(xmm0, left_shift, 56);
+
+        code.vpand(right_shift, right_shift, tmp);
+        code.vpand(left_shift, left_shift, tmp);
+
+        // There is no vpsravq without AVX-512: sra(x, n) == srl(x ^ sign, n) ^ sign
+        code.vpxor(sign, sign, sign);
+        code.vpcmpgtq(sign, sign, result);
+        code.vpxor(tmp, result, sign);
+        code.vpsrlvq(tmp, tmp, right_shift);
+        code.vpxor(tmp, tmp, sign);
+        code.vpsllvq(result, result, left_shift);
         code.blendvpd(result, tmp);
 
         ctx.reg_alloc.DefineValue(inst, result);
@@ -633,6 +834,33 @@ void EmitX64::EmitVectorArithmeticVShift64(EmitContext& ctx, IR::Inst* inst) {
     });
 }
 
+void EmitX64::EmitVectorBitwiseSelect(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    if (code.HasAVX512_Skylake()) {
+        const Xbyak::Xmm mask = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm a = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[2]);
+
+        // mask = mask ? a : b
+        code.vpternlogd(mask, a, b, 0b11001010);
+
+        ctx.reg_alloc.DefineValue(inst, mask);
+        return;
+    }
+
+    const Xbyak::Xmm mask = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[2]);
+
+    // a = ((a ^ b) & mask) ^ b
+    code.pxor(a, b);
+    code.pand(a, mask);
+    code.pxor(a, b);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
 void EmitX64::EmitVectorBroadcastLower8(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -859,7 +1087,24 @@ void EmitX64::EmitVectorCountLeadingZeros32(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
-    EmitOneArgumentFallback(code, ctx, inst, EmitVectorCountLeadingZeros<u32>);
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    // The count is derived from the exponent of the input converted to a float.
+    // Bits which could cause the conversion to round up to the next power of two are cleared first.
+    // Inputs with the top bit set convert to negative numbers, which saturate to a count of zero below.
+    code.movdqa(tmp, data);
+    code.psrld(tmp, 8);
+    code.pandn(tmp, data);
+    code.cvtdq2ps(tmp, tmp);
+    code.psrld(tmp, 23);
+    code.movdqa(data, code.MConst(xword, 0x0000009E0000009E, 0x0000009E0000009E));
+    code.psubusw(data, tmp);
+    code.pminsw(data, code.MConst(xword, 0x0000002000000020, 0x0000002000000020));
+
+    ctx.reg_alloc.DefineValue(inst, data);
 }
 
 void EmitX64::EmitVectorDeinterleaveEven8(EmitContext& ctx, IR::Inst* inst) {
@@ -1063,24 +1308,24 @@ void EmitX64::EmitVectorDeinterleaveOddLower64(EmitContext& ctx, IR::Inst* inst)
 }
 
 void EmitX64::EmitVectorEor(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pxor);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pxor, &Xbyak::CodeGenerator::vpxor);
 }
 
 void EmitX64::EmitVectorEqual8(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqb);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqb, &Xbyak::CodeGenerator::vpcmpeqb);
 }
 
 void EmitX64::EmitVectorEqual16(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqw);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqw, &Xbyak::CodeGenerator::vpcmpeqw);
 }
 
 void EmitX64::EmitVectorEqual32(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqd);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqd, &Xbyak::CodeGenerator::vpcmpeqd);
 }
 
 void EmitX64::EmitVectorEqual64(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqq);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpeqq, &Xbyak::CodeGenerator::vpcmpeqq);
         return;
     }
 
@@ -1175,20 +1420,20 @@ void EmitX64::EmitVectorExtractLower(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorGreaterS8(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtb);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtb, &Xbyak::CodeGenerator::vpcmpgtb);
 }
 
 void EmitX64::EmitVectorGreaterS16(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtw);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtw, &Xbyak::CodeGenerator::vpcmpgtw);
 }
 
 void EmitX64::EmitVectorGreaterS32(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtd);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtd, &Xbyak::CodeGenerator::vpcmpgtd);
 }
 
 void EmitX64::EmitVectorGreaterS64(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE42()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtq);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pcmpgtq, &Xbyak::CodeGenerator::vpcmpgtq);
         return;
     }
 
@@ -1554,6 +1799,11 @@ void EmitX64::EmitVectorLogicalShiftRight64(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorLogicalVShift8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorVShiftByWidening(8, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<u8>);
     });
@@ -1582,6 +1832,11 @@ void EmitX64::EmitVectorLogicalVShift16(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.HasAVX2()) {
+        EmitVectorVShiftByWidening(16, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& a, const VectorArray<u16>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), VShift<u16>);
     });
@@ -1645,7 +1900,7 @@ void EmitX64::EmitVectorLogicalVShift64(EmitContext& ctx, IR::Inst* inst) {
 
 void EmitX64::EmitVectorMaxS8(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsb);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsb, &Xbyak::CodeGenerator::vpmaxsb);
         return;
     }
 
@@ -1665,12 +1920,12 @@ void EmitX64::EmitVectorMaxS8(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorMaxS16(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsw);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsw, &Xbyak::CodeGenerator::vpmaxsw);
 }
 
 void EmitX64::EmitVectorMaxS32(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsd);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsd, &Xbyak::CodeGenerator::vpmaxsd);
         return;
     }
 
@@ -1708,18 +1963,32 @@ void EmitX64::EmitVectorMaxS64(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.HasSSE42()) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+
+        code.movdqa(xmm0, y);
+        code.pcmpgtq(xmm0, x);
+        code.pblendvb(x, y);
+
+        ctx.reg_alloc.DefineValue(inst, x);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), [](auto x, auto y) { return std::max(x, y); });
     });
 }
 
 void EmitX64::EmitVectorMaxU8(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxub);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxub, &Xbyak::CodeGenerator::vpmaxub);
 }
 
 void EmitX64::EmitVectorMaxU16(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxuw);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxuw, &Xbyak::CodeGenerator::vpmaxuw);
         return;
     }
 
@@ -1735,7 +2004,7 @@ void EmitX64::EmitVectorMaxU16(EmitContext& ctx, IR::Inst* inst) {
 
 void EmitX64::EmitVectorMaxU32(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxud);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmaxud, &Xbyak::CodeGenerator::vpmaxud);
         return;
     }
 
@@ -1783,6 +2052,25 @@ void EmitX64::EmitVectorMaxU64(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.HasSSE42()) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        code.movdqa(tmp, code.MConst(xword, 0x8000000000000000, 0x8000000000000000));
+        code.movdqa(xmm0, x);
+        code.pxor(xmm0, tmp);
+        code.pxor(tmp, y);
+        code.pcmpgtq(tmp, xmm0);
+        code.movdqa(xmm0, tmp);
+        code.pblendvb(x, y);
+
+        ctx.reg_alloc.DefineValue(inst, x);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b) {
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), [](auto x, auto y) { return std::max(x, y); });
     });
@@ -1790,7 +2078,7 @@ void EmitX64::EmitVectorMaxU64(EmitContext& ctx, IR::Inst* inst) {
 
 void EmitX64::EmitVectorMinS8(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminsb);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminsb, &Xbyak::CodeGenerator::vpminsb);
         return;
     }
 
@@ -1810,12 +2098,12 @@ void EmitX64::EmitVectorMinS8(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorMinS16(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminsw);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminsw, &Xbyak::CodeGenerator::vpminsw);
 }
 
 void EmitX64::EmitVectorMinS32(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminsd);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminsd, &Xbyak::CodeGenerator::vpminsd);
         return;
     }
 
@@ -1853,18 +2141,32 @@ void EmitX64::EmitVectorMinS64(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.HasSSE42()) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+
+        code.movdqa(xmm0, y);
+        code.pcmpgtq(xmm0, x);
+        code.pblendvb(y, x);
+
+        ctx.reg_alloc.DefineValue(inst, y);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& a, const VectorArray<s64>& b){
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), [](auto x, auto y) { return std::min(x, y); });
     });
 }
 
 void EmitX64::EmitVectorMinU8(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminub);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminub, &Xbyak::CodeGenerator::vpminub);
 }
 
 void EmitX64::EmitVectorMinU16(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminuw);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminuw, &Xbyak::CodeGenerator::vpminuw);
         return;
     }
 
@@ -1883,7 +2185,7 @@ void EmitX64::EmitVectorMinU16(EmitContext& ctx, IR::Inst* inst) {
 
 void EmitX64::EmitVectorMinU32(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminud);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pminud, &Xbyak::CodeGenerator::vpminud);
         return;
     }
 
@@ -1933,6 +2235,25 @@ void EmitX64::EmitVectorMinU64(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
+    if (code.HasSSE42()) {
+        auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+        const Xbyak::Xmm x = ctx.reg_alloc.UseXmm(args[0]);
+        const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+        const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+        code.movdqa(tmp, code.MConst(xword, 0x8000000000000000, 0x8000000000000000));
+        code.movdqa(xmm0, x);
+        code.pxor(xmm0, tmp);
+        code.pxor(tmp, y);
+        code.pcmpgtq(tmp, xmm0);
+        code.movdqa(xmm0, tmp);
+        code.pblendvb(y, x);
+
+        ctx.reg_alloc.DefineValue(inst, y);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& a, const VectorArray<u64>& b){
         std::transform(a.begin(), a.end(), b.begin(), result.begin(), [](auto x, auto y) { return std::min(x, y); });
     });
@@ -1960,12 +2281,12 @@ void EmitX64::EmitVectorMultiply8(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorMultiply16(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmullw);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmullw, &Xbyak::CodeGenerator::vpmullw);
 }
 
 void EmitX64::EmitVectorMultiply32(EmitContext& ctx, IR::Inst* inst) {
     if (code.HasSSE41()) {
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmulld);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pmulld, &Xbyak::CodeGenerator::vpmulld);
         return;
     }
 
@@ -2096,6 +2417,15 @@ void EmitX64::EmitVectorNarrow64(EmitContext& ctx, IR::Inst* inst) {
 void EmitX64::EmitVectorNot(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
+    if (code.HasAVX512_Skylake()) {
+        const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseScratchXmm(args[0]);
+
+        code.vpternlogq(xmm_a, xmm_a, xmm_a, static_cast<u8>(~0b11110000));
+
+        ctx.reg_alloc.DefineValue(inst, xmm_a);
+        return;
+    }
+
     const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseScratchXmm(args[0]);
     const Xbyak::Xmm xmm_b = ctx.reg_alloc.ScratchXmm();
 
@@ -2106,7 +2436,7 @@ void EmitX64::EmitVectorNot(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorOr(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::por);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::por, &Xbyak::CodeGenerator::vpor);
 }
 
 void EmitX64::EmitVectorPairedAddLower8(EmitContext& ctx, IR::Inst* inst) {
@@ -2386,6 +2716,60 @@ static void PairedOperation(VectorArray<T>& result, const VectorArray<T>& x, con
     }
 }
 
+// Separates the even and odd elements of x:y into two vectors, then combines them with fn.
+// Elements are sign-extended and narrowed with signed saturation, which preserves their bit patterns.
+template <typename Function>
+static void EmitVectorPairedOperation8(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm even_x = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm even_y = ctx.reg_alloc.ScratchXmm();
+
+    code.movdqa(even_x, x);
+    code.movdqa(even_y, y);
+    code.psllw(even_x, 8);
+    code.psllw(even_y, 8);
+    code.psraw(even_x, 8);
+    code.psraw(even_y, 8);
+    code.packsswb(even_x, even_y);
+
+    code.psraw(x, 8);
+    code.psraw(y, 8);
+    code.packsswb(x, y);
+
+    (code.*fn)(x, even_x);
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
+template <typename Function>
+static void EmitVectorPairedOperation16(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm x = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm y = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm even_x = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm even_y = ctx.reg_alloc.ScratchXmm();
+
+    code.movdqa(even_x, x);
+    code.movdqa(even_y, y);
+    code.pslld(even_x, 16);
+    code.pslld(even_y, 16);
+    code.psrad(even_x, 16);
+    code.psrad(even_y, 16);
+    code.packssdw(even_x, even_y);
+
+    code.psrad(x, 16);
+    code.psrad(y, 16);
+    code.packssdw(x, y);
+
+    (code.*fn)(x, even_x);
+
+    ctx.reg_alloc.DefineValue(inst, x);
+}
+
 template <typename T>
 static void PairedMax(VectorArray<T>& result, const VectorArray<T>& x, const VectorArray<T>& y) {
     PairedOperation(result, x, y, [](auto a, auto b) { return std::max(a, b); });
@@ -2397,15 +2781,18 @@ static void PairedMin(VectorArray<T>& result, const VectorArray<T>& x, const Vec
 }
 
 void EmitX64::EmitVectorPairedMaxS8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSSE41()) {
+        EmitVectorPairedOperation8(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsb);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& a, const VectorArray<s8>& b) {
         PairedMax(result, a, b);
     });
 }
 
 void EmitX64::EmitVectorPairedMaxS16(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& a, const VectorArray<s16>& b) {
-        PairedMax(result, a, b);
-    });
+    EmitVectorPairedOperation16(code, ctx, inst, &Xbyak::CodeGenerator::pmaxsw);
 }
 
 void EmitX64::EmitVectorPairedMaxS32(EmitContext& ctx, IR::Inst* inst) {
@@ -2437,12 +2824,15 @@ void EmitX64::EmitVectorPairedMaxS32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorPairedMaxU8(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
-        PairedMax(result, a, b);
-    });
+    EmitVectorPairedOperation8(code, ctx, inst, &Xbyak::CodeGenerator::pmaxub);
 }
 
 void EmitX64::EmitVectorPairedMaxU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSSE41()) {
+        EmitVectorPairedOperation16(code, ctx, inst, &Xbyak::CodeGenerator::pmaxuw);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& a, const VectorArray<u16>& b) {
         PairedMax(result, a, b);
     });
@@ -2482,15 +2872,18 @@ void EmitX64::EmitVectorPairedMaxU32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorPairedMinS8(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSSE41()) {
+        EmitVectorPairedOperation8(code, ctx, inst, &Xbyak::CodeGenerator::pminsb);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& a, const VectorArray<s8>& b) {
         PairedMin(result, a, b);
     });
 }
 
 void EmitX64::EmitVectorPairedMinS16(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& a, const VectorArray<s16>& b) {
-        PairedMin(result, a, b);
-    });
+    EmitVectorPairedOperation16(code, ctx, inst, &Xbyak::CodeGenerator::pminsw);
 }
 
 void EmitX64::EmitVectorPairedMinS32(EmitContext& ctx, IR::Inst* inst) {
@@ -2522,12 +2915,15 @@ void EmitX64::EmitVectorPairedMinS32(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorPairedMinU8(EmitContext& ctx, IR::Inst* inst) {
-    EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a, const VectorArray<u8>& b) {
-        PairedMin(result, a, b);
-    });
+    EmitVectorPairedOperation8(code, ctx, inst, &Xbyak::CodeGenerator::pminub);
 }
 
 void EmitX64::EmitVectorPairedMinU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSSE41()) {
+        EmitVectorPairedOperation16(code, ctx, inst, &Xbyak::CodeGenerator::pminuw);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& a, const VectorArray<u16>& b) {
         PairedMin(result, a, b);
     });
@@ -2736,14 +3132,31 @@ void EmitX64::EmitVectorPopulationCount(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
-    EmitOneArgumentFallback(code, ctx, inst, [](VectorArray<u8>& result, const VectorArray<u8>& a) {
-        std::transform(a.begin(), a.end(), result.begin(), [](u8 val) {
-            return static_cast<u8>(Common::BitCount(val));
-        });
-    });
-}
-
-void EmitX64::EmitVectorReverseBits(EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+
+    code.movdqa(tmp, data);
+    code.psrlw(tmp, 1);
+    code.pand(tmp, code.MConst(xword, 0x5555555555555555, 0x5555555555555555));
+    code.psubb(data, tmp);
+
+    code.movdqa(tmp, data);
+    code.psrlw(tmp, 2);
+    code.pand(tmp, code.MConst(xword, 0x3333333333333333, 0x3333333333333333));
+    code.pand(data, code.MConst(xword, 0x3333333333333333, 0x3333333333333333));
+    code.paddb(data, tmp);
+
+    code.movdqa(tmp, data);
+    code.psrlw(tmp, 4);
+    code.paddb(data, tmp);
+    code.pand(data, code.MConst(xword, 0x0F0F0F0F0F0F0F0F, 0x0F0F0F0F0F0F0F0F));
+
+    ctx.reg_alloc.DefineValue(inst, data);
+}
+
+void EmitX64::EmitVectorReverseBits(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     const Xbyak::Xmm data = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -2846,10 +3259,10 @@ void EmitX64::EmitVectorRoundingHalvingAddS32(EmitContext& ctx, IR::Inst* inst)
 static void EmitVectorRoundingHalvingAddUnsigned(size_t esize, EmitContext& ctx, IR::Inst* inst, BlockOfCode& code) {
     switch (esize) {
     case 8:
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pavgb);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pavgb, &Xbyak::CodeGenerator::vpavgb);
         return;
     case 16:
-        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pavgw);
+        EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::pavgw, &Xbyak::CodeGenerator::vpavgw);
         return;
     case 32: {
         auto args = ctx.reg_alloc.GetArgumentInfo(inst);
@@ -2920,6 +3333,233 @@ static void RoundingShiftLeft(VectorArray<T>& out, const VectorArray<T>& lhs, co
     }
 }
 
+// Rounding variable shift of 16, 32 or 64-bit elements using the variable shift instructions of AVX2 and AVX-512.
+// A negative shift amount -n rounds the result of shifting right by n: (x >> n) + ((x >> (n - 1)) & 1).
+// When saturating, left shifts that lose significant bits saturate and set FPSR.QC; right shifts cannot saturate.
+static void EmitVectorRoundingShiftLeft(size_t esize, bool is_signed, bool is_saturating, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    ASSERT(esize == 16 || esize == 32 || esize == 64);
+
+    // There is no vpsravq without AVX-512: sra(x, n) == srl(x ^ sign, n) ^ sign
+    const bool emulate_arithmetic_shift = esize == 64 && is_signed && !code.HasAVX512_Skylake();
+
+    const Xbyak::Address amount_mask = [esize, &code] {
+        switch (esize) {
+        case 16:
+            return code.MConst(xword, 0x00FF00FF00FF00FF, 0x00FF00FF00FF00FF);
+        case 32:
+            return code.MConst(xword, 0x000000FF000000FF, 0x000000FF000000FF);
+        case 64:
+            return code.MConst(xword, 0x00000000000000FF, 0x00000000000000FF);
+        default:
+            UNREACHABLE();
+        }
+    }();
+    const Xbyak::Address one = [esize, &code] {
+        switch (esize) {
+        case 16:
+            return code.MConst(xword, 0x0001000100010001, 0x0001000100010001);
+        case 32:
+            return code.MConst(xword, 0x0000000100000001, 0x0000000100000001);
+        case 64:
+            return code.MConst(xword, 0x0000000000000001, 0x0000000000000001);
+        default:
+            UNREACHABLE();
+        }
+    }();
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm left_shift = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm right_shift = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm rounding = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm sign = emulate_arithmetic_shift ? ctx.reg_alloc.ScratchXmm() : Xbyak::Xmm{};
+    const Xbyak::Xmm biased = emulate_arithmetic_shift ? ctx.reg_alloc.ScratchXmm() : Xbyak::Xmm{};
+    const Xbyak::Xmm shifted = is_saturating ? ctx.reg_alloc.ScratchXmm() : Xbyak::Xmm{};
+    const Xbyak::Xmm in_range = is_saturating ? ctx.reg_alloc.ScratchXmm() : Xbyak::Xmm{};
+    const Xbyak::Xmm saturated = is_saturating ? ctx.reg_alloc.ScratchXmm() : Xbyak::Xmm{};
+    const Xbyak::Reg8 overflow = is_saturating ? ctx.reg_alloc.ScratchGpr().cvt8() : Xbyak::Reg8{};
+
+    const auto shift_right = [&](const Xbyak::Xmm& dst, const Xbyak::Xmm& amount) {
+        switch (esize) {
+        case 16:
+            if (is_signed) {
+                code.vpsravw(dst, result, amount);
+            } else {
+                code.vpsrlvw(dst, result, amount);
+            }
+            break;
+        case 32:
+            if (is_signed) {
+                code.vpsravd(dst, result, amount);
+            } else {
+                code.vpsrlvd(dst, result, amount);
+            }
+            break;
+        case 64:
+            if (emulate_arithmetic_shift) {
+                code.vpsrlvq(dst, biased, amount);
+                code.vpxor(dst, dst, sign);
+            } else if (is_signed) {
+                code.vpsravq(dst, result, amount);
+            } else {
+                code.vpsrlvq(dst, result, amount);
+            }
+            break;
+        }
+    };
+
+    // Only the bottom byte of each element of the shift operand is significant.
+    switch (esize) {
+    case 16:
+        code.vpsllw(xmm0, left_shift, 8);
+        code.vpsraw(xmm0, xmm0, 15);
+        break;
+    case 32:
+        code.vpslld(xmm0, left_shift, 24);
+        break;
+    case 64:
+        code.vpsllq(xmm0, left_shift, 56);
+        break;
+    }
+    code.vpxor(right_shift, right_shift, right_shift);
+    code.vpsubb(right_shift, right_shift, left_shift);
+    code.vpand(right_shift, right_shift, amount_mask);
+    code.vpand(left_shift, left_shift, amount_mask);
+
+    if (emulate_arithmetic_shift) {
+        code.vpxor(sign, sign, sign);
+        code.vpcmpgtq(sign, sign, result);
+        code.vpxor(biased, result, sign);
+    }
+
+    // Shift amounts of zero or more select the left shift below, so the value of (n - 1) is irrelevant when n is zero.
+    switch (esize) {
+    case 16:
+        code.vpsubw(rounding, right_shift, one);
+        break;
+    case 32:
+        code.vpsubd(rounding, right_shift, one);
+        break;
+    case 64:
+        code.vpsubq(rounding, right_shift, one);
+        break;
+    }
+    shift_right(rounding, rounding);
+    code.vpand(rounding, rounding, one);
+    shift_right(right_shift, right_shift);
+
+    switch (esize) {
+    case 16:
+        code.vpaddw(right_shift, right_shift, rounding);
+        break;
+    case 32:
+        code.vpaddd(right_shift, right_shift, rounding);
+        break;
+    case 64:
+        code.vpaddq(right_shift, right_shift, rounding);
+        break;
+    }
+
+    if (is_saturating) {
+        // A left shift is exact if shifting the result back recovers the original element.
+        switch (esize) {
+        case 16:
+            code.vpsllvw(shifted, result, left_shift);
+            if (is_signed) {
+                code.vpsravw(in_range, shifted, left_shift);
+            } else {
+                code.vpsrlvw(in_range, shifted, left_shift);
+            }
+            code.vpcmpeqw(in_range, in_range, result);
+            code.vpor(in_range, in_range, xmm0);
+            break;
+        case 32:
+            code.vpsllvd(shifted, result, left_shift);
+            if (is_signed) {
+                code.vpsravd(in_range, shifted, left_shift);
+            } else {
+                code.vpsrlvd(in_range, shifted, left_shift);
+            }
+            code.vpcmpeqd(in_range, in_range, result);
+            code.vpsrad(rounding, xmm0, 31);
+            code.vpor(in_range, in_range, rounding);
+            break;
+        case 64:
+            code.vpsllvq(shifted, result, left_shift);
+            if (emulate_arithmetic_shift) {
+                code.vpxor(sign, sign, sign);
+                code.vpcmpgtq(sign, sign, shifted);
+                code.vpxor(biased, shifted, sign);
+                code.vpsrlvq(in_range, biased, left_shift);
+                code.vpxor(in_range, in_range, sign);
+            } else if (is_signed) {
+                code.vpsravq(in_range, shifted, left_shift);
+            } else {
+                code.vpsrlvq(in_range, shifted, left_shift);
+            }
+            code.vpcmpeqq(in_range, in_range, result);
+            code.vpxor(rounding, rounding, rounding);
+            code.vpcmpgtq(rounding, rounding, xmm0);
+            code.vpor(in_range, in_range, rounding);
+            break;
+        }
+
+        if (is_signed) {
+            switch (esize) {
+            case 16:
+                code.vpsraw(saturated, result, 15);
+                code.vpxor(saturated, saturated, code.MConst(xword, 0x7FFF7FFF7FFF7FFF, 0x7FFF7FFF7FFF7FFF));
+                break;
+            case 32:
+                code.vpsrad(saturated, result, 31);
+                code.vpxor(saturated, saturated, code.MConst(xword, 0x7FFFFFFF7FFFFFFF, 0x7FFFFFFF7FFFFFFF));
+                break;
+            case 64:
+                code.vpxor(saturated, saturated, saturated);
+                code.vpcmpgtq(saturated, saturated, result);
+                code.vpxor(saturated, saturated, code.MConst(xword, 0x7FFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF));
+                break;
+            }
+        } else {
+            code.vpcmpeqd(saturated, saturated, saturated);
+        }
+
+        code.vpblendvb(result, saturated, shifted, in_range);
+
+        code.vpcmpeqd(rounding, rounding, rounding);
+        code.vptest(in_range, rounding);
+        code.setnc(overflow);
+        code.or_(code.byte[code.r15 + code.GetJitStateInfo().offsetof_fpsr_qc], overflow);
+    } else {
+        switch (esize) {
+        case 16:
+            code.vpsllvw(result, result, left_shift);
+            break;
+        case 32:
+            code.vpsllvd(result, result, left_shift);
+            break;
+        case 64:
+            code.vpsllvq(result, result, left_shift);
+            break;
+        }
+    }
+
+    switch (esize) {
+    case 16:
+        code.pblendvb(result, right_shift);
+        break;
+    case 32:
+        code.blendvps(result, right_shift);
+        break;
+    case 64:
+        code.blendvpd(result, right_shift);
+        break;
+    }
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 void EmitX64::EmitVectorRoundingShiftLeftS8(EmitContext& ctx, IR::Inst* inst) {
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s8>& result, const VectorArray<s8>& lhs, const VectorArray<s8>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
@@ -2927,18 +3567,33 @@ void EmitX64::EmitVectorRoundingShiftLeftS8(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorRoundingShiftLeft(16, true, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s16>& result, const VectorArray<s16>& lhs, const VectorArray<s16>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitVectorRoundingShiftLeft(32, true, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s32>& result, const VectorArray<s32>& lhs, const VectorArray<s32>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftS64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitVectorRoundingShiftLeft(64, true, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<s64>& result, const VectorArray<s64>& lhs, const VectorArray<s64>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
@@ -2951,18 +3606,33 @@ void EmitX64::EmitVectorRoundingShiftLeftU8(EmitContext& ctx, IR::Inst* inst) {
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorRoundingShiftLeft(16, false, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u16>& result, const VectorArray<u16>& lhs, const VectorArray<s16>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitVectorRoundingShiftLeft(32, false, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u32>& result, const VectorArray<u32>& lhs, const VectorArray<s32>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
 }
 
 void EmitX64::EmitVectorRoundingShiftLeftU64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitVectorRoundingShiftLeft(64, false, false, code, ctx, inst);
+        return;
+    }
+
     EmitTwoArgumentFallback(code, ctx, inst, [](VectorArray<u64>& result, const VectorArray<u64>& lhs, const VectorArray<s64>& rhs) {
         RoundingShiftLeft(result, lhs, rhs);
     });
@@ -3977,6 +4647,178 @@ void EmitX64::EmitVectorSignedSaturatedNeg64(EmitContext& ctx, IR::Inst* inst) {
     });
 }
 
+template <typename T, bool is_subtract>
+static bool VectorSignedSaturatedRoundingDoublingMulAcc(VectorArray<T>& result, const VectorArray<T>& acc, const VectorArray<T>& a, const VectorArray<T>& b) {
+    constexpr size_t bit_size_minus_one = Common::BitSize<T>() - 1;
+    constexpr s64 min = std::numeric_limits<T>::min();
+    constexpr s64 max = std::numeric_limits<T>::max();
+
+    bool qc_flag = false;
+
+    for (size_t i = 0; i < result.size(); i++) {
+        // (acc * 2^esize ± 2 * a * b + 2^(esize - 1)) >> esize, halved so the 32-bit case fits within an s64.
+        const s64 product = static_cast<s64>(a[i]) * static_cast<s64>(b[i]);
+        const s64 accumulated = static_cast<s64>(acc[i]) * (s64(1) << bit_size_minus_one);
+        const s64 sum = (is_subtract ? accumulated - product : accumulated + product) + (s64(1) << (bit_size_minus_one - 1));
+        const s64 value = sum >> bit_size_minus_one;
+
+        if (value > max) {
+            result[i] = static_cast<T>(max);
+            qc_flag = true;
+        } else if (value < min) {
+            result[i] = static_cast<T>(min);
+            qc_flag = true;
+        } else {
+            result[i] = static_cast<T>(value);
+        }
+    }
+
+    return qc_flag;
+}
+
+static void EmitVectorSignedSaturatedRoundingDoublingMulAcc16(bool is_subtract, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm acc = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm b = ctx.reg_alloc.UseXmm(args[2]);
+    const Xbyak::Xmm lower_product = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm upper_product = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm lower_sum = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm upper_sum = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg32 bit = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    // Widen to 32-bit lanes, where acc * 2^15 ± a * b + 2^14 cannot overflow.
+    code.movdqa(lower_product, a);
+    code.pmullw(lower_product, b);
+    code.pmulhw(a, b);
+    code.movdqa(upper_product, lower_product);
+    code.punpcklwd(lower_product, a);
+    code.punpckhwd(upper_product, a);
+
+    code.pxor(lower_sum, lower_sum);
+    code.pxor(upper_sum, upper_sum);
+    code.punpcklwd(lower_sum, acc);
+    code.punpckhwd(upper_sum, acc);
+    code.psrad(lower_sum, 1);
+    code.psrad(upper_sum, 1);
+
+    if (is_subtract) {
+        code.psubd(lower_sum, lower_product);
+        code.psubd(upper_sum, upper_product);
+    } else {
+        code.paddd(lower_sum, lower_product);
+        code.paddd(upper_sum, upper_product);
+    }
+    code.paddd(lower_sum, code.MConst(xword, 0x0000400000004000, 0x0000400000004000));
+    code.paddd(upper_sum, code.MConst(xword, 0x0000400000004000, 0x0000400000004000));
+    code.psrad(lower_sum, 15);
+    code.psrad(upper_sum, 15);
+
+    code.movdqa(a, lower_sum);
+    code.packssdw(a, upper_sum);
+
+    // A lane saturated if its 32-bit result does not fit within 16 bits.
+    code.paddd(lower_sum, code.MConst(xword, 0x0000800000008000, 0x0000800000008000));
+    code.paddd(upper_sum, code.MConst(xword, 0x0000800000008000, 0x0000800000008000));
+    code.por(lower_sum, upper_sum);
+    code.psrld(lower_sum, 16);
+    code.pxor(upper_sum, upper_sum);
+    code.pcmpeqd(lower_sum, upper_sum);
+    code.pmovmskb(bit, lower_sum);
+    code.xor_(bit, 0xFFFF);
+    code.or_(code.dword[code.r15 + code.GetJitStateInfo().offsetof_fpsr_qc], bit);
+
+    ctx.reg_alloc.DefineValue(inst, a);
+}
+
+static void EmitVectorSignedSaturatedRoundingDoublingMulAcc32(bool is_subtract, BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm even_sum = ctx.reg_alloc.UseScratchXmm(args[0]);
+    const Xbyak::Xmm even = ctx.reg_alloc.UseScratchXmm(args[1]);
+    const Xbyak::Xmm b = ctx.reg_alloc.UseScratchXmm(args[2]);
+    const Xbyak::Xmm odd_sum = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm odd = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg32 bit = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    // 64-bit products of the even and odd elements.
+    code.movdqa(odd, even);
+    code.psrlq(odd, 32);
+    code.pmuldq(even, b);
+    code.psrlq(b, 32);
+    code.pmuldq(odd, b);
+
+    // acc * 2^31 for the even and odd elements, using psrlq with the sign bit restored in place of an arithmetic shift.
+    code.movdqa(odd_sum, even_sum);
+    code.pand(odd_sum, code.MConst(xword, 0xFFFFFFFF00000000, 0xFFFFFFFF00000000));
+    code.psllq(even_sum, 32);
+    for (const Xbyak::Xmm& sum : {even_sum, odd_sum}) {
+        code.movdqa(tmp, sum);
+        code.pand(tmp, code.MConst(xword, 0x8000000000000000, 0x8000000000000000));
+        code.psrlq(sum, 1);
+        code.por(sum, tmp);
+    }
+
+    if (is_subtract) {
+        code.psubq(even_sum, even);
+        code.psubq(odd_sum, odd);
+    } else {
+        code.paddq(even_sum, even);
+        code.paddq(odd_sum, odd);
+    }
+    code.paddq(even_sum, code.MConst(xword, 0x0000000040000000, 0x0000000040000000));
+    code.paddq(odd_sum, code.MConst(xword, 0x0000000040000000, 0x0000000040000000));
+
+    // The result is bits 62 to 31 of each sum; it saturates when bit 63 differs from bit 62.
+    code.movdqa(even, even_sum);
+    code.paddq(even, even);
+    code.movdqa(odd, odd_sum);
+    code.paddq(odd, odd);
+    code.psrlq(even, 32);
+    code.blendps(even, odd, 0b1010);
+    code.psrlq(even_sum, 32);
+    code.blendps(even_sum, odd_sum, 0b1010);
+
+    code.movdqa(xmm0, even_sum);
+    code.pxor(xmm0, even);
+    code.psrad(even_sum, 31);
+    code.pxor(even_sum, code.MConst(xword, 0x7FFFFFFF7FFFFFFF, 0x7FFFFFFF7FFFFFFF));
+    code.blendvps(even, even_sum);
+
+    code.movmskps(bit, xmm0);
+    code.or_(code.dword[code.r15 + code.GetJitStateInfo().offsetof_fpsr_qc], bit);
+
+    ctx.reg_alloc.DefineValue(inst, even);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingDoublingMulAdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedRoundingDoublingMulAcc16(false, code, ctx, inst);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingDoublingMulAdd32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSSE41()) {
+        EmitVectorSignedSaturatedRoundingDoublingMulAcc32(false, code, ctx, inst);
+        return;
+    }
+
+    EmitThreeArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingDoublingMulAcc<s32, false>);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingDoublingMulSub16(EmitContext& ctx, IR::Inst* inst) {
+    EmitVectorSignedSaturatedRoundingDoublingMulAcc16(true, code, ctx, inst);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingDoublingMulSub32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasSSE41()) {
+        EmitVectorSignedSaturatedRoundingDoublingMulAcc32(true, code, ctx, inst);
+        return;
+    }
+
+    EmitThreeArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingDoublingMulAcc<s32, true>);
+}
+
 // MSVC requires the capture within the saturate lambda, but it's
 // determined to be unnecessary via clang and GCC.
 #ifdef __clang__
@@ -4041,6 +4883,53 @@ void EmitX64::EmitVectorSignedSaturatedShiftLeft64(EmitContext& ctx, IR::Inst* i
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedShiftLeft<s64>);
 }
 
+// Right shifts round as RoundingShiftLeft does and cannot saturate; left shifts saturate as VectorSignedSaturatedShiftLeft does.
+template <typename T>
+static bool VectorSignedSaturatedRoundingShiftLeft(VectorArray<T>& dst, const VectorArray<T>& data, const VectorArray<T>& shift_values) {
+    VectorArray<T> left_shifted;
+    const bool qc_flag = VectorSignedSaturatedShiftLeft(left_shifted, data, shift_values);
+
+    RoundingShiftLeft(dst, data, shift_values);
+    for (size_t i = 0; i < dst.size(); i++) {
+        if (static_cast<s8>(shift_values[i]) >= 0) {
+            dst[i] = left_shifted[i];
+        }
+    }
+
+    return qc_flag;
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingShiftLeft<s8>);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorRoundingShiftLeft(16, true, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingShiftLeft<s16>);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitVectorRoundingShiftLeft(32, true, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingShiftLeft<s32>);
+}
+
+void EmitX64::EmitVectorSignedSaturatedRoundingShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitVectorRoundingShiftLeft(64, true, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorSignedSaturatedRoundingShiftLeft<s64>);
+}
+
 template <typename T, typename U = std::make_unsigned_t<T>>
 static bool VectorSignedSaturatedShiftLeftUnsigned(VectorArray<T>& dst, const VectorArray<T>& data, const VectorArray<T>& shift_values) {
     static_assert(std::is_signed_v<T>, "T must be signed.");
@@ -4096,19 +4985,72 @@ void EmitX64::EmitVectorSignedSaturatedShiftLeftUnsigned64(EmitContext& ctx, IR:
 }
 
 void EmitX64::EmitVectorSub8(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubb);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubb, &Xbyak::CodeGenerator::vpsubb);
 }
 
 void EmitX64::EmitVectorSub16(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubw);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubw, &Xbyak::CodeGenerator::vpsubw);
 }
 
 void EmitX64::EmitVectorSub32(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubd);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubd, &Xbyak::CodeGenerator::vpsubd);
 }
 
 void EmitX64::EmitVectorSub64(EmitContext& ctx, IR::Inst* inst) {
-    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubq);
+    EmitVectorOperation(code, ctx, inst, &Xbyak::CodeGenerator::psubq, &Xbyak::CodeGenerator::vpsubq);
+}
+
+// Recovers index vectors built from immediates (e.g. by MOVI), for which shuffle masks can be computed at compile time.
+static std::optional<VectorArray<u8>> GetConstantTableIndices(const IR::Value& value) {
+    if (value.IsImmediate()) {
+        return std::nullopt;
+    }
+
+    const IR::Inst* inst = value.GetInst();
+
+    const auto replicate = [](u64 element, size_t esize) {
+        VectorArray<u8> result;
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = static_cast<u8>(element >> ((i * 8) % esize));
+        }
+        return result;
+    };
+
+    switch (inst->GetOpcode()) {
+    case IR::Opcode::ZeroVector:
+        return VectorArray<u8>{};
+    case IR::Opcode::VectorBroadcast8:
+    case IR::Opcode::VectorBroadcast16:
+    case IR::Opcode::VectorBroadcast32:
+    case IR::Opcode::VectorBroadcast64: {
+        if (!inst->GetArg(0).IsImmediate()) {
+            return std::nullopt;
+        }
+        const size_t esize = [&] {
+            switch (inst->GetOpcode()) {
+            case IR::Opcode::VectorBroadcast8:
+                return 8;
+            case IR::Opcode::VectorBroadcast16:
+                return 16;
+            case IR::Opcode::VectorBroadcast32:
+                return 32;
+            default:
+                return 64;
+            }
+        }();
+        return replicate(inst->GetArg(0).GetImmediateAsU64(), esize);
+    }
+    case IR::Opcode::ZeroExtendLongToQuad: {
+        if (!inst->GetArg(0).IsImmediate()) {
+            return std::nullopt;
+        }
+        VectorArray<u8> result = replicate(inst->GetArg(0).GetImmediateAsU64(), 64);
+        std::fill(result.begin() + 8, result.end(), u8(0));
+        return result;
+    }
+    default:
+        return std::nullopt;
+    }
 }
 
 void EmitX64::EmitVectorTable(EmitContext&, IR::Inst* inst) {
@@ -4125,7 +5067,46 @@ void EmitX64::EmitVectorTableLookup64(EmitContext& ctx, IR::Inst* inst) {
     const size_t table_size = std::count_if(table.begin(), table.end(), [](const auto& elem){ return !elem.IsVoid(); });
     const bool is_defaults_zero = inst->GetArg(0).IsZero();
 
-    // TODO: AVX512VL implementation when available (VPERMB / VPERMI2B / VPERMT2B)
+    if (code.HasAVX512_Skylake() && code.HasAVX512_VBMI()) {
+        const Xbyak::Xmm indicies = ctx.reg_alloc.UseXmm(args[2]);
+        const Xbyak::Xmm result = is_defaults_zero ? ctx.reg_alloc.ScratchXmm() : ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm xmm_table0 = ctx.reg_alloc.UseScratchXmm(table[0]);
+
+        if (table_size >= 2) {
+            const Xbyak::Xmm xmm_table0_upper = ctx.reg_alloc.UseXmm(table[1]);
+            code.punpcklqdq(xmm_table0, xmm_table0_upper);
+            ctx.reg_alloc.Release(xmm_table0_upper);
+        }
+
+        // Lanes with an index beyond the table keep their default value.
+        const u64 table_limit = Common::Replicate<u64>(table_size * 8, 8);
+        code.vpcmpub(k1, indicies, code.MConst(xword, table_limit, 0), 1); // LT
+
+        if (table_size <= 2) {
+            if (is_defaults_zero) {
+                code.vpermb(result | k1 | T_z, indicies, xmm_table0);
+            } else {
+                code.vpermb(result | k1, indicies, xmm_table0);
+            }
+        } else {
+            const Xbyak::Xmm xmm_table1 = ctx.reg_alloc.UseScratchXmm(table[2]);
+            if (table_size == 4) {
+                const Xbyak::Xmm xmm_table1_upper = ctx.reg_alloc.UseXmm(table[3]);
+                code.punpcklqdq(xmm_table1, xmm_table1_upper);
+                ctx.reg_alloc.Release(xmm_table1_upper);
+            }
+
+            code.vpermt2b(xmm_table0, indicies, xmm_table1);
+            if (is_defaults_zero) {
+                code.vmovdqu8(result | k1 | T_z, xmm_table0);
+            } else {
+                code.vmovdqu8(result | k1, xmm_table0);
+            }
+        }
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
 
     const std::array<u64, 5> sat_const{
         0,
@@ -4292,7 +5273,119 @@ void EmitX64::EmitVectorTableLookup128(EmitContext& ctx, IR::Inst* inst) {
     const size_t table_size = std::count_if(table.begin(), table.end(), [](const auto& elem){ return !elem.IsVoid(); });
     const bool is_defaults_zero = !inst->GetArg(0).IsImmediate() && inst->GetArg(0).GetInst()->GetOpcode() == IR::Opcode::ZeroVector;
 
-    // TODO: AVX512VL implementation when available (VPERMB / VPERMI2B / VPERMT2B)
+    if (const auto constant_indicies = GetConstantTableIndices(inst->GetArg(2)); constant_indicies && code.HasSSSE3()) {
+        const auto make_const = [&](const VectorArray<u8>& bytes) {
+            u64 lower = 0;
+            u64 upper = 0;
+            for (size_t i = 0; i < 8; ++i) {
+                lower |= u64(bytes[i]) << (i * 8);
+                upper |= u64(bytes[i + 8]) << (i * 8);
+            }
+            return code.MConst(xword, lower, upper);
+        };
+
+        VectorArray<u8> out_of_range{};
+        bool any_out_of_range = false;
+        bool all_out_of_range = true;
+        for (size_t i = 0; i < out_of_range.size(); ++i) {
+            if ((*constant_indicies)[i] >= table_size * 16) {
+                out_of_range[i] = 0xFF;
+                any_out_of_range = true;
+            } else {
+                all_out_of_range = false;
+            }
+        }
+
+        if (all_out_of_range) {
+            ctx.reg_alloc.DefineValue(inst, args[0]);
+            return;
+        }
+
+        std::optional<Xbyak::Xmm> result;
+        for (size_t t = 0; t < table_size; ++t) {
+            VectorArray<u8> selector;
+            bool is_table_used = false;
+            for (size_t i = 0; i < selector.size(); ++i) {
+                const u8 index = (*constant_indicies)[i];
+                if (index / 16 == t) {
+                    selector[i] = index % 16;
+                    is_table_used = true;
+                } else {
+                    selector[i] = 0x80;
+                }
+            }
+
+            if (!is_table_used) {
+                continue;
+            }
+
+            const Xbyak::Xmm xmm_table = ctx.reg_alloc.UseScratchXmm(table[t]);
+            code.pshufb(xmm_table, make_const(selector));
+
+            if (!result) {
+                result = xmm_table;
+            } else {
+                code.por(*result, xmm_table);
+                ctx.reg_alloc.Release(xmm_table);
+            }
+        }
+
+        if (!is_defaults_zero && any_out_of_range) {
+            const Xbyak::Xmm defaults = ctx.reg_alloc.UseScratchXmm(args[0]);
+            code.pand(defaults, make_const(out_of_range));
+            code.por(*result, defaults);
+        }
+
+        ctx.reg_alloc.DefineValue(inst, *result);
+        return;
+    }
+
+    if (code.HasAVX512_Skylake() && code.HasAVX512_VBMI()) {
+        const Xbyak::Xmm indicies = ctx.reg_alloc.UseXmm(args[2]);
+        const Xbyak::Xmm result = is_defaults_zero ? ctx.reg_alloc.ScratchXmm() : ctx.reg_alloc.UseScratchXmm(args[0]);
+
+        // Lanes with an index beyond the table keep their default value.
+        const u64 table_limit = Common::Replicate<u64>(table_size * 16, 8);
+        code.vpcmpub(k1, indicies, code.MConst(xword, table_limit, table_limit), 1); // LT
+
+        if (table_size == 1) {
+            const Xbyak::Xmm xmm_table0 = ctx.reg_alloc.UseXmm(table[0]);
+            if (is_defaults_zero) {
+                code.vpermb(result | k1 | T_z, indicies, xmm_table0);
+            } else {
+                code.vpermb(result | k1, indicies, xmm_table0);
+            }
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+
+        const Xbyak::Xmm xmm_table0 = ctx.reg_alloc.UseXmm(table[0]);
+        const Xbyak::Xmm xmm_table1 = ctx.reg_alloc.UseXmm(table[1]);
+        const Xbyak::Xmm lookup = is_defaults_zero ? result : ctx.reg_alloc.ScratchXmm();
+
+        code.vmovdqa(lookup, indicies);
+        code.vpermi2b(lookup, xmm_table0, xmm_table1);
+
+        if (table_size >= 3) {
+            const Xbyak::Xmm xmm_table2 = ctx.reg_alloc.UseXmm(table[2]);
+            const Xbyak::Xmm xmm_table3 = table_size == 4 ? ctx.reg_alloc.UseXmm(table[3]) : xmm_table2;
+            const Xbyak::Xmm lookup_upper = ctx.reg_alloc.ScratchXmm();
+
+            code.vmovdqa(lookup_upper, indicies);
+            code.vpermi2b(lookup_upper, xmm_table2, xmm_table3);
+            code.vptestmb(k2, indicies, code.MConst(xword, 0x2020202020202020, 0x2020202020202020));
+            code.vmovdqu8(lookup | k2, lookup_upper);
+        }
+
+        if (is_defaults_zero) {
+            code.vmovdqu8(result | k1 | T_z, lookup);
+        } else {
+            code.vmovdqu8(result | k1, lookup);
+        }
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
 
     if (code.HasSSSE3() && is_defaults_zero && table_size == 1) {
         const Xbyak::Xmm indicies = ctx.reg_alloc.UseScratchXmm(args[2]);
@@ -4343,32 +5436,39 @@ void EmitX64::EmitVectorTableLookup128(EmitContext& ctx, IR::Inst* inst) {
         return;
     }
 
-    if (code.HasSSE41()) {
+    if (code.HasSSSE3()) {
         const Xbyak::Xmm indicies = ctx.reg_alloc.UseXmm(args[2]);
-        const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
-        const Xbyak::Xmm masked = ctx.reg_alloc.ScratchXmm();
-
-        code.movaps(masked, code.MConst(xword, 0xF0F0F0F0F0F0F0F0, 0xF0F0F0F0F0F0F0F0));
-        code.pand(masked, indicies);
+        const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(table[0]);
+        const Xbyak::Xmm selector = ctx.reg_alloc.ScratchXmm();
 
+        // Rebase the indices onto each table in turn; pshufb zeroes any lane that saturates to an index outside it.
         for (size_t i = 0; i < table_size; ++i) {
-            const Xbyak::Xmm xmm_table = ctx.reg_alloc.UseScratchXmm(table[i]);
-
+            const Xbyak::Xmm xmm_table = i == 0 ? result : ctx.reg_alloc.UseScratchXmm(table[i]);
             const u64 table_index = Common::Replicate<u64>(i * 16, 8);
 
-            if (table_index == 0) {
-                code.pxor(xmm0, xmm0);
-                code.pcmpeqb(xmm0, masked);
-            } else if (code.HasAVX()) {
-                code.vpcmpeqb(xmm0, masked, code.MConst(xword, table_index, table_index));
-            } else {
-                code.movaps(xmm0, code.MConst(xword, table_index, table_index));
-                code.pcmpeqb(xmm0, masked);
+            code.movaps(selector, indicies);
+            if (i != 0) {
+                code.psubb(selector, code.MConst(xword, table_index, table_index));
+            }
+            code.paddusb(selector, code.MConst(xword, 0x7070707070707070, 0x7070707070707070));
+            code.pshufb(xmm_table, selector);
+
+            if (i != 0) {
+                code.por(result, xmm_table);
+                ctx.reg_alloc.Release(xmm_table);
             }
-            code.pshufb(xmm_table, indicies);
-            code.pblendvb(result, xmm_table);
+        }
+
+        if (!is_defaults_zero) {
+            // Every table lookup has produced zero in the out-of-range lanes, so the defaults can simply be ORed in.
+            const Xbyak::Xmm defaults = ctx.reg_alloc.UseScratchXmm(args[0]);
+            const u64 table_limit = Common::Replicate<u64>(table_size * 16, 8);
 
-            ctx.reg_alloc.Release(xmm_table);
+            code.movaps(selector, code.MConst(xword, table_limit, table_limit));
+            code.pmaxub(selector, indicies);
+            code.pcmpeqb(selector, indicies);
+            code.pand(defaults, selector);
+            code.por(result, defaults);
         }
 
         ctx.reg_alloc.DefineValue(inst, result);
@@ -4841,6 +5941,56 @@ void EmitX64::EmitVectorUnsignedSaturatedShiftLeft64(EmitContext& ctx, IR::Inst*
     EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedShiftLeft<u64>);
 }
 
+template <typename T, typename S = std::make_signed_t<T>>
+static bool VectorUnsignedSaturatedRoundingShiftLeft(VectorArray<T>& dst, const VectorArray<T>& data, const VectorArray<T>& shift_values) {
+    VectorArray<T> left_shifted;
+    const bool qc_flag = VectorUnsignedSaturatedShiftLeft(left_shifted, data, shift_values);
+
+    // RoundingShiftLeft expects signed shift amounts.
+    VectorArray<S> signed_shift_values;
+    std::transform(shift_values.begin(), shift_values.end(), signed_shift_values.begin(), [](T value) { return static_cast<S>(value); });
+
+    RoundingShiftLeft(dst, data, signed_shift_values);
+    for (size_t i = 0; i < dst.size(); i++) {
+        if (static_cast<s8>(shift_values[i]) >= 0) {
+            dst[i] = left_shifted[i];
+        }
+    }
+
+    return qc_flag;
+}
+
+void EmitX64::EmitVectorUnsignedSaturatedRoundingShiftLeft8(EmitContext& ctx, IR::Inst* inst) {
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedRoundingShiftLeft<u8>);
+}
+
+void EmitX64::EmitVectorUnsignedSaturatedRoundingShiftLeft16(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorRoundingShiftLeft(16, false, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedRoundingShiftLeft<u16>);
+}
+
+void EmitX64::EmitVectorUnsignedSaturatedRoundingShiftLeft32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitVectorRoundingShiftLeft(32, false, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedRoundingShiftLeft<u32>);
+}
+
+void EmitX64::EmitVectorUnsignedSaturatedRoundingShiftLeft64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX2()) {
+        EmitVectorRoundingShiftLeft(64, false, true, code, ctx, inst);
+        return;
+    }
+
+    EmitTwoArgumentFallbackWithSaturation(code, ctx, inst, VectorUnsignedSaturatedRoundingShiftLeft<u64>);
+}
+
 void EmitX64::EmitVectorZeroExtend8(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const Xbyak::Xmm a = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -97,10 +97,93 @@ private:
     }
 };
 
+template<size_t fsize>
+Xbyak::Address GetNaNVector(BlockOfCode& code);
+
+template<size_t fsize>
+Xbyak::Address GetQuietBitVector(BlockOfCode& code);
+
+/// Replaces NaN lanes of xmms[0] with the result of FP::ProcessNaNs on the corresponding lanes of the operands
+/// xmms[1..nargs], or with the default NaN if no operand is a NaN. This matches the default NaNHandler with a
+/// DefaultIndexer when FPCR.DN is clear.
+template<size_t fsize, size_t nargs>
+void EmitPropagateNaNs(BlockOfCode& code, std::array<Xbyak::Xmm, nargs + 1> xmms, const Xbyak::Xmm& tmp1, const Xbyak::Xmm& tmp2) {
+    static_assert(nargs == 1 || nargs == 2, "nargs must be either 1 or 2");
+
+    const Xbyak::Xmm result = xmms[0];
+    const Xbyak::Xmm mask = xmm0;
+
+    code.movaps(mask, result);
+    FCODE(cmpunordp)(mask, mask);
+    FCODE(blendvp)(result, GetNaNVector<fsize>(code));
+
+    if constexpr (nargs == 1) {
+        const Xbyak::Xmm a = xmms[1];
+
+        code.movaps(tmp1, a);
+        code.orps(tmp1, GetQuietBitVector<fsize>(code));
+        code.movaps(mask, a);
+        FCODE(cmpunordp)(mask, mask);
+        FCODE(blendvp)(result, tmp1);
+    } else {
+        const Xbyak::Xmm a = xmms[1];
+        const Xbyak::Xmm b = xmms[2];
+
+        // Lanes where b is a NaN take quieted b
+        code.movaps(tmp1, b);
+        code.orps(tmp1, GetQuietBitVector<fsize>(code));
+        code.movaps(mask, b);
+        FCODE(cmpunordp)(mask, mask);
+        FCODE(blendvp)(result, tmp1);
+
+        // tmp2 := b is a signalling NaN
+        code.movaps(tmp2, b);
+        code.andps(tmp2, GetQuietBitVector<fsize>(code));
+        ICODE(pcmpeq)(tmp2, code.MConst(xword, 0, 0));
+        code.andps(tmp2, mask);
+
+        // tmp1 := a is a signalling NaN
+        code.movaps(tmp1, a);
+        code.andps(tmp1, GetQuietBitVector<fsize>(code));
+        ICODE(pcmpeq)(tmp1, code.MConst(xword, 0, 0));
+        code.movaps(mask, a);
+        FCODE(cmpunordp)(mask, mask);
+        code.andps(tmp1, mask);
+
+        // Lanes where a is a NaN take quieted a, unless only b is a signalling NaN
+        code.andnps(tmp1, tmp2);
+        code.andnps(tmp1, mask);
+        code.movaps(mask, tmp1);
+        code.movaps(tmp2, a);
+        code.orps(tmp2, GetQuietBitVector<fsize>(code));
+        FCODE(blendvp)(result, tmp2);
+    }
+}
+
 template<size_t fsize, size_t nargs, typename NaNHandler>
-void HandleNaNs(BlockOfCode& code, EmitContext& ctx, bool fpcr_controlled, std::array<Xbyak::Xmm, nargs + 1> xmms, const Xbyak::Xmm& nan_mask, NaNHandler nan_handler) {
+void HandleNaNs(BlockOfCode& code, EmitContext& ctx, bool fpcr_controlled, std::array<Xbyak::Xmm, nargs + 1> xmms, const Xbyak::Xmm& nan_mask, NaNHandler nan_handler, bool is_default_handler = false) {
     static_assert(fsize == 32 || fsize == 64, "fsize must be either 32 or 64");
 
+    if (is_default_handler && code.HasSSE41()) {
+        const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+
+        code.ptest(nan_mask, nan_mask);
+
+        Xbyak::Label end;
+        Xbyak::Label nan;
+
+        code.jnz(nan, code.T_NEAR);
+        code.L(end);
+
+        code.SwitchToFarCode();
+        code.L(nan);
+        EmitPropagateNaNs<fsize, nargs>(code, xmms, tmp1, tmp2);
+        code.jmp(end, code.T_NEAR);
+        code.SwitchToNearCode();
+        return;
+    }
+
     if (code.HasSSE41()) {
         code.ptest(nan_mask, nan_mask);
     } else {
@@ -143,7 +226,10 @@ void HandleNaNs(BlockOfCode& code, EmitContext& ctx, bool fpcr_controlled, std::
 
 template<size_t fsize>
 Xbyak::Address GetVectorOf(BlockOfCode& code, u64 value) {
-    if constexpr (fsize == 32) {
+    if constexpr (fsize == 16) {
+        const u64 replicated = (value << 48) | (value << 32) | (value << 16) | value;
+        return code.MConst(xword, replicated, replicated);
+    } else if constexpr (fsize == 32) {
         return code.MConst(xword, (value << 32) | value, (value << 32) | value);
     } else {
         return code.MConst(xword, value, value);
@@ -152,7 +238,10 @@ Xbyak::Address GetVectorOf(BlockOfCode& code, u64 value) {
 
 template<size_t fsize, u64 value>
 Xbyak::Address GetVectorOf(BlockOfCode& code) {
-    if constexpr (fsize == 32) {
+    if constexpr (fsize == 16) {
+        constexpr u64 replicated = (value << 48) | (value << 32) | (value << 16) | value;
+        return code.MConst(xword, replicated, replicated);
+    } else if constexpr (fsize == 32) {
         return code.MConst(xword, (value << 32) | value, (value << 32) | value);
     } else {
         return code.MConst(xword, value, value);
@@ -165,12 +254,25 @@ Xbyak::Address GetNaNVector(BlockOfCode& code) {
     return GetVectorOf<fsize, FP::FPInfo<FPT>::DefaultNaN()>(code);
 }
 
+template<size_t fsize>
+Xbyak::Address GetQuietBitVector(BlockOfCode& code) {
+    using FPT = mp::unsigned_integer_of_size<fsize>;
+    return GetVectorOf<fsize, FP::FPInfo<FPT>::mantissa_msb>(code);
+}
+
 template<size_t fsize>
 Xbyak::Address GetNegativeZeroVector(BlockOfCode& code) {
     using FPT = mp::unsigned_integer_of_size<fsize>;
     return GetVectorOf<fsize, FP::FPInfo<FPT>::Zero(true)>(code);
 }
 
+template<size_t fsize>
+Xbyak::Address GetNonSignMaskVector(BlockOfCode& code) {
+    using FPT = mp::unsigned_integer_of_size<fsize>;
+    constexpr FPT non_sign_mask = FP::FPInfo<FPT>::exponent_mask | FP::FPInfo<FPT>::mantissa_mask;
+    return GetVectorOf<fsize, non_sign_mask>(code);
+}
+
 template<size_t fsize>
 Xbyak::Address GetSmallestNormalVector(BlockOfCode& code) {
     using FPT = mp::unsigned_integer_of_size<fsize>;
@@ -330,7 +432,8 @@ void EmitTwoOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* ins
         FCODE(cmpunordp)(nan_mask, nan_mask);
     }
 
-    HandleNaNs<fsize, 1>(code, ctx, fpcr_controlled, {result, xmm_a}, nan_mask, nan_handler);
+    const bool is_default_handler = std::is_same_v<Indexer<u32>, DefaultIndexer<u32>> && nan_handler == NaNHandler<fsize, Indexer, 2>::GetDefault();
+    HandleNaNs<fsize, 1>(code, ctx, fpcr_controlled, {result, xmm_a}, nan_mask, nan_handler, is_default_handler);
 
     ctx.reg_alloc.DefineValue(inst, result);
 }
@@ -377,22 +480,16 @@ void EmitThreeOpVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* i
     }
     FCODE(cmpunordp)(nan_mask, result);
 
-    HandleNaNs<fsize, 2>(code, ctx, fpcr_controlled, {result, xmm_a, xmm_b}, nan_mask, nan_handler);
+    const bool is_default_handler = std::is_same_v<Indexer<u32>, DefaultIndexer<u32>> && nan_handler == NaNHandler<fsize, Indexer, 3>::GetDefault();
+    HandleNaNs<fsize, 2>(code, ctx, fpcr_controlled, {result, xmm_a, xmm_b}, nan_mask, nan_handler, is_default_handler);
 
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
-template<size_t fpcr_controlled_arg_index = 1, typename Lambda>
-void EmitTwoOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lambda lambda) {
+template<typename Lambda>
+void EmitTwoOpFallbackWithoutRegAlloc(BlockOfCode& code, EmitContext& ctx, Xbyak::Xmm result, Xbyak::Xmm arg1, Lambda lambda, bool fpcr_controlled) {
     const auto fn = static_cast<mp::equivalent_function_type<Lambda>*>(lambda);
 
-    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
-    const bool fpcr_controlled = args[fpcr_controlled_arg_index].GetImmediateU1();
-    const Xbyak::Xmm arg1 = ctx.reg_alloc.UseXmm(args[0]);
-    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
-    ctx.reg_alloc.EndOfAllocScope();
-    ctx.reg_alloc.HostCall(nullptr);
-
     constexpr u32 stack_space = 2 * 16;
     code.sub(rsp, stack_space + ABI_SHADOW_SPACE);
     code.lea(code.ABI_PARAM1, ptr[rsp + ABI_SHADOW_SPACE + 0 * 16]);
@@ -405,6 +502,18 @@ void EmitTwoOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lamb
     code.movaps(result, xword[rsp + ABI_SHADOW_SPACE + 0 * 16]);
 
     code.add(rsp, stack_space + ABI_SHADOW_SPACE);
+}
+
+template<size_t fpcr_controlled_arg_index = 1, typename Lambda>
+void EmitTwoOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lambda lambda) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const bool fpcr_controlled = args[fpcr_controlled_arg_index].GetImmediateU1();
+    const Xbyak::Xmm arg1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    ctx.reg_alloc.EndOfAllocScope();
+    ctx.reg_alloc.HostCall(nullptr);
+
+    EmitTwoOpFallbackWithoutRegAlloc(code, ctx, result, arg1, lambda, fpcr_controlled);
 
     ctx.reg_alloc.DefineValue(inst, result);
 }
@@ -518,6 +627,100 @@ void EmitFourOpFallback(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Lam
     ctx.reg_alloc.DefineValue(inst, result);
 }
 
+/// Half-precision lanes are widened to single-precision, which has more than twice the precision of half-precision;
+/// narrowing the single-precision result is therefore correctly rounded. NaNs and results of smallest-normal
+/// magnitude (which may have been tiny before rounding) use the soft-float implementation.
+template<size_t nargs, typename Function, typename Lambda>
+void EmitHalfVectorOperation(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn, Lambda fallback_fn) {
+    static_assert(nargs == 1 || nargs == 2);
+
+    const bool fpcr_controlled = inst->GetArg(nargs).GetU1();
+
+    if (!code.HasAVX() || !code.HasF16C() || ctx.FPCR(fpcr_controlled).FZ16()) {
+        if constexpr (nargs == 1) {
+            EmitTwoOpFallback(code, ctx, inst, fallback_fn);
+        } else {
+            EmitThreeOpFallback(code, ctx, inst, fallback_fn);
+        }
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm operand1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm operand2 = nargs == 2 ? ctx.reg_alloc.UseXmm(args[1]) : operand1;
+    const Xbyak::Ymm tmp1 = Xbyak::Ymm{ctx.reg_alloc.ScratchXmm().getIdx()};
+    const Xbyak::Ymm tmp2 = Xbyak::Ymm{ctx.reg_alloc.ScratchXmm().getIdx()};
+
+    Xbyak::Label end, fallback;
+
+    MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
+        code.vcvtph2ps(tmp1, operand1);
+        if constexpr (nargs == 2) {
+            code.vcvtph2ps(tmp2, operand2);
+        }
+        fn(tmp1, tmp2);
+        code.vcvtps2ph(result, tmp1, 0b100);
+        code.vzeroupper();
+
+        code.vpand(Xbyak::Xmm{tmp2.getIdx()}, result, GetNonSignMaskVector<16>(code));
+        code.vpcmpeqw(Xbyak::Xmm{tmp1.getIdx()}, Xbyak::Xmm{tmp2.getIdx()}, GetSmallestNormalVector<16>(code));
+        code.vpcmpgtw(Xbyak::Xmm{tmp2.getIdx()}, Xbyak::Xmm{tmp2.getIdx()}, GetVectorOf<16, FP::FPInfo<u16>::Infinity(false)>(code));
+        code.vpor(Xbyak::Xmm{tmp2.getIdx()}, Xbyak::Xmm{tmp2.getIdx()}, Xbyak::Xmm{tmp1.getIdx()});
+        code.vptest(Xbyak::Xmm{tmp2.getIdx()}, Xbyak::Xmm{tmp2.getIdx()});
+        code.jnz(fallback, code.T_NEAR);
+        code.L(end);
+    });
+
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.sub(rsp, 8);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    if constexpr (nargs == 1) {
+        EmitTwoOpFallbackWithoutRegAlloc(code, ctx, result, operand1, fallback_fn, fpcr_controlled);
+    } else {
+        EmitThreeOpFallbackWithoutRegAlloc(code, ctx, result, operand1, operand2, fallback_fn, fpcr_controlled);
+    }
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    code.add(rsp, 8);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
+/// Half-precision comparisons are exact, so are performed on lanes widened to single-precision. As on ARM, the
+/// ordered comparisons signal on any NaN.
+template<typename Function, typename Lambda>
+void EmitHalfVectorCompare(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst, Function fn, Lambda fallback_fn) {
+    const bool fpcr_controlled = inst->GetArg(2).GetU1();
+
+    if (!code.HasAVX() || !code.HasF16C() || ctx.FPCR(fpcr_controlled).FZ16()) {
+        EmitThreeOpFallback(code, ctx, inst, fallback_fn);
+        return;
+    }
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm operand1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm operand2 = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Ymm tmp1 = Xbyak::Ymm{ctx.reg_alloc.ScratchXmm().getIdx()};
+    const Xbyak::Ymm tmp2 = Xbyak::Ymm{ctx.reg_alloc.ScratchXmm().getIdx()};
+
+    MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
+        code.vcvtph2ps(tmp1, operand1);
+        code.vcvtph2ps(tmp2, operand2);
+        fn(tmp1, tmp2);
+        code.vextractf128(Xbyak::Xmm{tmp2.getIdx()}, tmp1, 1);
+        code.vpackssdw(result, Xbyak::Xmm{tmp1.getIdx()}, Xbyak::Xmm{tmp2.getIdx()});
+        code.vzeroupper();
+    });
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 } // anonymous namespace
 
 void EmitX64::EmitFPVectorAbs16(EmitContext& ctx, IR::Inst* inst) {
@@ -553,6 +756,16 @@ void EmitX64::EmitFPVectorAbs64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, a);
 }
 
+void EmitX64::EmitFPVectorAdd16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<2>(code, ctx, inst, [&](const Xbyak::Ymm& result, const Xbyak::Ymm& operand) {
+        code.vaddps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPAdd<u16>(op1[i], op2[i], fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorAdd32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::addps);
 }
@@ -561,6 +774,16 @@ void EmitX64::EmitFPVectorAdd64(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<64, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::addpd);
 }
 
+void EmitX64::EmitFPVectorDiv16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<2>(code, ctx, inst, [&](const Xbyak::Ymm& result, const Xbyak::Ymm& operand) {
+        code.vdivps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPDiv<u16>(op1[i], op2[i], fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorDiv32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::divps);
 }
@@ -791,6 +1014,16 @@ void EmitX64::EmitFPVectorFromUnsignedFixed64(EmitContext& ctx, IR::Inst* inst)
     ctx.reg_alloc.DefineValue(inst, xmm);
 }
 
+void EmitX64::EmitFPVectorGreater16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorCompare(code, ctx, inst, [&](const Xbyak::Ymm& a, const Xbyak::Ymm& b) {
+        code.vcmpgtps(a, a, b);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPCompareGT(op1[i], op2[i], fpcr, fpsr) ? 0xFFFF : 0;
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorGreater32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[2].GetImmediateU1();
@@ -819,6 +1052,16 @@ void EmitX64::EmitFPVectorGreater64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, b);
 }
 
+void EmitX64::EmitFPVectorGreaterEqual16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorCompare(code, ctx, inst, [&](const Xbyak::Ymm& a, const Xbyak::Ymm& b) {
+        code.vcmpgeps(a, a, b);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPCompareGE(op1[i], op2[i], fpcr, fpsr) ? 0xFFFF : 0;
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorGreaterEqual32(EmitContext& ctx, IR::Inst* inst) {
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
     const bool fpcr_controlled = args[2].GetImmediateU1();
@@ -847,6 +1090,85 @@ void EmitX64::EmitFPVectorGreaterEqual64(EmitContext& ctx, IR::Inst* inst) {
     ctx.reg_alloc.DefineValue(inst, b);
 }
 
+template<bool is_max>
+static void EmitHalfVectorMinMax(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    const auto fallback_fn = [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = is_max ? FP::FPMax<u16>(op1[i], op2[i], fpcr, fpsr) : FP::FPMin<u16>(op1[i], op2[i], fpcr, fpsr);
+        }
+    };
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    const bool fpcr_controlled = args[2].GetImmediateU1();
+
+    const Xbyak::Xmm operand1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm operand2 = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp1 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Xmm tmp2 = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg32 tmp_gpr = ctx.reg_alloc.ScratchGpr().cvt32();
+
+    Xbyak::Label end, fallback;
+
+    // Minimum and maximum are exact, so they are computed on integers that order in the same way as the values
+    // they encode. NaNs use the soft-float implementation.
+    code.movdqa(tmp1, operand1);
+    code.movdqa(tmp2, operand2);
+    code.pand(tmp1, GetNonSignMaskVector<16>(code));
+    code.pand(tmp2, GetNonSignMaskVector<16>(code));
+    code.pcmpgtw(tmp1, GetVectorOf<16, FP::FPInfo<u16>::Infinity(false)>(code));
+    code.pcmpgtw(tmp2, GetVectorOf<16, FP::FPInfo<u16>::Infinity(false)>(code));
+    code.por(tmp1, tmp2);
+    code.pmovmskb(tmp_gpr, tmp1);
+    code.test(tmp_gpr, tmp_gpr);
+    code.jnz(fallback, code.T_NEAR);
+
+    const auto flush_denormal = [&](Xbyak::Xmm value, Xbyak::Xmm scratch) {
+        code.movdqa(scratch, value);
+        code.pand(scratch, GetVectorOf<16, FP::FPInfo<u16>::exponent_mask>(code));
+        code.pcmpeqw(scratch, code.MConst(xword, 0, 0));
+        code.pand(scratch, GetNonSignMaskVector<16>(code));
+        code.pandn(scratch, value);
+        code.movdqa(value, scratch);
+    };
+
+    // Maps sign-magnitude encodings to two's complement, where -0 orders below +0 as ARM requires.
+    const auto to_ordered = [&](Xbyak::Xmm value, Xbyak::Xmm scratch) {
+        code.movdqa(scratch, value);
+        code.psraw(scratch, 15);
+        code.pand(scratch, GetNonSignMaskVector<16>(code));
+        code.pxor(value, scratch);
+    };
+
+    code.movdqa(result, operand1);
+    code.movdqa(tmp1, operand2);
+    if (ctx.FPCR(fpcr_controlled).FZ16()) {
+        flush_denormal(result, tmp2);
+        flush_denormal(tmp1, tmp2);
+    }
+    to_ordered(result, tmp2);
+    to_ordered(tmp1, tmp2);
+    if constexpr (is_max) {
+        code.pmaxsw(result, tmp1);
+    } else {
+        code.pminsw(result, tmp1);
+    }
+    to_ordered(result, tmp2);
+    code.L(end);
+
+    code.SwitchToFarCode();
+    code.L(fallback);
+    code.sub(rsp, 8);
+    ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    EmitThreeOpFallbackWithoutRegAlloc(code, ctx, result, operand1, operand2, fallback_fn, fpcr_controlled);
+    ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+    code.add(rsp, 8);
+    code.jmp(end, code.T_NEAR);
+    code.SwitchToNearCode();
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 template<size_t fsize, bool is_max>
 static void EmitFPVectorMinMax(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
     const bool fpcr_controlled = inst->GetArg(2).GetU1();
@@ -950,6 +1272,10 @@ static void EmitFPVectorMinMax(BlockOfCode& code, EmitContext& ctx, IR::Inst* in
     });
 }
 
+void EmitX64::EmitFPVectorMax16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorMinMax<true>(code, ctx, inst);
+}
+
 void EmitX64::EmitFPVectorMax32(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMinMax<32, true>(code, ctx, inst);
 }
@@ -958,6 +1284,10 @@ void EmitX64::EmitFPVectorMax64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMinMax<64, true>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPVectorMin16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorMinMax<false>(code, ctx, inst);
+}
+
 void EmitX64::EmitFPVectorMin32(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMinMax<32, false>(code, ctx, inst);
 }
@@ -966,6 +1296,16 @@ void EmitX64::EmitFPVectorMin64(EmitContext& ctx, IR::Inst* inst) {
     EmitFPVectorMinMax<64, false>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPVectorMul16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<2>(code, ctx, inst, [&](const Xbyak::Ymm& result, const Xbyak::Ymm& operand) {
+        code.vmulps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPMul<u16>(op1[i], op2[i], fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorMul32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::mulps);
 }
@@ -984,7 +1324,96 @@ void EmitFPVectorMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
         }
     };
 
-    if constexpr (fsize != 16) {
+    if constexpr (fsize == 16) {
+        const bool fpcr_controlled = inst->GetArg(3).GetU1();
+
+        // Each half of the vector is widened to double-precision, where the product is exact and the sum is either
+        // exact or only rounded in bits that cannot affect the final result. Narrowing then rounds once, as the
+        // intermediate single-precision conversion rounds to odd.
+        if (code.HasFMA() && code.HasAVX() && code.HasF16C() && !ctx.FPCR(fpcr_controlled).FZ16()) {
+            auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+            const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm xmm_a = ctx.reg_alloc.UseXmm(args[0]);
+            const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
+            const Xbyak::Xmm xmm_c = ctx.reg_alloc.UseXmm(args[2]);
+            const Xbyak::Xmm upper = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Ymm tmp1 = Xbyak::Ymm{ctx.reg_alloc.ScratchXmm().getIdx()};
+            const Xbyak::Ymm tmp2 = Xbyak::Ymm{ctx.reg_alloc.ScratchXmm().getIdx()};
+            const Xbyak::Ymm tmp3 = Xbyak::Ymm{ctx.reg_alloc.ScratchXmm().getIdx()};
+            const Xbyak::Ymm tmp4 = Xbyak::Ymm{ctx.reg_alloc.ScratchXmm().getIdx()};
+
+            Xbyak::Label end, fallback;
+
+            const auto widen = [&](Xbyak::Ymm dest, Xbyak::Xmm source, bool upper_half) {
+                if (upper_half) {
+                    code.vpshufd(Xbyak::Xmm{dest.getIdx()}, source, 0b11101110);
+                    code.vcvtph2ps(Xbyak::Xmm{dest.getIdx()}, Xbyak::Xmm{dest.getIdx()});
+                } else {
+                    code.vcvtph2ps(Xbyak::Xmm{dest.getIdx()}, source);
+                }
+                code.vcvtps2pd(dest, Xbyak::Xmm{dest.getIdx()});
+            };
+
+            // Packs the lower doubleword of each quadword of a ymm mask into an xmm mask
+            const auto pack_mask = [&](Xbyak::Ymm mask, Xbyak::Ymm scratch) {
+                code.vextractf128(Xbyak::Xmm{scratch.getIdx()}, mask, 1);
+                code.vshufps(Xbyak::Xmm{mask.getIdx()}, Xbyak::Xmm{mask.getIdx()}, Xbyak::Xmm{scratch.getIdx()}, 0b10001000);
+            };
+
+            const auto fma_half = [&](Xbyak::Xmm dest, bool upper_half) {
+                widen(tmp1, xmm_a, upper_half);
+                widen(tmp2, xmm_b, upper_half);
+                widen(tmp3, xmm_c, upper_half);
+                code.vfmadd231pd(tmp1, tmp2, tmp3);
+
+                // Round to odd (see EmitConvertDoubleToSingleRoundToOdd in the scalar emitter)
+                code.vcvtpd2ps(Xbyak::Xmm{tmp2.getIdx()}, tmp1);
+                code.vcvtps2pd(tmp3, Xbyak::Xmm{tmp2.getIdx()});
+                code.vbroadcastsd(tmp4, code.MConst(qword, 0x7FFFFFFFFFFFFFFF));
+                code.vandpd(tmp1, tmp1, tmp4);
+                code.vandpd(tmp3, tmp3, tmp4);
+                code.vcmpneq_oqpd(tmp4, tmp1, tmp3);
+                code.vcmplt_oqpd(tmp1, tmp1, tmp3);
+                pack_mask(tmp1, tmp3);
+                pack_mask(tmp4, tmp3);
+                code.vpaddd(Xbyak::Xmm{tmp2.getIdx()}, Xbyak::Xmm{tmp2.getIdx()}, Xbyak::Xmm{tmp1.getIdx()});
+                code.vpsrld(Xbyak::Xmm{tmp4.getIdx()}, Xbyak::Xmm{tmp4.getIdx()}, 31);
+                code.vpor(Xbyak::Xmm{tmp2.getIdx()}, Xbyak::Xmm{tmp2.getIdx()}, Xbyak::Xmm{tmp4.getIdx()});
+
+                code.vcvtps2ph(dest, Xbyak::Xmm{tmp2.getIdx()}, 0b100);
+            };
+
+            MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
+                fma_half(result, false);
+                fma_half(upper, true);
+                code.vzeroupper();
+                code.vpunpcklqdq(result, result, upper);
+
+                // NaNs require ARM's NaN selection, and results of smallest-normal magnitude may have been tiny before rounding.
+                code.vpand(upper, result, code.MConst(xword, 0x7FFF7FFF7FFF7FFF, 0x7FFF7FFF7FFF7FFF));
+                code.vpcmpeqw(Xbyak::Xmm{tmp1.getIdx()}, upper, code.MConst(xword, 0x0400040004000400, 0x0400040004000400));
+                code.vpcmpgtw(upper, upper, code.MConst(xword, 0x7C007C007C007C00, 0x7C007C007C007C00));
+                code.vpor(upper, upper, Xbyak::Xmm{tmp1.getIdx()});
+                code.vptest(upper, upper);
+                code.jnz(fallback, code.T_NEAR);
+                code.L(end);
+            });
+
+            code.SwitchToFarCode();
+            code.L(fallback);
+            code.sub(rsp, 8);
+            ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            EmitFourOpFallbackWithoutRegAlloc(code, ctx, result, xmm_a, xmm_b, xmm_c, fallback_fn, fpcr_controlled);
+            ABI_PopCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
+            code.add(rsp, 8);
+            code.jmp(end, code.T_NEAR);
+            code.SwitchToNearCode();
+
+            ctx.reg_alloc.DefineValue(inst, result);
+            return;
+        }
+    } else {
         if (code.HasFMA() && code.HasAVX()) {
             auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
@@ -995,8 +1424,9 @@ void EmitFPVectorMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
             const Xbyak::Xmm xmm_b = ctx.reg_alloc.UseXmm(args[1]);
             const Xbyak::Xmm xmm_c = ctx.reg_alloc.UseXmm(args[2]);
             const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
+            const Xbyak::Xmm probe = ctx.reg_alloc.ScratchXmm();
 
-            Xbyak::Label end, fallback;
+            Xbyak::Label end, fallback, nan;
 
             MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&]{
                 code.movaps(result, xmm_a);
@@ -1012,6 +1442,38 @@ void EmitFPVectorMulAdd(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
 
             code.SwitchToFarCode();
             code.L(fallback);
+
+            FCODE(vcmpunordp)(probe, result, result);
+            code.vptest(probe, probe);
+            code.jnz(nan, code.T_NEAR);
+
+            // x64 detects tininess after rounding whereas ARM detects it before rounding. A result of smallest-normal
+            // magnitude was tiny before rounding iff the same operation rounded towards zero is subnormal.
+            code.sub(rsp, 8);
+            code.stmxcsr(dword[rsp]);
+            code.stmxcsr(dword[rsp + 4]);
+            code.or_(dword[rsp + 4], 0x6000);
+            code.ldmxcsr(dword[rsp + 4]);
+            code.movaps(probe, xmm_a);
+            FCODE(vfmadd231p)(probe, xmm_b, xmm_c);
+            code.ldmxcsr(dword[rsp]);
+            code.add(rsp, 8);
+
+            code.andps(probe, GetNonSignMaskVector<fsize>(code));
+            FCODE(vcmplt_oqp)(probe, probe, GetSmallestNormalVector<fsize>(code));
+            code.andps(probe, tmp);
+            code.vptest(probe, probe);
+            code.jz(end, code.T_NEAR);
+
+            code.or_(dword[code.r15 + code.GetJitStateInfo().offsetof_fpsr_exc], 1 << 3); // UFC
+            if (ctx.FPCR(fpcr_controlled).FZ()) {
+                code.andps(probe, GetNonSignMaskVector<fsize>(code));
+                code.andnps(probe, result);
+                code.movaps(result, probe);
+            }
+            code.jmp(end, code.T_NEAR);
+
+            code.L(nan);
             code.sub(rsp, 8);
             ABI_PushCallerSaveRegistersAndAdjustStackExcept(code, HostLocXmmIdx(result.getIdx()));
             EmitFourOpFallbackWithoutRegAlloc(code, ctx, result, xmm_a, xmm_b, xmm_c, fallback_fn, fpcr_controlled);
@@ -1501,6 +1963,16 @@ void EmitX64::EmitFPVectorRSqrtStepFused64(EmitContext& ctx, IR::Inst* inst) {
     EmitRSqrtStepFused<64>(code, ctx, inst);
 }
 
+void EmitX64::EmitFPVectorSqrt16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<1>(code, ctx, inst, [&](const Xbyak::Ymm& result, const Xbyak::Ymm&) {
+        code.vsqrtps(result, result);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& operand, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPSqrt<u16>(operand[i], fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorSqrt32(EmitContext& ctx, IR::Inst* inst) {
     EmitTwoOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, [this](const Xbyak::Xmm& result, const Xbyak::Xmm& operand) {
         code.sqrtps(result, operand);
@@ -1513,6 +1985,16 @@ void EmitX64::EmitFPVectorSqrt64(EmitContext& ctx, IR::Inst* inst) {
     });
 }
 
+void EmitX64::EmitFPVectorSub16(EmitContext& ctx, IR::Inst* inst) {
+    EmitHalfVectorOperation<2>(code, ctx, inst, [&](const Xbyak::Ymm& result, const Xbyak::Ymm& operand) {
+        code.vsubps(result, result, operand);
+    }, [](VectorArray<u16>& result, const VectorArray<u16>& op1, const VectorArray<u16>& op2, FP::FPCR fpcr, FP::FPSR& fpsr) {
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = FP::FPSub<u16>(op1[i], op2[i], fpcr, fpsr);
+        }
+    });
+}
+
 void EmitX64::EmitFPVectorSub32(EmitContext& ctx, IR::Inst* inst) {
     EmitThreeOpVectorOperation<32, DefaultIndexer>(code, ctx, inst, &Xbyak::CodeGenerator::subps);
 }
@@ -56,12 +56,59 @@ void EmitVectorSignedSaturated(BlockOfCode& code, EmitContext& ctx, IR::Inst* in
 
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
+    if (code.HasAVX512_Skylake()) {
+        const Xbyak::Xmm operand1 = ctx.reg_alloc.UseScratchXmm(args[0]);
+        const Xbyak::Xmm operand2 = ctx.reg_alloc.UseXmm(args[1]);
+        const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+        const Xbyak::Reg8 overflow = ctx.reg_alloc.ScratchGpr().cvt8();
+
+        if constexpr (op == Op::Add) {
+            if constexpr (esize == 32) {
+                code.vpaddd(result, operand1, operand2);
+            } else {
+                code.vpaddq(result, operand1, operand2);
+            }
+        } else {
+            if constexpr (esize == 32) {
+                code.vpsubd(result, operand1, operand2);
+            } else {
+                code.vpsubq(result, operand1, operand2);
+            }
+        }
+
+        // Sign bit of operand1 is set for each overflowing element
+        if constexpr (op == Op::Add) {
+            // (operand1 ^ result) & (operand2 ^ result)
+            code.vpternlogd(operand1, operand2, result, 0b01000010);
+        } else {
+            // (operand1 ^ operand2) & (operand1 ^ result)
+            code.vpternlogd(operand1, operand2, result, 0b00011000);
+        }
+
+        // Overflowing elements saturate to MAX if the wrapped result is negative and to MIN otherwise
+        if constexpr (esize == 32) {
+            code.vpmovd2m(k1, operand1);
+            code.vpsrad(operand1, result, 31);
+            code.vpxord(result | k1, operand1, code.MConst(xword, msb_mask, msb_mask));
+        } else {
+            code.vpmovq2m(k1, operand1);
+            code.vpsraq(operand1, result, 63);
+            code.vpxorq(result | k1, operand1, code.MConst(xword, msb_mask, msb_mask));
+        }
+
+        code.kortestb(k1, k1);
+        code.setnz(overflow);
+        code.or_(code.byte[code.r15 + code.GetJitStateInfo().offsetof_fpsr_qc], overflow);
+
+        ctx.reg_alloc.DefineValue(inst, result);
+        return;
+    }
+
     const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
     const Xbyak::Xmm arg = ctx.reg_alloc.UseXmm(args[1]);
     const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
     const Xbyak::Reg8 overflow = ctx.reg_alloc.ScratchGpr().cvt8();
 
-    // TODO AVX-512: vpternlog, vpsraq
     // TODO AVX2 implementation
 
     code.movaps(xmm0, result);
@@ -131,6 +178,49 @@ void EmitVectorSignedSaturated(BlockOfCode& code, EmitContext& ctx, IR::Inst* in
     }
 }
 
+template<Op op, size_t esize>
+void EmitVectorUnsignedSaturatedAVX512(BlockOfCode& code, EmitContext& ctx, IR::Inst* inst) {
+    static_assert(esize == 32 || esize == 64);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+
+    const Xbyak::Xmm operand1 = ctx.reg_alloc.UseXmm(args[0]);
+    const Xbyak::Xmm operand2 = ctx.reg_alloc.UseXmm(args[1]);
+    const Xbyak::Xmm result = ctx.reg_alloc.ScratchXmm();
+    const Xbyak::Reg8 overflow = ctx.reg_alloc.ScratchGpr().cvt8();
+
+    constexpr u8 less_than = 1;
+
+    if constexpr (op == Op::Add) {
+        // Elements that wrap around compare less than either operand
+        if constexpr (esize == 32) {
+            code.vpaddd(result, operand1, operand2);
+            code.vpcmpud(k1, result, operand1, less_than);
+            code.vpternlogd(result | k1, result, result, 0xFF);
+        } else {
+            code.vpaddq(result, operand1, operand2);
+            code.vpcmpuq(k1, result, operand1, less_than);
+            code.vpternlogq(result | k1, result, result, 0xFF);
+        }
+    } else {
+        if constexpr (esize == 32) {
+            code.vpcmpud(k1, operand1, operand2, less_than);
+            code.vpsubd(result, operand1, operand2);
+            code.vpxord(result | k1, result, result);
+        } else {
+            code.vpcmpuq(k1, operand1, operand2, less_than);
+            code.vpsubq(result, operand1, operand2);
+            code.vpxorq(result | k1, result, result);
+        }
+    }
+
+    code.kortestb(k1, k1);
+    code.setnz(overflow);
+    code.or_(code.byte[code.r15 + code.GetJitStateInfo().offsetof_fpsr_qc], overflow);
+
+    ctx.reg_alloc.DefineValue(inst, result);
+}
+
 } // anonymous namespace
 
 void EmitX64::EmitVectorSignedSaturatedAdd8(EmitContext& ctx, IR::Inst* inst) {
@@ -174,6 +264,11 @@ void EmitX64::EmitVectorUnsignedSaturatedAdd16(EmitContext& ctx, IR::Inst* inst)
 }
 
 void EmitX64::EmitVectorUnsignedSaturatedAdd32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorUnsignedSaturatedAVX512<Op::Add, 32>(code, ctx, inst);
+        return;
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -181,7 +276,7 @@ void EmitX64::EmitVectorUnsignedSaturatedAdd32(EmitContext& ctx, IR::Inst* inst)
     const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
     const Xbyak::Reg8 overflow = ctx.reg_alloc.ScratchGpr().cvt8();
 
-    // TODO AVX2, AVX-512: vpternlog
+    // TODO AVX2 implementation
 
     code.movaps(tmp, result);
     code.movaps(xmm0, result);
@@ -209,6 +304,11 @@ void EmitX64::EmitVectorUnsignedSaturatedAdd32(EmitContext& ctx, IR::Inst* inst)
 }
 
 void EmitX64::EmitVectorUnsignedSaturatedAdd64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorUnsignedSaturatedAVX512<Op::Add, 64>(code, ctx, inst);
+        return;
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -216,7 +316,7 @@ void EmitX64::EmitVectorUnsignedSaturatedAdd64(EmitContext& ctx, IR::Inst* inst)
     const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
     const Xbyak::Reg8 overflow = ctx.reg_alloc.ScratchGpr().cvt8();
 
-    // TODO AVX2, AVX-512: vpternlog
+    // TODO AVX2 implementation
 
     code.movaps(tmp, result);
     code.movaps(xmm0, result);
@@ -253,6 +353,11 @@ void EmitX64::EmitVectorUnsignedSaturatedSub16(EmitContext& ctx, IR::Inst* inst)
 }
 
 void EmitX64::EmitVectorUnsignedSaturatedSub32(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorUnsignedSaturatedAVX512<Op::Sub, 32>(code, ctx, inst);
+        return;
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -260,7 +365,7 @@ void EmitX64::EmitVectorUnsignedSaturatedSub32(EmitContext& ctx, IR::Inst* inst)
     const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
     const Xbyak::Reg8 overflow = ctx.reg_alloc.ScratchGpr().cvt8();
 
-    // TODO AVX2, AVX-512: vpternlog
+    // TODO AVX2 implementation
 
     code.movaps(tmp, result);
     code.movaps(xmm0, subtrahend);
@@ -287,6 +392,11 @@ void EmitX64::EmitVectorUnsignedSaturatedSub32(EmitContext& ctx, IR::Inst* inst)
 }
 
 void EmitX64::EmitVectorUnsignedSaturatedSub64(EmitContext& ctx, IR::Inst* inst) {
+    if (code.HasAVX512_Skylake()) {
+        EmitVectorUnsignedSaturatedAVX512<Op::Sub, 64>(code, ctx, inst);
+        return;
+    }
+
     auto args = ctx.reg_alloc.GetArgumentInfo(inst);
 
     const Xbyak::Xmm result = ctx.reg_alloc.UseScratchXmm(args[0]);
@@ -294,7 +404,7 @@ void EmitX64::EmitVectorUnsignedSaturatedSub64(EmitContext& ctx, IR::Inst* inst)
     const Xbyak::Xmm tmp = ctx.reg_alloc.ScratchXmm();
     const Xbyak::Reg8 overflow = ctx.reg_alloc.ScratchGpr().cvt8();
 
-    // TODO AVX2, AVX-512: vpternlog
+    // TODO AVX2 implementation
 
     code.movaps(tmp, result);
     code.movaps(xmm0, subtrahend);
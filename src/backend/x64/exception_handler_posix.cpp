@@ -60,7 +60,7 @@ private:
 SigHandler sig_handler;
 
 SigHandler::SigHandler() {
-    constexpr size_t signal_stack_size = std::max(SIGSTKSZ, 2 * 1024 * 1024);
+    const size_t signal_stack_size = std::max<size_t>(SIGSTKSZ, 2 * 1024 * 1024);
 
     stack_t signal_stack;
     signal_stack.ss_sp = std::malloc(signal_stack_size);
@@ -7,53 +7,92 @@
 
 #include <dynarmic/exclusive_monitor.h>
 #include "common/assert.h"
+#include "common/bit_util.h"
+#include "common/common_types.h"
 
 namespace Dynarmic {
 
-ExclusiveMonitor::ExclusiveMonitor(size_t processor_count) :
-    exclusive_addresses(processor_count, INVALID_EXCLUSIVE_ADDRESS), exclusive_values(processor_count) {
-    Unlock();
+ExclusiveMonitor::ExclusiveMonitor(size_t processor_count)
+        : processor_count(processor_count)
+        , processors(std::make_unique<ProcessorSlot[]>(processor_count))
+        , shards(std::make_unique<Shard[]>(SHARD_COUNT)) {
+    Clear();
 }
 
+ExclusiveMonitor::~ExclusiveMonitor() = default;
+
 size_t ExclusiveMonitor::GetProcessorCount() const {
-    return exclusive_addresses.size();
+    return processor_count;
 }
 
-void ExclusiveMonitor::Lock() {
-    while (is_locked.test_and_set(std::memory_order_acquire)) {}
+size_t ExclusiveMonitor::ShardIndex(VAddr masked_address) {
+    // Fibonacci hashing: the top bits of the product are well mixed.
+    return static_cast<size_t>((masked_address * SHARD_HASH_MULTIPLIER) >> (64 - SHARD_BITS));
 }
 
-void ExclusiveMonitor::Unlock() {
-    is_locked.clear(std::memory_order_release);
+void ExclusiveMonitor::Lock(Shard& shard) {
+    while (shard.is_locked.exchange(true, std::memory_order_acquire)) {}
 }
 
-bool ExclusiveMonitor::CheckAndClear(size_t processor_id, VAddr address) {
-    const VAddr masked_address = address & RESERVATION_GRANULE_MASK;
+void ExclusiveMonitor::Unlock(Shard& shard) {
+    shard.is_locked.store(false, std::memory_order_release);
+}
 
-    Lock();
-    if (exclusive_addresses[processor_id] != masked_address) {
-        Unlock();
+void ExclusiveMonitor::Mark(Shard& shard, size_t processor_id, VAddr masked_address) {
+    processors[processor_id].address.store(masked_address, std::memory_order_relaxed);
+    if (processor_id < Common::BitSize<u64>()) {
+        shard.processor_mask |= u64(1) << processor_id;
+    }
+}
+
+bool ExclusiveMonitor::CheckAndClear(Shard& shard, size_t processor_id, VAddr masked_address) {
+    if (processors[processor_id].address.load(std::memory_order_relaxed) != masked_address) {
         return false;
     }
 
-    for (VAddr& other_address : exclusive_addresses) {
-        if (other_address == masked_address) {
-            other_address = INVALID_EXCLUSIVE_ADDRESS;
+    // Our own reservation can only be modified while this shard is locked.
+    processors[processor_id].address.store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed);
+
+    // Other processors may concurrently move their reservation to an address belonging to
+    // another shard, so their reservations are only ever cleared with a compare-exchange.
+    const auto clear_if_reserved = [&](size_t other_id) {
+        if (other_id == processor_id) {
+            return false;
+        }
+        VAddr expected = processors[other_id].address.load(std::memory_order_relaxed);
+        if (expected == masked_address && processors[other_id].address.compare_exchange_strong(expected, INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed)) {
+            return false;
+        }
+        // Keep processors that still hold another reservation in this shard.
+        return ShardIndex(expected) == ShardIndex(masked_address);
+    };
+
+    if (processor_count > Common::BitSize<u64>()) {
+        for (size_t other_id = 0; other_id < processor_count; other_id++) {
+            clear_if_reserved(other_id);
+        }
+        return true;
+    }
+
+    u64 remaining = 0;
+    for (u64 mask = shard.processor_mask; mask != 0; mask &= mask - 1) {
+        const size_t other_id = Common::LowestSetBit(mask);
+        if (clear_if_reserved(other_id)) {
+            remaining |= u64(1) << other_id;
         }
     }
+    shard.processor_mask = remaining;
     return true;
 }
 
 void ExclusiveMonitor::Clear() {
-    Lock();
-    std::fill(exclusive_addresses.begin(), exclusive_addresses.end(), INVALID_EXCLUSIVE_ADDRESS);
-    Unlock();
+    for (size_t i = 0; i < processor_count; i++) {
+        processors[i].address.store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed);
+    }
 }
 
 void ExclusiveMonitor::ClearProcessor(size_t processor_id) {
-    Lock();
-    exclusive_addresses[processor_id] = INVALID_EXCLUSIVE_ADDRESS;
-    Unlock();
+    processors[processor_id].address.store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed);
 }
 
 } // namespace Dynarmic
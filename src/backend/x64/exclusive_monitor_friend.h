@@ -0,0 +1,54 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <dynarmic/exclusive_monitor.h>
+
+#include "common/common_types.h"
+
+namespace Dynarmic::Backend::X64 {
+
+/// Exposes the layout of ExclusiveMonitor so that emitted code can operate on it directly.
+struct ExclusiveMonitorFriend {
+    using Shard = ExclusiveMonitor::Shard;
+    using ProcessorSlot = ExclusiveMonitor::ProcessorSlot;
+
+    static constexpr size_t shard_bits = ExclusiveMonitor::SHARD_BITS;
+    static constexpr u64 shard_hash_multiplier = ExclusiveMonitor::SHARD_HASH_MULTIPLIER;
+    static constexpr size_t shard_size = sizeof(Shard);
+    static constexpr size_t shard_lock_offset = offsetof(Shard, is_locked);
+    static constexpr size_t shard_processor_mask_offset = offsetof(Shard, processor_mask);
+    static constexpr size_t slot_address_offset = offsetof(ProcessorSlot, address);
+    static constexpr size_t slot_value_offset = offsetof(ProcessorSlot, value);
+    static constexpr VAddr invalid_exclusive_address = ExclusiveMonitor::INVALID_EXCLUSIVE_ADDRESS;
+    static constexpr size_t max_inline_processor_count = 64;
+
+    static_assert(sizeof(std::atomic<bool>) == 1, "Shard lock is accessed as a byte");
+    static_assert(sizeof(std::atomic<VAddr>) == sizeof(VAddr), "Reservation address is accessed as a qword");
+    static_assert(shard_size == 64, "Shard index is scaled with a shift");
+
+    static Shard* ShardsPointer(ExclusiveMonitor* monitor) {
+        return monitor->shards.get();
+    }
+
+    static ProcessorSlot* SlotPointer(ExclusiveMonitor* monitor, size_t processor_id) {
+        return &monitor->processors[processor_id];
+    }
+
+    /// Emitted code can only maintain per-shard processor masks for a limited number of processors.
+    static bool SupportsInlineAccess(ExclusiveMonitor* monitor) {
+        return monitor->GetProcessorCount() <= max_inline_processor_count;
+    }
+
+    /// Slow path for clearing other processors' reservations. Must be called with the shard locked.
+    static void CheckAndClear(ExclusiveMonitor* monitor, size_t processor_id, VAddr masked_address) {
+        monitor->CheckAndClear(monitor->GetShard(masked_address), processor_id, masked_address);
+    }
+};
+
+} // namespace Dynarmic::Backend::X64
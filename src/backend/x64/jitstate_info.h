@@ -24,6 +24,9 @@ struct JitStateInfo {
         , offsetof_cpsr_nzcv(offsetof(JitStateType, cpsr_nzcv))
         , offsetof_fpsr_exc(offsetof(JitStateType, fpsr_exc))
         , offsetof_fpsr_qc(offsetof(JitStateType, fpsr_qc))
+        , offsetof_processor_id(offsetof(JitStateType, processor_id))
+        , offsetof_exclusive_slot(offsetof(JitStateType, exclusive_slot))
+        , offsetof_exclusive_processor_mask(offsetof(JitStateType, exclusive_processor_mask))
     {}
 
     const size_t offsetof_cycles_remaining;
@@ -38,6 +41,9 @@ struct JitStateInfo {
     const size_t offsetof_cpsr_nzcv;
     const size_t offsetof_fpsr_exc;
     const size_t offsetof_fpsr_qc;
+    const size_t offsetof_processor_id;
+    const size_t offsetof_exclusive_slot;
+    const size_t offsetof_exclusive_processor_mask;
 };
 
 } // namespace Dynarmic::Backend::X64
@@ -4,6 +4,7 @@
  */
 
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <utility>
 
@@ -133,6 +134,10 @@ bool HostLocInfo::ContainsValue(const IR::Inst* inst) const {
     return std::find(values.begin(), values.end(), inst) != values.end();
 }
 
+const std::vector<IR::Inst*>& HostLocInfo::GetValues() const {
+    return values;
+}
+
 size_t HostLocInfo::GetMaxBitWidth() const {
     return max_bit_width;
 }
@@ -231,6 +236,27 @@ RegAlloc::RegAlloc(BlockOfCode& code, size_t num_spills, std::function<Xbyak::Ad
     , spill_to_addr(std::move(spill_to_addr))
 {}
 
+void RegAlloc::AnalyzeUses(const IR::Block& block) {
+    size_t position = 0;
+    for (const IR::Inst& inst : block) {
+        inst_positions.emplace(&inst, position);
+        for (size_t i = 0; i < inst.NumArgs(); i++) {
+            const IR::Value arg = inst.GetArg(i);
+            if (!arg.IsImmediate() && !IsValuelessType(arg.GetType())) {
+                use_positions[arg.GetInst()].push_back(position);
+            }
+        }
+        position++;
+    }
+    analyzed_uses = true;
+}
+
+void RegAlloc::SetCurrentInstruction(const IR::Inst* inst) {
+    if (analyzed_uses) {
+        current_position = inst_positions.at(inst);
+    }
+}
+
 RegAlloc::ArgumentInfo RegAlloc::GetArgumentInfo(IR::Inst* inst) {
     ArgumentInfo ret = {Argument{*this}, Argument{*this}, Argument{*this}, Argument{*this}};
     for (size_t i = 0; i < inst->NumArgs(); i++) {
@@ -459,15 +485,49 @@ HostLoc RegAlloc::SelectARegister(const std::vector<HostLoc>& desired_locations)
     ASSERT_MSG(!candidates.empty(), "All candidate registers have already been allocated");
 
     // Selects the best location out of the available locations.
-    // TODO: Actually do LRU or something. Currently we just try to pick something without a value if possible.
+    // We try to pick something without a value if possible. Failing that, if uses have been analyzed,
+    // we pick the location whose value is needed furthest in the future.
 
     std::partition(candidates.begin(), candidates.end(), [this](auto loc) {
         return this->LocInfo(loc).IsEmpty();
     });
 
+    if (analyzed_uses && !LocInfo(candidates.front()).IsEmpty()) {
+        return *std::max_element(candidates.begin(), candidates.end(), [this](auto a, auto b) {
+            return this->NextUse(a) < this->NextUse(b);
+        });
+    }
+
     return candidates.front();
 }
 
+size_t RegAlloc::NextUse(HostLoc loc) const {
+    size_t next_use = std::numeric_limits<size_t>::max();
+    for (const IR::Inst* value : LocInfo(loc).GetValues()) {
+        const auto iter = use_positions.find(value);
+        if (iter == use_positions.end()) {
+            continue;
+        }
+        const auto& positions = iter->second;
+        const auto next = std::lower_bound(positions.begin(), positions.end(), current_position);
+        if (next != positions.end()) {
+            next_use = std::min(next_use, *next);
+        }
+    }
+    return next_use;
+}
+
+std::optional<HostLoc> RegAlloc::FindFreeCalleeSaveRegister(HostLoc like) const {
+    const std::vector<HostLoc>& order = HostLocIsGPR(like) ? gpr_order : xmm_order;
+    for (HostLoc loc : order) {
+        const bool is_caller_save = std::find(ABI_ALL_CALLER_SAVE.begin(), ABI_ALL_CALLER_SAVE.end(), loc) != ABI_ALL_CALLER_SAVE.end();
+        if (loc != like && !is_caller_save && LocInfo(loc).IsEmpty()) {
+            return loc;
+        }
+    }
+    return std::nullopt;
+}
+
 std::optional<HostLoc> RegAlloc::ValueLocation(const IR::Inst* value) const {
     for (size_t i = 0; i < hostloc_info.size(); i++) {
         if (hostloc_info[i].ContainsValue(value)) {
@@ -504,7 +564,7 @@ HostLoc RegAlloc::LoadImmediate(IR::Value imm, HostLoc host_loc) {
     if (HostLocIsGPR(host_loc)) {
         const Xbyak::Reg64 reg = HostLocToReg64(host_loc);
         const u64 imm_value = imm.GetImmediateAsU64();
-        if (imm_value == 0) {
+        if (imm_value == 0 && !host_flags_value) {
             code.xor_(reg.cvt32(), reg.cvt32());
         } else {
             code.mov(reg, imm_value);
@@ -569,9 +629,19 @@ void RegAlloc::Exchange(HostLoc a, HostLoc b) {
 
 void RegAlloc::MoveOutOfTheWay(HostLoc reg) {
     ASSERT(!LocInfo(reg).IsLocked());
-    if (!LocInfo(reg).IsEmpty()) {
-        SpillRegister(reg);
+    if (LocInfo(reg).IsEmpty()) {
+        return;
     }
+
+    // A callee-saved register is preferred as the value then survives any host call being set up.
+    if (analyzed_uses) {
+        if (const auto free_reg = FindFreeCalleeSaveRegister(reg)) {
+            Move(*free_reg, reg);
+            return;
+        }
+    }
+
+    SpillRegister(reg);
 }
 
 void RegAlloc::SpillRegister(HostLoc loc) {
@@ -581,6 +651,7 @@ void RegAlloc::SpillRegister(HostLoc loc) {
 
     const HostLoc new_loc = FindFreeSpill();
     Move(new_loc, loc);
+    spill_count++;
 }
 
 HostLoc RegAlloc::FindFreeSpill() const {
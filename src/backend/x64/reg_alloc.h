@@ -11,12 +11,14 @@
 #include <utility>
 #include <vector>
 
+#include <tsl/robin_map.h>
 #include <xbyak.h>
 
 #include "backend/x64/block_of_code.h"
 #include "backend/x64/hostloc.h"
 #include "backend/x64/oparg.h"
 #include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
 #include "frontend/ir/cond.h"
 #include "frontend/ir/microinstruction.h"
 #include "frontend/ir/value.h"
@@ -38,6 +40,7 @@ public:
     void ReleaseAll();
 
     bool ContainsValue(const IR::Inst* inst) const;
+    const std::vector<IR::Inst*>& GetValues() const;
     size_t GetMaxBitWidth() const;
 
     void AddValue(IR::Inst* inst);
@@ -98,6 +101,15 @@ public:
 
     explicit RegAlloc(BlockOfCode& code, size_t num_spills, std::function<Xbyak::Address(HostLoc)> spill_to_addr, std::vector<HostLoc> gpr_order, std::vector<HostLoc> xmm_order);
 
+    /// Records where each value in block is used. Registers are then selected for eviction by the distance
+    /// to their next use, and values displaced from a register are moved to a free callee-saved register
+    /// rather than spilled where possible. SetCurrentInstruction must be called for every instruction emitted.
+    void AnalyzeUses(const IR::Block& block);
+    void SetCurrentInstruction(const IR::Inst* inst);
+
+    /// Number of values spilled to memory so far.
+    size_t SpillCount() const { return spill_count; }
+
     ArgumentInfo GetArgumentInfo(IR::Inst* inst);
 
     Xbyak::Reg64 UseGpr(Argument& arg);
@@ -125,7 +137,10 @@ public:
                   std::optional<Argument::copyable_reference> arg2 = {},
                   std::optional<Argument::copyable_reference> arg3 = {});
 
-    // TODO: Values in host flags
+    /// Records that the host's SF, ZF, CF and OF currently hold the flags described by inst (a GetNZCVFromOp
+    /// value), or nothing of interest if nullptr. While set, registers are loaded without modifying the host flags.
+    void SetHostFlagsValue(const IR::Inst* inst) { host_flags_value = inst; }
+    const IR::Inst* GetHostFlagsValue() const { return host_flags_value; }
 
     void EndOfAllocScope();
 
@@ -138,6 +153,8 @@ private:
     std::vector<HostLoc> xmm_order;
 
     HostLoc SelectARegister(const std::vector<HostLoc>& desired_locations) const;
+    size_t NextUse(HostLoc loc) const;
+    std::optional<HostLoc> FindFreeCalleeSaveRegister(HostLoc like) const;
     std::optional<HostLoc> ValueLocation(const IR::Inst* value) const;
 
     HostLoc UseImpl(IR::Value use_value, const std::vector<HostLoc>& desired_locations);
@@ -155,6 +172,13 @@ private:
     void SpillRegister(HostLoc loc);
     HostLoc FindFreeSpill() const;
 
+    bool analyzed_uses = false;
+    size_t current_position = 0;
+    tsl::robin_map<const IR::Inst*, size_t> inst_positions;
+    tsl::robin_map<const IR::Inst*, std::vector<size_t>> use_positions;
+    size_t spill_count = 0;
+    const IR::Inst* host_flags_value = nullptr;
+
     std::vector<HostLocInfo> hostloc_info;
     HostLocInfo& LocInfo(HostLoc loc);
     const HostLocInfo& LocInfo(HostLoc loc) const;
@@ -0,0 +1,16 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <dynarmic/shared_code_cache.h>
+
+#include "backend/x64/shared_code_cache_friend.h"
+
+namespace Dynarmic {
+
+SharedCodeCache::SharedCodeCache() : impl(std::make_unique<Impl>()) {}
+
+SharedCodeCache::~SharedCodeCache() = default;
+
+} // namespace Dynarmic
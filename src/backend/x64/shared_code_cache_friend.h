@@ -0,0 +1,50 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <typeinfo>
+
+#include <dynarmic/shared_code_cache.h>
+
+#include "common/assert.h"
+
+namespace Dynarmic {
+
+struct SharedCodeCache::Impl {
+    std::mutex mutex;
+    std::shared_ptr<void> code_cache;
+    std::type_index code_cache_type = typeid(void);
+};
+
+namespace Backend::X64 {
+
+/// Interface used by the Jit implementations to access the code cache held by a SharedCodeCache.
+struct SharedCodeCacheFriend {
+    /// Returns the code cache held by shared_code_cache. If no Jit has used it yet, a code cache
+    /// is created by calling make_code_cache.
+    template <typename CodeCacheT, typename MakeCodeCache>
+    static std::shared_ptr<CodeCacheT> GetOrCreate(SharedCodeCache& shared_code_cache, MakeCodeCache make_code_cache) {
+        auto& impl = *shared_code_cache.impl;
+        std::lock_guard lock{impl.mutex};
+
+        if (!impl.code_cache) {
+            std::shared_ptr<CodeCacheT> code_cache = make_code_cache();
+            impl.code_cache = code_cache;
+            impl.code_cache_type = typeid(CodeCacheT);
+            return code_cache;
+        }
+
+        ASSERT_MSG(impl.code_cache_type == typeid(CodeCacheT), "SharedCodeCache used by Jits of different architectures");
+        return std::static_pointer_cast<CodeCacheT>(impl.code_cache);
+    }
+};
+
+} // namespace Backend::X64
+
+} // namespace Dynarmic
@@ -0,0 +1,319 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <dynarmic/translation_cache.h>
+
+#include "backend/x64/translation_cache_friend.h"
+#include "common/common_types.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/serialization.h"
+
+namespace Dynarmic {
+
+namespace {
+
+/// FNV-1a, used both for keys and for validating guest code.
+class Hasher {
+public:
+    void Add(u64 value) {
+        for (size_t i = 0; i < sizeof(value); i++) {
+            hash = (hash ^ ((value >> (i * 8)) & 0xFF)) * prime;
+        }
+    }
+
+    void Add(const std::vector<u8>& data) {
+        for (const u8 byte : data) {
+            hash = (hash ^ byte) * prime;
+        }
+    }
+
+    void Add(const std::string& data) {
+        Add(static_cast<u64>(data.size()));
+        for (const char c : data) {
+            hash = (hash ^ static_cast<u8>(c)) * prime;
+        }
+    }
+
+    u64 Get() const {
+        return hash;
+    }
+
+private:
+    static constexpr u64 prime = 0x100000001B3;
+    u64 hash = 0xCBF29CE484222325;
+};
+
+/// Identifies files written by TranslationCache::Save.
+constexpr u64 file_magic = 0x43544D52414E5944; // "DYNARMTC"
+
+/// Changes whenever the serialized representation of a block may change. Opcodes are serialized
+/// by index, so any change to the opcode table changes the fingerprint.
+u64 FormatFingerprint() {
+    Hasher hasher;
+    hasher.Add(3); // Serialization format version
+    for (size_t i = 0; i < IR::OpcodeCount; i++) {
+        const auto op = static_cast<IR::Opcode>(i);
+        hasher.Add(IR::GetNameOf(op));
+        hasher.Add(static_cast<u64>(IR::GetTypeOf(op)));
+        hasher.Add(IR::GetNumArgsOf(op));
+        for (size_t arg = 0; arg < IR::GetNumArgsOf(op); arg++) {
+            hasher.Add(static_cast<u64>(IR::GetArgTypeOf(op, arg)));
+        }
+    }
+    return hasher.Get();
+}
+
+template <typename ReadCode>
+u64 HashCode(const Backend::X64::TranslationCacheFriend::CodeRanges& code, const ReadCode& read_code) {
+    Hasher hasher;
+    for (const auto& range : code) {
+        for (u64 vaddr = range.start; vaddr < range.end; vaddr += 4) {
+            hasher.Add(read_code(vaddr));
+        }
+    }
+    return hasher.Get();
+}
+
+template <typename T>
+void WriteValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadValue(std::istream& stream, T& value) {
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+} // anonymous namespace
+
+struct TranslationCache::Impl {
+    struct Key {
+        u64 location;
+        u64 config_hash;
+
+        bool operator==(const Key& other) const {
+            return location == other.location && config_hash == other.config_hash;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return static_cast<size_t>(key.location ^ (key.config_hash * 0x9E3779B97F4A7C15));
+        }
+    };
+
+    struct Entry {
+        Backend::X64::TranslationCacheFriend::CodeRanges code;
+        u64 code_hash;
+        std::vector<u8> ir;
+    };
+
+    mutable std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    /// Incremented by every invalidation, so that translations which were in progress
+    /// when it happened are not inserted.
+    u64 generation = 0;
+};
+
+TranslationCache::TranslationCache() : impl(std::make_unique<Impl>()) {}
+
+TranslationCache::~TranslationCache() = default;
+
+bool TranslationCache::Load(const std::string& path) {
+    std::unordered_map<Impl::Key, Impl::Entry, Impl::KeyHash> entries;
+
+    const bool success = [&] {
+        std::ifstream file{path, std::ios::binary};
+        if (!file) {
+            return false;
+        }
+
+        u64 magic, fingerprint, count;
+        if (!ReadValue(file, magic) || !ReadValue(file, fingerprint) || !ReadValue(file, count)) {
+            return false;
+        }
+        if (magic != file_magic || fingerprint != FormatFingerprint()) {
+            return false;
+        }
+
+        for (u64 i = 0; i < count; i++) {
+            Impl::Key key;
+            Impl::Entry entry;
+            u64 code_range_count, ir_size, ir_checksum;
+            if (!ReadValue(file, key.location) || !ReadValue(file, key.config_hash) || !ReadValue(file, code_range_count)) {
+                return false;
+            }
+
+            // Guard against allocating absurd amounts of memory for a corrupted file.
+            if (code_range_count > 1024) {
+                return false;
+            }
+            entry.code.resize(static_cast<size_t>(code_range_count));
+            for (auto& range : entry.code) {
+                if (!ReadValue(file, range.start) || !ReadValue(file, range.end)) {
+                    return false;
+                }
+            }
+
+            if (!ReadValue(file, entry.code_hash) || !ReadValue(file, ir_size) || !ReadValue(file, ir_checksum)) {
+                return false;
+            }
+
+            if (ir_size > 16 * 1024 * 1024) {
+                return false;
+            }
+            entry.ir.resize(static_cast<size_t>(ir_size));
+            if (!file.read(reinterpret_cast<char*>(entry.ir.data()), static_cast<std::streamsize>(ir_size))) {
+                return false;
+            }
+
+            Hasher hasher;
+            hasher.Add(entry.ir);
+            if (hasher.Get() != ir_checksum) {
+                return false;
+            }
+
+            entries.insert_or_assign(key, std::move(entry));
+        }
+
+        return true;
+    }();
+
+    std::lock_guard lock{impl->mutex};
+    impl->entries = success ? std::move(entries) : decltype(entries){};
+    return success;
+}
+
+bool TranslationCache::Save(const std::string& path) const {
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    if (!file) {
+        return false;
+    }
+
+    std::lock_guard lock{impl->mutex};
+
+    WriteValue(file, file_magic);
+    WriteValue(file, FormatFingerprint());
+    WriteValue(file, static_cast<u64>(impl->entries.size()));
+
+    for (const auto& [key, entry] : impl->entries) {
+        Hasher hasher;
+        hasher.Add(entry.ir);
+
+        WriteValue(file, key.location);
+        WriteValue(file, key.config_hash);
+        WriteValue(file, static_cast<u64>(entry.code.size()));
+        for (const auto& range : entry.code) {
+            WriteValue(file, range.start);
+            WriteValue(file, range.end);
+        }
+        WriteValue(file, entry.code_hash);
+        WriteValue(file, static_cast<u64>(entry.ir.size()));
+        WriteValue(file, hasher.Get());
+        file.write(reinterpret_cast<const char*>(entry.ir.data()), static_cast<std::streamsize>(entry.ir.size()));
+    }
+
+    return static_cast<bool>(file.flush());
+}
+
+size_t TranslationCache::Size() const {
+    std::lock_guard lock{impl->mutex};
+    return impl->entries.size();
+}
+
+void TranslationCache::Clear() {
+    std::lock_guard lock{impl->mutex};
+    impl->entries.clear();
+}
+
+namespace Backend::X64 {
+
+u64 TranslationCacheFriend::HashConfig(std::initializer_list<u64> values) {
+    Hasher hasher;
+    for (const u64 value : values) {
+        hasher.Add(value);
+    }
+    return hasher.Get();
+}
+
+std::optional<IR::Block> TranslationCacheFriend::Lookup(TranslationCache& cache, u64 config_hash, IR::LocationDescriptor location, const ReadCodeFunction& read_code) {
+    const TranslationCache::Impl::Key key{location.Value(), config_hash};
+
+    TranslationCache::Impl::Entry entry;
+    {
+        std::lock_guard lock{cache.impl->mutex};
+        const auto iter = cache.impl->entries.find(key);
+        if (iter == cache.impl->entries.end()) {
+            return std::nullopt;
+        }
+        entry = iter->second;
+    }
+
+    if (HashCode(entry.code, read_code) != entry.code_hash) {
+        return std::nullopt;
+    }
+
+    auto block = IR::DeserializeBlock(entry.ir);
+    if (!block || block->Location() != location) {
+        return std::nullopt;
+    }
+    return block;
+}
+
+u64 TranslationCacheFriend::Generation(const TranslationCache& cache) {
+    std::lock_guard lock{cache.impl->mutex};
+    return cache.impl->generation;
+}
+
+void TranslationCacheFriend::Insert(TranslationCache& cache, u64 config_hash, const IR::Block& block, const TranslatedCode& code, u64 generation) {
+    const TranslationCache::Impl::Key key{block.Location().Value(), config_hash};
+    const u64 code_hash = HashCode(code.ranges, [&code](u64 vaddr) { return code.words.at(vaddr); });
+    TranslationCache::Impl::Entry entry{code.ranges, code_hash, IR::SerializeBlock(block)};
+
+    std::lock_guard lock{cache.impl->mutex};
+    if (cache.impl->generation != generation) {
+        return;
+    }
+    cache.impl->entries.insert_or_assign(key, std::move(entry));
+}
+
+void TranslationCacheFriend::AddCodeWord(TranslatedCode& code, u64 vaddr, u32 word) {
+    code.words.insert_or_assign(vaddr, word);
+
+    auto& ranges = code.ranges;
+    if (!ranges.empty() && ranges.back().start <= vaddr && vaddr <= ranges.back().end) {
+        ranges.back().end = std::max(ranges.back().end, vaddr + 4);
+        return;
+    }
+    ranges.push_back({vaddr, vaddr + 4});
+}
+
+void TranslationCacheFriend::InvalidateRange(TranslationCache& cache, u64 first, u64 last) {
+    std::lock_guard lock{cache.impl->mutex};
+    cache.impl->generation++;
+    auto& entries = cache.impl->entries;
+    for (auto iter = entries.begin(); iter != entries.end();) {
+        const auto& code = iter->second.code;
+        const bool overlaps = std::any_of(code.begin(), code.end(), [&](const CodeRange& range) {
+            return range.start <= last && first < range.end;
+        });
+        if (overlaps) {
+            iter = entries.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+} // namespace Backend::X64
+
+} // namespace Dynarmic
@@ -0,0 +1,76 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <functional>
+#include <initializer_list>
+#include <optional>
+#include <vector>
+
+#include <boost/icl/interval_set.hpp>
+#include <tsl/robin_map.h>
+#include <dynarmic/translation_cache.h>
+
+#include "common/common_types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/location_descriptor.h"
+
+namespace Dynarmic::Backend::X64 {
+
+/// Interface used by the Jit implementations to store and retrieve blocks in a TranslationCache.
+struct TranslationCacheFriend {
+    /// Reads a 32-bit word of guest code.
+    using ReadCodeFunction = std::function<u32(u64 vaddr)>;
+
+    /// A half-open range of addresses of guest code.
+    struct CodeRange {
+        u64 start;
+        u64 end;
+    };
+
+    /// Addresses of guest code which a block was translated from.
+    using CodeRanges = std::vector<CodeRange>;
+
+    /// Guest code which a block was translated from, with each word as the translator read it.
+    struct TranslatedCode {
+        CodeRanges ranges;
+        tsl::robin_map<u64, u32> words;
+    };
+
+    /// Hashes the translation-relevant parts of a Jit's configuration.
+    static u64 HashConfig(std::initializer_list<u64> values);
+
+    /// Retrieves a previously cached block, if one exists and the guest code it was
+    /// translated from is unchanged.
+    static std::optional<IR::Block> Lookup(TranslationCache& cache, u64 config_hash, IR::LocationDescriptor location, const ReadCodeFunction& read_code);
+
+    /// Returns a value which changes whenever blocks are invalidated. It must be read before
+    /// translating a block which is to be inserted.
+    static u64 Generation(const TranslationCache& cache);
+
+    /// Adds a block to the cache, replacing any existing entry for the same location. The entry
+    /// is validated against code as it was read during translation. Nothing is added if the cache
+    /// was invalidated after generation was read, as the block may have been translated from
+    /// code which has since changed.
+    static void Insert(TranslationCache& cache, u64 config_hash, const IR::Block& block, const TranslatedCode& code, u64 generation);
+
+    /// Records a 32-bit word of guest code at vaddr, as read during translation.
+    static void AddCodeWord(TranslatedCode& code, u64 vaddr, u32 word);
+
+    /// Removes all blocks whose guest code overlaps with the given ranges.
+    template <typename T>
+    static void InvalidateRanges(TranslationCache& cache, const boost::icl::interval_set<T>& ranges) {
+        for (const auto& range : ranges) {
+            InvalidateRange(cache, static_cast<u64>(boost::icl::first(range)), static_cast<u64>(boost::icl::last(range)));
+        }
+    }
+
+private:
+    /// Removes all blocks whose guest code overlaps with [first, last].
+    static void InvalidateRange(TranslationCache& cache, u64 first, u64 last);
+};
+
+} // namespace Dynarmic::Backend::X64
@@ -10,8 +10,6 @@
 
 namespace Dynarmic::Common::Crypto::CRC32 {
 
-using CRC32Table = std::array<u32, 256>;
-
 // CRC32 algorithm that uses polynomial 0x1EDC6F41
 constexpr CRC32Table castagnoli_table{{
     0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4,
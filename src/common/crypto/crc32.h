@@ -5,10 +5,18 @@
 
 #pragma once
 
+#include <array>
+
 #include "common/common_types.h"
 
 namespace Dynarmic::Common::Crypto::CRC32 {
 
+using CRC32Table = std::array<u32, 256>;
+
+/// Byte-at-a-time lookup tables for the bit-reflected forms of the polynomials below.
+extern const CRC32Table castagnoli_table;
+extern const CRC32Table iso_table;
+
 /**
  * Computes a CRC32 value using Castagnoli polynomial (0x1EDC6F41).
  *
@@ -0,0 +1,83 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "common/fp/fpcr.h"
+#include "common/fp/fpsr.h"
+#include "common/fp/fused.h"
+#include "common/fp/info.h"
+#include "common/fp/op/FPAdd.h"
+#include "common/fp/process_exception.h"
+#include "common/fp/process_nan.h"
+#include "common/fp/rounding_mode.h"
+#include "common/fp/unpacked.h"
+
+namespace Dynarmic::FP {
+
+template<typename FPT>
+static FPT FPAddUnpacked(FPType type1, FPUnpacked value1, FPType type2, FPUnpacked value2, FPCR fpcr, FPSR& fpsr) {
+    const bool inf1 = type1 == FPType::Infinity;
+    const bool inf2 = type2 == FPType::Infinity;
+    const bool zero1 = type1 == FPType::Zero;
+    const bool zero2 = type2 == FPType::Zero;
+
+    if (inf1 && inf2 && value1.sign != value2.sign) {
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return FPInfo<FPT>::DefaultNaN();
+    }
+
+    if ((inf1 && !value1.sign) || (inf2 && !value2.sign)) {
+        return FPInfo<FPT>::Infinity(false);
+    }
+    if ((inf1 && value1.sign) || (inf2 && value2.sign)) {
+        return FPInfo<FPT>::Infinity(true);
+    }
+
+    if (zero1 && zero2 && value1.sign == value2.sign) {
+        return FPInfo<FPT>::Zero(value1.sign);
+    }
+
+    // result_value = value1 + (value2 * 1.0)
+    const FPUnpacked result_value = FusedMulAdd(value1, value2, ToNormalized(false, 0, 1));
+    if (result_value.mantissa == 0) {
+        return FPInfo<FPT>::Zero(fpcr.RMode() == RoundingMode::TowardsMinusInfinity);
+    }
+    return FPRound<FPT>(result_value, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPAdd(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack<FPT>(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack<FPT>(op2, fpcr, fpsr);
+
+    if (const auto maybe_nan = FPProcessNaNs(type1, type2, op1, op2, fpcr, fpsr)) {
+        return *maybe_nan;
+    }
+
+    return FPAddUnpacked<FPT>(type1, value1, type2, value2, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPSub(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack<FPT>(op1, fpcr, fpsr);
+    auto [type2, sign2, value2] = FPUnpack<FPT>(op2, fpcr, fpsr);
+
+    // NaNs are propagated without negation.
+    if (const auto maybe_nan = FPProcessNaNs(type1, type2, op1, op2, fpcr, fpsr)) {
+        return *maybe_nan;
+    }
+
+    value2.sign = !value2.sign;
+    return FPAddUnpacked<FPT>(type1, value1, type2, value2, fpcr, fpsr);
+}
+
+template u16 FPAdd<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPAdd<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPAdd<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+template u16 FPSub<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPSub<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPSub<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+} // namespace Dynarmic::FP
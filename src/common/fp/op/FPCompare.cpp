@@ -33,8 +33,46 @@ bool FPCompareEQ(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
     return value1 == value2 || (type1 == FPType::Zero && type2 == FPType::Zero);
 }
 
+template <typename FPT>
+bool FPCompareGE(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack(lhs, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack(rhs, fpcr, fpsr);
+
+    if (type1 == FPType::QNaN || type1 == FPType::SNaN ||
+        type2 == FPType::QNaN || type2 == FPType::SNaN) {
+        // Ordered comparisons signal on all NaNs.
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return false;
+    }
+
+    return !FPUnpackedLessThan(value1, value2);
+}
+
+template <typename FPT>
+bool FPCompareGT(FPT lhs, FPT rhs, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack(lhs, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack(rhs, fpcr, fpsr);
+
+    if (type1 == FPType::QNaN || type1 == FPType::SNaN ||
+        type2 == FPType::QNaN || type2 == FPType::SNaN) {
+        // Ordered comparisons signal on all NaNs.
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return false;
+    }
+
+    return FPUnpackedLessThan(value2, value1);
+}
+
 template bool FPCompareEQ<u16>(u16 lhs, u16 rhs, FPCR fpcr, FPSR& fpsr);
 template bool FPCompareEQ<u32>(u32 lhs, u32 rhs, FPCR fpcr, FPSR& fpsr);
 template bool FPCompareEQ<u64>(u64 lhs, u64 rhs, FPCR fpcr, FPSR& fpsr);
 
+template bool FPCompareGE<u16>(u16 lhs, u16 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGE<u32>(u32 lhs, u32 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGE<u64>(u64 lhs, u64 rhs, FPCR fpcr, FPSR& fpsr);
+
+template bool FPCompareGT<u16>(u16 lhs, u16 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGT<u32>(u32 lhs, u32 rhs, FPCR fpcr, FPSR& fpsr);
+template bool FPCompareGT<u64>(u64 lhs, u64 rhs, FPCR fpcr, FPSR& fpsr);
+
 } // namespace Dynarmic::FP
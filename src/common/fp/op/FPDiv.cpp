@@ -0,0 +1,68 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "common/fp/fpcr.h"
+#include "common/fp/fpsr.h"
+#include "common/fp/info.h"
+#include "common/fp/op/FPDiv.h"
+#include "common/fp/process_exception.h"
+#include "common/fp/process_nan.h"
+#include "common/fp/unpacked.h"
+
+namespace Dynarmic::FP {
+
+template<typename FPT>
+FPT FPDiv(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack<FPT>(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack<FPT>(op2, fpcr, fpsr);
+
+    if (const auto maybe_nan = FPProcessNaNs(type1, type2, op1, op2, fpcr, fpsr)) {
+        return *maybe_nan;
+    }
+
+    const bool inf1 = type1 == FPType::Infinity;
+    const bool inf2 = type2 == FPType::Infinity;
+    const bool zero1 = type1 == FPType::Zero;
+    const bool zero2 = type2 == FPType::Zero;
+
+    if ((inf1 && inf2) || (zero1 && zero2)) {
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return FPInfo<FPT>::DefaultNaN();
+    }
+
+    if (inf1 || zero2) {
+        if (!inf1) {
+            FPProcessException(FPExc::DivideByZero, fpcr, fpsr);
+        }
+        return FPInfo<FPT>::Infinity(sign1 != sign2);
+    }
+
+    if (zero1 || inf2) {
+        return FPInfo<FPT>::Zero(sign1 != sign2);
+    }
+
+    // Restoring division of the normalized mantissas. Both are in [2^62, 2^63), so the partial remainder always
+    // fits in 64 bits and the quotient has at least 63 significant bits.
+    u64 remainder = value1.mantissa;
+    u64 quotient = 0;
+    for (size_t i = 0; i < 64; i++) {
+        quotient <<= 1;
+        if (remainder >= value2.mantissa) {
+            remainder -= value2.mantissa;
+            quotient |= 1;
+        }
+        remainder <<= 1;
+    }
+
+    // quotient = floor(2^63 * mantissa1 / mantissa2)
+    const FPUnpacked result_value{sign1 != sign2, value1.exponent - value2.exponent - 1, quotient | static_cast<u64>(remainder != 0)};
+    return FPRound<FPT>(result_value, fpcr, fpsr);
+}
+
+template u16 FPDiv<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPDiv<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPDiv<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+} // namespace Dynarmic::FP
@@ -0,0 +1,91 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "common/fp/fpcr.h"
+#include "common/fp/fpsr.h"
+#include "common/fp/info.h"
+#include "common/fp/op/FPMinMax.h"
+#include "common/fp/process_nan.h"
+#include "common/fp/unpacked.h"
+
+namespace Dynarmic::FP {
+
+template<typename FPT, bool is_max>
+static FPT FPMinMax(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack<FPT>(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack<FPT>(op2, fpcr, fpsr);
+
+    if (const auto maybe_nan = FPProcessNaNs(type1, type2, op1, op2, fpcr, fpsr)) {
+        return *maybe_nan;
+    }
+
+    const bool select_op1 = is_max ? FPUnpackedLessThan(value2, value1) : FPUnpackedLessThan(value1, value2);
+    const FPType type = select_op1 ? type1 : type2;
+    const FPUnpacked& value = select_op1 ? value1 : value2;
+
+    if (type == FPType::Infinity) {
+        return FPInfo<FPT>::Infinity(value.sign);
+    }
+
+    if (type == FPType::Zero) {
+        // max(+0, -0) is +0 and min(+0, -0) is -0
+        return FPInfo<FPT>::Zero(is_max ? sign1 && sign2 : sign1 || sign2);
+    }
+
+    return FPRound<FPT>(value, fpcr, fpsr);
+}
+
+template<typename FPT, bool is_max>
+static FPT FPMinMaxNumeric(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    const auto [type1, sign1, value1] = FPUnpack<FPT>(op1, fpcr, fpsr);
+    const auto [type2, sign2, value2] = FPUnpack<FPT>(op2, fpcr, fpsr);
+
+    // A single quiet NaN is replaced with the infinity that loses the comparison.
+    if (type1 == FPType::QNaN && type2 != FPType::QNaN) {
+        op1 = FPInfo<FPT>::Infinity(is_max);
+    } else if (type1 != FPType::QNaN && type2 == FPType::QNaN) {
+        op2 = FPInfo<FPT>::Infinity(is_max);
+    }
+
+    return FPMinMax<FPT, is_max>(op1, op2, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPMax(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    return FPMinMax<FPT, true>(op1, op2, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPMaxNumeric(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    return FPMinMaxNumeric<FPT, true>(op1, op2, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPMin(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    return FPMinMax<FPT, false>(op1, op2, fpcr, fpsr);
+}
+
+template<typename FPT>
+FPT FPMinNumeric(FPT op1, FPT op2, FPCR fpcr, FPSR& fpsr) {
+    return FPMinMaxNumeric<FPT, false>(op1, op2, fpcr, fpsr);
+}
+
+template u16 FPMax<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPMax<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPMax<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+template u16 FPMaxNumeric<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPMaxNumeric<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPMaxNumeric<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+template u16 FPMin<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPMin<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPMin<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+template u16 FPMinNumeric<u16>(u16 op1, u16 op2, FPCR fpcr, FPSR& fpsr);
+template u32 FPMinNumeric<u32>(u32 op1, u32 op2, FPCR fpcr, FPSR& fpsr);
+template u64 FPMinNumeric<u64>(u64 op1, u64 op2, FPCR fpcr, FPSR& fpsr);
+
+} // namespace Dynarmic::FP
@@ -0,0 +1,63 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "common/fp/fpcr.h"
+#include "common/fp/fpsr.h"
+#include "common/fp/info.h"
+#include "common/fp/op/FPSqrt.h"
+#include "common/fp/process_exception.h"
+#include "common/fp/process_nan.h"
+#include "common/fp/unpacked.h"
+#include "common/u128.h"
+
+namespace Dynarmic::FP {
+
+template<typename FPT>
+FPT FPSqrt(FPT op, FPCR fpcr, FPSR& fpsr) {
+    const auto [type, sign, value] = FPUnpack<FPT>(op, fpcr, fpsr);
+
+    if (type == FPType::SNaN || type == FPType::QNaN) {
+        return FPProcessNaN(type, op, fpcr, fpsr);
+    }
+
+    if (type == FPType::Zero) {
+        return FPInfo<FPT>::Zero(sign);
+    }
+
+    if (type == FPType::Infinity && !sign) {
+        return FPInfo<FPT>::Infinity(sign);
+    }
+
+    if (sign) {
+        FPProcessException(FPExc::InvalidOp, fpcr, fpsr);
+        return FPInfo<FPT>::DefaultNaN();
+    }
+
+    // value = radicand * 2^scale, where scale is made even so that it can be halved exactly.
+    const int shift = value.exponent % 2 == 0 ? 64 : 63;
+    const int scale = value.exponent - static_cast<int>(normalized_point_position) - shift;
+    const u128 radicand = u128(value.mantissa) << shift;
+
+    // Bitwise integer square root; the root is in [2^62, 2^64).
+    u128 remainder = radicand;
+    u128 root = 0;
+    for (u128 bit = u128(1) << 126; bit != u128(0); bit = bit >> 2) {
+        if (remainder >= root + bit) {
+            remainder = remainder - (root + bit);
+            root = (root >> 1) + bit;
+        } else {
+            root = root >> 1;
+        }
+    }
+
+    const FPUnpacked result_value{false, scale / 2 + static_cast<int>(normalized_point_position), root.lower | static_cast<u64>(remainder != u128(0))};
+    return FPRound<FPT>(result_value, fpcr, fpsr);
+}
+
+template u16 FPSqrt<u16>(u16 op, FPCR fpcr, FPSR& fpsr);
+template u32 FPSqrt<u32>(u32 op, FPCR fpcr, FPSR& fpsr);
+template u64 FPSqrt<u64>(u64 op, FPCR fpcr, FPSR& fpsr);
+
+} // namespace Dynarmic::FP
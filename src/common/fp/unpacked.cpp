@@ -70,7 +70,11 @@ std::tuple<bool, int, u64, ResidualError> Normalize(FPUnpacked op, int extra_rig
     const int highest_set_bit = Common::HighestSetBit(op.mantissa);
     const int shift_amount = highest_set_bit - static_cast<int>(F) + extra_right_shift;
     const u64 mantissa = Safe::LogicalShiftRight(op.mantissa, shift_amount);
-    const ResidualError error = ResidualErrorOnRightShift(op.mantissa, shift_amount);
+    // op.mantissa is unsigned: when shifted out entirely it is always less than half an ulp,
+    // whereas ResidualErrorOnRightShift would treat it as sign-extended.
+    const ResidualError error = shift_amount > static_cast<int>(Common::BitSize<u64>())
+                                  ? ResidualError::LessThanHalf
+                                  : ResidualErrorOnRightShift(op.mantissa, shift_amount);
     const int exponent = op.exponent + highest_set_bit - normalized_point_position;
     return std::make_tuple(op.sign, exponent, mantissa, error);
 }
@@ -37,6 +37,26 @@ inline bool operator==(const FPUnpacked& a, const FPUnpacked& b) {
     return std::tie(a.sign, a.exponent, a.mantissa) == std::tie(b.sign, b.exponent, b.mantissa);
 }
 
+/// Compares the values represented by a and b. Zeros compare equal regardless of sign.
+inline bool FPUnpackedLessThan(const FPUnpacked& a, const FPUnpacked& b) {
+    const auto magnitude_less_than = [](const FPUnpacked& x, const FPUnpacked& y) {
+        if (y.mantissa == 0) {
+            return false;
+        }
+        if (x.mantissa == 0) {
+            return true;
+        }
+        return std::tie(x.exponent, x.mantissa) < std::tie(y.exponent, y.mantissa);
+    };
+
+    const bool a_negative = a.sign && a.mantissa != 0;
+    const bool b_negative = b.sign && b.mantissa != 0;
+    if (a_negative != b_negative) {
+        return a_negative;
+    }
+    return a_negative ? magnitude_less_than(b, a) : magnitude_less_than(a, b);
+}
+
 /// return value = (sign ? -1 : +1) * value * 2^exponent
 constexpr FPUnpacked ToNormalized(bool sign, int exponent, u64 value) {
     if (value == 0) {
@@ -44,12 +44,11 @@ public:
     }
 
     ITState Advance() const {
-        ITState result{*this};
-        result.Mask(result.Mask() << 1);
-        if (result.Mask() == 0) {
-            return ITState{0};
+        if (Common::Bits<0, 2>(value) == 0b000) {
+            return ITState{0b00000000};
         }
-        return result;
+        // The low bit of the condition is shifted in from the mask.
+        return ITState{Common::ModifyBits<0, 4>(value, static_cast<u8>(value << 1))};
     }
 
     u8 Value() const {
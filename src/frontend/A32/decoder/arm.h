@@ -15,6 +15,7 @@
 #include "common/bit_util.h"
 #include "common/common_types.h"
 #include "frontend/decoder/decoder_detail.h"
+#include "frontend/decoder/lookup_table.h"
 #include "frontend/decoder/matcher.h"
 
 namespace Dynarmic::A32 {
@@ -22,6 +23,16 @@ namespace Dynarmic::A32 {
 template <typename Visitor>
 using ArmMatcher = Decoder::Matcher<Visitor, u32>;
 
+namespace detail {
+/// Gathers bits [27:20] and [7:4] of an instruction.
+inline size_t ToArmLookupIndex(u32 instruction) {
+    return ((instruction >> 16) & 0xFF0) | ((instruction >> 4) & 0x00F);
+}
+} // namespace detail
+
+template <typename V>
+using ArmLookupTable = Decoder::LookupTable<ArmMatcher<V>, 12, &detail::ToArmLookupIndex>;
+
 template <typename V>
 std::vector<ArmMatcher<V>> GetArmDecodeTable() {
     std::vector<ArmMatcher<V>> table = {
@@ -42,12 +53,9 @@ std::vector<ArmMatcher<V>> GetArmDecodeTable() {
 
 template<typename V>
 std::optional<std::reference_wrapper<const ArmMatcher<V>>> DecodeArm(u32 instruction) {
-    static const auto table = GetArmDecodeTable<V>();
-
-    const auto matches_instruction = [instruction](const auto& matcher) { return matcher.Matches(instruction); };
+    static const ArmLookupTable<V> table{GetArmDecodeTable<V>()};
 
-    auto iter = std::find_if(table.begin(), table.end(), matches_instruction);
-    return iter != table.end() ? std::optional<std::reference_wrapper<const ArmMatcher<V>>>(*iter) : std::nullopt;
+    return table.Find(instruction);
 }
 
 } // namespace Dynarmic::A32
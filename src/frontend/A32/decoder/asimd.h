@@ -14,6 +14,7 @@
 #include "common/bit_util.h"
 #include "common/common_types.h"
 #include "frontend/decoder/decoder_detail.h"
+#include "frontend/decoder/lookup_table.h"
 #include "frontend/decoder/matcher.h"
 
 namespace Dynarmic::A32 {
@@ -21,6 +22,16 @@ namespace Dynarmic::A32 {
 template <typename Visitor>
 using ASIMDMatcher = Decoder::Matcher<Visitor, u32>;
 
+namespace detail {
+/// Gathers bits [24:20], [11:8] and [6:4] of an instruction.
+inline size_t ToASIMDLookupIndex(u32 instruction) {
+    return ((instruction >> 13) & 0xF80) | ((instruction >> 5) & 0x078) | ((instruction >> 4) & 0x007);
+}
+} // namespace detail
+
+template <typename V>
+using ASIMDLookupTable = Decoder::LookupTable<ASIMDMatcher<V>, 12, &detail::ToASIMDLookupIndex>;
+
 template <typename V>
 std::vector<ASIMDMatcher<V>> GetASIMDDecodeTable() {
     std::vector<ASIMDMatcher<V>> table = {
@@ -66,12 +77,9 @@ std::vector<ASIMDMatcher<V>> GetASIMDDecodeTable() {
 
 template<typename V>
 std::optional<std::reference_wrapper<const ASIMDMatcher<V>>> DecodeASIMD(u32 instruction) {
-    static const auto table = GetASIMDDecodeTable<V>();
-
-    const auto matches_instruction = [instruction](const auto& matcher) { return matcher.Matches(instruction); };
+    static const ASIMDLookupTable<V> table{GetASIMDDecodeTable<V>()};
 
-    auto iter = std::find_if(table.begin(), table.end(), matches_instruction);
-    return iter != table.end() ? std::optional<std::reference_wrapper<const ASIMDMatcher<V>>>(*iter) : std::nullopt;
+    return table.Find(instruction);
 }
 
 } // namespace Dynarmic::A32
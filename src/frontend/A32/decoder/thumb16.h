@@ -12,6 +12,7 @@
 
 #include "common/common_types.h"
 #include "frontend/decoder/decoder_detail.h"
+#include "frontend/decoder/lookup_table.h"
 #include "frontend/decoder/matcher.h"
 
 namespace Dynarmic::A32 {
@@ -19,9 +20,20 @@ namespace Dynarmic::A32 {
 template <typename Visitor>
 using Thumb16Matcher = Decoder::Matcher<Visitor, u16>;
 
-template<typename V>
-std::optional<std::reference_wrapper<const Thumb16Matcher<V>>> DecodeThumb16(u16 instruction) {
-    static const std::vector<Thumb16Matcher<V>> table = {
+namespace detail {
+/// Gathers bits [15:6] of an instruction.
+inline size_t ToThumb16LookupIndex(u16 instruction) {
+    return (instruction >> 6) & 0x3FF;
+}
+} // namespace detail
+
+template <typename V>
+using Thumb16LookupTable = Decoder::LookupTable<Thumb16Matcher<V>, 10, &detail::ToThumb16LookupIndex>;
+
+template <typename V>
+std::vector<Thumb16Matcher<V>> GetThumb16DecodeTable() {
+    // Matchers are tested in the order listed here.
+    return {
 
 #define INST(fn, name, bitstring) Decoder::detail::detail<Thumb16Matcher<V>>::GetMatcher(fn, name, bitstring)
 
@@ -93,6 +105,10 @@ std::optional<std::reference_wrapper<const Thumb16Matcher<V>>> DecodeThumb16(u16
         INST(&V::thumb16_WFE,            "WFE",                      "1011111100100000"), // v7
         INST(&V::thumb16_WFI,            "WFI",                      "1011111100110000"), // v7
         INST(&V::thumb16_YIELD,          "YIELD",                    "1011111100010000"), // v7
+        INST(&V::thumb16_NOP,            "NOP",                      "10111111----0000"), // v6T2
+
+        // If-Then
+        INST(&V::thumb16_IT,             "IT",                       "10111111iiiiiiii"), // v6T2
 
         // Miscellaneous 16-bit instructions
         INST(&V::thumb16_SXTH,           "SXTH",                     "1011001000mmmddd"), // v6
@@ -124,11 +140,13 @@ std::optional<std::reference_wrapper<const Thumb16Matcher<V>>> DecodeThumb16(u16
 #undef INST
 
     };
+}
 
-    const auto matches_instruction = [instruction](const auto& matcher){ return matcher.Matches(instruction); };
+template<typename V>
+std::optional<std::reference_wrapper<const Thumb16Matcher<V>>> DecodeThumb16(u16 instruction) {
+    static const Thumb16LookupTable<V> table{GetThumb16DecodeTable<V>()};
 
-    auto iter = std::find_if(table.begin(), table.end(), matches_instruction);
-    return iter != table.end() ? std::optional<std::reference_wrapper<const Thumb16Matcher<V>>>(*iter) : std::nullopt;
+    return table.Find(instruction);
 }
 
 } // namespace Dynarmic::A32
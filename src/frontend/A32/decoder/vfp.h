@@ -10,9 +10,9 @@
 #include <optional>
 #include <vector>
 
-
 #include "common/common_types.h"
 #include "frontend/decoder/decoder_detail.h"
+#include "frontend/decoder/lookup_table.h"
 #include "frontend/decoder/matcher.h"
 
 namespace Dynarmic::A32 {
@@ -20,39 +20,59 @@ namespace Dynarmic::A32 {
 template <typename Visitor>
 using VFPMatcher = Decoder::Matcher<Visitor, u32>;
 
-template<typename V>
-std::optional<std::reference_wrapper<const VFPMatcher<V>>> DecodeVFP(u32 instruction) {
-    using Table = std::vector<VFPMatcher<V>>;
+namespace detail {
+/// Gathers bits [23:16], 8 and 6 of an instruction.
+inline size_t ToVFPLookupIndex(u32 instruction) {
+    return ((instruction >> 14) & 0x3FC) | ((instruction >> 7) & 0x002) | ((instruction >> 6) & 0x001);
+}
+} // namespace detail
 
-    static const struct Tables {
-        Table unconditional;
-        Table conditional;
-    } tables = []{
-        Table list = {
+template <typename V>
+using VFPLookupTable = Decoder::LookupTable<VFPMatcher<V>, 10, &detail::ToVFPLookupIndex>;
+
+template <typename V>
+struct VFPDecodeTables {
+    std::vector<VFPMatcher<V>> unconditional;
+    std::vector<VFPMatcher<V>> conditional;
+};
+
+template <typename V>
+VFPDecodeTables<V> GetVFPDecodeTables() {
+    std::vector<VFPMatcher<V>> list = {
 
 #define INST(fn, name, bitstring) Decoder::detail::detail<VFPMatcher<V>>::GetMatcher(&V::fn, name, bitstring),
 #include "vfp.inc"
 #undef INST
 
-        };
+    };
+
+    const auto division = std::stable_partition(list.begin(), list.end(), [&](const auto& matcher) {
+        return (matcher.GetMask() & 0xF0000000) == 0xF0000000;
+    });
 
-        const auto division = std::stable_partition(list.begin(), list.end(), [&](const auto& matcher) {
-            return (matcher.GetMask() & 0xF0000000) == 0xF0000000;
-        });
+    return VFPDecodeTables<V>{
+        std::vector<VFPMatcher<V>>{list.begin(), division},
+        std::vector<VFPMatcher<V>>{division, list.end()},
+    };
+}
 
+template<typename V>
+std::optional<std::reference_wrapper<const VFPMatcher<V>>> DecodeVFP(u32 instruction) {
+    static const struct Tables {
+        VFPLookupTable<V> unconditional;
+        VFPLookupTable<V> conditional;
+    } tables = []{
+        auto [unconditional, conditional] = GetVFPDecodeTables<V>();
         return Tables{
-            Table{list.begin(), division},
-            Table{division, list.end()},
+            VFPLookupTable<V>{std::move(unconditional)},
+            VFPLookupTable<V>{std::move(conditional)},
         };
     }();
 
     const bool is_unconditional = (instruction & 0xF0000000) == 0xF0000000;
-    const Table& table = is_unconditional ? tables.unconditional : tables.conditional;
-
-    const auto matches_instruction = [instruction](const auto& matcher){ return matcher.Matches(instruction); };
+    const VFPLookupTable<V>& table = is_unconditional ? tables.unconditional : tables.conditional;
 
-    auto iter = std::find_if(table.begin(), table.end(), matches_instruction);
-    return iter != table.end() ? std::optional<std::reference_wrapper<const VFPMatcher<V>>>(*iter) : std::nullopt;
+    return table.Find(instruction);
 }
 
 } // namespace Dynarmic::A32
@@ -269,6 +269,18 @@ public:
         return "yield";
     }
 
+    std::string thumb16_IT(Imm<8> imm8) {
+        const Cond firstcond = imm8.Bits<4, 7, Cond>();
+        const bool firstcond0 = imm8.Bit<4>();
+        const u32 mask = imm8.Bits<0, 3>();
+
+        std::string suffix;
+        for (size_t i = 3; i > Common::LowestSetBit(mask); i--) {
+            suffix += Common::Bit(i, mask) == firstcond0 ? "t" : "e";
+        }
+        return fmt::format("it{} {}", suffix, CondToString(firstcond));
+    }
+
     std::string thumb16_SXTH(Reg m, Reg d) {
         return fmt::format("sxth {}, {}", d, m);
     }
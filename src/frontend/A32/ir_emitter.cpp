@@ -79,6 +79,10 @@ void IREmitter::BranchWritePC(const IR::U32& value) {
     } else {
         const auto new_pc = And(value, Imm32(0xFFFFFFFE));
         Inst(Opcode::A32SetRegister, IR::Value(A32::Reg::PC), new_pc);
+        // A branch is always the last instruction of an IT block.
+        if (current_location.IT().IsInITBlock()) {
+            SetITState(Imm8(0));
+        }
     }
 }
 
@@ -86,6 +90,10 @@ void IREmitter::BXWritePC(const IR::U32& value) {
     Inst(Opcode::A32BXWritePC, value);
 }
 
+void IREmitter::SetITState(const IR::U8& value) {
+    Inst(Opcode::A32SetITState, value);
+}
+
 void IREmitter::LoadWritePC(const IR::U32& value) {
     // This behaviour is ARM version-dependent.
     // The below implementation is for ARMv6k
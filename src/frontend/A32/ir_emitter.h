@@ -43,6 +43,7 @@ public:
     void ALUWritePC(const IR::U32& value);
     void BranchWritePC(const IR::U32& value);
     void BXWritePC(const IR::U32& value);
+    void SetITState(const IR::U8& value);
     void LoadWritePC(const IR::U32& value);
 
     void CallSupervisor(const IR::U32& value);
@@ -88,6 +88,13 @@ public:
         return LocationDescriptor(arm_pc, cpsr, A32::FPSCR{new_fpscr & FPSCR_MODE_MASK}, single_stepping);
     }
 
+    LocationDescriptor SetIT(ITState new_it) const {
+        PSR new_cpsr = cpsr;
+        new_cpsr.IT(new_it);
+
+        return LocationDescriptor(arm_pc, new_cpsr, fpscr, single_stepping);
+    }
+
     LocationDescriptor AdvanceIT() const {
         PSR new_cpsr = cpsr;
         new_cpsr.IT(new_cpsr.IT().Advance());
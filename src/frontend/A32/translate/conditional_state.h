@@ -0,0 +1,36 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace Dynarmic::IR {
+enum class Cond;
+} // namespace Dynarmic::IR
+
+namespace Dynarmic::A32 {
+
+class IREmitter;
+
+enum class ConditionalState {
+    /// We haven't met any conditional instructions yet.
+    None,
+    /// Current instruction is a conditional. This marks the end of this basic block.
+    Break,
+    /// This basic block is made up solely of conditional instructions.
+    Translating,
+    /// This basic block is made up of conditional instructions followed by unconditional instructions.
+    Trailing,
+};
+
+/// Determines whether translation of the current block may continue after the current instruction.
+bool CondCanContinue(ConditionalState cond_state, const A32::IREmitter& ir);
+
+/// Determines whether the instruction at ir.current_location, which is conditional on cond,
+/// should be translated into the current block. Updates cond_state and the block condition.
+bool IsConditionPassed(IR::Cond cond, ConditionalState& cond_state, A32::IREmitter& ir, int instruction_size);
+
+} // namespace Dynarmic::A32
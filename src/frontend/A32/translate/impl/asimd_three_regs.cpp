@@ -27,6 +27,11 @@ enum class WidenBehaviour {
     Both,
 };
 
+enum class Rounding {
+    None,
+    Round,
+};
+
 template <bool WithDst, typename Callable>
 bool BitwiseInstruction(ArmTranslatorVisitor& v, bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm, Callable fn) {
     if (Q && (Common::Bit<0>(Vd) || Common::Bit<0>(Vn) || Common::Bit<0>(Vm))) {
@@ -245,6 +250,69 @@ bool WideInstruction(ArmTranslatorVisitor& v, bool U, bool D, size_t sz, size_t
     return true;
 }
 
+template <typename Callable>
+bool NarrowingHighHalf(ArmTranslatorVisitor& v, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm, Rounding rounding, Callable fn) {
+    if (sz == 0b11) {
+        return v.DecodeError();
+    }
+
+    if (Common::Bit<0>(Vn) || Common::Bit<0>(Vm)) {
+        return v.UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    const size_t source_esize = 2 * esize;
+    const auto d = ToVector(false, Vd, D);
+    const auto m = ToVector(true, Vm, M);
+    const auto n = ToVector(true, Vn, N);
+
+    const auto reg_n = v.ir.GetVector(n);
+    const auto reg_m = v.ir.GetVector(m);
+    auto wide = fn(source_esize, reg_n, reg_m);
+
+    if (rounding == Rounding::Round) {
+        const auto round_const = v.ir.VectorBroadcast(source_esize, v.I(source_esize, 1ULL << (esize - 1)));
+        wide = v.ir.VectorAdd(source_esize, wide, round_const);
+    }
+
+    const auto result = v.ir.VectorNarrow(source_esize, v.ir.VectorLogicalShiftRight(source_esize, wide, static_cast<u8>(esize)));
+
+    v.ir.SetVector(d, result);
+    return true;
+}
+
+bool SaturatingDoublingMultiplyLong(ArmTranslatorVisitor& v, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm,
+                                    AccumulateBehavior accumulate, bool subtract) {
+    if (sz == 0b11) {
+        return v.DecodeError();
+    }
+
+    if (sz == 0b00 || Common::Bit<0>(Vd)) {
+        return v.UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    const auto d = ToVector(true, Vd, D);
+    const auto m = ToVector(false, Vm, M);
+    const auto n = ToVector(false, Vn, N);
+
+    const auto reg_n = v.ir.GetVector(n);
+    const auto reg_m = v.ir.GetVector(m);
+    const auto product = v.ir.VectorSignedSaturatedDoublingMultiplyLong(esize, reg_n, reg_m);
+    const auto result = [&] {
+        if (accumulate == AccumulateBehavior::None) {
+            return product;
+        }
+
+        const auto reg_d = v.ir.GetVector(d);
+        return subtract ? v.ir.VectorSignedSaturatedSub(2 * esize, reg_d, product)
+                        : v.ir.VectorSignedSaturatedAdd(2 * esize, reg_d, product);
+    }();
+
+    v.ir.SetVector(d, result);
+    return true;
+}
+
 } // Anonymous namespace
 
 // ASIMD Three registers of the same length
@@ -347,19 +415,19 @@ bool ArmTranslatorVisitor::asimd_VEOR_reg(bool D, size_t Vn, size_t Vd, bool N,
 
 bool ArmTranslatorVisitor::asimd_VBSL(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
     return BitwiseInstruction<true>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_d, const auto& reg_n, const auto& reg_m) {
-        return ir.VectorOr(ir.VectorAnd(reg_n, reg_d), ir.VectorAnd(reg_m, ir.VectorNot(reg_d)));
+        return ir.VectorBitwiseSelect(reg_d, reg_n, reg_m);
     });
 }
 
 bool ArmTranslatorVisitor::asimd_VBIT(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
     return BitwiseInstruction<true>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_d, const auto& reg_n, const auto& reg_m) {
-        return ir.VectorOr(ir.VectorAnd(reg_n, reg_m), ir.VectorAnd(reg_d, ir.VectorNot(reg_m)));
+        return ir.VectorBitwiseSelect(reg_m, reg_n, reg_d);
     });
 }
 
 bool ArmTranslatorVisitor::asimd_VBIF(bool D, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
     return BitwiseInstruction<true>(*this, D, Vn, Vd, N, Q, M, Vm, [this](const auto& reg_d, const auto& reg_n, const auto& reg_m) {
-        return ir.VectorOr(ir.VectorAnd(reg_d, reg_m), ir.VectorAnd(reg_n, ir.VectorNot(reg_m)));
+        return ir.VectorBitwiseSelect(reg_m, reg_d, reg_n);
     });
 }
 
@@ -516,6 +584,25 @@ bool ArmTranslatorVisitor::asimd_VRSHL(bool U, bool D, size_t sz, size_t Vn, siz
     return true;
 }
 
+bool ArmTranslatorVisitor::asimd_VQRSHL(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, size_t Vm) {
+    if (Q && (Common::Bit<0>(Vd) || Common::Bit<0>(Vn) || Common::Bit<0>(Vm))) {
+        return UndefinedInstruction();
+    }
+
+    const size_t esize = 8U << sz;
+    const auto d = ToVector(Q, Vd, D);
+    const auto m = ToVector(Q, Vm, M);
+    const auto n = ToVector(Q, Vn, N);
+
+    const auto reg_m = ir.GetVector(m);
+    const auto reg_n = ir.GetVector(n);
+    const auto result = U ? ir.VectorUnsignedSaturatedRoundingShiftLeft(esize, reg_m, reg_n)
+                          : ir.VectorSignedSaturatedRoundingShiftLeft(esize, reg_m, reg_n);
+
+    ir.SetVector(d, result);
+    return true;
+}
+
 bool ArmTranslatorVisitor::asimd_VMAX(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool Q, bool M, bool op, size_t Vm) {
     if (sz == 0b11) {
         return UndefinedInstruction();
@@ -850,10 +937,34 @@ bool ArmTranslatorVisitor::asimd_VSUBL(bool U, bool D, size_t sz, size_t Vn, siz
     });
 }
 
+bool ArmTranslatorVisitor::asimd_VADDHN(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    return NarrowingHighHalf(*this, D, sz, Vn, Vd, N, M, Vm, Rounding::None, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorAdd(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VRADDHN(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    return NarrowingHighHalf(*this, D, sz, Vn, Vd, N, M, Vm, Rounding::Round, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorAdd(esize, reg_n, reg_m);
+    });
+}
+
 bool ArmTranslatorVisitor::asimd_VABAL(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
     return AbsoluteDifferenceLong(*this, U, D, sz, Vn, Vd, N, M, Vm, AccumulateBehavior::Accumulate);
 }
 
+bool ArmTranslatorVisitor::asimd_VSUBHN(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    return NarrowingHighHalf(*this, D, sz, Vn, Vd, N, M, Vm, Rounding::None, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorSub(esize, reg_n, reg_m);
+    });
+}
+
+bool ArmTranslatorVisitor::asimd_VRSUBHN(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    return NarrowingHighHalf(*this, D, sz, Vn, Vd, N, M, Vm, Rounding::Round, [this](size_t esize, const auto& reg_n, const auto& reg_m) {
+        return ir.VectorSub(esize, reg_n, reg_m);
+    });
+}
+
 bool ArmTranslatorVisitor::asimd_VABDL(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
     return AbsoluteDifferenceLong(*this, U, D, sz, Vn, Vd, N, M, Vm, AccumulateBehavior::None);
 }
@@ -866,6 +977,10 @@ bool ArmTranslatorVisitor::asimd_VMLAL(bool U, bool D, size_t sz, size_t Vn, siz
     });
 }
 
+bool ArmTranslatorVisitor::asimd_VQDMLAL(bool D, size_t sz, size_t Vn, size_t Vd, bool op, bool N, bool M, size_t Vm) {
+    return SaturatingDoublingMultiplyLong(*this, D, sz, Vn, Vd, N, M, Vm, AccumulateBehavior::Accumulate, op);
+}
+
 bool ArmTranslatorVisitor::asimd_VMULL(bool U, bool D, size_t sz, size_t Vn, size_t Vd, bool P, bool N, bool M, size_t Vm) {
     if (sz == 0b11) {
         return DecodeError();
@@ -893,4 +1008,8 @@ bool ArmTranslatorVisitor::asimd_VMULL(bool U, bool D, size_t sz, size_t Vn, siz
     return true;
 }
 
+bool ArmTranslatorVisitor::asimd_VQDMULL(bool D, size_t sz, size_t Vn, size_t Vd, bool N, bool M, size_t Vm) {
+    return SaturatingDoublingMultiplyLong(*this, D, sz, Vn, Vd, N, M, Vm, AccumulateBehavior::None, false);
+}
+
 } // namespace Dynarmic::A32
@@ -17,8 +17,7 @@ bool ArmTranslatorVisitor::arm_B(Cond cond, Imm<24> imm24) {
 
     const u32 imm32 = Common::SignExtend<26, u32>(imm24.ZeroExtend() << 2) + 8;
     const auto new_location = ir.current_location.AdvancePC(imm32);
-    ir.SetTerm(IR::Term::LinkBlock{new_location});
-    return false;
+    return LinkOrFollowBranch(new_location);
 }
 
 // BL <label>
@@ -32,8 +31,7 @@ bool ArmTranslatorVisitor::arm_BL(Cond cond, Imm<24> imm24) {
 
     const u32 imm32 = Common::SignExtend<26, u32>(imm24.ZeroExtend() << 2) + 8;
     const auto new_location = ir.current_location.AdvancePC(imm32);
-    ir.SetTerm(IR::Term::LinkBlock{new_location});
-    return false;
+    return LinkOrFollowBranch(new_location);
 }
 
 // BLX <label>
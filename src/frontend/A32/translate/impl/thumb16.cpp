@@ -16,9 +16,11 @@ bool ThumbTranslatorVisitor::thumb16_LSL_imm(Imm<5> imm5, Reg m, Reg d) {
     const auto result = ir.LogicalShiftLeft(ir.GetRegister(m), ir.Imm8(shift_n), cpsr_c);
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+    }
     return true;
 }
 
@@ -29,9 +31,11 @@ bool ThumbTranslatorVisitor::thumb16_LSR_imm(Imm<5> imm5, Reg m, Reg d) {
     const auto result = ir.LogicalShiftRight(ir.GetRegister(m), ir.Imm8(shift_n), cpsr_c);
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+    }
     return true;
 }
 
@@ -42,9 +46,11 @@ bool ThumbTranslatorVisitor::thumb16_ASR_imm(Imm<5> imm5, Reg m, Reg d) {
     const auto result = ir.ArithmeticShiftRight(ir.GetRegister(m), ir.Imm8(shift_n), cpsr_c);
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+    }
     return true;
 }
 
@@ -53,10 +59,12 @@ bool ThumbTranslatorVisitor::thumb16_ASR_imm(Imm<5> imm5, Reg m, Reg d) {
 bool ThumbTranslatorVisitor::thumb16_ADD_reg_t1(Reg m, Reg n, Reg d) {
     const auto result = ir.AddWithCarry(ir.GetRegister(n), ir.GetRegister(m), ir.Imm1(0));
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
-    ir.SetVFlag(result.overflow);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+        ir.SetVFlag(result.overflow);
+    }
     return true;
 }
 
@@ -65,10 +73,12 @@ bool ThumbTranslatorVisitor::thumb16_ADD_reg_t1(Reg m, Reg n, Reg d) {
 bool ThumbTranslatorVisitor::thumb16_SUB_reg(Reg m, Reg n, Reg d) {
     const auto result = ir.SubWithCarry(ir.GetRegister(n), ir.GetRegister(m), ir.Imm1(1));
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
-    ir.SetVFlag(result.overflow);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+        ir.SetVFlag(result.overflow);
+    }
     return true;
 }
 
@@ -79,10 +89,12 @@ bool ThumbTranslatorVisitor::thumb16_ADD_imm_t1(Imm<3> imm3, Reg n, Reg d) {
     const auto result = ir.AddWithCarry(ir.GetRegister(n), ir.Imm32(imm32), ir.Imm1(0));
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
-    ir.SetVFlag(result.overflow);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+        ir.SetVFlag(result.overflow);
+    }
     return true;
 }
 
@@ -93,10 +105,12 @@ bool ThumbTranslatorVisitor::thumb16_SUB_imm_t1(Imm<3> imm3, Reg n, Reg d) {
     const auto result = ir.SubWithCarry(ir.GetRegister(n), ir.Imm32(imm32), ir.Imm1(1));
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
-    ir.SetVFlag(result.overflow);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+        ir.SetVFlag(result.overflow);
+    }
     return true;
 }
 
@@ -107,8 +121,10 @@ bool ThumbTranslatorVisitor::thumb16_MOV_imm(Reg d, Imm<8> imm8) {
     const auto result = ir.Imm32(imm32);
 
     ir.SetRegister(d, result);
-    ir.SetNFlag(ir.MostSignificantBit(result));
-    ir.SetZFlag(ir.IsZero(result));
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result));
+        ir.SetZFlag(ir.IsZero(result));
+    }
     return true;
 }
 
@@ -133,10 +149,12 @@ bool ThumbTranslatorVisitor::thumb16_ADD_imm_t2(Reg d_n, Imm<8> imm8) {
     const auto result = ir.AddWithCarry(ir.GetRegister(n), ir.Imm32(imm32), ir.Imm1(0));
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
-    ir.SetVFlag(result.overflow);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+        ir.SetVFlag(result.overflow);
+    }
     return true;
 }
 
@@ -149,10 +167,12 @@ bool ThumbTranslatorVisitor::thumb16_SUB_imm_t2(Reg d_n, Imm<8> imm8) {
     const auto result = ir.SubWithCarry(ir.GetRegister(n), ir.Imm32(imm32), ir.Imm1(1));
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
-    ir.SetVFlag(result.overflow);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+        ir.SetVFlag(result.overflow);
+    }
     return true;
 }
 
@@ -164,8 +184,10 @@ bool ThumbTranslatorVisitor::thumb16_AND_reg(Reg m, Reg d_n) {
     const auto result = ir.And(ir.GetRegister(n), ir.GetRegister(m));
 
     ir.SetRegister(d, result);
-    ir.SetNFlag(ir.MostSignificantBit(result));
-    ir.SetZFlag(ir.IsZero(result));
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result));
+        ir.SetZFlag(ir.IsZero(result));
+    }
     return true;
 }
 
@@ -177,8 +199,10 @@ bool ThumbTranslatorVisitor::thumb16_EOR_reg(Reg m, Reg d_n) {
     const auto result = ir.Eor(ir.GetRegister(n), ir.GetRegister(m));
 
     ir.SetRegister(d, result);
-    ir.SetNFlag(ir.MostSignificantBit(result));
-    ir.SetZFlag(ir.IsZero(result));
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result));
+        ir.SetZFlag(ir.IsZero(result));
+    }
     return true;
 }
 
@@ -191,9 +215,11 @@ bool ThumbTranslatorVisitor::thumb16_LSL_reg(Reg m, Reg d_n) {
     const auto result_carry = ir.LogicalShiftLeft(ir.GetRegister(n), shift_n, apsr_c);
 
     ir.SetRegister(d, result_carry.result);
-    ir.SetNFlag(ir.MostSignificantBit(result_carry.result));
-    ir.SetZFlag(ir.IsZero(result_carry.result));
-    ir.SetCFlag(result_carry.carry);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result_carry.result));
+        ir.SetZFlag(ir.IsZero(result_carry.result));
+        ir.SetCFlag(result_carry.carry);
+    }
     return true;
 }
 
@@ -206,9 +232,11 @@ bool ThumbTranslatorVisitor::thumb16_LSR_reg(Reg m, Reg d_n) {
     const auto result = ir.LogicalShiftRight(ir.GetRegister(n), shift_n, cpsr_c);
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+    }
     return true;
 }
 
@@ -221,9 +249,11 @@ bool ThumbTranslatorVisitor::thumb16_ASR_reg(Reg m, Reg d_n) {
     const auto result = ir.ArithmeticShiftRight(ir.GetRegister(n), shift_n, cpsr_c);
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+    }
     return true;
 }
 
@@ -236,10 +266,12 @@ bool ThumbTranslatorVisitor::thumb16_ADC_reg(Reg m, Reg d_n) {
     const auto result = ir.AddWithCarry(ir.GetRegister(n), ir.GetRegister(m), aspr_c);
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
-    ir.SetVFlag(result.overflow);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+        ir.SetVFlag(result.overflow);
+    }
     return true;
 }
 
@@ -252,10 +284,12 @@ bool ThumbTranslatorVisitor::thumb16_SBC_reg(Reg m, Reg d_n) {
     const auto result = ir.SubWithCarry(ir.GetRegister(n), ir.GetRegister(m), aspr_c);
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
-    ir.SetVFlag(result.overflow);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+        ir.SetVFlag(result.overflow);
+    }
     return true;
 }
 
@@ -268,9 +302,11 @@ bool ThumbTranslatorVisitor::thumb16_ROR_reg(Reg m, Reg d_n) {
     const auto result = ir.RotateRight(ir.GetRegister(n), shift_n, cpsr_c);
 
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+    }
     return true;
 }
 
@@ -287,10 +323,12 @@ bool ThumbTranslatorVisitor::thumb16_TST_reg(Reg m, Reg n) {
 bool ThumbTranslatorVisitor::thumb16_RSB_imm(Reg n, Reg d) {
     const auto result = ir.SubWithCarry(ir.Imm32(0), ir.GetRegister(n), ir.Imm1(1));
     ir.SetRegister(d, result.result);
-    ir.SetNFlag(ir.MostSignificantBit(result.result));
-    ir.SetZFlag(ir.IsZero(result.result));
-    ir.SetCFlag(result.carry);
-    ir.SetVFlag(result.overflow);
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result.result));
+        ir.SetZFlag(ir.IsZero(result.result));
+        ir.SetCFlag(result.carry);
+        ir.SetVFlag(result.overflow);
+    }
     return true;
 }
 
@@ -322,8 +360,10 @@ bool ThumbTranslatorVisitor::thumb16_ORR_reg(Reg m, Reg d_n) {
     const auto result = ir.Or(ir.GetRegister(m), ir.GetRegister(n));
 
     ir.SetRegister(d, result);
-    ir.SetNFlag(ir.MostSignificantBit(result));
-    ir.SetZFlag(ir.IsZero(result));
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result));
+        ir.SetZFlag(ir.IsZero(result));
+    }
     return true;
 }
 
@@ -335,8 +375,10 @@ bool ThumbTranslatorVisitor::thumb16_MUL_reg(Reg n, Reg d_m) {
     const auto result = ir.Mul(ir.GetRegister(m), ir.GetRegister(n));
 
     ir.SetRegister(d, result);
-    ir.SetNFlag(ir.MostSignificantBit(result));
-    ir.SetZFlag(ir.IsZero(result));
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result));
+        ir.SetZFlag(ir.IsZero(result));
+    }
     return true;
 }
 
@@ -348,8 +390,10 @@ bool ThumbTranslatorVisitor::thumb16_BIC_reg(Reg m, Reg d_n) {
     const auto result = ir.And(ir.GetRegister(n), ir.Not(ir.GetRegister(m)));
 
     ir.SetRegister(d, result);
-    ir.SetNFlag(ir.MostSignificantBit(result));
-    ir.SetZFlag(ir.IsZero(result));
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result));
+        ir.SetZFlag(ir.IsZero(result));
+    }
     return true;
 }
 
@@ -358,8 +402,10 @@ bool ThumbTranslatorVisitor::thumb16_BIC_reg(Reg m, Reg d_n) {
 bool ThumbTranslatorVisitor::thumb16_MVN_reg(Reg m, Reg d) {
     const auto result = ir.Not(ir.GetRegister(m));
     ir.SetRegister(d, result);
-    ir.SetNFlag(ir.MostSignificantBit(result));
-    ir.SetZFlag(ir.IsZero(result));
+    if (!ir.current_location.IT().IsInITBlock()) {
+        ir.SetNFlag(ir.MostSignificantBit(result));
+        ir.SetZFlag(ir.IsZero(result));
+    }
     return true;
 }
 
@@ -367,11 +413,14 @@ bool ThumbTranslatorVisitor::thumb16_MVN_reg(Reg m, Reg d) {
 bool ThumbTranslatorVisitor::thumb16_ADD_reg_t2(bool d_n_hi, Reg m, Reg d_n_lo) {
     const Reg d_n = d_n_hi ? (d_n_lo + 8) : d_n_lo;
     const Reg n = d_n;
+    const Reg d = d_n;
     if (n == Reg::PC && m == Reg::PC) {
         return UnpredictableInstruction();
     }
+    if (d == Reg::PC && IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
 
-    const Reg d = d_n;
     const auto result = ir.AddWithCarry(ir.GetRegister(n), ir.GetRegister(m), ir.Imm1(0));
     if (d == Reg::PC) {
         ir.ALUWritePC(result.result);
@@ -405,6 +454,10 @@ bool ThumbTranslatorVisitor::thumb16_CMP_reg_t2(bool n_hi, Reg m, Reg n_lo) {
 // MOV <Rd>, <Rm>
 bool ThumbTranslatorVisitor::thumb16_MOV_reg(bool d_hi, Reg m, Reg d_lo) {
     const Reg d = d_hi ? (d_lo + 8) : d_lo;
+    if (d == Reg::PC && IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
     const auto result = ir.GetRegister(m);
 
     if (d == Reg::PC) {
@@ -747,6 +800,9 @@ bool ThumbTranslatorVisitor::thumb16_POP(bool P, RegList reg_list) {
     if (Common::BitCount(reg_list) < 1) {
         return UnpredictableInstruction();
     }
+    if (P && IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
 
     auto address = ir.GetRegister(Reg::SP);
     for (size_t i = 0; i < 15; i++) {
@@ -774,6 +830,10 @@ bool ThumbTranslatorVisitor::thumb16_POP(bool P, RegList reg_list) {
 
 // SETEND <endianness>
 bool ThumbTranslatorVisitor::thumb16_SETEND(bool E) {
+    if (ir.current_location.IT().IsInITBlock()) {
+        return UnpredictableInstruction();
+    }
+
     if (E == ir.current_location.EFlag()) {
         return true;
     }
@@ -873,6 +933,10 @@ bool ThumbTranslatorVisitor::thumb16_LDMIA(Reg n, RegList reg_list) {
 
 // CB{N}Z <Rn>, <label>
 bool ThumbTranslatorVisitor::thumb16_CBZ_CBNZ(bool nonzero, Imm<1> i, Imm<5> imm5, Reg n) {
+    if (ir.current_location.IT().IsInITBlock()) {
+        return UnpredictableInstruction();
+    }
+
     const u32 imm = concatenate(i, imm5, Imm<1>{0}).ZeroExtend();
     const IR::U32 rn = ir.GetRegister(n);
 
@@ -881,7 +945,7 @@ bool ThumbTranslatorVisitor::thumb16_CBZ_CBNZ(bool nonzero, Imm<1> i, Imm<5> imm
     const auto [cond_pass, cond_fail] = [this, imm, nonzero] {
         const u32 target = ir.PC() + imm;
         const auto skip = IR::Term::LinkBlock{ir.current_location.AdvancePC(2)};
-        const auto branch = IR::Term::LinkBlock{ir.current_location.AdvancePC(target)};
+        const auto branch = IR::Term::LinkBlock{ir.current_location.SetPC(target)};
 
         if (nonzero) {
             return std::make_pair(skip, branch);
@@ -890,7 +954,7 @@ bool ThumbTranslatorVisitor::thumb16_CBZ_CBNZ(bool nonzero, Imm<1> i, Imm<5> imm
         }
     }();
 
-     ir.SetTerm(IR::Term::CheckBit{cond_pass, cond_fail});
+    ir.SetTerm(IR::Term::CheckBit{cond_pass, cond_fail});
     return false;
 }
 
@@ -900,6 +964,10 @@ bool ThumbTranslatorVisitor::thumb16_UDF() {
 
 // BX <Rm>
 bool ThumbTranslatorVisitor::thumb16_BX(Reg m) {
+    if (IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
     ir.BXWritePC(ir.GetRegister(m));
     if (m == Reg::R14)
         ir.SetTerm(IR::Term::PopRSBHint{});
@@ -910,7 +978,11 @@ bool ThumbTranslatorVisitor::thumb16_BX(Reg m) {
 
 // BLX <Rm>
 bool ThumbTranslatorVisitor::thumb16_BLX_reg(Reg m) {
-    ir.PushRSB(ir.current_location.AdvancePC(2));
+    if (IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
+    ir.PushRSB(ir.current_location.AdvancePC(2).AdvanceIT());
     ir.BXWritePC(ir.GetRegister(m));
     ir.SetRegister(Reg::LR, ir.Imm32((ir.current_location.PC() + 2) | 1));
     ir.SetTerm(IR::Term::FastDispatchHint{});
@@ -920,18 +992,37 @@ bool ThumbTranslatorVisitor::thumb16_BLX_reg(Reg m) {
 // SVC #<imm8>
 bool ThumbTranslatorVisitor::thumb16_SVC(Imm<8> imm8) {
     const u32 imm32 = imm8.ZeroExtend();
-    ir.BranchWritePC(ir.Imm32(ir.current_location.PC() + 2));
-    ir.PushRSB(ir.current_location.AdvancePC(2));
+    const auto next_location = WriteNextLocation();
+    ir.PushRSB(next_location);
     ir.CallSupervisor(ir.Imm32(imm32));
     ir.SetTerm(IR::Term::CheckHalt{IR::Term::PopRSBHint{}});
     return false;
 }
 
+// IT{<x>{<y>{<z>}}} <firstcond>
+bool ThumbTranslatorVisitor::thumb16_IT(Imm<8> imm8) {
+    ASSERT_MSG((imm8.Bits<0, 3>() != 0b0000), "Decode Error");
+    if (imm8.Bits<4, 7>() == 0b1111 || (imm8.Bits<4, 7>() == 0b1110 && Common::BitCount(imm8.Bits<0, 3>()) != 1)) {
+        return UnpredictableInstruction();
+    }
+    if (ir.current_location.IT().IsInITBlock()) {
+        return UnpredictableInstruction();
+    }
+
+    // The IT state is part of the location descriptor, so the IT block begins in a new basic block.
+    const auto next_location = ir.current_location.AdvancePC(2).SetIT(ITState{imm8.ZeroExtend<u8>()});
+    ir.SetTerm(IR::Term::LinkBlockFast{next_location});
+    return false;
+}
+
 // B<cond> <label>
 bool ThumbTranslatorVisitor::thumb16_B_t1(Cond cond, Imm<8> imm8) {
     if (cond == Cond::AL) {
         return thumb16_UDF();
     }
+    if (ir.current_location.IT().IsInITBlock()) {
+        return UnpredictableInstruction();
+    }
 
     const s32 imm32 = static_cast<s32>((imm8.SignExtend<u32>() << 1) + 4);
     const auto then_location = ir.current_location.AdvancePC(imm32);
@@ -943,8 +1034,12 @@ bool ThumbTranslatorVisitor::thumb16_B_t1(Cond cond, Imm<8> imm8) {
 
 // B <label>
 bool ThumbTranslatorVisitor::thumb16_B_t2(Imm<11> imm11) {
+    if (IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
     const s32 imm32 = static_cast<s32>((imm11.SignExtend<u32>() << 1) + 4);
-    const auto next_location = ir.current_location.AdvancePC(imm32);
+    const auto next_location = ir.current_location.AdvancePC(imm32).AdvanceIT();
 
     ir.SetTerm(IR::Term::LinkBlock{next_location});
     return false;
@@ -3,38 +3,177 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <dynarmic/A32/config.h>
+
 #include "frontend/A32/translate/impl/translate_thumb.h"
 
 namespace Dynarmic::A32 {
 
+static s32 DecodeBranchOffset(Imm<1> S, Imm<10> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
+    const Imm<1> i1{static_cast<u32>(j1 == S)};
+    const Imm<1> i2{static_cast<u32>(j2 == S)};
+    return concatenate(S, i1, i2, hi, lo, Imm<1>{0}).SignExtend<s32>();
+}
+
 // BL <label>
-bool ThumbTranslatorVisitor::thumb32_BL_imm(Imm<11> hi, Imm<11> lo) {
-    ir.PushRSB(ir.current_location.AdvancePC(4));
+bool ThumbTranslatorVisitor::thumb32_BL_imm(Imm<1> S, Imm<10> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
+    if (IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
+    ir.PushRSB(ir.current_location.AdvancePC(4).AdvanceIT());
     ir.SetRegister(Reg::LR, ir.Imm32((ir.current_location.PC() + 4) | 1));
 
-    const s32 imm32 = static_cast<s32>((concatenate(hi, lo).SignExtend<u32>() << 1) + 4);
-    const auto new_location = ir.current_location.AdvancePC(imm32);
+    const s32 imm32 = DecodeBranchOffset(S, hi, j1, j2, lo) + 4;
+    const auto new_location = ir.current_location.AdvancePC(imm32).AdvanceIT();
     ir.SetTerm(IR::Term::LinkBlock{new_location});
     return false;
 }
 
 // BLX <label>
-bool ThumbTranslatorVisitor::thumb32_BLX_imm(Imm<11> hi, Imm<11> lo) {
+bool ThumbTranslatorVisitor::thumb32_BLX_imm(Imm<1> S, Imm<10> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
     if (lo.Bit<0>()) {
         return UnpredictableInstruction();
     }
+    if (IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
 
-    ir.PushRSB(ir.current_location.AdvancePC(4));
+    ir.PushRSB(ir.current_location.AdvancePC(4).AdvanceIT());
     ir.SetRegister(Reg::LR, ir.Imm32((ir.current_location.PC() + 4) | 1));
 
-    const s32 imm32 = static_cast<s32>(concatenate(hi, lo).SignExtend<u32>() << 1);
+    const s32 imm32 = DecodeBranchOffset(S, hi, j1, j2, lo);
     const auto new_location = ir.current_location
                                 .SetPC(ir.AlignPC(4) + imm32)
-                                .SetTFlag(false);
+                                .SetTFlag(false)
+                                .AdvanceIT();
     ir.SetTerm(IR::Term::LinkBlock{new_location});
     return false;
 }
 
+// B <label>
+bool ThumbTranslatorVisitor::thumb32_B(Imm<1> S, Imm<10> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
+    if (IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
+    const s32 imm32 = DecodeBranchOffset(S, hi, j1, j2, lo) + 4;
+    const auto new_location = ir.current_location.AdvancePC(imm32).AdvanceIT();
+    ir.SetTerm(IR::Term::LinkBlock{new_location});
+    return false;
+}
+
+// B<cond> <label>
+bool ThumbTranslatorVisitor::thumb32_B_cond(Imm<1> S, Cond cond, Imm<6> hi, Imm<1> j1, Imm<1> j2, Imm<11> lo) {
+    if (cond == Cond::AL || cond == Cond::NV) {
+        // Unallocated miscellaneous control instructions.
+        return thumb32_UDF();
+    }
+    if (ir.current_location.IT().IsInITBlock()) {
+        return UnpredictableInstruction();
+    }
+
+    // Note: j1 and j2 are not inverted in this encoding.
+    const s32 imm32 = concatenate(S, j2, j1, hi, lo, Imm<1>{0}).SignExtend<s32>() + 4;
+    const auto then_location = ir.current_location.AdvancePC(imm32);
+    const auto else_location = ir.current_location.AdvancePC(4);
+
+    ir.SetTerm(IR::Term::If{cond, IR::Term::LinkBlock{then_location}, IR::Term::LinkBlock{else_location}});
+    return false;
+}
+
+// MSR<c> <spec_reg>, <Rn>
+bool ThumbTranslatorVisitor::thumb32_MSR_reg(bool R, Reg n, Imm<4> mask) {
+    if (R) {
+        // SPSR is not accessible from User mode.
+        return UnpredictableInstruction();
+    }
+    if (n == Reg::PC || n == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MSR_reg, mask.ZeroExtend<int>(), n);
+}
+
+// NOP<c>.W
+bool ThumbTranslatorVisitor::thumb32_NOP() {
+    return true;
+}
+
+// YIELD<c>.W
+bool ThumbTranslatorVisitor::thumb32_YIELD() {
+    return thumb16_YIELD();
+}
+
+// WFE<c>.W
+bool ThumbTranslatorVisitor::thumb32_WFE() {
+    return thumb16_WFE();
+}
+
+// WFI<c>.W
+bool ThumbTranslatorVisitor::thumb32_WFI() {
+    return thumb16_WFI();
+}
+
+// SEV<c>.W
+bool ThumbTranslatorVisitor::thumb32_SEV() {
+    return thumb16_SEV();
+}
+
+// SEVL<c>.W
+bool ThumbTranslatorVisitor::thumb32_SEVL() {
+    return thumb16_SEVL();
+}
+
+// CLREX<c>
+bool ThumbTranslatorVisitor::thumb32_CLREX() {
+    ir.ClearExclusive();
+    return true;
+}
+
+// DSB<c> <option>
+bool ThumbTranslatorVisitor::thumb32_DSB([[maybe_unused]] Imm<4> option) {
+    ir.DataSynchronizationBarrier();
+    return true;
+}
+
+// DMB<c> <option>
+bool ThumbTranslatorVisitor::thumb32_DMB([[maybe_unused]] Imm<4> option) {
+    ir.DataMemoryBarrier();
+    return true;
+}
+
+// ISB<c> <option>
+bool ThumbTranslatorVisitor::thumb32_ISB([[maybe_unused]] Imm<4> option) {
+    ir.InstructionSynchronizationBarrier();
+    WriteNextLocation();
+    ir.SetTerm(IR::Term::ReturnToDispatch{});
+    return false;
+}
+
+// BXJ<c> <Rm>
+bool ThumbTranslatorVisitor::thumb32_BXJ(Reg m) {
+    if (m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    // Jazelle not supported
+    return thumb16_BX(m);
+}
+
+// MRS<c> <Rd>, <spec_reg>
+bool ThumbTranslatorVisitor::thumb32_MRS_reg(bool R, Reg d) {
+    if (R) {
+        // SPSR is not accessible from User mode.
+        return UnpredictableInstruction();
+    }
+    if (d == Reg::PC || d == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MRS, d);
+}
+
 bool ThumbTranslatorVisitor::thumb32_UDF() {
     return thumb16_UDF();
 }
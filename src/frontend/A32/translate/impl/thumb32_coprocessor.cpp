@@ -0,0 +1,72 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+/// The A32 coprocessor handlers identify the *2 variants by an NV condition.
+template <typename FnT, typename... Args>
+static bool TranslateCoprocessorAsArm(ThumbTranslatorVisitor& v, bool two, FnT fn, Args... args) {
+    ArmTranslatorVisitor arm_visitor{v.ir.block, v.ir.current_location, v.options};
+    return (arm_visitor.*fn)(two ? Cond::NV : Cond::AL, args...);
+}
+
+// MCRR{2}<c> <coproc>, #<opc>, <Rt>, <Rt2>, <CRm>
+bool ThumbTranslatorVisitor::thumb32_MCRR(bool two, Reg t2, Reg t, size_t coproc_no, size_t opc, CoprocReg CRm) {
+    if (t == Reg::SP || t2 == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateCoprocessorAsArm(*this, two, &ArmTranslatorVisitor::arm_MCRR, t2, t, coproc_no, opc, CRm);
+}
+
+// MRRC{2}<c> <coproc>, #<opc>, <Rt>, <Rt2>, <CRm>
+bool ThumbTranslatorVisitor::thumb32_MRRC(bool two, Reg t2, Reg t, size_t coproc_no, size_t opc, CoprocReg CRm) {
+    if (t == Reg::SP || t2 == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateCoprocessorAsArm(*this, two, &ArmTranslatorVisitor::arm_MRRC, t2, t, coproc_no, opc, CRm);
+}
+
+// STC{2}{L}<c> <coproc>, <CRd>, [<Rn>, #+/-<imm32>]{!}
+// STC{2}{L}<c> <coproc>, <CRd>, [<Rn>], #+/-<imm32>
+// STC{2}{L}<c> <coproc>, <CRd>, [<Rn>], <imm8>
+bool ThumbTranslatorVisitor::thumb32_STC(bool two, bool p, bool u, bool d, bool w, Reg n, CoprocReg CRd, size_t coproc_no, Imm<8> imm8) {
+    return TranslateCoprocessorAsArm(*this, two, &ArmTranslatorVisitor::arm_STC, p, u, d, w, n, CRd, coproc_no, imm8);
+}
+
+// LDC{2}{L}<c> <coproc>, <CRd>, [<Rn>, #+/-<imm32>]{!}
+// LDC{2}{L}<c> <coproc>, <CRd>, [<Rn>], #+/-<imm32>
+// LDC{2}{L}<c> <coproc>, <CRd>, [<Rn>], <imm8>
+bool ThumbTranslatorVisitor::thumb32_LDC(bool two, bool p, bool u, bool d, bool w, Reg n, CoprocReg CRd, size_t coproc_no, Imm<8> imm8) {
+    return TranslateCoprocessorAsArm(*this, two, &ArmTranslatorVisitor::arm_LDC, p, u, d, w, n, CRd, coproc_no, imm8);
+}
+
+// CDP{2}<c> <coproc>, #<opc1>, <CRd>, <CRn>, <CRm>, #<opc2>
+bool ThumbTranslatorVisitor::thumb32_CDP(bool two, size_t opc1, CoprocReg CRn, CoprocReg CRd, size_t coproc_no, size_t opc2, CoprocReg CRm) {
+    return TranslateCoprocessorAsArm(*this, two, &ArmTranslatorVisitor::arm_CDP, opc1, CRn, CRd, coproc_no, opc2, CRm);
+}
+
+// MCR{2}<c> <coproc>, #<opc1>, <Rt>, <CRn>, <CRm>, #<opc2>
+bool ThumbTranslatorVisitor::thumb32_MCR(bool two, size_t opc1, CoprocReg CRn, Reg t, size_t coproc_no, size_t opc2, CoprocReg CRm) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateCoprocessorAsArm(*this, two, &ArmTranslatorVisitor::arm_MCR, opc1, CRn, t, coproc_no, opc2, CRm);
+}
+
+// MRC{2}<c> <coproc>, #<opc1>, <Rt>, <CRn>, <CRm>, #<opc2>
+bool ThumbTranslatorVisitor::thumb32_MRC(bool two, size_t opc1, CoprocReg CRn, Reg t, size_t coproc_no, size_t opc2, CoprocReg CRm) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateCoprocessorAsArm(*this, two, &ArmTranslatorVisitor::arm_MRC, opc1, CRn, t, coproc_no, opc2, CRm);
+}
+
+} // namespace Dynarmic::A32
@@ -0,0 +1,158 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool IsBadReg(Reg r) {
+    return r == Reg::SP || r == Reg::PC;
+}
+
+// ADR<c>.W <Rd>, <label>
+// ADD<c>.W <Rd>, PC, #<imm12>
+bool ThumbTranslatorVisitor::thumb32_ADR_t3(Imm<1> imm1, Imm<3> imm3, Reg d, Imm<8> imm8) {
+    if (IsBadReg(d)) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = concatenate(imm1, imm3, imm8).ZeroExtend();
+    const auto result = ir.AlignPC(4) + imm32;
+
+    ir.SetRegister(d, ir.Imm32(result));
+    return true;
+}
+
+// ADDW<c> <Rd>, <Rn>, #<imm12>
+bool ThumbTranslatorVisitor::thumb32_ADD_imm_2(Imm<1> imm1, Reg n, Imm<3> imm3, Reg d, Imm<8> imm8) {
+    if (d == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = concatenate(imm1, imm3, imm8).ZeroExtend();
+    const auto result = ir.Add(ir.GetRegister(n), ir.Imm32(imm32));
+
+    ir.SetRegister(d, result);
+    return true;
+}
+
+// MOVW<c> <Rd>, #<imm16>
+bool ThumbTranslatorVisitor::thumb32_MOVW_imm(Imm<1> imm1, Imm<4> imm4, Imm<3> imm3, Reg d, Imm<8> imm8) {
+    if (IsBadReg(d)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOVW, imm4, d, concatenate(imm1, imm3, imm8));
+}
+
+// ADR<c>.W <Rd>, <label>
+// SUB<c> <Rd>, PC, #<imm12>
+bool ThumbTranslatorVisitor::thumb32_ADR_t2(Imm<1> imm1, Imm<3> imm3, Reg d, Imm<8> imm8) {
+    if (IsBadReg(d)) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = concatenate(imm1, imm3, imm8).ZeroExtend();
+    const auto result = ir.AlignPC(4) - imm32;
+
+    ir.SetRegister(d, ir.Imm32(result));
+    return true;
+}
+
+// SUBW<c> <Rd>, <Rn>, #<imm12>
+bool ThumbTranslatorVisitor::thumb32_SUB_imm_2(Imm<1> imm1, Reg n, Imm<3> imm3, Reg d, Imm<8> imm8) {
+    if (d == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = concatenate(imm1, imm3, imm8).ZeroExtend();
+    const auto result = ir.Sub(ir.GetRegister(n), ir.Imm32(imm32));
+
+    ir.SetRegister(d, result);
+    return true;
+}
+
+// MOVT<c> <Rd>, #<imm16>
+bool ThumbTranslatorVisitor::thumb32_MOVT(Imm<1> imm1, Imm<4> imm4, Imm<3> imm3, Reg d, Imm<8> imm8) {
+    if (IsBadReg(d)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOVT, imm4, d, concatenate(imm1, imm3, imm8));
+}
+
+// SSAT16<c> <Rd>, #<imm>, <Rn>
+bool ThumbTranslatorVisitor::thumb32_SSAT16(Reg n, Reg d, Imm<4> sat_imm) {
+    if (IsBadReg(d) || IsBadReg(n)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SSAT16, sat_imm, d, n);
+}
+
+// SSAT<c> <Rd>, #<imm>, <Rn>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_SSAT(bool sh, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, Imm<5> sat_imm) {
+    if (IsBadReg(d) || IsBadReg(n)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SSAT, sat_imm, d, concatenate(imm3, imm2), sh, n);
+}
+
+// SBFX<c> <Rd>, <Rn>, #<lsb>, #<width>
+bool ThumbTranslatorVisitor::thumb32_SBFX(Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, Imm<5> widthm1) {
+    if (IsBadReg(d) || IsBadReg(n)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SBFX, widthm1, d, concatenate(imm3, imm2), n);
+}
+
+// BFC<c> <Rd>, #<lsb>, #<width>
+bool ThumbTranslatorVisitor::thumb32_BFC(Imm<3> imm3, Reg d, Imm<2> imm2, Imm<5> msb) {
+    if (IsBadReg(d)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_BFC, msb, d, concatenate(imm3, imm2));
+}
+
+// BFI<c> <Rd>, <Rn>, #<lsb>, #<width>
+bool ThumbTranslatorVisitor::thumb32_BFI(Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, Imm<5> msb) {
+    if (IsBadReg(d) || n == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_BFI, msb, d, concatenate(imm3, imm2), n);
+}
+
+// USAT16<c> <Rd>, #<imm4>, <Rn>
+bool ThumbTranslatorVisitor::thumb32_USAT16(Reg n, Reg d, Imm<4> sat_imm) {
+    if (IsBadReg(d) || IsBadReg(n)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_USAT16, sat_imm, d, n);
+}
+
+// USAT<c> <Rd>, #<imm5>, <Rn>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_USAT(bool sh, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, Imm<5> sat_imm) {
+    if (IsBadReg(d) || IsBadReg(n)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_USAT, sat_imm, d, concatenate(imm3, imm2), sh, n);
+}
+
+// UBFX<c> <Rd>, <Rn>, #<lsb>, #<width>
+bool ThumbTranslatorVisitor::thumb32_UBFX(Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, Imm<5> widthm1) {
+    if (IsBadReg(d) || IsBadReg(n)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UBFX, widthm1, d, concatenate(imm3, imm2), n);
+}
+
+} // namespace Dynarmic::A32
@@ -0,0 +1,158 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool IsBadReg(Reg r) {
+    return r == Reg::SP || r == Reg::PC;
+}
+
+// LSL{S}<c>.W <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_LSL_reg(bool S, Reg m, Reg d, Reg s) {
+    if (IsBadReg(d) || IsBadReg(m) || IsBadReg(s)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_rsr, S, d, s, ShiftType::LSL, m);
+}
+
+// LSR{S}<c>.W <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_LSR_reg(bool S, Reg m, Reg d, Reg s) {
+    if (IsBadReg(d) || IsBadReg(m) || IsBadReg(s)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_rsr, S, d, s, ShiftType::LSR, m);
+}
+
+// ASR{S}<c>.W <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_ASR_reg(bool S, Reg m, Reg d, Reg s) {
+    if (IsBadReg(d) || IsBadReg(m) || IsBadReg(s)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_rsr, S, d, s, ShiftType::ASR, m);
+}
+
+// ROR{S}<c>.W <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_ROR_reg(bool S, Reg m, Reg d, Reg s) {
+    if (IsBadReg(d) || IsBadReg(m) || IsBadReg(s)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_rsr, S, d, s, ShiftType::ROR, m);
+}
+
+// SXTH<c>.W <Rd>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_SXTH(Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SXTH, d, rotate, m);
+}
+
+// SXTAH<c> <Rd>, <Rn>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_SXTAH(Reg n, Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SXTAH, n, d, rotate, m);
+}
+
+// UXTH<c>.W <Rd>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_UXTH(Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UXTH, d, rotate, m);
+}
+
+// UXTAH<c> <Rd>, <Rn>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_UXTAH(Reg n, Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UXTAH, n, d, rotate, m);
+}
+
+// SXTB16<c> <Rd>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_SXTB16(Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SXTB16, d, rotate, m);
+}
+
+// SXTAB16<c> <Rd>, <Rn>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_SXTAB16(Reg n, Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SXTAB16, n, d, rotate, m);
+}
+
+// UXTB16<c> <Rd>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_UXTB16(Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UXTB16, d, rotate, m);
+}
+
+// UXTAB16<c> <Rd>, <Rn>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_UXTAB16(Reg n, Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UXTAB16, n, d, rotate, m);
+}
+
+// SXTB<c>.W <Rd>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_SXTB(Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SXTB, d, rotate, m);
+}
+
+// SXTAB<c> <Rd>, <Rn>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_SXTAB(Reg n, Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SXTAB, n, d, rotate, m);
+}
+
+// UXTB<c>.W <Rd>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_UXTB(Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UXTB, d, rotate, m);
+}
+
+// UXTAB<c> <Rd>, <Rn>, <Rm>{, <rotation>}
+bool ThumbTranslatorVisitor::thumb32_UXTAB(Reg n, Reg d, SignExtendRotation rotate, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UXTAB, n, d, rotate, m);
+}
+
+} // namespace Dynarmic::A32
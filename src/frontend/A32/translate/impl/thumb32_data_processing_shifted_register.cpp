@@ -0,0 +1,222 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+// TST<c>.W <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_TST_reg(Reg n, Imm<3> imm3, Imm<2> imm2, ShiftType type, Reg m) {
+    if (n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_TST_reg, n, concatenate(imm3, imm2), type, m);
+}
+
+// AND{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_AND_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_AND_reg, S, n, d, concatenate(imm3, imm2), type, m);
+}
+
+// BIC{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_BIC_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_BIC_reg, S, n, d, concatenate(imm3, imm2), type, m);
+}
+
+// MOV{S}<c>.W <Rd>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_MOV_reg(bool S, Reg d, Reg m) {
+    if (d == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_reg, S, d, Imm<5>{0}, ShiftType::LSL, m);
+}
+
+// LSL{S}<c>.W <Rd>, <Rm>, #<imm>
+bool ThumbTranslatorVisitor::thumb32_LSL_imm(bool S, Imm<3> imm3, Reg d, Imm<2> imm2, Reg m) {
+    if (d == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_reg, S, d, concatenate(imm3, imm2), ShiftType::LSL, m);
+}
+
+// LSR{S}<c>.W <Rd>, <Rm>, #<imm>
+bool ThumbTranslatorVisitor::thumb32_LSR_imm(bool S, Imm<3> imm3, Reg d, Imm<2> imm2, Reg m) {
+    if (d == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_reg, S, d, concatenate(imm3, imm2), ShiftType::LSR, m);
+}
+
+// ASR{S}<c>.W <Rd>, <Rm>, #<imm>
+bool ThumbTranslatorVisitor::thumb32_ASR_imm(bool S, Imm<3> imm3, Reg d, Imm<2> imm2, Reg m) {
+    if (d == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_reg, S, d, concatenate(imm3, imm2), ShiftType::ASR, m);
+}
+
+// RRX{S}<c> <Rd>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_RRX(bool S, Reg d, Reg m) {
+    if (d == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_reg, S, d, Imm<5>{0}, ShiftType::ROR, m);
+}
+
+// ROR{S}<c> <Rd>, <Rm>, #<imm>
+bool ThumbTranslatorVisitor::thumb32_ROR_imm(bool S, Imm<3> imm3, Reg d, Imm<2> imm2, Reg m) {
+    if (d == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MOV_reg, S, d, concatenate(imm3, imm2), ShiftType::ROR, m);
+}
+
+// ORR{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_ORR_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_ORR_reg, S, n, d, concatenate(imm3, imm2), type, m);
+}
+
+// MVN{S}<c>.W <Rd>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_MVN_reg(bool S, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MVN_reg, S, d, concatenate(imm3, imm2), type, m);
+}
+
+// ORN{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_ORN_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto carry_in = ir.GetCFlag();
+    const auto shifted = EmitImmShift(ir.GetRegister(m), type, concatenate(imm3, imm2), carry_in);
+    const auto result = ir.Or(ir.GetRegister(n), ir.Not(shifted.result));
+
+    ir.SetRegister(d, result);
+    if (S) {
+        ir.SetNFlag(ir.MostSignificantBit(result));
+        ir.SetZFlag(ir.IsZero(result));
+        ir.SetCFlag(shifted.carry);
+    }
+    return true;
+}
+
+// TEQ<c> <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_TEQ_reg(Reg n, Imm<3> imm3, Imm<2> imm2, ShiftType type, Reg m) {
+    if (n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_TEQ_reg, n, concatenate(imm3, imm2), type, m);
+}
+
+// EOR{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_EOR_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_EOR_reg, S, n, d, concatenate(imm3, imm2), type, m);
+}
+
+// PKHBT<c> <Rd>, <Rn>, <Rm>{, LSL #<imm>}
+// PKHTB<c> <Rd>, <Rn>, <Rm>{, ASR #<imm>}
+bool ThumbTranslatorVisitor::thumb32_PKH(Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, bool tb, Reg m) {
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    if (tb) {
+        return TranslateAsArm(&ArmTranslatorVisitor::arm_PKHTB, n, d, concatenate(imm3, imm2), m);
+    }
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_PKHBT, n, d, concatenate(imm3, imm2), m);
+}
+
+// CMN<c>.W <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_CMN_reg(Reg n, Imm<3> imm3, Imm<2> imm2, ShiftType type, Reg m) {
+    if (n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_CMN_reg, n, concatenate(imm3, imm2), type, m);
+}
+
+// ADD{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_ADD_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_ADD_reg, S, n, d, concatenate(imm3, imm2), type, m);
+}
+
+// ADC{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_ADC_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_ADC_reg, S, n, d, concatenate(imm3, imm2), type, m);
+}
+
+// SBC{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_SBC_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SBC_reg, S, n, d, concatenate(imm3, imm2), type, m);
+}
+
+// CMP<c>.W <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_CMP_reg(Reg n, Imm<3> imm3, Imm<2> imm2, ShiftType type, Reg m) {
+    if (n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_CMP_reg, n, concatenate(imm3, imm2), type, m);
+}
+
+// SUB{S}<c>.W <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_SUB_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SUB_reg, S, n, d, concatenate(imm3, imm2), type, m);
+}
+
+// RSB{S}<c> <Rd>, <Rn>, <Rm>{, <shift>}
+bool ThumbTranslatorVisitor::thumb32_RSB_reg(bool S, Reg n, Imm<3> imm3, Reg d, Imm<2> imm2, ShiftType type, Reg m) {
+    if (d == Reg::PC || n == Reg::PC || m == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_RSB_reg, S, n, d, concatenate(imm3, imm2), type, m);
+}
+
+} // namespace Dynarmic::A32
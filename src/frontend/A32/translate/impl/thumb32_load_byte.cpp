@@ -0,0 +1,218 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <dynarmic/A32/config.h>
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool PLDHandler(ThumbTranslatorVisitor& v, bool W) {
+    if (!v.options.hook_hint_instructions) {
+        return true;
+    }
+
+    const auto exception = W ? Exception::PreloadDataWithIntentToWrite
+                             : Exception::PreloadData;
+    return v.RaiseException(exception);
+}
+
+template <typename LoadFn>
+static bool LoadLiteral(ThumbTranslatorVisitor& v, bool U, Reg t, Imm<12> imm12, LoadFn load_fn) {
+    const u32 imm32 = imm12.ZeroExtend();
+    const u32 base = v.ir.AlignPC(4);
+    const u32 address = U ? (base + imm32) : (base - imm32);
+    const auto data = load_fn(v.ir.Imm32(address));
+
+    v.ir.SetRegister(t, data);
+    return true;
+}
+
+template <typename LoadFn>
+static bool LoadRegister(ThumbTranslatorVisitor& v, Reg n, Reg t, Imm<2> imm2, Reg m, LoadFn load_fn) {
+    if (m == Reg::PC || m == Reg::SP) {
+        return v.UnpredictableInstruction();
+    }
+
+    const IR::U32 reg_n = v.ir.GetRegister(n);
+    const auto reg_m = v.ir.GetRegister(m);
+    const auto shift_amount = v.ir.Imm8(static_cast<u8>(imm2.ZeroExtend()));
+    const auto offset = v.ir.LogicalShiftLeft(reg_m, shift_amount);
+    const auto address = v.ir.Add(reg_n, offset);
+    const auto data = load_fn(address);
+
+    v.ir.SetRegister(t, data);
+    return true;
+}
+
+template <typename LoadFn>
+static bool LoadImmediate(ThumbTranslatorVisitor& v, Reg n, Reg t, bool P, bool U, bool W, Imm<12> imm12, LoadFn load_fn) {
+    const u32 imm32 = imm12.ZeroExtend();
+    const IR::U32 reg_n = v.ir.GetRegister(n);
+    const IR::U32 offset_address = U ? v.ir.Add(reg_n, v.ir.Imm32(imm32))
+                                  : v.ir.Sub(reg_n, v.ir.Imm32(imm32));
+    const IR::U32 address = P ? offset_address : reg_n;
+    const auto data = load_fn(address);
+
+    if (W) {
+        v.ir.SetRegister(n, offset_address);
+    }
+    v.ir.SetRegister(t, data);
+    return true;
+}
+
+static auto LoadByte(ThumbTranslatorVisitor& v) {
+    return [&v](const IR::U32& address) { return v.ir.ZeroExtendByteToWord(v.ir.ReadMemory8(address)); };
+}
+
+static auto LoadSignedByte(ThumbTranslatorVisitor& v) {
+    return [&v](const IR::U32& address) { return v.ir.SignExtendByteToWord(v.ir.ReadMemory8(address)); };
+}
+
+// PLD <label>
+bool ThumbTranslatorVisitor::thumb32_PLD_lit([[maybe_unused]] bool U, [[maybe_unused]] Imm<12> imm12) {
+    return PLDHandler(*this, false);
+}
+
+// PLD{W} [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_PLD_reg(bool W, [[maybe_unused]] Reg n, [[maybe_unused]] Imm<2> imm2, Reg m) {
+    if (m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    return PLDHandler(*this, W);
+}
+
+// PLD{W} [<Rn>, #-<imm8>]
+bool ThumbTranslatorVisitor::thumb32_PLD_imm8(bool W, [[maybe_unused]] Reg n, [[maybe_unused]] Imm<8> imm8) {
+    return PLDHandler(*this, W);
+}
+
+// PLD{W} [<Rn>, #<imm12>]
+bool ThumbTranslatorVisitor::thumb32_PLD_imm12(bool W, [[maybe_unused]] Reg n, [[maybe_unused]] Imm<12> imm12) {
+    return PLDHandler(*this, W);
+}
+
+// PLI <label>
+bool ThumbTranslatorVisitor::thumb32_PLI_lit([[maybe_unused]] bool U, [[maybe_unused]] Imm<12> imm12) {
+    // Instruction preloads are treated as a NOP.
+    return true;
+}
+
+// PLI [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_PLI_reg([[maybe_unused]] Reg n, [[maybe_unused]] Imm<2> imm2, Reg m) {
+    if (m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    // Instruction preloads are treated as a NOP.
+    return true;
+}
+
+// PLI [<Rn>, #-<imm8>]
+bool ThumbTranslatorVisitor::thumb32_PLI_imm8([[maybe_unused]] Reg n, [[maybe_unused]] Imm<8> imm8) {
+    // Instruction preloads are treated as a NOP.
+    return true;
+}
+
+// PLI [<Rn>, #<imm12>]
+bool ThumbTranslatorVisitor::thumb32_PLI_imm12([[maybe_unused]] Reg n, [[maybe_unused]] Imm<12> imm12) {
+    // Instruction preloads are treated as a NOP.
+    return true;
+}
+
+// LDRB<c> <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRB_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadLiteral(*this, U, t, imm12, LoadByte(*this));
+}
+
+// LDRB<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDRB_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadRegister(*this, n, t, imm2, m, LoadByte(*this));
+}
+
+// LDRBT<c> <Rt>, [<Rn>, #<imm8>]
+bool ThumbTranslatorVisitor::thumb32_LDRBT(Reg n, Reg t, Imm<8> imm8) {
+    // Unprivileged loads behave as ordinary loads in User mode.
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, true, true, false, Imm<12>{imm8.ZeroExtend()}, LoadByte(*this));
+}
+
+// LDRB<c> <Rt>, [<Rn>, #-<imm8>]
+// LDRB<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDRB<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDRB_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::SP || (t == Reg::PC && W) || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, P, U, W, Imm<12>{imm8.ZeroExtend()}, LoadByte(*this));
+}
+
+// LDRB<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDRB_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, true, true, false, imm12, LoadByte(*this));
+}
+
+// LDRSB<c> <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRSB_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadLiteral(*this, U, t, imm12, LoadSignedByte(*this));
+}
+
+// LDRSB<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDRSB_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadRegister(*this, n, t, imm2, m, LoadSignedByte(*this));
+}
+
+// LDRSBT<c> <Rt>, [<Rn>, #<imm8>]
+bool ThumbTranslatorVisitor::thumb32_LDRSBT(Reg n, Reg t, Imm<8> imm8) {
+    // Unprivileged loads behave as ordinary loads in User mode.
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, true, true, false, Imm<12>{imm8.ZeroExtend()}, LoadSignedByte(*this));
+}
+
+// LDRSB<c> <Rt>, [<Rn>, #-<imm8>]
+// LDRSB<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDRSB<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDRSB_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::SP || (t == Reg::PC && W) || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, P, U, W, Imm<12>{imm8.ZeroExtend()}, LoadSignedByte(*this));
+}
+
+// LDRSB<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDRSB_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, true, true, false, imm12, LoadSignedByte(*this));
+}
+
+} // namespace Dynarmic::A32
@@ -0,0 +1,154 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+template <typename LoadFn>
+static bool LoadLiteral(ThumbTranslatorVisitor& v, bool U, Reg t, Imm<12> imm12, LoadFn load_fn) {
+    const u32 imm32 = imm12.ZeroExtend();
+    const u32 base = v.ir.AlignPC(4);
+    const u32 address = U ? (base + imm32) : (base - imm32);
+    const auto data = load_fn(v.ir.Imm32(address));
+
+    v.ir.SetRegister(t, data);
+    return true;
+}
+
+template <typename LoadFn>
+static bool LoadRegister(ThumbTranslatorVisitor& v, Reg n, Reg t, Imm<2> imm2, Reg m, LoadFn load_fn) {
+    if (m == Reg::PC || m == Reg::SP) {
+        return v.UnpredictableInstruction();
+    }
+
+    const IR::U32 reg_n = v.ir.GetRegister(n);
+    const auto reg_m = v.ir.GetRegister(m);
+    const auto shift_amount = v.ir.Imm8(static_cast<u8>(imm2.ZeroExtend()));
+    const auto offset = v.ir.LogicalShiftLeft(reg_m, shift_amount);
+    const auto address = v.ir.Add(reg_n, offset);
+    const auto data = load_fn(address);
+
+    v.ir.SetRegister(t, data);
+    return true;
+}
+
+template <typename LoadFn>
+static bool LoadImmediate(ThumbTranslatorVisitor& v, Reg n, Reg t, bool P, bool U, bool W, Imm<12> imm12, LoadFn load_fn) {
+    const u32 imm32 = imm12.ZeroExtend();
+    const IR::U32 reg_n = v.ir.GetRegister(n);
+    const IR::U32 offset_address = U ? v.ir.Add(reg_n, v.ir.Imm32(imm32))
+                                  : v.ir.Sub(reg_n, v.ir.Imm32(imm32));
+    const IR::U32 address = P ? offset_address : reg_n;
+    const auto data = load_fn(address);
+
+    if (W) {
+        v.ir.SetRegister(n, offset_address);
+    }
+    v.ir.SetRegister(t, data);
+    return true;
+}
+
+static auto LoadHalf(ThumbTranslatorVisitor& v) {
+    return [&v](const IR::U32& address) { return v.ir.ZeroExtendHalfToWord(v.ir.ReadMemory16(address)); };
+}
+
+static auto LoadSignedHalf(ThumbTranslatorVisitor& v) {
+    return [&v](const IR::U32& address) { return v.ir.SignExtendHalfToWord(v.ir.ReadMemory16(address)); };
+}
+
+// LDRH<c> <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRH_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadLiteral(*this, U, t, imm12, LoadHalf(*this));
+}
+
+// LDRH<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDRH_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadRegister(*this, n, t, imm2, m, LoadHalf(*this));
+}
+
+// LDRHT<c> <Rt>, [<Rn>, #<imm8>]
+bool ThumbTranslatorVisitor::thumb32_LDRHT(Reg n, Reg t, Imm<8> imm8) {
+    // Unprivileged loads behave as ordinary loads in User mode.
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, true, true, false, Imm<12>{imm8.ZeroExtend()}, LoadHalf(*this));
+}
+
+// LDRH<c> <Rt>, [<Rn>, #-<imm8>]
+// LDRH<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDRH<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDRH_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::SP || (t == Reg::PC && W) || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, P, U, W, Imm<12>{imm8.ZeroExtend()}, LoadHalf(*this));
+}
+
+// LDRH<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDRH_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, true, true, false, imm12, LoadHalf(*this));
+}
+
+// LDRSH<c> <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRSH_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadLiteral(*this, U, t, imm12, LoadSignedHalf(*this));
+}
+
+// LDRSH<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDRSH_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadRegister(*this, n, t, imm2, m, LoadSignedHalf(*this));
+}
+
+// LDRSHT<c> <Rt>, [<Rn>, #<imm8>]
+bool ThumbTranslatorVisitor::thumb32_LDRSHT(Reg n, Reg t, Imm<8> imm8) {
+    // Unprivileged loads behave as ordinary loads in User mode.
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, true, true, false, Imm<12>{imm8.ZeroExtend()}, LoadSignedHalf(*this));
+}
+
+// LDRSH<c> <Rt>, [<Rn>, #-<imm8>]
+// LDRSH<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDRSH<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDRSH_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::SP || (t == Reg::PC && W) || (W && n == t)) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, P, U, W, Imm<12>{imm8.ZeroExtend()}, LoadSignedHalf(*this));
+}
+
+// LDRSH<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDRSH_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return LoadImmediate(*this, n, t, true, true, false, imm12, LoadSignedHalf(*this));
+}
+
+} // namespace Dynarmic::A32
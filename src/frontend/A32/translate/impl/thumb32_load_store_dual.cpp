@@ -0,0 +1,233 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool IsBadReg(Reg r) {
+    return r == Reg::SP || r == Reg::PC;
+}
+
+static bool LDRDHelper(ThumbTranslatorVisitor& v, bool P, bool U, bool W, Reg n, Reg t, Reg t2, Imm<8> imm8) {
+    if (W && (n == t || n == t2)) {
+        return v.UnpredictableInstruction();
+    }
+    if (IsBadReg(t) || IsBadReg(t2) || t == t2) {
+        return v.UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm8.ZeroExtend() << 2;
+    const IR::U32 reg_n = v.ir.GetRegister(n);
+    const IR::U32 offset_address = U ? v.ir.Add(reg_n, v.ir.Imm32(imm32)) : v.ir.Sub(reg_n, v.ir.Imm32(imm32));
+    const IR::U32 address = P ? offset_address : reg_n;
+    const auto data_a = v.ir.ReadMemory32(address);
+    const auto data_b = v.ir.ReadMemory32(v.ir.Add(address, v.ir.Imm32(4)));
+
+    if (W) {
+        v.ir.SetRegister(n, offset_address);
+    }
+    v.ir.SetRegister(t, data_a);
+    v.ir.SetRegister(t2, data_b);
+    return true;
+}
+
+static bool STRDHelper(ThumbTranslatorVisitor& v, bool P, bool U, bool W, Reg n, Reg t, Reg t2, Imm<8> imm8) {
+    if (W && (n == t || n == t2)) {
+        return v.UnpredictableInstruction();
+    }
+    if (n == Reg::PC || IsBadReg(t) || IsBadReg(t2)) {
+        return v.UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm8.ZeroExtend() << 2;
+    const IR::U32 reg_n = v.ir.GetRegister(n);
+    const IR::U32 offset_address = U ? v.ir.Add(reg_n, v.ir.Imm32(imm32)) : v.ir.Sub(reg_n, v.ir.Imm32(imm32));
+    const IR::U32 address = P ? offset_address : reg_n;
+
+    v.ir.WriteMemory32(address, v.ir.GetRegister(t));
+    v.ir.WriteMemory32(v.ir.Add(address, v.ir.Imm32(4)), v.ir.GetRegister(t2));
+    if (W) {
+        v.ir.SetRegister(n, offset_address);
+    }
+    return true;
+}
+
+static bool LDRDLiteralHelper(ThumbTranslatorVisitor& v, bool U, bool W, Reg t, Reg t2, Imm<8> imm8) {
+    if (W || IsBadReg(t) || IsBadReg(t2) || t == t2) {
+        return v.UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm8.ZeroExtend() << 2;
+    const u32 base = v.ir.AlignPC(4);
+    const u32 address = U ? (base + imm32) : (base - imm32);
+
+    v.ir.SetRegister(t, v.ir.ReadMemory32(v.ir.Imm32(address)));
+    v.ir.SetRegister(t2, v.ir.ReadMemory32(v.ir.Imm32(address + 4)));
+    return true;
+}
+
+// STREX<c> <Rd>, <Rt>, [<Rn>{, #<imm>}]
+bool ThumbTranslatorVisitor::thumb32_STREX(Reg n, Reg t, Reg d, Imm<8> imm8) {
+    if (IsBadReg(d) || IsBadReg(t) || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    if (d == n || d == t) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm8.ZeroExtend() << 2));
+    const auto value = ir.GetRegister(t);
+    const auto passed = ir.ExclusiveWriteMemory32(address, value);
+    ir.SetRegister(d, passed);
+    return true;
+}
+
+// LDREX<c> <Rt>, [<Rn>{, #<imm>}]
+bool ThumbTranslatorVisitor::thumb32_LDREX(Reg n, Reg t, Imm<8> imm8) {
+    if (IsBadReg(t) || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm8.ZeroExtend() << 2));
+    ir.SetRegister(t, ir.ExclusiveReadMemory32(address));
+    return true;
+}
+
+// STRD<c> <Rt>, <Rt2>, [<Rn>], #+/-<imm>
+bool ThumbTranslatorVisitor::thumb32_STRD_imm_1(bool U, Reg n, Reg t, Reg t2, Imm<8> imm8) {
+    return STRDHelper(*this, false, U, true, n, t, t2, imm8);
+}
+
+// STRD<c> <Rt>, <Rt2>, [<Rn>{, #+/-<imm>}]{!}
+bool ThumbTranslatorVisitor::thumb32_STRD_imm_2(bool U, bool W, Reg n, Reg t, Reg t2, Imm<8> imm8) {
+    return STRDHelper(*this, true, U, W, n, t, t2, imm8);
+}
+
+// LDRD<c> <Rt>, <Rt2>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRD_lit_1(bool U, Reg t, Reg t2, Imm<8> imm8) {
+    return LDRDLiteralHelper(*this, U, true, t, t2, imm8);
+}
+
+// LDRD<c> <Rt>, <Rt2>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDRD_lit_2(bool U, bool W, Reg t, Reg t2, Imm<8> imm8) {
+    return LDRDLiteralHelper(*this, U, W, t, t2, imm8);
+}
+
+// LDRD<c> <Rt>, <Rt2>, [<Rn>], #+/-<imm>
+bool ThumbTranslatorVisitor::thumb32_LDRD_imm_1(bool U, Reg n, Reg t, Reg t2, Imm<8> imm8) {
+    return LDRDHelper(*this, false, U, true, n, t, t2, imm8);
+}
+
+// LDRD<c> <Rt>, <Rt2>, [<Rn>{, #+/-<imm>}]{!}
+bool ThumbTranslatorVisitor::thumb32_LDRD_imm_2(bool U, bool W, Reg n, Reg t, Reg t2, Imm<8> imm8) {
+    return LDRDHelper(*this, true, U, W, n, t, t2, imm8);
+}
+
+// STREXB<c> <Rd>, <Rt>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_STREXB(Reg n, Reg t, Reg d) {
+    if (IsBadReg(d) || IsBadReg(t) || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_STREXB, n, d, t);
+}
+
+// STREXH<c> <Rd>, <Rt>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_STREXH(Reg n, Reg t, Reg d) {
+    if (IsBadReg(d) || IsBadReg(t) || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_STREXH, n, d, t);
+}
+
+// STREXD<c> <Rd>, <Rt>, <Rt2>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_STREXD(Reg n, Reg t, Reg t2, Reg d) {
+    if (IsBadReg(d) || IsBadReg(t) || IsBadReg(t2) || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    if (d == n || d == t || d == t2) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.GetRegister(n);
+    const auto value_lo = ir.GetRegister(t);
+    const auto value_hi = ir.GetRegister(t2);
+    const auto passed = ir.ExclusiveWriteMemory64(address, value_lo, value_hi);
+    ir.SetRegister(d, passed);
+    return true;
+}
+
+// TBB<c> [<Rn>, <Rm>]
+bool ThumbTranslatorVisitor::thumb32_TBB(Reg n, Reg m) {
+    if (n == Reg::SP || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+    if (IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.GetRegister(m));
+    const auto halfwords = ir.ZeroExtendByteToWord(ir.ReadMemory8(address));
+    const auto branch_value = ir.Add(ir.Imm32(ir.PC()), ir.Add(halfwords, halfwords));
+
+    ir.BranchWritePC(branch_value);
+    ir.SetTerm(IR::Term::FastDispatchHint{});
+    return false;
+}
+
+// TBH<c> [<Rn>, <Rm>, LSL #1]
+bool ThumbTranslatorVisitor::thumb32_TBH(Reg n, Reg m) {
+    if (n == Reg::SP || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+    if (IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
+    const auto reg_m = ir.GetRegister(m);
+    const auto address = ir.Add(ir.GetRegister(n), ir.Add(reg_m, reg_m));
+    const auto halfwords = ir.ZeroExtendHalfToWord(ir.ReadMemory16(address));
+    const auto branch_value = ir.Add(ir.Imm32(ir.PC()), ir.Add(halfwords, halfwords));
+
+    ir.BranchWritePC(branch_value);
+    ir.SetTerm(IR::Term::FastDispatchHint{});
+    return false;
+}
+
+// LDREXB<c> <Rt>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_LDREXB(Reg n, Reg t) {
+    if (IsBadReg(t) || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_LDREXB, n, t);
+}
+
+// LDREXH<c> <Rt>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_LDREXH(Reg n, Reg t) {
+    if (IsBadReg(t) || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_LDREXH, n, t);
+}
+
+// LDREXD<c> <Rt>, <Rt2>, [<Rn>]
+bool ThumbTranslatorVisitor::thumb32_LDREXD(Reg n, Reg t, Reg t2) {
+    if (IsBadReg(t) || IsBadReg(t2) || t == t2 || n == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.GetRegister(n);
+    const auto [lo, hi] = ir.ExclusiveReadMemory64(address);
+    // DO NOT SWAP hi AND lo IN BIG ENDIAN MODE, THIS IS CORRECT BEHAVIOUR
+    ir.SetRegister(t, lo);
+    ir.SetRegister(t2, hi);
+    return true;
+}
+
+} // namespace Dynarmic::A32
@@ -0,0 +1,89 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "common/bit_util.h"
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool LDMChecks(const ThumbTranslatorVisitor& v, bool W, Reg n, RegList list) {
+    if (n == Reg::PC || Common::BitCount(list) < 2) {
+        return false;
+    }
+    if (Common::Bit<15>(list) && Common::Bit<14>(list)) {
+        return false;
+    }
+    if (Common::Bit<13>(list)) {
+        return false;
+    }
+    if (W && Common::Bit(static_cast<size_t>(n), list)) {
+        return false;
+    }
+    // A load to PC must be the last instruction of an IT block.
+    return !Common::Bit<15>(list) || !v.IsInITBlockButNotLast();
+}
+
+static bool STMChecks(bool W, Reg n, RegList list) {
+    if (n == Reg::PC || Common::BitCount(list) < 2) {
+        return false;
+    }
+    if (Common::Bit<13>(list)) {
+        return false;
+    }
+    if (W && Common::Bit(static_cast<size_t>(n), list)) {
+        return false;
+    }
+    return true;
+}
+
+// STM<c>.W <Rn>{!}, <registers>
+bool ThumbTranslatorVisitor::thumb32_STMIA(bool W, Reg n, Imm<15> reg_list) {
+    const RegList list = reg_list.ZeroExtend<RegList>();
+    if (!STMChecks(W, n, list)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_STM, W, n, list);
+}
+
+// POP<c>.W <registers>
+bool ThumbTranslatorVisitor::thumb32_POP(RegList reg_list) {
+    return thumb32_LDMIA(true, Reg::SP, reg_list);
+}
+
+// LDM<c>.W <Rn>{!}, <registers>
+bool ThumbTranslatorVisitor::thumb32_LDMIA(bool W, Reg n, RegList reg_list) {
+    if (!LDMChecks(*this, W, n, reg_list)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_LDM, W, n, reg_list);
+}
+
+// PUSH<c>.W <registers>
+bool ThumbTranslatorVisitor::thumb32_PUSH(Imm<15> reg_list) {
+    return thumb32_STMDB(true, Reg::SP, reg_list);
+}
+
+// STMDB<c> <Rn>{!}, <registers>
+bool ThumbTranslatorVisitor::thumb32_STMDB(bool W, Reg n, Imm<15> reg_list) {
+    const RegList list = reg_list.ZeroExtend<RegList>();
+    if (!STMChecks(W, n, list)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_STMDB, W, n, list);
+}
+
+// LDMDB<c> <Rn>{!}, <registers>
+bool ThumbTranslatorVisitor::thumb32_LDMDB(bool W, Reg n, RegList reg_list) {
+    if (!LDMChecks(*this, W, n, reg_list)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_LDMDB, W, n, reg_list);
+}
+
+} // namespace Dynarmic::A32
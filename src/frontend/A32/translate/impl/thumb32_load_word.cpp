@@ -0,0 +1,108 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool WriteRegisterOrPC(ThumbTranslatorVisitor& v, Reg t, const IR::U32& data, IR::Term::Terminal pc_terminal) {
+    if (t == Reg::PC) {
+        v.ir.LoadWritePC(data);
+        v.ir.SetTerm(pc_terminal);
+        return false;
+    }
+
+    v.ir.SetRegister(t, data);
+    return true;
+}
+
+// LDR<c>.W <Rt>, <label>
+bool ThumbTranslatorVisitor::thumb32_LDR_lit(bool U, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC && IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm12.ZeroExtend();
+    const u32 base = ir.AlignPC(4);
+    const u32 address = U ? (base + imm32) : (base - imm32);
+    const auto data = ir.ReadMemory32(ir.Imm32(address));
+
+    return WriteRegisterOrPC(*this, t, data, IR::Term::FastDispatchHint{});
+}
+
+// LDRT<c> <Rt>, [<Rn>, #<imm8>]
+bool ThumbTranslatorVisitor::thumb32_LDRT(Reg n, Reg t, Imm<8> imm8) {
+    // Unprivileged loads behave as ordinary loads in User mode.
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm8.ZeroExtend()));
+    ir.SetRegister(t, ir.ReadMemory32(address));
+    return true;
+}
+
+// LDR<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_LDR_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (m == Reg::PC || m == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    if (t == Reg::PC && IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
+    const auto reg_m = ir.GetRegister(m);
+    const auto shift_amount = ir.Imm8(static_cast<u8>(imm2.ZeroExtend()));
+    const auto offset = ir.LogicalShiftLeft(reg_m, shift_amount);
+    const auto address = ir.Add(ir.GetRegister(n), offset);
+    const auto data = ir.ReadMemory32(address);
+
+    return WriteRegisterOrPC(*this, t, data, IR::Term::FastDispatchHint{});
+}
+
+// LDR<c> <Rt>, [<Rn>, #-<imm8>]
+// LDR<c> <Rt>, [<Rn>], #+/-<imm8>
+// LDR<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_LDR_imm8(Reg n, Reg t, bool P, bool U, bool W, Imm<8> imm8) {
+    if (!P && !W) {
+        return UndefinedInstruction();
+    }
+    if (W && n == t) {
+        return UnpredictableInstruction();
+    }
+    if (t == Reg::PC && IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
+    const u32 imm32 = imm8.ZeroExtend();
+    const IR::U32 reg_n = ir.GetRegister(n);
+    const IR::U32 offset_address = U ? ir.Add(reg_n, ir.Imm32(imm32))
+                                  : ir.Sub(reg_n, ir.Imm32(imm32));
+    const IR::U32 address = P ? offset_address : reg_n;
+    const auto data = ir.ReadMemory32(address);
+
+    if (W) {
+        ir.SetRegister(n, offset_address);
+    }
+
+    if (!P && W && U && n == Reg::SP && t == Reg::PC) {
+        return WriteRegisterOrPC(*this, t, data, IR::Term::PopRSBHint{});
+    }
+    return WriteRegisterOrPC(*this, t, data, IR::Term::FastDispatchHint{});
+}
+
+// LDR<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_LDR_imm12(Reg n, Reg t, Imm<12> imm12) {
+    if (t == Reg::PC && IsInITBlockButNotLast()) {
+        return UnpredictableInstruction();
+    }
+
+    const auto address = ir.Add(ir.GetRegister(n), ir.Imm32(imm12.ZeroExtend()));
+    const auto data = ir.ReadMemory32(address);
+
+    return WriteRegisterOrPC(*this, t, data, IR::Term::FastDispatchHint{});
+}
+
+} // namespace Dynarmic::A32
@@ -0,0 +1,104 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool IsBadReg(Reg r) {
+    return r == Reg::SP || r == Reg::PC;
+}
+
+// SMULL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMULL(Reg n, Reg dLo, Reg dHi, Reg m) {
+    if (IsBadReg(dLo) || IsBadReg(dHi) || IsBadReg(n) || IsBadReg(m) || dHi == dLo) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMULL, false, dHi, dLo, m, n);
+}
+
+// SDIV<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SDIV(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SDIV, d, m, n);
+}
+
+// UMULL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UMULL(Reg n, Reg dLo, Reg dHi, Reg m) {
+    if (IsBadReg(dLo) || IsBadReg(dHi) || IsBadReg(n) || IsBadReg(m) || dHi == dLo) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UMULL, false, dHi, dLo, m, n);
+}
+
+// UDIV<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UDIV(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UDIV, d, m, n);
+}
+
+// SMLAL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMLAL(Reg n, Reg dLo, Reg dHi, Reg m) {
+    if (IsBadReg(dLo) || IsBadReg(dHi) || IsBadReg(n) || IsBadReg(m) || dHi == dLo) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMLAL, false, dHi, dLo, m, n);
+}
+
+// SMLAL<x><y><c> <RdLo>, <RdHi>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMLALXY(Reg n, Reg dLo, Reg dHi, bool N, bool M, Reg m) {
+    if (IsBadReg(dLo) || IsBadReg(dHi) || IsBadReg(n) || IsBadReg(m) || dHi == dLo) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMLALxy, dHi, dLo, m, M, N, n);
+}
+
+// SMLALD{X}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMLALD(Reg n, Reg dLo, Reg dHi, bool M, Reg m) {
+    if (IsBadReg(dLo) || IsBadReg(dHi) || IsBadReg(n) || IsBadReg(m) || dHi == dLo) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMLALD, dHi, dLo, m, M, n);
+}
+
+// SMLSLD{X}<c> <RdLo>, <RdHi>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMLSLD(Reg n, Reg dLo, Reg dHi, bool M, Reg m) {
+    if (IsBadReg(dLo) || IsBadReg(dHi) || IsBadReg(n) || IsBadReg(m) || dHi == dLo) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMLSLD, dHi, dLo, m, M, n);
+}
+
+// UMLAL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UMLAL(Reg n, Reg dLo, Reg dHi, Reg m) {
+    if (IsBadReg(dLo) || IsBadReg(dHi) || IsBadReg(n) || IsBadReg(m) || dHi == dLo) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UMLAL, false, dHi, dLo, m, n);
+}
+
+// UMAAL<c> <RdLo>, <RdHi>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UMAAL(Reg n, Reg dLo, Reg dHi, Reg m) {
+    if (IsBadReg(dLo) || IsBadReg(dHi) || IsBadReg(n) || IsBadReg(m) || dHi == dLo) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UMAAL, dHi, dLo, m, n);
+}
+
+} // namespace Dynarmic::A32
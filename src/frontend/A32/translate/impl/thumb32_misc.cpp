@@ -0,0 +1,104 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool IsBadReg(Reg r) {
+    return r == Reg::SP || r == Reg::PC;
+}
+
+// QADD<c> <Rd>, <Rm>, <Rn>
+bool ThumbTranslatorVisitor::thumb32_QADD(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QADD, n, d, m);
+}
+
+// QDADD<c> <Rd>, <Rm>, <Rn>
+bool ThumbTranslatorVisitor::thumb32_QDADD(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QDADD, n, d, m);
+}
+
+// QSUB<c> <Rd>, <Rm>, <Rn>
+bool ThumbTranslatorVisitor::thumb32_QSUB(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QSUB, n, d, m);
+}
+
+// QDSUB<c> <Rd>, <Rm>, <Rn>
+bool ThumbTranslatorVisitor::thumb32_QDSUB(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QDSUB, n, d, m);
+}
+
+// REV<c>.W <Rd>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_REV(Reg n, Reg d, Reg m) {
+    if (m != n || IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_REV, d, m);
+}
+
+// REV16<c>.W <Rd>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_REV16(Reg n, Reg d, Reg m) {
+    if (m != n || IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_REV16, d, m);
+}
+
+// RBIT<c> <Rd>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_RBIT(Reg n, Reg d, Reg m) {
+    if (m != n || IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_RBIT, d, m);
+}
+
+// REVSH<c>.W <Rd>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_REVSH(Reg n, Reg d, Reg m) {
+    if (m != n || IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_REVSH, d, m);
+}
+
+// SEL<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SEL(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SEL, n, d, m);
+}
+
+// CLZ<c> <Rd>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_CLZ(Reg n, Reg d, Reg m) {
+    if (m != n || IsBadReg(d) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_CLZ, d, m);
+}
+
+} // namespace Dynarmic::A32
@@ -0,0 +1,158 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool IsBadReg(Reg r) {
+    return r == Reg::SP || r == Reg::PC;
+}
+
+// MUL<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_MUL(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MUL, false, d, m, n);
+}
+
+// MLA<c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ThumbTranslatorVisitor::thumb32_MLA(Reg n, Reg a, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m) || IsBadReg(a)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MLA, false, d, a, m, n);
+}
+
+// MLS<c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ThumbTranslatorVisitor::thumb32_MLS(Reg n, Reg a, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m) || IsBadReg(a)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_MLS, d, a, m, n);
+}
+
+// SMUL<x><y><c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMULXY(Reg n, Reg d, bool N, bool M, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMULxy, d, m, M, N, n);
+}
+
+// SMLA<x><y><c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ThumbTranslatorVisitor::thumb32_SMLAXY(Reg n, Reg a, Reg d, bool N, bool M, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m) || IsBadReg(a)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMLAxy, d, a, m, M, N, n);
+}
+
+// SMUAD{X}<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMUAD(Reg n, Reg d, bool M, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMUAD, d, m, M, n);
+}
+
+// SMLAD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ThumbTranslatorVisitor::thumb32_SMLAD(Reg n, Reg a, Reg d, bool X, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m) || IsBadReg(a)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMLAD, d, a, m, X, n);
+}
+
+// SMULW<y><c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMULWY(Reg n, Reg d, bool M, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMULWy, d, m, M, n);
+}
+
+// SMLAW<y><c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ThumbTranslatorVisitor::thumb32_SMLAWY(Reg n, Reg a, Reg d, bool M, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m) || IsBadReg(a)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMLAWy, d, a, m, M, n);
+}
+
+// SMUSD{X}<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMUSD(Reg n, Reg d, bool M, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMUSD, d, m, M, n);
+}
+
+// SMLSD{X}<c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ThumbTranslatorVisitor::thumb32_SMLSD(Reg n, Reg a, Reg d, bool X, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m) || IsBadReg(a)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMLSD, d, a, m, X, n);
+}
+
+// SMMUL{R}<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SMMUL(Reg n, Reg d, bool R, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMMUL, d, m, R, n);
+}
+
+// SMMLA{R}<c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ThumbTranslatorVisitor::thumb32_SMMLA(Reg n, Reg a, Reg d, bool R, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m) || IsBadReg(a)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMMLA, d, a, m, R, n);
+}
+
+// SMMLS{R}<c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ThumbTranslatorVisitor::thumb32_SMMLS(Reg n, Reg a, Reg d, bool R, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m) || IsBadReg(a)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SMMLS, d, a, m, R, n);
+}
+
+// USAD8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_USAD8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_USAD8, d, m, n);
+}
+
+// USADA8<c> <Rd>, <Rn>, <Rm>, <Ra>
+bool ThumbTranslatorVisitor::thumb32_USADA8(Reg n, Reg a, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m) || IsBadReg(a)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_USADA8, d, a, m, n);
+}
+
+} // namespace Dynarmic::A32
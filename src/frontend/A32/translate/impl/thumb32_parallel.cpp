@@ -0,0 +1,338 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+static bool IsBadReg(Reg r) {
+    return r == Reg::SP || r == Reg::PC;
+}
+
+// SADD16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SADD16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SADD16, n, d, m);
+}
+
+// SASX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SASX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SASX, n, d, m);
+}
+
+// SSAX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SSAX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SSAX, n, d, m);
+}
+
+// SSUB16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SSUB16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SSUB16, n, d, m);
+}
+
+// SADD8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SADD8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SADD8, n, d, m);
+}
+
+// SSUB8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SSUB8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SSUB8, n, d, m);
+}
+
+// QADD16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_QADD16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QADD16, n, d, m);
+}
+
+// QASX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_QASX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QASX, n, d, m);
+}
+
+// QSAX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_QSAX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QSAX, n, d, m);
+}
+
+// QSUB16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_QSUB16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QSUB16, n, d, m);
+}
+
+// QADD8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_QADD8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QADD8, n, d, m);
+}
+
+// QSUB8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_QSUB8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_QSUB8, n, d, m);
+}
+
+// SHADD16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SHADD16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SHADD16, n, d, m);
+}
+
+// SHASX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SHASX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SHASX, n, d, m);
+}
+
+// SHSAX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SHSAX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SHSAX, n, d, m);
+}
+
+// SHSUB16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SHSUB16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SHSUB16, n, d, m);
+}
+
+// SHADD8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SHADD8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SHADD8, n, d, m);
+}
+
+// SHSUB8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_SHSUB8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_SHSUB8, n, d, m);
+}
+
+// UADD16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UADD16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UADD16, n, d, m);
+}
+
+// UASX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UASX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UASX, n, d, m);
+}
+
+// USAX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_USAX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_USAX, n, d, m);
+}
+
+// USUB16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_USUB16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_USUB16, n, d, m);
+}
+
+// UADD8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UADD8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UADD8, n, d, m);
+}
+
+// USUB8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_USUB8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_USUB8, n, d, m);
+}
+
+// UQADD16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UQADD16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UQADD16, n, d, m);
+}
+
+// UQASX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UQASX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UQASX, n, d, m);
+}
+
+// UQSAX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UQSAX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UQSAX, n, d, m);
+}
+
+// UQSUB16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UQSUB16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UQSUB16, n, d, m);
+}
+
+// UQADD8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UQADD8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UQADD8, n, d, m);
+}
+
+// UQSUB8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UQSUB8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UQSUB8, n, d, m);
+}
+
+// UHADD16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UHADD16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UHADD16, n, d, m);
+}
+
+// UHASX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UHASX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UHASX, n, d, m);
+}
+
+// UHSAX<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UHSAX(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UHSAX, n, d, m);
+}
+
+// UHSUB16<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UHSUB16(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UHSUB16, n, d, m);
+}
+
+// UHADD8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UHADD8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UHADD8, n, d, m);
+}
+
+// UHSUB8<c> <Rd>, <Rn>, <Rm>
+bool ThumbTranslatorVisitor::thumb32_UHSUB8(Reg n, Reg d, Reg m) {
+    if (IsBadReg(d) || IsBadReg(n) || IsBadReg(m)) {
+        return UnpredictableInstruction();
+    }
+
+    return TranslateAsArm(&ArmTranslatorVisitor::arm_UHSUB8, n, d, m);
+}
+
+} // namespace Dynarmic::A32
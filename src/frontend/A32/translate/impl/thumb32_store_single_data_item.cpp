@@ -0,0 +1,226 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A32/translate/impl/translate_thumb.h"
+
+namespace Dynarmic::A32 {
+
+template <typename StoreFn>
+static bool StoreImmediate(ThumbTranslatorVisitor& v, Reg n, Reg t, bool P, bool U, bool W, Imm<12> imm12, StoreFn store_fn) {
+    const u32 imm32 = imm12.ZeroExtend();
+    const IR::U32 reg_n = v.ir.GetRegister(n);
+    const auto reg_t = v.ir.GetRegister(t);
+    const IR::U32 offset_address = U ? v.ir.Add(reg_n, v.ir.Imm32(imm32))
+                                  : v.ir.Sub(reg_n, v.ir.Imm32(imm32));
+    const IR::U32 address = P ? offset_address : reg_n;
+
+    store_fn(address, reg_t);
+    if (W) {
+        v.ir.SetRegister(n, offset_address);
+    }
+    return true;
+}
+
+template <typename StoreFn>
+static bool StoreRegister(ThumbTranslatorVisitor& v, Reg n, Reg t, Imm<2> imm2, Reg m, StoreFn store_fn) {
+    if (n == Reg::PC) {
+        return v.UndefinedInstruction();
+    }
+    if (t == Reg::PC || m == Reg::PC || m == Reg::SP) {
+        return v.UnpredictableInstruction();
+    }
+
+    const auto reg_m = v.ir.GetRegister(m);
+    const IR::U32 reg_n = v.ir.GetRegister(n);
+    const auto reg_t = v.ir.GetRegister(t);
+    const auto shift_amount = v.ir.Imm8(static_cast<u8>(imm2.ZeroExtend()));
+    const auto offset = v.ir.LogicalShiftLeft(reg_m, shift_amount);
+    const auto address = v.ir.Add(reg_n, offset);
+
+    store_fn(address, reg_t);
+    return true;
+}
+
+static auto StoreByte(ThumbTranslatorVisitor& v) {
+    return [&v](const IR::U32& address, const IR::U32& data) {
+        v.ir.WriteMemory8(address, v.ir.LeastSignificantByte(data));
+    };
+}
+
+static auto StoreHalf(ThumbTranslatorVisitor& v) {
+    return [&v](const IR::U32& address, const IR::U32& data) {
+        v.ir.WriteMemory16(address, v.ir.LeastSignificantHalf(data));
+    };
+}
+
+static auto StoreWord(ThumbTranslatorVisitor& v) {
+    return [&v](const IR::U32& address, const IR::U32& data) {
+        v.ir.WriteMemory32(address, data);
+    };
+}
+
+// STRB<c> <Rt>, [<Rn>, #-<imm8>]
+// STRB<c> <Rt>, [<Rn>], #+/-<imm8>
+// STRB<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_STRB_imm_1(Reg n, Reg t, bool P, bool U, Imm<8> imm8) {
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP || n == t) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, P, U, true, Imm<12>{imm8.ZeroExtend()}, StoreByte(*this));
+}
+
+// STRB<c> <Rt>, [<Rn>, #-<imm8>]
+bool ThumbTranslatorVisitor::thumb32_STRB_imm_2(Reg n, Reg t, Imm<8> imm8) {
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, true, false, false, Imm<12>{imm8.ZeroExtend()}, StoreByte(*this));
+}
+
+// STRB<c>.W <Rt>, [<Rn>, #<imm12>]
+bool ThumbTranslatorVisitor::thumb32_STRB_imm_3(Reg n, Reg t, Imm<12> imm12) {
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, true, true, false, imm12, StoreByte(*this));
+}
+
+// STRBT<c> <Rt>, [<Rn>, #<imm8>]
+bool ThumbTranslatorVisitor::thumb32_STRBT(Reg n, Reg t, Imm<8> imm8) {
+    // Unprivileged stores behave as ordinary stores in User mode.
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, true, true, false, Imm<12>{imm8.ZeroExtend()}, StoreByte(*this));
+}
+
+// STRB<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_STRB_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return StoreRegister(*this, n, t, imm2, m, StoreByte(*this));
+}
+
+// STRH<c> <Rt>, [<Rn>, #-<imm8>]
+// STRH<c> <Rt>, [<Rn>], #+/-<imm8>
+// STRH<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_STRH_imm_1(Reg n, Reg t, bool P, bool U, Imm<8> imm8) {
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP || n == t) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, P, U, true, Imm<12>{imm8.ZeroExtend()}, StoreHalf(*this));
+}
+
+// STRH<c> <Rt>, [<Rn>, #-<imm8>]
+bool ThumbTranslatorVisitor::thumb32_STRH_imm_2(Reg n, Reg t, Imm<8> imm8) {
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, true, false, false, Imm<12>{imm8.ZeroExtend()}, StoreHalf(*this));
+}
+
+// STRH<c>.W <Rt>, [<Rn>{, #<imm12>}]
+bool ThumbTranslatorVisitor::thumb32_STRH_imm_3(Reg n, Reg t, Imm<12> imm12) {
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, true, true, false, imm12, StoreHalf(*this));
+}
+
+// STRHT<c> <Rt>, [<Rn>, #<imm8>]
+bool ThumbTranslatorVisitor::thumb32_STRHT(Reg n, Reg t, Imm<8> imm8) {
+    // Unprivileged stores behave as ordinary stores in User mode.
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, true, true, false, Imm<12>{imm8.ZeroExtend()}, StoreHalf(*this));
+}
+
+// STRH<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_STRH_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    if (t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return StoreRegister(*this, n, t, imm2, m, StoreHalf(*this));
+}
+
+// STR<c> <Rt>, [<Rn>, #-<imm8>]
+// STR<c> <Rt>, [<Rn>], #+/-<imm8>
+// STR<c> <Rt>, [<Rn>, #+/-<imm8>]!
+bool ThumbTranslatorVisitor::thumb32_STR_imm_1(Reg n, Reg t, bool P, bool U, Imm<8> imm8) {
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || n == t) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, P, U, true, Imm<12>{imm8.ZeroExtend()}, StoreWord(*this));
+}
+
+// STR<c> <Rt>, [<Rn>, #-<imm8>]
+bool ThumbTranslatorVisitor::thumb32_STR_imm_2(Reg n, Reg t, Imm<8> imm8) {
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, true, false, false, Imm<12>{imm8.ZeroExtend()}, StoreWord(*this));
+}
+
+// STR<c>.W <Rt>, [<Rn>, #<imm12>]
+bool ThumbTranslatorVisitor::thumb32_STR_imm_3(Reg n, Reg t, Imm<12> imm12) {
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, true, true, false, imm12, StoreWord(*this));
+}
+
+// STRT<c> <Rt>, [<Rn>, #<imm8>]
+bool ThumbTranslatorVisitor::thumb32_STRT(Reg n, Reg t, Imm<8> imm8) {
+    // Unprivileged stores behave as ordinary stores in User mode.
+    if (n == Reg::PC) {
+        return UndefinedInstruction();
+    }
+    if (t == Reg::PC || t == Reg::SP) {
+        return UnpredictableInstruction();
+    }
+    return StoreImmediate(*this, n, t, true, true, false, Imm<12>{imm8.ZeroExtend()}, StoreWord(*this));
+}
+
+// STR<c>.W <Rt>, [<Rn>, <Rm>{, LSL #<imm2>}]
+bool ThumbTranslatorVisitor::thumb32_STR_reg(Reg n, Reg t, Imm<2> imm2, Reg m) {
+    return StoreRegister(*this, n, t, imm2, m, StoreWord(*this));
+}
+
+} // namespace Dynarmic::A32
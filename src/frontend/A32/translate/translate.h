@@ -26,6 +26,11 @@ struct TranslationOptions {
     /// If this is false, we treat the instruction as a NOP.
     /// If this is true, we emit an ExceptionRaised instruction.
     bool hook_hint_instructions = true;
+
+    /// This allows the translator to continue translating at the target of an unconditional
+    /// direct branch in Arm mode, instead of ending the basic block at the branch.
+    /// The resulting block may then consist of multiple discontiguous ranges of guest code.
+    bool follow_direct_branches = false;
 };
 
 /**
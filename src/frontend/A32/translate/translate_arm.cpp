@@ -4,6 +4,8 @@
  */
 
 #include <algorithm>
+#include <optional>
+#include <utility>
 
 #include <dynarmic/A32/config.h>
 
@@ -19,21 +21,36 @@
 
 namespace Dynarmic::A32 {
 
-static bool CondCanContinue(ConditionalState cond_state, const A32::IREmitter& ir) {
-    ASSERT_MSG(cond_state != ConditionalState::Break, "Should never happen.");
-
-    if (cond_state == ConditionalState::None)
-        return true;
-
-    // TODO: This is more conservative than necessary.
-    return std::all_of(ir.block.begin(), ir.block.end(), [](const IR::Inst& inst) { return !inst.WritesToCPSR(); });
-}
+/// Upper bound on the number of branches followed while translating a single block.
+constexpr size_t max_followed_branches = 8;
 
 IR::Block TranslateArm(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options) {
+    ASSERT_MSG(!descriptor.TFlag(), "The processor must be in Arm mode");
+
     const bool single_step = descriptor.SingleStepping();
 
     IR::Block block{descriptor};
     ArmTranslatorVisitor visitor{block, descriptor, options};
+    if (single_step) {
+        visitor.options.follow_direct_branches = false;
+    }
+
+    LocationDescriptor range_start = descriptor;
+    size_t followed_branches = 0;
+
+    // Following a branch back into code already in this block would translate it again indefinitely.
+    const auto is_translated = [&](u32 pc) {
+        if (range_start.PC() <= pc && pc < visitor.ir.current_location.PC()) {
+            return true;
+        }
+        if (followed_branches == 0) {
+            return false;
+        }
+        const auto code_ranges = block.CodeRanges();
+        return std::any_of(code_ranges.begin(), code_ranges.end(), [pc](const auto& range) {
+            return LocationDescriptor{range.first}.PC() <= pc && pc < LocationDescriptor{range.second}.PC();
+        });
+    };
 
     bool should_continue = true;
     do {
@@ -56,6 +73,18 @@ IR::Block TranslateArm(LocationDescriptor descriptor, MemoryReadCodeFuncType mem
 
         visitor.ir.current_location = visitor.ir.current_location.AdvancePC(4);
         block.CycleCount()++;
+
+        if (const auto target = std::exchange(visitor.branch_to_follow, std::nullopt)) {
+            if (followed_branches < max_followed_branches && !is_translated(target->PC())) {
+                block.AddCodeRange(range_start, visitor.ir.current_location);
+                range_start = *target;
+                visitor.ir.current_location = *target;
+                followed_branches++;
+            } else {
+                visitor.ir.SetTerm(IR::Term::LinkBlock{*target});
+                should_continue = false;
+            }
+        }
     } while (should_continue && CondCanContinue(visitor.cond_state, visitor.ir) && !single_step);
 
     if (visitor.cond_state == ConditionalState::Translating || visitor.cond_state == ConditionalState::Trailing || single_step) {
@@ -71,6 +100,9 @@ IR::Block TranslateArm(LocationDescriptor descriptor, MemoryReadCodeFuncType mem
     ASSERT_MSG(block.HasTerminal(), "Terminal has not been set");
 
     block.SetEndLocation(visitor.ir.current_location);
+    if (followed_branches != 0) {
+        block.AddCodeRange(range_start, visitor.ir.current_location);
+    }
 
     return block;
 }
@@ -102,53 +134,13 @@ bool TranslateSingleArmInstruction(IR::Block& block, LocationDescriptor descript
 }
 
 bool ArmTranslatorVisitor::ConditionPassed(Cond cond) {
-    ASSERT_MSG(cond_state != ConditionalState::Break,
-               "This should never happen. We requested a break but that wasn't honored.");
     if (cond == Cond::NV) {
         // NV conditional is obsolete
         ir.ExceptionRaised(Exception::UnpredictableInstruction);
         return false;
     }
 
-    if (cond_state == ConditionalState::Translating) {
-        if (ir.block.ConditionFailedLocation() != ir.current_location || cond == Cond::AL) {
-            cond_state = ConditionalState::Trailing;
-        } else {
-            if (cond == ir.block.GetCondition()) {
-                ir.block.SetConditionFailedLocation(ir.current_location.AdvancePC(4));
-                ir.block.ConditionFailedCycleCount()++;
-                return true;
-            }
-
-            // cond has changed, abort
-            cond_state = ConditionalState::Break;
-            ir.SetTerm(IR::Term::LinkBlockFast{ir.current_location});
-            return false;
-        }
-    }
-
-    if (cond == Cond::AL) {
-        // Everything is fine with the world
-        return true;
-    }
-
-    // non-AL cond
-
-    if (!ir.block.empty()) {
-        // We've already emitted instructions. Quit for now, we'll make a new block here later.
-        cond_state = ConditionalState::Break;
-        ir.SetTerm(IR::Term::LinkBlockFast{ir.current_location});
-        return false;
-    }
-
-    // We've not emitted instructions yet.
-    // We'll emit one instruction, and set the block-entry conditional appropriately.
-
-    cond_state = ConditionalState::Translating;
-    ir.block.SetCondition(cond);
-    ir.block.SetConditionFailedLocation(ir.current_location.AdvancePC(4));
-    ir.block.ConditionFailedCycleCount() = ir.block.CycleCount() + 1;
-    return true;
+    return IsConditionPassed(cond, cond_state, ir, 4);
 }
 
 bool ArmTranslatorVisitor::InterpretThisInstruction() {
@@ -181,6 +173,17 @@ bool ArmTranslatorVisitor::RaiseException(Exception exception) {
     return false;
 }
 
+bool ArmTranslatorVisitor::LinkOrFollowBranch(LocationDescriptor target) {
+    // The block's entry condition would otherwise apply to the code at the branch target.
+    if (options.follow_direct_branches && cond_state == ConditionalState::None) {
+        branch_to_follow = target;
+        return true;
+    }
+
+    ir.SetTerm(IR::Term::LinkBlock{target});
+    return false;
+}
+
 IR::UAny ArmTranslatorVisitor::I(size_t bitsize, u64 value) {
     switch (bitsize) {
     case 8:
@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <optional>
 #include <tuple>
 
 #include <dynarmic/A32/config.h>
@@ -10,10 +11,13 @@
 #include "common/assert.h"
 #include "common/bit_util.h"
 #include "frontend/imm.h"
+#include "frontend/A32/decoder/asimd.h"
 #include "frontend/A32/decoder/thumb16.h"
 #include "frontend/A32/decoder/thumb32.h"
+#include "frontend/A32/decoder/vfp.h"
 #include "frontend/A32/ir_emitter.h"
 #include "frontend/A32/location_descriptor.h"
+#include "frontend/A32/translate/impl/translate_arm.h"
 #include "frontend/A32/translate/impl/translate_thumb.h"
 #include "frontend/A32/translate/translate.h"
 
@@ -25,7 +29,7 @@ enum class ThumbInstSize {
 };
 
 bool IsThumb16(u16 first_part) {
-    return (first_part & 0xF800) <= 0xE800;
+    return (first_part & 0xF800) < 0xE800;
 }
 
 std::tuple<u32, ThumbInstSize> ReadThumbInstruction(u32 arm_pc, MemoryReadCodeFuncType memory_read_code) {
@@ -52,6 +56,71 @@ std::tuple<u32, ThumbInstSize> ReadThumbInstruction(u32 arm_pc, MemoryReadCodeFu
     return std::make_tuple(static_cast<u32>((first_part << 16) | second_part), ThumbInstSize::Thumb32);
 }
 
+/// Instructions which are executed regardless of the condition of the IT block they are in.
+bool IsUnconditionalInstruction(bool is_thumb_16, u32 instruction) {
+    if (!is_thumb_16) {
+        return false;
+    }
+    if ((instruction & 0xFF00) == 0b10111110'00000000) { // BKPT
+        return true;
+    }
+    return false;
+}
+
+/// T32 Advanced SIMD instructions share their A32 encodings apart from the top byte.
+std::optional<u32> ConvertASIMDInstruction(u32 thumb_instruction) {
+    if ((thumb_instruction & 0xEF000000) == 0xEF000000) {
+        // Data-processing instructions: 111U1111 -> 1111001U
+        const bool U = Common::Bit<28>(thumb_instruction);
+        return 0xF2000000 | (U << 24) | (thumb_instruction & 0x00FFFFFF);
+    }
+    if ((thumb_instruction & 0xFF100000) == 0xF9000000) {
+        // Element and structure load/store instructions: 11111001 -> 11110100
+        return 0xF4000000 | (thumb_instruction & 0x00FFFFFF);
+    }
+    return std::nullopt;
+}
+
+/// VFP and Advanced SIMD instructions are shared with the A32 translator.
+std::optional<bool> TranslateThumbVFPOrASIMD(ThumbTranslatorVisitor& visitor, u32 thumb_instruction) {
+    // Apart from the condition field, VFP instructions share their A32 encodings.
+    // The condition field is AL (0b1110) or unconditional (0b1111).
+    if ((thumb_instruction & 0xEC000000) == 0xEC000000) {
+        if (const auto vfp_decoder = DecodeVFP<ArmTranslatorVisitor>(thumb_instruction)) {
+            ArmTranslatorVisitor arm_visitor{visitor.ir.block, visitor.ir.current_location, visitor.options};
+            return vfp_decoder->get().call(arm_visitor, thumb_instruction);
+        }
+    }
+
+    if (const auto arm_instruction = ConvertASIMDInstruction(thumb_instruction)) {
+        if (const auto asimd_decoder = DecodeASIMD<ArmTranslatorVisitor>(*arm_instruction)) {
+            ArmTranslatorVisitor arm_visitor{visitor.ir.block, visitor.ir.current_location, visitor.options};
+            return asimd_decoder->get().call(arm_visitor, *arm_instruction);
+        }
+    }
+
+    return std::nullopt;
+}
+
+bool TranslateThumbInstruction(ThumbTranslatorVisitor& visitor, u32 thumb_instruction, ThumbInstSize inst_size) {
+    visitor.current_instruction_size = inst_size == ThumbInstSize::Thumb16 ? 2 : 4;
+
+    if (inst_size == ThumbInstSize::Thumb16) {
+        if (const auto decoder = DecodeThumb16<ThumbTranslatorVisitor>(static_cast<u16>(thumb_instruction))) {
+            return decoder->get().call(visitor, static_cast<u16>(thumb_instruction));
+        }
+        return visitor.thumb16_UDF();
+    }
+
+    if (const auto result = TranslateThumbVFPOrASIMD(visitor, thumb_instruction)) {
+        return *result;
+    }
+    if (const auto decoder = DecodeThumb32<ThumbTranslatorVisitor>(thumb_instruction)) {
+        return decoder->get().call(visitor, thumb_instruction);
+    }
+    return visitor.thumb32_UDF();
+}
+
 } // local namespace
 
 IR::Block TranslateThumb(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, const TranslationOptions& options) {
@@ -64,30 +133,33 @@ IR::Block TranslateThumb(LocationDescriptor descriptor, MemoryReadCodeFuncType m
     do {
         const u32 arm_pc = visitor.ir.current_location.PC();
         const auto [thumb_instruction, inst_size] = ReadThumbInstruction(arm_pc, memory_read_code);
+        const bool is_thumb_16 = inst_size == ThumbInstSize::Thumb16;
 
-        if (inst_size == ThumbInstSize::Thumb16) {
-            if (const auto decoder = DecodeThumb16<ThumbTranslatorVisitor>(static_cast<u16>(thumb_instruction))) {
-                should_continue = decoder->get().call(visitor, static_cast<u16>(thumb_instruction));
-            } else {
-                should_continue = visitor.thumb16_UDF();
-            }
-        } else {
-            if (const auto decoder = DecodeThumb32<ThumbTranslatorVisitor>(thumb_instruction)) {
-                should_continue = decoder->get().call(visitor, thumb_instruction);
-            } else {
-                should_continue = visitor.thumb32_UDF();
-            }
+        if (IsUnconditionalInstruction(is_thumb_16, thumb_instruction) || visitor.ConditionPassed(is_thumb_16)) {
+            should_continue = TranslateThumbInstruction(visitor, thumb_instruction, inst_size);
         }
 
-        const s32 advance_pc = (inst_size == ThumbInstSize::Thumb16) ? 2 : 4;
-        visitor.ir.current_location = visitor.ir.current_location.AdvancePC(advance_pc);
+        if (visitor.cond_state == ConditionalState::Break) {
+            break;
+        }
+
+        const s32 advance_pc = is_thumb_16 ? 2 : 4;
+        visitor.ir.current_location = visitor.ir.current_location.AdvancePC(advance_pc).AdvanceIT();
         block.CycleCount()++;
-    } while (should_continue && !single_step);
+    } while (should_continue && CondCanContinue(visitor.cond_state, visitor.ir) && !single_step);
 
-    if (single_step && should_continue) {
-        visitor.ir.SetTerm(IR::Term::LinkBlock{visitor.ir.current_location});
+    if (visitor.cond_state == ConditionalState::Translating || visitor.cond_state == ConditionalState::Trailing || single_step) {
+        if (should_continue) {
+            if (single_step) {
+                visitor.ir.SetTerm(IR::Term::LinkBlock{visitor.ir.current_location});
+            } else {
+                visitor.ir.SetTerm(IR::Term::LinkBlockFast{visitor.ir.current_location});
+            }
+        }
     }
 
+    ASSERT_MSG(block.HasTerminal(), "Terminal has not been set");
+
     block.SetEndLocation(visitor.ir.current_location);
 
     return block;
@@ -97,23 +169,13 @@ bool TranslateSingleThumbInstruction(IR::Block& block, LocationDescriptor descri
     ThumbTranslatorVisitor visitor{block, descriptor, {}};
 
     const bool is_thumb_16 = IsThumb16(static_cast<u16>(thumb_instruction));
-    bool should_continue = true;
-    if (is_thumb_16) {
-        if (const auto decoder = DecodeThumb16<ThumbTranslatorVisitor>(static_cast<u16>(thumb_instruction))) {
-            should_continue = decoder->get().call(visitor, static_cast<u16>(thumb_instruction));
-        } else {
-            should_continue = visitor.thumb16_UDF();
-        }
-    } else {
-        if (const auto decoder = DecodeThumb32<ThumbTranslatorVisitor>(thumb_instruction)) {
-            should_continue = decoder->get().call(visitor, thumb_instruction);
-        } else {
-            should_continue = visitor.thumb32_UDF();
-        }
-    }
+    const auto inst_size = is_thumb_16 ? ThumbInstSize::Thumb16 : ThumbInstSize::Thumb32;
+
+    // TODO: Proper cond handling
+    const bool should_continue = TranslateThumbInstruction(visitor, thumb_instruction, inst_size);
 
     const s32 advance_pc = is_thumb_16 ? 2 : 4;
-    visitor.ir.current_location = visitor.ir.current_location.AdvancePC(advance_pc);
+    visitor.ir.current_location = visitor.ir.current_location.AdvancePC(advance_pc).AdvanceIT();
     block.CycleCount()++;
 
     block.SetEndLocation(visitor.ir.current_location);
@@ -121,6 +183,42 @@ bool TranslateSingleThumbInstruction(IR::Block& block, LocationDescriptor descri
     return should_continue;
 }
 
+bool ThumbTranslatorVisitor::ConditionPassed(bool is_thumb16) {
+    const auto it = ir.current_location.IT();
+    const Cond cond = it.IsInITBlock() ? it.Cond() : Cond::AL;
+    return IsConditionPassed(cond, cond_state, ir, is_thumb16 ? 2 : 4);
+}
+
+IR::ResultAndCarry<IR::U32> ThumbTranslatorVisitor::EmitImmShift(IR::U32 value, ShiftType type, Imm<5> imm5, IR::U1 carry_in) {
+    u8 imm5_value = imm5.ZeroExtend<u8>();
+    switch (type) {
+    case ShiftType::LSL:
+        return ir.LogicalShiftLeft(value, ir.Imm8(imm5_value), carry_in);
+    case ShiftType::LSR:
+        imm5_value = imm5_value ? imm5_value : 32;
+        return ir.LogicalShiftRight(value, ir.Imm8(imm5_value), carry_in);
+    case ShiftType::ASR:
+        imm5_value = imm5_value ? imm5_value : 32;
+        return ir.ArithmeticShiftRight(value, ir.Imm8(imm5_value), carry_in);
+    case ShiftType::ROR:
+        if (imm5_value) {
+            return ir.RotateRight(value, ir.Imm8(imm5_value), carry_in);
+        } else {
+            return ir.RotateRightExtended(value, carry_in);
+        }
+    }
+    UNREACHABLE();
+}
+
+LocationDescriptor ThumbTranslatorVisitor::WriteNextLocation() {
+    const auto next_location = ir.current_location.AdvancePC(static_cast<int>(current_instruction_size)).AdvanceIT();
+    ir.BranchWritePC(ir.Imm32(next_location.PC()));
+    if (ir.current_location.IT().IsInITBlock()) {
+        ir.SetITState(ir.Imm8(next_location.IT().Value()));
+    }
+    return next_location;
+}
+
 bool ThumbTranslatorVisitor::InterpretThisInstruction() {
     ir.SetTerm(IR::Term::Interpret(ir.current_location));
     return false;
@@ -139,7 +237,7 @@ bool ThumbTranslatorVisitor::UndefinedInstruction() {
 }
 
 bool ThumbTranslatorVisitor::RaiseException(Exception exception) {
-    ir.BranchWritePC(ir.Imm32(ir.current_location.PC() + 2)); // TODO: T32
+    WriteNextLocation();
     ir.ExceptionRaised(exception);
     ir.SetTerm(IR::Term::CheckHalt{IR::Term::ReturnToDispatch{}});
     return false;
@@ -12,6 +12,7 @@
 #include "common/common_types.h"
 #include "frontend/A64/location_descriptor.h"
 #include "frontend/A64/types.h"
+#include "frontend/ir/atomic_op.h"
 #include "frontend/ir/ir_emitter.h"
 #include "frontend/ir/value.h"
 
@@ -74,6 +75,15 @@ public:
     IR::U32 ExclusiveWriteMemory32(const IR::U64& vaddr, const IR::U32& value);
     IR::U32 ExclusiveWriteMemory64(const IR::U64& vaddr, const IR::U64& value);
     IR::U32 ExclusiveWriteMemory128(const IR::U64& vaddr, const IR::U128& value);
+    IR::U8 AtomicMemoryOperation8(const IR::U64& vaddr, const IR::U8& value, IR::AtomicOp op);
+    IR::U16 AtomicMemoryOperation16(const IR::U64& vaddr, const IR::U16& value, IR::AtomicOp op);
+    IR::U32 AtomicMemoryOperation32(const IR::U64& vaddr, const IR::U32& value, IR::AtomicOp op);
+    IR::U64 AtomicMemoryOperation64(const IR::U64& vaddr, const IR::U64& value, IR::AtomicOp op);
+    IR::U8 CompareAndSwapMemory8(const IR::U64& vaddr, const IR::U8& expected, const IR::U8& desired);
+    IR::U16 CompareAndSwapMemory16(const IR::U64& vaddr, const IR::U16& expected, const IR::U16& desired);
+    IR::U32 CompareAndSwapMemory32(const IR::U64& vaddr, const IR::U32& expected, const IR::U32& desired);
+    IR::U64 CompareAndSwapMemory64(const IR::U64& vaddr, const IR::U64& expected, const IR::U64& desired);
+    IR::U128 CompareAndSwapMemory128(const IR::U64& vaddr, const IR::U128& expected, const IR::U128& desired);
 
     IR::U32 GetW(Reg source_reg);
     IR::U64 GetX(Reg source_reg);
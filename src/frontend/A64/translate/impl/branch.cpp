@@ -21,8 +21,7 @@ bool TranslatorVisitor::B_uncond(Imm<26> imm26) {
     const s64 offset = concatenate(imm26, Imm<2>{0}).SignExtend<s64>();
     const u64 target = ir.PC() + offset;
 
-    ir.SetTerm(IR::Term::LinkBlock{ir.current_location->SetPC(target)});
-    return false;
+    return LinkOrFollowBranch(ir.current_location->SetPC(target));
 }
 
 bool TranslatorVisitor::BL(Imm<26> imm26) {
@@ -32,8 +31,7 @@ bool TranslatorVisitor::BL(Imm<26> imm26) {
     ir.PushRSB(ir.current_location->AdvancePC(4));
 
     const u64 target = ir.PC() + offset;
-    ir.SetTerm(IR::Term::LinkBlock{ir.current_location->SetPC(target)});
-    return false;
+    return LinkOrFollowBranch(ir.current_location->SetPC(target));
 }
 
 bool TranslatorVisitor::BLR(Reg Rn) {
@@ -9,14 +9,14 @@ namespace Dynarmic::A64 {
 
 bool TranslatorVisitor::FMUL_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
     const auto datasize = FPGetDataSize(type);
-    if (!datasize || *datasize == 16) {
+    if (!datasize) {
         return UnallocatedEncoding();
     }
 
-    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
-    const IR::U32U64 operand2 = V_scalar(*datasize, Vm);
+    const IR::U16U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U16U32U64 operand2 = V_scalar(*datasize, Vm);
 
-    const IR::U32U64 result = ir.FPMul(operand1, operand2);
+    const IR::U16U32U64 result = ir.FPMul(operand1, operand2);
 
     V_scalar(*datasize, Vd, result);
     return true;
@@ -24,14 +24,14 @@ bool TranslatorVisitor::FMUL_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
 
 bool TranslatorVisitor::FDIV_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
     const auto datasize = FPGetDataSize(type);
-    if (!datasize || *datasize == 16) {
+    if (!datasize) {
         return UnallocatedEncoding();
     }
 
-    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
-    const IR::U32U64 operand2 = V_scalar(*datasize, Vm);
+    const IR::U16U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U16U32U64 operand2 = V_scalar(*datasize, Vm);
 
-    const IR::U32U64 result = ir.FPDiv(operand1, operand2);
+    const IR::U16U32U64 result = ir.FPDiv(operand1, operand2);
 
     V_scalar(*datasize, Vd, result);
     return true;
@@ -39,14 +39,14 @@ bool TranslatorVisitor::FDIV_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
 
 bool TranslatorVisitor::FADD_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
     const auto datasize = FPGetDataSize(type);
-    if (!datasize || *datasize == 16) {
+    if (!datasize) {
         return UnallocatedEncoding();
     }
 
-    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
-    const IR::U32U64 operand2 = V_scalar(*datasize, Vm);
+    const IR::U16U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U16U32U64 operand2 = V_scalar(*datasize, Vm);
 
-    const IR::U32U64 result = ir.FPAdd(operand1, operand2);
+    const IR::U16U32U64 result = ir.FPAdd(operand1, operand2);
 
     V_scalar(*datasize, Vd, result);
     return true;
@@ -54,14 +54,14 @@ bool TranslatorVisitor::FADD_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
 
 bool TranslatorVisitor::FSUB_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
     const auto datasize = FPGetDataSize(type);
-    if (!datasize || *datasize == 16) {
+    if (!datasize) {
         return UnallocatedEncoding();
     }
 
-    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
-    const IR::U32U64 operand2 = V_scalar(*datasize, Vm);
+    const IR::U16U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U16U32U64 operand2 = V_scalar(*datasize, Vm);
 
-    const IR::U32U64 result = ir.FPSub(operand1, operand2);
+    const IR::U16U32U64 result = ir.FPSub(operand1, operand2);
 
     V_scalar(*datasize, Vd, result);
     return true;
@@ -69,14 +69,14 @@ bool TranslatorVisitor::FSUB_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
 
 bool TranslatorVisitor::FMAX_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
     const auto datasize = FPGetDataSize(type);
-    if (!datasize || *datasize == 16) {
+    if (!datasize) {
         return UnallocatedEncoding();
     }
 
-    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
-    const IR::U32U64 operand2 = V_scalar(*datasize, Vm);
+    const IR::U16U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U16U32U64 operand2 = V_scalar(*datasize, Vm);
 
-    const IR::U32U64 result = ir.FPMax(operand1, operand2);
+    const IR::U16U32U64 result = ir.FPMax(operand1, operand2);
 
     V_scalar(*datasize, Vd, result);
     return true;
@@ -84,14 +84,14 @@ bool TranslatorVisitor::FMAX_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
 
 bool TranslatorVisitor::FMIN_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
     const auto datasize = FPGetDataSize(type);
-    if (!datasize || *datasize == 16) {
+    if (!datasize) {
         return UnallocatedEncoding();
     }
 
-    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
-    const IR::U32U64 operand2 = V_scalar(*datasize, Vm);
+    const IR::U16U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U16U32U64 operand2 = V_scalar(*datasize, Vm);
 
-    const IR::U32U64 result = ir.FPMin(operand1, operand2);
+    const IR::U16U32U64 result = ir.FPMin(operand1, operand2);
 
     V_scalar(*datasize, Vd, result);
     return true;
@@ -99,14 +99,14 @@ bool TranslatorVisitor::FMIN_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
 
 bool TranslatorVisitor::FMAXNM_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
     const auto datasize = FPGetDataSize(type);
-    if (!datasize || *datasize == 16) {
+    if (!datasize) {
         return UnallocatedEncoding();
     }
 
-    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
-    const IR::U32U64 operand2 = V_scalar(*datasize, Vm);
+    const IR::U16U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U16U32U64 operand2 = V_scalar(*datasize, Vm);
 
-    const IR::U32U64 result = ir.FPMaxNumeric(operand1, operand2);
+    const IR::U16U32U64 result = ir.FPMaxNumeric(operand1, operand2);
 
     V_scalar(*datasize, Vd, result);
     return true;
@@ -114,14 +114,14 @@ bool TranslatorVisitor::FMAXNM_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
 
 bool TranslatorVisitor::FMINNM_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
     const auto datasize = FPGetDataSize(type);
-    if (!datasize || *datasize == 16) {
+    if (!datasize) {
         return UnallocatedEncoding();
     }
 
-    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
-    const IR::U32U64 operand2 = V_scalar(*datasize, Vm);
+    const IR::U16U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U16U32U64 operand2 = V_scalar(*datasize, Vm);
 
-    const IR::U32U64 result = ir.FPMinNumeric(operand1, operand2);
+    const IR::U16U32U64 result = ir.FPMinNumeric(operand1, operand2);
 
     V_scalar(*datasize, Vd, result);
     return true;
@@ -129,14 +129,14 @@ bool TranslatorVisitor::FMINNM_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
 
 bool TranslatorVisitor::FNMUL_float(Imm<2> type, Vec Vm, Vec Vn, Vec Vd) {
     const auto datasize = FPGetDataSize(type);
-    if (!datasize || *datasize == 16) {
+    if (!datasize) {
         return UnallocatedEncoding();
     }
 
-    const IR::U32U64 operand1 = V_scalar(*datasize, Vn);
-    const IR::U32U64 operand2 = V_scalar(*datasize, Vm);
+    const IR::U16U32U64 operand1 = V_scalar(*datasize, Vn);
+    const IR::U16U32U64 operand2 = V_scalar(*datasize, Vm);
 
-    const IR::U32U64 result = ir.FPNeg(ir.FPMul(operand1, operand2));
+    const IR::U16U32U64 result = ir.FPNeg(ir.FPMul(operand1, operand2));
 
     V_scalar(*datasize, Vd, result);
     return true;
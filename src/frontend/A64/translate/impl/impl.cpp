@@ -37,6 +37,16 @@ bool TranslatorVisitor::RaiseException(Exception exception) {
     return false;
 }
 
+bool TranslatorVisitor::LinkOrFollowBranch(LocationDescriptor target) {
+    if (options.follow_direct_branches) {
+        branch_to_follow = target;
+        return true;
+    }
+
+    ir.SetTerm(IR::Term::LinkBlock{target});
+    return false;
+}
+
 std::optional<TranslatorVisitor::BitMasks> TranslatorVisitor::DecodeBitMasks(bool immN, Imm<6> imms, Imm<6> immr, bool immediate) {
     const int len = Common::HighestSetBit((immN ? 1 << 6 : 0) | (imms.ZeroExtend() ^ 0b111111));
     if (len < 1) {
@@ -289,6 +299,38 @@ IR::U32 TranslatorVisitor::ExclusiveMem(IR::U64 address, size_t bytesize, IR::Ac
     }
 }
 
+IR::UAny TranslatorVisitor::AtomicMem(IR::U64 address, size_t bytesize, IR::AccType /*acctype*/, IR::AtomicOp op, IR::UAny value) {
+    switch (bytesize) {
+    case 1:
+        return ir.AtomicMemoryOperation8(address, value, op);
+    case 2:
+        return ir.AtomicMemoryOperation16(address, value, op);
+    case 4:
+        return ir.AtomicMemoryOperation32(address, value, op);
+    case 8:
+        return ir.AtomicMemoryOperation64(address, value, op);
+    default:
+        ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+    }
+}
+
+IR::UAnyU128 TranslatorVisitor::CompareAndSwapMem(IR::U64 address, size_t bytesize, IR::AccType /*acctype*/, IR::UAnyU128 expected, IR::UAnyU128 desired) {
+    switch (bytesize) {
+    case 1:
+        return ir.CompareAndSwapMemory8(address, expected, desired);
+    case 2:
+        return ir.CompareAndSwapMemory16(address, expected, desired);
+    case 4:
+        return ir.CompareAndSwapMemory32(address, expected, desired);
+    case 8:
+        return ir.CompareAndSwapMemory64(address, expected, desired);
+    case 16:
+        return ir.CompareAndSwapMemory128(address, expected, desired);
+    default:
+        ASSERT_FALSE("Invalid bytesize parameter {}", bytesize);
+    }
+}
+
 IR::U32U64 TranslatorVisitor::SignExtend(IR::UAny value, size_t to_size) {
     switch (to_size) {
     case 32:
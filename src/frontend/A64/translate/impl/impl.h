@@ -22,6 +22,9 @@ struct TranslatorVisitor final {
 
     A64::IREmitter ir;
     TranslationOptions options;
+    /// Set by an unconditional direct branch when translation may continue at its target.
+    /// If translation does not continue there, the translator links to it instead.
+    std::optional<LocationDescriptor> branch_to_follow;
 
     bool InterpretThisInstruction();
     bool UnpredictableInstruction();
@@ -29,6 +32,7 @@ struct TranslatorVisitor final {
     bool ReservedValue();
     bool UnallocatedEncoding();
     bool RaiseException(Exception exception);
+    bool LinkOrFollowBranch(LocationDescriptor target);
 
     struct BitMasks {
         u64 wmask, tmask;
@@ -58,6 +62,8 @@ struct TranslatorVisitor final {
     void Mem(IR::U64 address, size_t size, IR::AccType acctype, IR::UAnyU128 value);
     IR::UAnyU128 ExclusiveMem(IR::U64 address, size_t size, IR::AccType acctype);
     IR::U32 ExclusiveMem(IR::U64 address, size_t size, IR::AccType acctype, IR::UAnyU128 value);
+    IR::UAny AtomicMem(IR::U64 address, size_t size, IR::AccType acctype, IR::AtomicOp op, IR::UAny value);
+    IR::UAnyU128 CompareAndSwapMem(IR::U64 address, size_t size, IR::AccType acctype, IR::UAnyU128 expected, IR::UAnyU128 desired);
 
     IR::U32U64 SignExtend(IR::UAny value, size_t to_size);
     IR::U32U64 ZeroExtend(IR::UAny value, size_t to_size);
@@ -307,16 +313,16 @@ struct TranslatorVisitor final {
     bool LDUMINH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
     bool SWPH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
     bool LDAPRH(Reg Rn, Reg Rt);
-    bool LDADD(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDCLR(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDEOR(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSET(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMAX(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDSMIN(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMAX(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDUMIN(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool SWP(bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
-    bool LDAPR(Reg Rn, Reg Rt);
+    bool LDADD(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDCLR(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDEOR(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDSET(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDSMAX(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDSMIN(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDUMAX(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDUMIN(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool SWP(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt);
+    bool LDAPR(bool sz, Reg Rn, Reg Rt);
 
     // Loads and stores - Load/Store register (register offset)
     bool STRx_reg(Imm<2> size, Imm<1> opc_1, Reg Rm, Imm<3> option, bool S, Reg Rn, Reg Rt);
@@ -585,9 +591,9 @@ struct TranslatorVisitor final {
     bool FMINP_pair_2(bool sz, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD Scalar three different
-    bool SQDMLAL_vec_1(Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SQDMLSL_vec_1(Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
-    bool SQDMULL_vec_1(Imm<2> size, Reg Rm, Reg Rn, Vec Vd);
+    bool SQDMLAL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SQDMLSL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
+    bool SQDMULL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
 
     // Data Processing - FP and SIMD - SIMD Scalar three same
     bool SQADD_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd);
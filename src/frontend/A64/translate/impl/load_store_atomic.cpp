@@ -0,0 +1,167 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic::A64 {
+
+static bool AtomicMemoryOperation(TranslatorVisitor& v, size_t size, bool A, bool R, IR::AtomicOp op, Reg Rs, Reg Rn, Reg Rt) {
+    const auto acctype = A || R ? IR::AccType::ORDEREDRW : IR::AccType::ATOMIC;
+    const size_t datasize = 8 << size;
+    const size_t regsize = datasize == 64 ? 64 : 32;
+
+    IR::U64 address;
+    if (Rn == Reg::SP) {
+        // TODO: Check SP Alignment
+        address = v.SP(64);
+    } else {
+        address = v.X(64, Rn);
+    }
+
+    const IR::UAny value = v.X(datasize, Rs);
+    const IR::UAny data = v.AtomicMem(address, datasize / 8, acctype, op, value);
+    v.X(regsize, Rt, v.ZeroExtend(data, regsize));
+    return true;
+}
+
+bool TranslatorVisitor::LDADDB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 0, A, R, IR::AtomicOp::Add, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDADDH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 1, A, R, IR::AtomicOp::Add, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDADD(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz ? 3 : 2, A, R, IR::AtomicOp::Add, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDCLRB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 0, A, R, IR::AtomicOp::Clear, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDCLRH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 1, A, R, IR::AtomicOp::Clear, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDCLR(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz ? 3 : 2, A, R, IR::AtomicOp::Clear, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDEORB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 0, A, R, IR::AtomicOp::Eor, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDEORH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 1, A, R, IR::AtomicOp::Eor, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDEOR(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz ? 3 : 2, A, R, IR::AtomicOp::Eor, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSETB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 0, A, R, IR::AtomicOp::Set, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSETH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 1, A, R, IR::AtomicOp::Set, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSET(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz ? 3 : 2, A, R, IR::AtomicOp::Set, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMAXB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 0, A, R, IR::AtomicOp::SMax, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMAXH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 1, A, R, IR::AtomicOp::SMax, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMAX(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz ? 3 : 2, A, R, IR::AtomicOp::SMax, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMINB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 0, A, R, IR::AtomicOp::SMin, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMINH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 1, A, R, IR::AtomicOp::SMin, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDSMIN(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz ? 3 : 2, A, R, IR::AtomicOp::SMin, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMAXB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 0, A, R, IR::AtomicOp::UMax, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMAXH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 1, A, R, IR::AtomicOp::UMax, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMAX(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz ? 3 : 2, A, R, IR::AtomicOp::UMax, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMINB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 0, A, R, IR::AtomicOp::UMin, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMINH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 1, A, R, IR::AtomicOp::UMin, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDUMIN(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz ? 3 : 2, A, R, IR::AtomicOp::UMin, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::SWPB(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 0, A, R, IR::AtomicOp::Swap, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::SWPH(bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, 1, A, R, IR::AtomicOp::Swap, Rs, Rn, Rt);
+}
+
+bool TranslatorVisitor::SWP(bool sz, bool A, bool R, Reg Rs, Reg Rn, Reg Rt) {
+    return AtomicMemoryOperation(*this, sz ? 3 : 2, A, R, IR::AtomicOp::Swap, Rs, Rn, Rt);
+}
+
+static bool LoadAcquirePC(TranslatorVisitor& v, size_t size, Reg Rn, Reg Rt) {
+    const auto acctype = IR::AccType::ORDERED;
+    const size_t datasize = 8 << size;
+    const size_t regsize = datasize == 64 ? 64 : 32;
+
+    IR::U64 address;
+    if (Rn == Reg::SP) {
+        // TODO: Check SP Alignment
+        address = v.SP(64);
+    } else {
+        address = v.X(64, Rn);
+    }
+
+    const IR::UAny data = v.Mem(address, datasize / 8, acctype);
+    v.X(regsize, Rt, v.ZeroExtend(data, regsize));
+    return true;
+}
+
+bool TranslatorVisitor::LDAPRB(Reg Rn, Reg Rt) {
+    return LoadAcquirePC(*this, 0, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDAPRH(Reg Rn, Reg Rt) {
+    return LoadAcquirePC(*this, 1, Rn, Rt);
+}
+
+bool TranslatorVisitor::LDAPR(bool sz, Reg Rn, Reg Rt) {
+    return LoadAcquirePC(*this, sz ? 3 : 2, Rn, Rt);
+}
+
+} // namespace Dynarmic::A64
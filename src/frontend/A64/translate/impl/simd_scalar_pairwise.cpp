@@ -14,13 +14,11 @@ enum class MinMaxOperation {
     MinNumeric,
 };
 
-bool FPPairwiseMinMax(TranslatorVisitor& v, bool sz, Vec Vn, Vec Vd, MinMaxOperation operation) {
-    const size_t esize = sz ? 64 : 32;
-
+bool FPPairwiseMinMax(TranslatorVisitor& v, size_t esize, Vec Vn, Vec Vd, MinMaxOperation operation) {
     const IR::U128 operand = v.V(128, Vn);
-    const IR::U32U64 element1 = v.ir.VectorGetElement(esize, operand, 0);
-    const IR::U32U64 element2 = v.ir.VectorGetElement(esize, operand, 1);
-    const IR::U32U64 result = [&] {
+    const IR::U16U32U64 element1 = v.ir.VectorGetElement(esize, operand, 0);
+    const IR::U16U32U64 element2 = v.ir.VectorGetElement(esize, operand, 1);
+    const IR::U16U32U64 result = [&] {
         switch (operation) {
         case MinMaxOperation::Max:
             return v.ir.FPMax(element1, element2);
@@ -52,6 +50,16 @@ bool TranslatorVisitor::ADDP_pair(Imm<2> size, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FADDP_pair_1(Vec Vn, Vec Vd) {
+    const size_t esize = 16;
+
+    const IR::U16 operand1 = ir.VectorGetElement(esize, V(128, Vn), 0);
+    const IR::U16 operand2 = ir.VectorGetElement(esize, V(128, Vn), 1);
+    const IR::U128 result = ir.ZeroExtendToQuad(ir.FPAdd(operand1, operand2));
+    V(128, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FADDP_pair_2(bool size, Vec Vn, Vec Vd) {
     const size_t esize = size ? 64 : 32;
 
@@ -62,19 +70,35 @@ bool TranslatorVisitor::FADDP_pair_2(bool size, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMAXNMP_pair_1(Vec Vn, Vec Vd) {
+    return FPPairwiseMinMax(*this, 16, Vn, Vd, MinMaxOperation::MaxNumeric);
+}
+
 bool TranslatorVisitor::FMAXNMP_pair_2(bool sz, Vec Vn, Vec Vd) {
-    return FPPairwiseMinMax(*this, sz, Vn, Vd, MinMaxOperation::MaxNumeric);
+    return FPPairwiseMinMax(*this, sz ? 64 : 32, Vn, Vd, MinMaxOperation::MaxNumeric);
+}
+
+bool TranslatorVisitor::FMAXP_pair_1(Vec Vn, Vec Vd) {
+    return FPPairwiseMinMax(*this, 16, Vn, Vd, MinMaxOperation::Max);
 }
 
 bool TranslatorVisitor::FMAXP_pair_2(bool sz, Vec Vn, Vec Vd) {
-    return FPPairwiseMinMax(*this, sz, Vn, Vd, MinMaxOperation::Max);
+    return FPPairwiseMinMax(*this, sz ? 64 : 32, Vn, Vd, MinMaxOperation::Max);
+}
+
+bool TranslatorVisitor::FMINNMP_pair_1(Vec Vn, Vec Vd) {
+    return FPPairwiseMinMax(*this, 16, Vn, Vd, MinMaxOperation::MinNumeric);
 }
 
 bool TranslatorVisitor::FMINNMP_pair_2(bool sz, Vec Vn, Vec Vd) {
-    return FPPairwiseMinMax(*this, sz, Vn, Vd, MinMaxOperation::MinNumeric);
+    return FPPairwiseMinMax(*this, sz ? 64 : 32, Vn, Vd, MinMaxOperation::MinNumeric);
+}
+
+bool TranslatorVisitor::FMINP_pair_1(Vec Vn, Vec Vd) {
+    return FPPairwiseMinMax(*this, 16, Vn, Vd, MinMaxOperation::Min);
 }
 
 bool TranslatorVisitor::FMINP_pair_2(bool sz, Vec Vn, Vec Vd) {
-    return FPPairwiseMinMax(*this, sz, Vn, Vd, MinMaxOperation::Min);
+    return FPPairwiseMinMax(*this, sz ? 64 : 32, Vn, Vd, MinMaxOperation::Min);
 }
 } // namespace Dynarmic::A64
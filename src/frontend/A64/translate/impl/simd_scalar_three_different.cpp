@@ -0,0 +1,56 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include "frontend/A64/translate/impl/impl.h"
+
+namespace Dynarmic::A64 {
+namespace {
+enum class MultiplyLongBehavior {
+    None,
+    Accumulate,
+    Subtract,
+};
+
+bool SaturatingDoublingMultiplyLong(TranslatorVisitor& v, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, MultiplyLongBehavior behavior) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+
+    const IR::U128 operand1 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vn), 0));
+    const IR::U128 operand2 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vm), 0));
+    const IR::U128 product = v.ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, operand2);
+    const IR::U128 result = [&] {
+        if (behavior == MultiplyLongBehavior::None) {
+            return product;
+        }
+
+        const IR::U128 operand3 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(2 * esize, v.V(128, Vd), 0));
+        if (behavior == MultiplyLongBehavior::Subtract) {
+            return v.ir.VectorSignedSaturatedSub(2 * esize, operand3, product);
+        }
+
+        return v.ir.VectorSignedSaturatedAdd(2 * esize, operand3, product);
+    }();
+
+    v.V(128, Vd, result);
+    return true;
+}
+} // Anonymous namespace
+
+bool TranslatorVisitor::SQDMLAL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLong(*this, size, Vm, Vn, Vd, MultiplyLongBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::SQDMLSL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLong(*this, size, Vm, Vn, Vd, MultiplyLongBehavior::Subtract);
+}
+
+bool TranslatorVisitor::SQDMULL_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingDoublingMultiplyLong(*this, size, Vm, Vn, Vd, MultiplyLongBehavior::None);
+}
+
+} // namespace Dynarmic::A64
@@ -93,12 +93,20 @@ enum class FPComparisonType {
     AbsoluteGT
 };
 
-bool ScalarFPCompareRegister(TranslatorVisitor& v, bool sz, Vec Vm, Vec Vn, Vec Vd, FPComparisonType type) {
-    const size_t esize = sz ? 64 : 32;
+bool ScalarFPCompareRegister(TranslatorVisitor& v, size_t esize, Vec Vm, Vec Vn, Vec Vd, FPComparisonType type) {
     const size_t datasize = esize;
 
-    const IR::U128 operand1 = v.V(datasize, Vn);
-    const IR::U128 operand2 = v.V(datasize, Vm);
+    // There is no 16-bit register view, so half-precision operands are zero-extended
+    // to keep the remaining lanes from affecting the comparison.
+    const auto get_operand = [&](Vec vec) -> IR::U128 {
+        if (esize == 16) {
+            return v.ir.ZeroExtendToQuad(v.V_scalar(esize, vec));
+        }
+        return v.V(datasize, vec);
+    };
+
+    const IR::U128 operand1 = get_operand(Vn);
+    const IR::U128 operand2 = get_operand(Vm);
     const IR::U128 result = [&] {
         switch (type) {
         case FPComparisonType::EQ:
@@ -270,6 +278,17 @@ bool TranslatorVisitor::CMTST_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FABD_1(Vec Vm, Vec Vn, Vec Vd) {
+    const size_t esize = 16;
+
+    const IR::U16 operand1 = V_scalar(esize, Vn);
+    const IR::U16 operand2 = V_scalar(esize, Vm);
+    const IR::U16 result = ir.FPAbs(ir.FPSub(operand1, operand2));
+
+    V_scalar(esize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FABD_2(bool sz, Vec Vm, Vec Vn, Vec Vd) {
     const size_t esize = sz ? 64 : 32;
 
@@ -336,33 +355,55 @@ bool TranslatorVisitor::FRSQRTS_2(bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FACGE_1(Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarFPCompareRegister(*this, 16, Vm, Vn, Vd, FPComparisonType::AbsoluteGE);
+}
+
 bool TranslatorVisitor::FACGE_2(bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return ScalarFPCompareRegister(*this, sz, Vm, Vn, Vd, FPComparisonType::AbsoluteGE);
+    return ScalarFPCompareRegister(*this, sz ? 64 : 32, Vm, Vn, Vd, FPComparisonType::AbsoluteGE);
+}
+
+bool TranslatorVisitor::FACGT_1(Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarFPCompareRegister(*this, 16, Vm, Vn, Vd, FPComparisonType::AbsoluteGT);
 }
 
 bool TranslatorVisitor::FACGT_2(bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return ScalarFPCompareRegister(*this, sz, Vm, Vn, Vd, FPComparisonType::AbsoluteGT);
+    return ScalarFPCompareRegister(*this, sz ? 64 : 32, Vm, Vn, Vd, FPComparisonType::AbsoluteGT);
 }
 
 bool TranslatorVisitor::FCMEQ_reg_1(Vec Vm, Vec Vn, Vec Vd) {
-    const IR::U128 lhs = V(128, Vn);
-    const IR::U128 rhs = V(128, Vm);
-    const IR::U128 result = ir.FPVectorEqual(16, lhs, rhs);
-
-    V_scalar(16, Vd, ir.VectorGetElement(16, result, 0));
-    return true;
+    return ScalarFPCompareRegister(*this, 16, Vm, Vn, Vd, FPComparisonType::EQ);
 }
 
 bool TranslatorVisitor::FCMEQ_reg_2(bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return ScalarFPCompareRegister(*this, sz, Vm, Vn, Vd, FPComparisonType::EQ);
+    return ScalarFPCompareRegister(*this, sz ? 64 : 32, Vm, Vn, Vd, FPComparisonType::EQ);
+}
+
+bool TranslatorVisitor::FCMGE_reg_1(Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarFPCompareRegister(*this, 16, Vm, Vn, Vd, FPComparisonType::GE);
 }
 
 bool TranslatorVisitor::FCMGE_reg_2(bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return ScalarFPCompareRegister(*this, sz, Vm, Vn, Vd, FPComparisonType::GE);
+    return ScalarFPCompareRegister(*this, sz ? 64 : 32, Vm, Vn, Vd, FPComparisonType::GE);
+}
+
+bool TranslatorVisitor::FCMGT_reg_1(Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarFPCompareRegister(*this, 16, Vm, Vn, Vd, FPComparisonType::GT);
 }
 
 bool TranslatorVisitor::FCMGT_reg_2(bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return ScalarFPCompareRegister(*this, sz, Vm, Vn, Vd, FPComparisonType::GT);
+    return ScalarFPCompareRegister(*this, sz ? 64 : 32, Vm, Vn, Vd, FPComparisonType::GT);
+}
+
+bool TranslatorVisitor::SQRSHL_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t esize = 8U << size.ZeroExtend();
+
+    const IR::U128 operand1 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vn), 0));
+    const IR::U128 operand2 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vm), 0));
+    const IR::U128 result = ir.VectorSignedSaturatedRoundingShiftLeft(esize, operand1, operand2);
+
+    ir.SetQ(Vd, result);
+    return true;
 }
 
 bool TranslatorVisitor::SQSHL_reg_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
@@ -407,6 +448,17 @@ bool TranslatorVisitor::SUB_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::UQRSHL_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t esize = 8U << size.ZeroExtend();
+
+    const IR::U128 operand1 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vn), 0));
+    const IR::U128 operand2 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vm), 0));
+    const IR::U128 result = ir.VectorUnsignedSaturatedRoundingShiftLeft(esize, operand1, operand2);
+
+    ir.SetQ(Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::UQSHL_reg_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     const size_t esize = 8U << size.ZeroExtend();
 
@@ -69,13 +69,12 @@ bool MultiplyByElementHalfPrecision(TranslatorVisitor& v, Imm<1> L, Imm<1> M, Im
     const IR::U16 result = [&]() -> IR::U16 {
         IR::U16 operand1 = v.V_scalar(esize, Vn);
 
-        // TODO: Currently we don't implement half-precision paths
-        //       for regular multiplication and extended multiplication.
-
         if (extra_behavior == ExtraBehavior::None) {
-            ASSERT_FALSE("half-precision option unimplemented");
+            return v.ir.FPMul(operand1, element);
         }
 
+        // TODO: Currently we don't implement a half-precision path
+        //       for extended multiplication.
         if (extra_behavior == ExtraBehavior::MultiplyExtended) {
             ASSERT_FALSE("half-precision option unimplemented");
         }
@@ -109,6 +108,10 @@ bool TranslatorVisitor::FMLS_elt_2(bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm
     return MultiplyByElement(*this, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Subtract);
 }
 
+bool TranslatorVisitor::FMUL_elt_1(Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return MultiplyByElementHalfPrecision(*this, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
+}
+
 bool TranslatorVisitor::FMUL_elt_2(bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     return MultiplyByElement(*this, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
 }
@@ -153,6 +156,44 @@ bool TranslatorVisitor::SQRDMULH_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> V
     return true;
 }
 
+bool TranslatorVisitor::SQDMLAL_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    if (size == 0b00 || size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vn), 0));
+    const IR::UAny operand2 = ir.VectorGetElement(esize, V(128, Vm), index);
+    const IR::U128 operand3 = ir.ZeroExtendToQuad(ir.VectorGetElement(2 * esize, V(128, Vd), 0));
+    const IR::U128 broadcast = ir.VectorBroadcast(esize, operand2);
+    const IR::U128 product = ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, broadcast);
+    const IR::U128 result = ir.VectorSignedSaturatedAdd(2 * esize, operand3, product);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SQDMLSL_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    if (size == 0b00 || size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vn), 0));
+    const IR::UAny operand2 = ir.VectorGetElement(esize, V(128, Vm), index);
+    const IR::U128 operand3 = ir.ZeroExtendToQuad(ir.VectorGetElement(2 * esize, V(128, Vd), 0));
+    const IR::U128 broadcast = ir.VectorBroadcast(esize, operand2);
+    const IR::U128 product = ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, broadcast);
+    const IR::U128 result = ir.VectorSignedSaturatedSub(2 * esize, operand3, product);
+
+    V(128, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::SQDMULL_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     if (size == 0b00 || size == 0b11) {
         return ReservedValue();
@@ -170,4 +211,40 @@ bool TranslatorVisitor::SQDMULL_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vm
     return true;
 }
 
+bool TranslatorVisitor::SQRDMLAH_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    if (size == 0b00 || size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vn), 0));
+    const IR::UAny operand2 = ir.VectorGetElement(esize, V(128, Vm), index);
+    const IR::U128 operand3 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vd), 0));
+    const IR::U128 broadcast = ir.VectorBroadcast(esize, operand2);
+    const IR::U128 result = ir.VectorSignedSaturatedRoundingDoublingMulAdd(esize, operand3, operand1, broadcast);
+
+    V_scalar(esize, Vd, ir.VectorGetElement(esize, result, 0));
+    return true;
+}
+
+bool TranslatorVisitor::SQRDMLSH_elt_1(Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    if (size == 0b00 || size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vn), 0));
+    const IR::UAny operand2 = ir.VectorGetElement(esize, V(128, Vm), index);
+    const IR::U128 operand3 = ir.ZeroExtendToQuad(ir.VectorGetElement(esize, V(128, Vd), 0));
+    const IR::U128 broadcast = ir.VectorBroadcast(esize, operand2);
+    const IR::U128 result = ir.VectorSignedSaturatedRoundingDoublingMulSub(esize, operand3, operand1, broadcast);
+
+    V_scalar(esize, Vd, ir.VectorGetElement(esize, result, 0));
+    return true;
+}
+
 } // namespace Dynarmic::A64
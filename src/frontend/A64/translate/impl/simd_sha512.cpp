@@ -131,12 +131,7 @@ IR::U128 SM4Hash(IREmitter& ir, Vec Vn, Vec Vd, SM4RotationType type) {
         const IR::U32 before_upper_round = ir.VectorGetElement(32, roundresult, 2);
         const IR::U32 after_lower_round = ir.VectorGetElement(32, roundresult, 1);
 
-        IR::U128 intval_vec = ir.ZeroExtendToQuad(ir.Eor(upper_round, ir.Eor(before_upper_round, ir.Eor(after_lower_round, round_key))));
-
-        for (size_t j = 0; j < 4; j++) {
-            const IR::U8 byte_element = ir.VectorGetElement(8, intval_vec, j);
-            intval_vec = ir.VectorSetElement(8, intval_vec, j, ir.SM4AccessSubstitutionBox(byte_element));
-        }
+        const IR::U128 intval_vec = ir.SM4AccessSubstitutionBox(ir.ZeroExtendToQuad(ir.Eor(upper_round, ir.Eor(before_upper_round, ir.Eor(after_lower_round, round_key)))));
 
         const IR::U32 intval_low_word = ir.VectorGetElement(32, intval_vec, 0);
         const IR::U32 round_result_low_word = ir.VectorGetElement(32, roundresult, 0);
@@ -131,12 +131,11 @@ enum class ComparisonType {
     AbsoluteGT
 };
 
-bool FPCompareRegister(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd, ComparisonType type) {
-    if (sz && !Q) {
+bool FPCompareRegister(TranslatorVisitor& v, bool Q, size_t esize, Vec Vm, Vec Vn, Vec Vd, ComparisonType type) {
+    if (esize == 64 && !Q) {
         return v.ReservedValue();
     }
 
-    const size_t esize = sz ? 64 : 32;
     const size_t datasize = Q ? 128 : 64;
 
     const IR::U128 operand1 = v.V(datasize, Vn);
@@ -205,12 +204,11 @@ bool VectorMinMaxOperation(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Ve
     return true;
 }
 
-bool FPMinMaxOperation(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd, MinMaxOperation operation) {
-    if (sz && !Q) {
+bool FPMinMaxOperation(TranslatorVisitor& v, bool Q, size_t esize, Vec Vm, Vec Vn, Vec Vd, MinMaxOperation operation) {
+    if (esize == 64 && !Q) {
         return v.ReservedValue();
     }
 
-    const size_t esize = sz ? 64 : 32;
     const size_t datasize = Q ? 128 : 64;
 
     const IR::U128 operand1 = v.V(datasize, Vn);
@@ -227,13 +225,12 @@ bool FPMinMaxOperation(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Ve
     return true;
 }
 
-bool FPMinMaxNumericOperation(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd,
-                              IR::U32U64 (IREmitter::* fn)(const IR::U32U64&, const IR::U32U64&)) {
-    if (sz && !Q) {
+bool FPMinMaxNumericOperation(TranslatorVisitor& v, bool Q, size_t esize, Vec Vm, Vec Vn, Vec Vd,
+                              IR::U16U32U64 (IREmitter::* fn)(const IR::U16U32U64&, const IR::U16U32U64&)) {
+    if (esize == 64 && !Q) {
         return v.ReservedValue();
     }
 
-    const size_t esize = sz ? 64 : 32;
     const size_t datasize = Q ? 128 : 64;
     const size_t elements = datasize / esize;
 
@@ -291,13 +288,12 @@ bool PairedMinMaxOperation(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Ve
     return true;
 }
 
-bool FPPairedMinMax(TranslatorVisitor& v, bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd,
-                    IR::U32U64 (IREmitter::* fn)(const IR::U32U64&, const IR::U32U64&)) {
-    if (sz && !Q) {
+bool FPPairedOperation(TranslatorVisitor& v, bool Q, size_t esize, Vec Vm, Vec Vn, Vec Vd,
+                    IR::U16U32U64 (IREmitter::* fn)(const IR::U16U32U64&, const IR::U16U32U64&)) {
+    if (esize == 64 && !Q) {
         return v.ReservedValue();
     }
 
-    const size_t esize = sz ? 64 : 32;
     const size_t datasize = Q ? 128 : 64;
     const size_t elements = datasize / esize;
     const size_t boundary = elements / 2;
@@ -377,6 +373,28 @@ bool SaturatingShiftLeft(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec
     return true;
 }
 
+bool SaturatingRoundingShiftLeft(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, Signedness sign) {
+    if (size == 0b11 && !Q) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+    const IR::U128 result = [&] {
+        if (sign == Signedness::Signed) {
+            return v.ir.VectorSignedSaturatedRoundingShiftLeft(esize, operand1, operand2);
+        }
+
+        return v.ir.VectorUnsignedSaturatedRoundingShiftLeft(esize, operand1, operand2);
+    }();
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 } // Anonymous namespace
 
 bool TranslatorVisitor::CMGT_reg_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
@@ -639,6 +657,18 @@ bool TranslatorVisitor::ADDP_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FABD_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorAbs(esize, ir.FPVectorSub(esize, operand1, operand2));
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FABD_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -655,12 +685,32 @@ bool TranslatorVisitor::FABD_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FACGE_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegister(*this, Q, 16, Vm, Vn, Vd, ComparisonType::AbsoluteGE);
+}
+
 bool TranslatorVisitor::FACGE_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::AbsoluteGE);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::AbsoluteGE);
+}
+
+bool TranslatorVisitor::FACGT_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegister(*this, Q, 16, Vm, Vn, Vd, ComparisonType::AbsoluteGT);
 }
 
 bool TranslatorVisitor::FACGT_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::AbsoluteGT);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::AbsoluteGT);
+}
+
+bool TranslatorVisitor::FADD_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t esize = 16;
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorAdd(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
 }
 
 bool TranslatorVisitor::FADD_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
@@ -751,15 +801,23 @@ bool TranslatorVisitor::FCMEQ_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
 }
 
 bool TranslatorVisitor::FCMEQ_reg_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::EQ);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::EQ);
+}
+
+bool TranslatorVisitor::FCMGE_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegister(*this, Q, 16, Vm, Vn, Vd, ComparisonType::GE);
 }
 
 bool TranslatorVisitor::FCMGE_reg_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::GE);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::GE);
+}
+
+bool TranslatorVisitor::FCMGT_reg_3(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPCompareRegister(*this, Q, 16, Vm, Vn, Vd, ComparisonType::GT);
 }
 
 bool TranslatorVisitor::FCMGT_reg_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPCompareRegister(*this, Q, sz, Vm, Vn, Vd, ComparisonType::GT);
+    return FPCompareRegister(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, ComparisonType::GT);
 }
 
 bool TranslatorVisitor::AND_asimd(bool Q, Vec Vm, Vec Vn, Vec Vd) {
@@ -840,6 +898,10 @@ bool TranslatorVisitor::CMTST_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::SQRSHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingRoundingShiftLeft(*this, Q, size, Vm, Vn, Vd, Signedness::Signed);
+}
+
 bool TranslatorVisitor::SQSHL_reg_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return SaturatingShiftLeft(*this, Q, size, Vm, Vn, Vd, Signedness::Signed);
 }
@@ -864,6 +926,10 @@ bool TranslatorVisitor::SSHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::UQRSHL_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return SaturatingRoundingShiftLeft(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned);
+}
+
 bool TranslatorVisitor::UQSHL_reg_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return SaturatingShiftLeft(*this, Q, size, Vm, Vn, Vd, Signedness::Unsigned);
 }
@@ -939,6 +1005,18 @@ bool TranslatorVisitor::UMINP(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return PairedMinMaxOperation(*this, Q, size, Vm, Vn, Vd, MinMaxOperation::Min, Signedness::Unsigned);
 }
 
+bool TranslatorVisitor::FSUB_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t esize = 16;
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorSub(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FSUB_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -1117,36 +1195,72 @@ bool TranslatorVisitor::EOR_asimd(bool Q, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMAX_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPMinMaxOperation(*this, Q, 16, Vm, Vn, Vd, MinMaxOperation::Max);
+}
+
 bool TranslatorVisitor::FMAX_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPMinMaxOperation(*this, Q, sz, Vm, Vn, Vd, MinMaxOperation::Max);
+    return FPMinMaxOperation(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, MinMaxOperation::Max);
+}
+
+bool TranslatorVisitor::FMAXNM_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPMinMaxNumericOperation(*this, Q, 16, Vm, Vn, Vd, &IREmitter::FPMaxNumeric);
 }
 
 bool TranslatorVisitor::FMAXNM_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPMinMaxNumericOperation(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMaxNumeric);
+    return FPMinMaxNumericOperation(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, &IREmitter::FPMaxNumeric);
+}
+
+bool TranslatorVisitor::FMAXNMP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPPairedOperation(*this, Q, 16, Vm, Vn, Vd, &IREmitter::FPMaxNumeric);
 }
 
 bool TranslatorVisitor::FMAXNMP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPPairedMinMax(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMaxNumeric);
+    return FPPairedOperation(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, &IREmitter::FPMaxNumeric);
+}
+
+bool TranslatorVisitor::FMAXP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPPairedOperation(*this, Q, 16, Vm, Vn, Vd, &IREmitter::FPMax);
 }
 
 bool TranslatorVisitor::FMAXP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPPairedMinMax(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMax);
+    return FPPairedOperation(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, &IREmitter::FPMax);
+}
+
+bool TranslatorVisitor::FMIN_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPMinMaxOperation(*this, Q, 16, Vm, Vn, Vd, MinMaxOperation::Min);
 }
 
 bool TranslatorVisitor::FMIN_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPMinMaxOperation(*this, Q, sz, Vm, Vn, Vd, MinMaxOperation::Min);
+    return FPMinMaxOperation(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, MinMaxOperation::Min);
+}
+
+bool TranslatorVisitor::FMINNM_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPMinMaxNumericOperation(*this, Q, 16, Vm, Vn, Vd, &IREmitter::FPMinNumeric);
 }
 
 bool TranslatorVisitor::FMINNM_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPMinMaxNumericOperation(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMinNumeric);
+    return FPMinMaxNumericOperation(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, &IREmitter::FPMinNumeric);
+}
+
+bool TranslatorVisitor::FMINNMP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPPairedOperation(*this, Q, 16, Vm, Vn, Vd, &IREmitter::FPMinNumeric);
 }
 
 bool TranslatorVisitor::FMINNMP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPPairedMinMax(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMinNumeric);
+    return FPPairedOperation(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, &IREmitter::FPMinNumeric);
+}
+
+bool TranslatorVisitor::FMINP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPPairedOperation(*this, Q, 16, Vm, Vn, Vd, &IREmitter::FPMin);
 }
 
 bool TranslatorVisitor::FMINP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
-    return FPPairedMinMax(*this, Q, sz, Vm, Vn, Vd, &IREmitter::FPMin);
+    return FPPairedOperation(*this, Q, sz ? 64 : 32, Vm, Vn, Vd, &IREmitter::FPMin);
+}
+
+bool TranslatorVisitor::FADDP_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    return FPPairedOperation(*this, Q, 16, Vm, Vn, Vd, &IREmitter::FPAdd);
 }
 
 bool TranslatorVisitor::FADDP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
@@ -1164,6 +1278,18 @@ bool TranslatorVisitor::FADDP_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FMUL_vec_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t esize = 16;
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorMul(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FMUL_vec_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -1196,6 +1322,18 @@ bool TranslatorVisitor::FMULX_vec_4(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FDIV_1(bool Q, Vec Vm, Vec Vn, Vec Vd) {
+    const size_t esize = 16;
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = V(datasize, Vm);
+    const IR::U128 result = ir.FPVectorDiv(esize, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FDIV_2(bool Q, bool sz, Vec Vm, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
@@ -1220,8 +1358,8 @@ bool TranslatorVisitor::BIF(bool Q, Vec Vm, Vec Vn, Vec Vd) {
 
     const auto operand1 = V(datasize, Vd);
     const auto operand4 = V(datasize, Vn);
-    const auto operand3 = ir.VectorNot(V(datasize, Vm));
-    const auto result = ir.VectorEor(operand1, ir.VectorAnd(ir.VectorEor(operand1, operand4), operand3));
+    const auto operand3 = V(datasize, Vm);
+    const auto result = ir.VectorBitwiseSelect(operand3, operand1, operand4);
 
     V(datasize, Vd, result);
     return true;
@@ -1233,7 +1371,7 @@ bool TranslatorVisitor::BIT(bool Q, Vec Vm, Vec Vn, Vec Vd) {
     const auto operand1 = V(datasize, Vd);
     const auto operand4 = V(datasize, Vn);
     const auto operand3 = V(datasize, Vm);
-    const auto result = ir.VectorEor(operand1, ir.VectorAnd(ir.VectorEor(operand1, operand4), operand3));
+    const auto result = ir.VectorBitwiseSelect(operand3, operand4, operand1);
 
     V(datasize, Vd, result);
     return true;
@@ -1245,7 +1383,7 @@ bool TranslatorVisitor::BSL(bool Q, Vec Vm, Vec Vn, Vec Vd) {
     const auto operand4 = V(datasize, Vn);
     const auto operand1 = V(datasize, Vm);
     const auto operand3 = V(datasize, Vd);
-    const auto result = ir.VectorEor(operand1, ir.VectorAnd(ir.VectorEor(operand1, operand4), operand3));
+    const auto result = ir.VectorBitwiseSelect(operand3, operand4, operand1);
 
     V(datasize, Vd, result);
     return true;
@@ -42,12 +42,75 @@ bool DotProduct(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec V
     return true;
 }
 
+enum class AccumulateBehavior {
+    Accumulate,
+    Subtract,
+};
+
+IR::U128 RoundingDoublingMultiplyAccumulate(TranslatorVisitor& v, size_t esize, const IR::U128& operand1, const IR::U128& operand2,
+                                            const IR::U128& operand3, AccumulateBehavior behavior) {
+    if (behavior == AccumulateBehavior::Subtract) {
+        return v.ir.VectorSignedSaturatedRoundingDoublingMulSub(esize, operand3, operand1, operand2);
+    }
+
+    return v.ir.VectorSignedSaturatedRoundingDoublingMulAdd(esize, operand3, operand1, operand2);
+}
+
+bool ScalarRoundingDoublingMultiplyAccumulate(TranslatorVisitor& v, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, AccumulateBehavior behavior) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+
+    const IR::U128 operand1 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vn), 0));
+    const IR::U128 operand2 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vm), 0));
+    const IR::U128 operand3 = v.ir.ZeroExtendToQuad(v.ir.VectorGetElement(esize, v.V(128, Vd), 0));
+    const IR::U128 result = RoundingDoublingMultiplyAccumulate(v, esize, operand1, operand2, operand3, behavior);
+
+    v.V_scalar(esize, Vd, v.ir.VectorGetElement(esize, result, 0));
+    return true;
+}
+
+bool VectorRoundingDoublingMultiplyAccumulate(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd, AccumulateBehavior behavior) {
+    if (size == 0b00 || size == 0b11) {
+        return v.ReservedValue();
+    }
+
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = Q ? 128 : 64;
+
+    const IR::U128 operand1 = v.V(datasize, Vn);
+    const IR::U128 operand2 = v.V(datasize, Vm);
+    const IR::U128 operand3 = v.V(datasize, Vd);
+    const IR::U128 result = RoundingDoublingMultiplyAccumulate(v, esize, operand1, operand2, operand3, behavior);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 } // Anonymous namespace
 
 bool TranslatorVisitor::SDOT_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return DotProduct(*this, Q, size, Vm, Vn, Vd, &IREmitter::SignExtendToWord);
 }
 
+bool TranslatorVisitor::SQRDMLAH_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarRoundingDoublingMultiplyAccumulate(*this, size, Vm, Vn, Vd, AccumulateBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::SQRDMLAH_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return VectorRoundingDoublingMultiplyAccumulate(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::Accumulate);
+}
+
+bool TranslatorVisitor::SQRDMLSH_vec_1(Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return ScalarRoundingDoublingMultiplyAccumulate(*this, size, Vm, Vn, Vd, AccumulateBehavior::Subtract);
+}
+
+bool TranslatorVisitor::SQRDMLSH_vec_2(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
+    return VectorRoundingDoublingMultiplyAccumulate(*this, Q, size, Vm, Vn, Vd, AccumulateBehavior::Subtract);
+}
+
 bool TranslatorVisitor::UDOT_vec(bool Q, Imm<2> size, Vec Vm, Vec Vn, Vec Vd) {
     return DotProduct(*this, Q, size, Vm, Vn, Vd, &IREmitter::ZeroExtendToWord);
 }
@@ -50,12 +50,11 @@ bool CompareAgainstZero(TranslatorVisitor& v, bool Q, Imm<2> size, Vec Vn, Vec V
     return true;
 }
 
-bool FPCompareAgainstZero(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, ComparisonType type) {
-    if (sz && !Q) {
+bool FPCompareAgainstZero(TranslatorVisitor& v, bool Q, size_t esize, Vec Vn, Vec Vd, ComparisonType type) {
+    if (esize == 64 && !Q) {
         return v.ReservedValue();
     }
 
-    const size_t esize = sz ? 64 : 32;
     const size_t datasize = Q ? 128 : 64;
 
     const IR::U128 operand = v.V(datasize, Vn);
@@ -121,6 +120,19 @@ bool FloatConvertToInteger(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd
     return true;
 }
 
+bool FloatConvertToIntegerHalfPrecision(TranslatorVisitor& v, bool Q, Vec Vn, Vec Vd, Signedness signedness, FP::RoundingMode rounding_mode) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand = v.V(datasize, Vn);
+    const IR::U128 result = signedness == Signedness::Signed
+                          ? v.ir.FPVectorToSignedFixed(esize, operand, 0, rounding_mode)
+                          : v.ir.FPVectorToUnsignedFixed(esize, operand, 0, rounding_mode);
+
+    v.V(datasize, Vd, result);
+    return true;
+}
+
 bool FloatRoundToIntegral(TranslatorVisitor& v, bool Q, bool sz, Vec Vn, Vec Vd, FP::RoundingMode rounding_mode, bool exact) {
     if (sz && !Q) {
         return v.ReservedValue();
@@ -342,23 +354,39 @@ bool TranslatorVisitor::FCMEQ_zero_3(bool Q, Vec Vn, Vec Vd) {
 }
 
 bool TranslatorVisitor::FCMEQ_zero_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::EQ);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::EQ);
+}
+
+bool TranslatorVisitor::FCMGE_zero_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZero(*this, Q, 16, Vn, Vd, ComparisonType::GE);
 }
 
 bool TranslatorVisitor::FCMGE_zero_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::GE);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::GE);
+}
+
+bool TranslatorVisitor::FCMGT_zero_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZero(*this, Q, 16, Vn, Vd, ComparisonType::GT);
 }
 
 bool TranslatorVisitor::FCMGT_zero_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::GT);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::GT);
+}
+
+bool TranslatorVisitor::FCMLE_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZero(*this, Q, 16, Vn, Vd, ComparisonType::LE);
 }
 
 bool TranslatorVisitor::FCMLE_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::LE);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::LE);
+}
+
+bool TranslatorVisitor::FCMLT_3(bool Q, Vec Vn, Vec Vd) {
+    return FPCompareAgainstZero(*this, Q, 16, Vn, Vd, ComparisonType::LT);
 }
 
 bool TranslatorVisitor::FCMLT_4(bool Q, bool sz, Vec Vn, Vec Vd) {
-    return FPCompareAgainstZero(*this, Q, sz, Vn, Vd, ComparisonType::LT);
+    return FPCompareAgainstZero(*this, Q, sz ? 64 : 32, Vn, Vd, ComparisonType::LT);
 }
 
 bool TranslatorVisitor::FCVTL(bool Q, bool sz, Vec Vn, Vec Vd) {
@@ -411,18 +439,34 @@ bool TranslatorVisitor::FCVTN(bool Q, bool sz, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FCVTNS_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::ToNearest_TieEven);
+}
+
 bool TranslatorVisitor::FCVTNS_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::ToNearest_TieEven);
 }
 
+bool TranslatorVisitor::FCVTMS_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsMinusInfinity);
+}
+
 bool TranslatorVisitor::FCVTMS_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsMinusInfinity);
 }
 
+bool TranslatorVisitor::FCVTAS_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::ToNearest_TieAwayFromZero);
+}
+
 bool TranslatorVisitor::FCVTAS_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::ToNearest_TieAwayFromZero);
 }
 
+bool TranslatorVisitor::FCVTPS_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsPlusInfinity);
+}
+
 bool TranslatorVisitor::FCVTPS_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsPlusInfinity);
 }
@@ -447,26 +491,50 @@ bool TranslatorVisitor::FCVTXN_2(bool Q, bool sz, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FCVTZS_int_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsZero);
+}
+
 bool TranslatorVisitor::FCVTZS_int_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Signed, FP::RoundingMode::TowardsZero);
 }
 
+bool TranslatorVisitor::FCVTNU_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieEven);
+}
+
 bool TranslatorVisitor::FCVTNU_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieEven);
 }
 
+bool TranslatorVisitor::FCVTMU_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsMinusInfinity);
+}
+
 bool TranslatorVisitor::FCVTMU_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsMinusInfinity);
 }
 
+bool TranslatorVisitor::FCVTAU_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieAwayFromZero);
+}
+
 bool TranslatorVisitor::FCVTAU_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::ToNearest_TieAwayFromZero);
 }
 
+bool TranslatorVisitor::FCVTPU_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsPlusInfinity);
+}
+
 bool TranslatorVisitor::FCVTPU_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsPlusInfinity);
 }
 
+bool TranslatorVisitor::FCVTZU_int_3(bool Q, Vec Vn, Vec Vd) {
+    return FloatConvertToIntegerHalfPrecision(*this, Q, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsZero);
+}
+
 bool TranslatorVisitor::FCVTZU_int_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return FloatConvertToInteger(*this, Q, sz, Vn, Vd, Signedness::Unsigned, FP::RoundingMode::TowardsZero);
 }
@@ -553,6 +621,17 @@ bool TranslatorVisitor::FRECPE_4(bool Q, bool sz, Vec Vn, Vec Vd) {
     return true;
 }
 
+bool TranslatorVisitor::FSQRT_1(bool Q, Vec Vn, Vec Vd) {
+    const size_t datasize = Q ? 128 : 64;
+    const size_t esize = 16;
+
+    const IR::U128 operand = V(datasize, Vn);
+    const IR::U128 result = ir.FPVectorSqrt(esize, operand);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::FSQRT_2(bool Q, bool sz, Vec Vn, Vec Vd) {
     if (sz && !Q) {
         return ReservedValue();
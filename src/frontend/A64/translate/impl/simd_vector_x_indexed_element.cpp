@@ -100,12 +100,12 @@ bool FPMultiplyByElementHalfPrecision(TranslatorVisitor& v, bool Q, Imm<1> L, Im
     const IR::U128 operand2 = Q ? v.ir.VectorBroadcast(esize, element2) : v.ir.VectorBroadcastLower(esize, element2);
     const IR::U128 operand3 = v.V(datasize, Vd);
 
-    // TODO: We currently don't implement half-precision paths for
-    //       regular multiplies and extended multiplies.
+    // TODO: We currently don't implement a half-precision path for
+    //       extended multiplies.
     const IR::U128 result = [&]{
         switch (extra_behavior) {
         case ExtraBehavior::None:
-            break;
+            return v.ir.FPVectorMul(esize, operand1, operand2);
         case ExtraBehavior::Extended:
             break;
         case ExtraBehavior::Accumulate:
@@ -320,6 +320,10 @@ bool TranslatorVisitor::FMLS_elt_4(bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> V
     return FPMultiplyByElement(*this, Q, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::Subtract);
 }
 
+bool TranslatorVisitor::FMUL_elt_3(bool Q, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    return FPMultiplyByElementHalfPrecision(*this, Q, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
+}
+
 bool TranslatorVisitor::FMUL_elt_4(bool Q, bool sz, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     return FPMultiplyByElement(*this, Q, sz, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None);
 }
@@ -340,6 +344,48 @@ bool TranslatorVisitor::SMULL_elt(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4
     return MultiplyLong(*this, Q, size, L, M, Vmlo, H, Vn, Vd, ExtraBehavior::None, Signedness::Signed);
 }
 
+bool TranslatorVisitor::SQDMLAL_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    if (size == 0b00 || size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t part = Q ? 1 : 0;
+    const size_t idxsize = H == 1 ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = 64;
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = Vpart(datasize, Vn, part);
+    const IR::U128 operand2 = V(idxsize, Vm);
+    const IR::U128 index_vector = ir.VectorBroadcast(esize, ir.VectorGetElement(esize, operand2, index));
+    const IR::U128 product = ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, index_vector);
+    const IR::U128 result = ir.VectorSignedSaturatedAdd(2 * esize, V(128, Vd), product);
+
+    V(128, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SQDMLSL_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    if (size == 0b00 || size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t part = Q ? 1 : 0;
+    const size_t idxsize = H == 1 ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = 64;
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = Vpart(datasize, Vn, part);
+    const IR::U128 operand2 = V(idxsize, Vm);
+    const IR::U128 index_vector = ir.VectorBroadcast(esize, ir.VectorGetElement(esize, operand2, index));
+    const IR::U128 product = ir.VectorSignedSaturatedDoublingMultiplyLong(esize, operand1, index_vector);
+    const IR::U128 result = ir.VectorSignedSaturatedSub(2 * esize, V(128, Vd), product);
+
+    V(128, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::SQDMULL_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     if (size == 0b00 || size == 0b11) {
         return ReservedValue();
@@ -399,6 +445,44 @@ bool TranslatorVisitor::SQRDMULH_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M,
     return true;
 }
 
+bool TranslatorVisitor::SQRDMLAH_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    if (size == 0b00 || size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t idxsize = H == 1 ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = Q ? 128 : 64;
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = ir.VectorBroadcast(esize, ir.VectorGetElement(esize, V(idxsize, Vm), index));
+    const IR::U128 operand3 = V(datasize, Vd);
+    const IR::U128 result = ir.VectorSignedSaturatedRoundingDoublingMulAdd(esize, operand3, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
+bool TranslatorVisitor::SQRDMLSH_elt_2(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
+    if (size == 0b00 || size == 0b11) {
+        return ReservedValue();
+    }
+
+    const size_t idxsize = H == 1 ? 128 : 64;
+    const size_t esize = 8 << size.ZeroExtend();
+    const size_t datasize = Q ? 128 : 64;
+    const auto [index, Vm] = Combine(size, H, L, M, Vmlo);
+
+    const IR::U128 operand1 = V(datasize, Vn);
+    const IR::U128 operand2 = ir.VectorBroadcast(esize, ir.VectorGetElement(esize, V(idxsize, Vm), index));
+    const IR::U128 operand3 = V(datasize, Vd);
+    const IR::U128 result = ir.VectorSignedSaturatedRoundingDoublingMulSub(esize, operand3, operand1, operand2);
+
+    V(datasize, Vd, result);
+    return true;
+}
+
 bool TranslatorVisitor::SDOT_elt(bool Q, Imm<2> size, Imm<1> L, Imm<1> M, Imm<4> Vmlo, Imm<1> H, Vec Vn, Vec Vd) {
     return DotProduct(*this, Q, size, L, M, Vmlo, H, Vn, Vd, &IREmitter::SignExtendToWord);
 }
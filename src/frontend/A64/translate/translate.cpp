@@ -3,6 +3,10 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
+#include <optional>
+#include <utility>
+
 #include "frontend/A64/decoder/a64.h"
 #include "frontend/A64/location_descriptor.h"
 #include "frontend/A64/translate/impl/impl.h"
@@ -12,12 +16,35 @@
 
 namespace Dynarmic::A64 {
 
+/// Upper bound on the number of branches followed while translating a single block.
+constexpr size_t max_followed_branches = 8;
+
 IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory_read_code, TranslationOptions options) {
     const bool single_step = descriptor.SingleStepping();
+    if (single_step) {
+        options.follow_direct_branches = false;
+    }
 
     IR::Block block{descriptor};
     TranslatorVisitor visitor{block, descriptor, std::move(options)};
 
+    LocationDescriptor range_start = descriptor;
+    size_t followed_branches = 0;
+
+    // Following a branch back into code already in this block would translate it again indefinitely.
+    const auto is_translated = [&](u64 pc) {
+        if (range_start.PC() <= pc && pc < visitor.ir.current_location->PC()) {
+            return true;
+        }
+        if (followed_branches == 0) {
+            return false;
+        }
+        const auto code_ranges = block.CodeRanges();
+        return std::any_of(code_ranges.begin(), code_ranges.end(), [pc](const auto& range) {
+            return LocationDescriptor{range.first}.PC() <= pc && pc < LocationDescriptor{range.second}.PC();
+        });
+    };
+
     bool should_continue = true;
     do {
         const u64 pc = visitor.ir.current_location->PC();
@@ -31,6 +58,18 @@ IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory
 
         visitor.ir.current_location = visitor.ir.current_location->AdvancePC(4);
         block.CycleCount()++;
+
+        if (const auto target = std::exchange(visitor.branch_to_follow, std::nullopt)) {
+            if (followed_branches < max_followed_branches && !is_translated(target->PC())) {
+                block.AddCodeRange(range_start, *visitor.ir.current_location);
+                range_start = *target;
+                visitor.ir.current_location = *target;
+                followed_branches++;
+            } else {
+                visitor.ir.SetTerm(IR::Term::LinkBlock{*target});
+                should_continue = false;
+            }
+        }
     } while (should_continue && !single_step);
 
     if (single_step && should_continue) {
@@ -40,6 +79,9 @@ IR::Block Translate(LocationDescriptor descriptor, MemoryReadCodeFuncType memory
     ASSERT_MSG(block.HasTerminal(), "Terminal has not been set");
 
     block.SetEndLocation(*visitor.ir.current_location);
+    if (followed_branches != 0) {
+        block.AddCodeRange(range_start, *visitor.ir.current_location);
+    }
 
     return block;
 }
@@ -0,0 +1,83 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "common/assert.h"
+#include "common/common_types.h"
+
+namespace Dynarmic::Decoder {
+
+/**
+ * Bucketed instruction lookup table.
+ *
+ * Matchers are distributed into buckets indexed by a subset of the instruction bits,
+ * so that decoding an instruction only has to test the matchers that could possibly
+ * match it instead of the whole table. Within a bucket matchers retain the order of
+ * the list they were constructed from, so the first-match-wins semantics of the
+ * original list are preserved.
+ *
+ * @tparam MatcherT   The type of the Matcher to use.
+ * @tparam index_bits Number of bits in a bucket index.
+ * @tparam to_index   Function that gathers the index bits of an opcode. This must be a
+ *                    pure bit gather, as it is also applied to masks and expected values.
+ */
+template <typename MatcherT, size_t index_bits, size_t (*to_index)(typename MatcherT::opcode_type)>
+class LookupTable {
+public:
+    using opcode_type = typename MatcherT::opcode_type;
+
+    explicit LookupTable(std::vector<MatcherT> list) : matchers{std::move(list)} {
+        for (size_t i = 0; i < bucket_count; ++i) {
+            bucket_begin[i] = static_cast<u32>(bucket_entries.size());
+            for (const auto& matcher : matchers) {
+                if ((i & to_index(matcher.GetMask())) == to_index(matcher.GetExpected())) {
+                    bucket_entries.push_back(&matcher);
+                }
+            }
+        }
+        bucket_begin[bucket_count] = static_cast<u32>(bucket_entries.size());
+    }
+
+    // Buckets refer to elements of matchers, so this table must not be copied.
+    LookupTable(const LookupTable&) = delete;
+    LookupTable& operator=(const LookupTable&) = delete;
+    LookupTable(LookupTable&&) = default;
+    LookupTable& operator=(LookupTable&&) = default;
+
+    /// Finds the first matcher in the original list which matches the given instruction.
+    std::optional<std::reference_wrapper<const MatcherT>> Find(opcode_type instruction) const {
+        const size_t index = to_index(instruction);
+        DEBUG_ASSERT(index < bucket_count);
+
+        const auto begin = bucket_entries.begin() + bucket_begin[index];
+        const auto end = bucket_entries.begin() + bucket_begin[index + 1];
+
+        const auto matches_instruction = [instruction](const MatcherT* matcher) { return matcher->Matches(instruction); };
+
+        auto iter = std::find_if(begin, end, matches_instruction);
+        return iter != end ? std::optional<std::reference_wrapper<const MatcherT>>(**iter) : std::nullopt;
+    }
+
+    /// The matchers this table was constructed from, in their original order.
+    const std::vector<MatcherT>& Matchers() const {
+        return matchers;
+    }
+
+private:
+    static constexpr size_t bucket_count = size_t(1) << index_bits;
+
+    std::vector<MatcherT> matchers;
+    std::vector<const MatcherT*> bucket_entries;
+    std::array<u32, bucket_count + 1> bucket_begin{};
+};
+
+} // namespace Dynarmic::Decoder
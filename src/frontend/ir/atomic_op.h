@@ -0,0 +1,24 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+namespace Dynarmic::IR {
+
+/// Read-modify-write operation performed by an AtomicMemoryOperation IR instruction.
+/// The value written back to memory is `op(old_value, operand)`.
+enum class AtomicOp {
+    Add,   ///< old + operand
+    Clear, ///< old & ~operand
+    Eor,   ///< old ^ operand
+    Set,   ///< old | operand
+    SMax,  ///< signed max(old, operand)
+    SMin,  ///< signed min(old, operand)
+    UMax,  ///< unsigned max(old, operand)
+    UMin,  ///< unsigned min(old, operand)
+    Swap,  ///< operand
+};
+
+} // namespace Dynarmic::IR
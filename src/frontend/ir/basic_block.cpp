@@ -35,7 +35,20 @@ void Block::AppendNewInst(Opcode opcode, std::initializer_list<IR::Value> args)
     PrependNewInst(end(), opcode, args);
 }
 
+void Block::AppendNewInst(Opcode opcode, const std::vector<Value>& args) {
+    PrependNewInst(end(), opcode, args);
+}
+
 Block::iterator Block::PrependNewInst(iterator insertion_point, Opcode opcode, std::initializer_list<Value> args) {
+    return PrependNewInstImpl(insertion_point, opcode, args);
+}
+
+Block::iterator Block::PrependNewInst(iterator insertion_point, Opcode opcode, const std::vector<Value>& args) {
+    return PrependNewInstImpl(insertion_point, opcode, args);
+}
+
+template <typename ArgList>
+Block::iterator Block::PrependNewInstImpl(iterator insertion_point, Opcode opcode, const ArgList& args) {
     IR::Inst* inst = new(instruction_alloc_pool->Alloc()) IR::Inst(opcode);
     ASSERT(args.size() == inst->NumArgs());
 
@@ -59,6 +72,17 @@ void Block::SetEndLocation(const LocationDescriptor& descriptor) {
     end_location = descriptor;
 }
 
+void Block::AddCodeRange(const LocationDescriptor& start, const LocationDescriptor& end) {
+    code_ranges.emplace_back(start, end);
+}
+
+std::vector<std::pair<LocationDescriptor, LocationDescriptor>> Block::CodeRanges() const {
+    if (code_ranges.empty()) {
+        return {{location, end_location}};
+    }
+    return code_ranges;
+}
+
 Cond Block::GetCondition() const {
     return cond;
 }
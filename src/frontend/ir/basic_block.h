@@ -9,6 +9,8 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/intrusive_list.h"
@@ -83,6 +85,7 @@ public:
      * @param args A sequence of Value instances used as arguments for the instruction.
      */
     void AppendNewInst(Opcode op, std::initializer_list<Value> args);
+    void AppendNewInst(Opcode op, const std::vector<Value>& args);
 
     /**
      * Prepends a new instruction to this basic block before the insertion point,
@@ -94,6 +97,7 @@ public:
      * @returns Iterator to the newly created instruction.
      */
     iterator PrependNewInst(iterator insertion_point, Opcode op, std::initializer_list<Value> args);
+    iterator PrependNewInst(iterator insertion_point, Opcode op, const std::vector<Value>& args);
 
     /// Gets the starting location for this basic block.
     LocationDescriptor Location() const;
@@ -102,6 +106,12 @@ public:
     /// Sets the end location for this basic block.
     void SetEndLocation(const LocationDescriptor& descriptor);
 
+    /// Records a range [start, end) of guest code this basic block was translated from.
+    /// Only required if the block was not translated from the single range [Location(), EndLocation()).
+    void AddCodeRange(const LocationDescriptor& start, const LocationDescriptor& end);
+    /// Gets the ranges of guest code this basic block was translated from, as [start, end) pairs.
+    std::vector<std::pair<LocationDescriptor, LocationDescriptor>> CodeRanges() const;
+
     /// Gets the condition required to pass in order to execute this block.
     Cond GetCondition() const;
     /// Sets the condition required to pass in order to execute this block.
@@ -139,10 +149,15 @@ public:
     const size_t& CycleCount() const;
 
 private:
+    template <typename ArgList>
+    iterator PrependNewInstImpl(iterator insertion_point, Opcode op, const ArgList& args);
+
     /// Description of the starting location of this block
     LocationDescriptor location;
     /// Description of the end location of this block
     LocationDescriptor end_location;
+    /// Ranges of guest code this block was translated from, if other than [location, end_location).
+    std::vector<std::pair<LocationDescriptor, LocationDescriptor>> code_ranges;
     /// Conditional to pass in order to execute this block
     Cond cond;
     /// Block to execute next if `cond` did not pass.
@@ -903,8 +903,32 @@ U128 IREmitter::AESMixColumns(const U128& a) {
     return Inst<U128>(Opcode::AESMixColumns, a);
 }
 
-U8 IREmitter::SM4AccessSubstitutionBox(const U8& a) {
-    return Inst<U8>(Opcode::SM4AccessSubstitutionBox, a);
+U128 IREmitter::SHA1HashUpdateChoose(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateChoose, x, y, w);
+}
+
+U128 IREmitter::SHA1HashUpdateMajority(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateMajority, x, y, w);
+}
+
+U128 IREmitter::SHA1HashUpdateParity(const U128& x, const U128& y, const U128& w) {
+    return Inst<U128>(Opcode::SHA1HashUpdateParity, x, y, w);
+}
+
+U128 IREmitter::SHA256Hash(const U128& x, const U128& y, const U128& w, bool part1) {
+    return Inst<U128>(Opcode::SHA256Hash, x, y, w, Imm1(part1));
+}
+
+U128 IREmitter::SHA256MessageSchedule0(const U128& x, const U128& y) {
+    return Inst<U128>(Opcode::SHA256MessageSchedule0, x, y);
+}
+
+U128 IREmitter::SHA256MessageSchedule1(const U128& x, const U128& y, const U128& z) {
+    return Inst<U128>(Opcode::SHA256MessageSchedule1, x, y, z);
+}
+
+U128 IREmitter::SM4AccessSubstitutionBox(const U128& a) {
+    return Inst<U128>(Opcode::SM4AccessSubstitutionBox, a);
 }
 
 UAny IREmitter::VectorGetElement(size_t esize, const U128& a, size_t index) {
@@ -999,6 +1023,10 @@ U128 IREmitter::VectorArithmeticVShift(size_t esize, const U128& a, const U128&
     UNREACHABLE();
 }
 
+U128 IREmitter::VectorBitwiseSelect(const U128& mask, const U128& a, const U128& b) {
+    return Inst<U128>(Opcode::VectorBitwiseSelect, mask, a, b);
+}
+
 U128 IREmitter::VectorBroadcastLower(size_t esize, const UAny& a) {
     switch (esize) {
     case 8:
@@ -1725,6 +1753,40 @@ U128 IREmitter::VectorSignedSaturatedNeg(size_t esize, const U128& a) {
     UNREACHABLE();
 }
 
+U128 IREmitter::VectorSignedSaturatedRoundingDoublingMulAdd(size_t esize, const U128& addend, const U128& a, const U128& b) {
+    switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingDoublingMulAdd16, addend, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingDoublingMulAdd32, addend, a, b);
+    }
+    UNREACHABLE();
+}
+
+U128 IREmitter::VectorSignedSaturatedRoundingDoublingMulSub(size_t esize, const U128& minuend, const U128& a, const U128& b) {
+    switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingDoublingMulSub16, minuend, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingDoublingMulSub32, minuend, a, b);
+    }
+    UNREACHABLE();
+}
+
+U128 IREmitter::VectorSignedSaturatedRoundingShiftLeft(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingShiftLeft8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingShiftLeft16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingShiftLeft32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorSignedSaturatedRoundingShiftLeft64, a, b);
+    }
+    UNREACHABLE();
+}
+
 U128 IREmitter::VectorSignedSaturatedShiftLeft(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
     case 8:
@@ -1849,6 +1911,20 @@ U128 IREmitter::VectorUnsignedSaturatedNarrow(size_t esize, const U128& a) {
     UNREACHABLE();
 }
 
+U128 IREmitter::VectorUnsignedSaturatedRoundingShiftLeft(size_t esize, const U128& a, const U128& b) {
+    switch (esize) {
+    case 8:
+        return Inst<U128>(Opcode::VectorUnsignedSaturatedRoundingShiftLeft8, a, b);
+    case 16:
+        return Inst<U128>(Opcode::VectorUnsignedSaturatedRoundingShiftLeft16, a, b);
+    case 32:
+        return Inst<U128>(Opcode::VectorUnsignedSaturatedRoundingShiftLeft32, a, b);
+    case 64:
+        return Inst<U128>(Opcode::VectorUnsignedSaturatedRoundingShiftLeft64, a, b);
+    }
+    UNREACHABLE();
+}
+
 U128 IREmitter::VectorUnsignedSaturatedShiftLeft(size_t esize, const U128& a, const U128& b) {
     switch (esize) {
     case 8:
@@ -1898,10 +1974,12 @@ U16U32U64 IREmitter::FPAbs(const U16U32U64& a) {
     }
 }
 
-U32U64 IREmitter::FPAdd(const U32U64& a, const U32U64& b) {
+U16U32U64 IREmitter::FPAdd(const U16U32U64& a, const U16U32U64& b) {
     ASSERT(a.GetType() == b.GetType());
 
     switch (a.GetType()) {
+    case Type::U16:
+        return Inst<U16>(Opcode::FPAdd16, a, b);
     case Type::U32:
         return Inst<U32>(Opcode::FPAdd32, a, b);
     case Type::U64:
@@ -1926,10 +2004,12 @@ NZCV IREmitter::FPCompare(const U32U64& a, const U32U64& b, bool exc_on_qnan) {
     }
 }
 
-U32U64 IREmitter::FPDiv(const U32U64& a, const U32U64& b) {
+U16U32U64 IREmitter::FPDiv(const U16U32U64& a, const U16U32U64& b) {
     ASSERT(a.GetType() == b.GetType());
 
     switch (a.GetType()) {
+    case Type::U16:
+        return Inst<U16>(Opcode::FPDiv16, a, b);
     case Type::U32:
         return Inst<U32>(Opcode::FPDiv32, a, b);
     case Type::U64:
@@ -1939,10 +2019,12 @@ U32U64 IREmitter::FPDiv(const U32U64& a, const U32U64& b) {
     }
 }
 
-U32U64 IREmitter::FPMax(const U32U64& a, const U32U64& b) {
+U16U32U64 IREmitter::FPMax(const U16U32U64& a, const U16U32U64& b) {
     ASSERT(a.GetType() == b.GetType());
 
     switch (a.GetType()) {
+    case Type::U16:
+        return Inst<U16>(Opcode::FPMax16, a, b);
     case Type::U32:
         return Inst<U32>(Opcode::FPMax32, a, b);
     case Type::U64:
@@ -1952,10 +2034,12 @@ U32U64 IREmitter::FPMax(const U32U64& a, const U32U64& b) {
     }
 }
 
-U32U64 IREmitter::FPMaxNumeric(const U32U64& a, const U32U64& b) {
+U16U32U64 IREmitter::FPMaxNumeric(const U16U32U64& a, const U16U32U64& b) {
     ASSERT(a.GetType() == b.GetType());
 
     switch (a.GetType()) {
+    case Type::U16:
+        return Inst<U16>(Opcode::FPMaxNumeric16, a, b);
     case Type::U32:
         return Inst<U32>(Opcode::FPMaxNumeric32, a, b);
     case Type::U64:
@@ -1965,10 +2049,12 @@ U32U64 IREmitter::FPMaxNumeric(const U32U64& a, const U32U64& b) {
     }
 }
 
-U32U64 IREmitter::FPMin(const U32U64& a, const U32U64& b) {
+U16U32U64 IREmitter::FPMin(const U16U32U64& a, const U16U32U64& b) {
     ASSERT(a.GetType() == b.GetType());
 
     switch (a.GetType()) {
+    case Type::U16:
+        return Inst<U16>(Opcode::FPMin16, a, b);
     case Type::U32:
         return Inst<U32>(Opcode::FPMin32, a, b);
     case Type::U64:
@@ -1978,10 +2064,12 @@ U32U64 IREmitter::FPMin(const U32U64& a, const U32U64& b) {
     }
 }
 
-U32U64 IREmitter::FPMinNumeric(const U32U64& a, const U32U64& b) {
+U16U32U64 IREmitter::FPMinNumeric(const U16U32U64& a, const U16U32U64& b) {
     ASSERT(a.GetType() == b.GetType());
 
     switch (a.GetType()) {
+    case Type::U16:
+        return Inst<U16>(Opcode::FPMinNumeric16, a, b);
     case Type::U32:
         return Inst<U32>(Opcode::FPMinNumeric32, a, b);
     case Type::U64:
@@ -1991,10 +2079,12 @@ U32U64 IREmitter::FPMinNumeric(const U32U64& a, const U32U64& b) {
     }
 }
 
-U32U64 IREmitter::FPMul(const U32U64& a, const U32U64& b) {
+U16U32U64 IREmitter::FPMul(const U16U32U64& a, const U16U32U64& b) {
     ASSERT(a.GetType() == b.GetType());
 
     switch (a.GetType()) {
+    case Type::U16:
+        return Inst<U16>(Opcode::FPMul16, a, b);
     case Type::U32:
         return Inst<U32>(Opcode::FPMul32, a, b);
     case Type::U64:
@@ -2130,8 +2220,10 @@ U16U32U64 IREmitter::FPRSqrtStepFused(const U16U32U64& a, const U16U32U64& b) {
     }
 }
 
-U32U64 IREmitter::FPSqrt(const U32U64& a) {
+U16U32U64 IREmitter::FPSqrt(const U16U32U64& a) {
     switch (a.GetType()) {
+    case Type::U16:
+        return Inst<U16>(Opcode::FPSqrt16, a);
     case Type::U32:
         return Inst<U32>(Opcode::FPSqrt32, a);
     case Type::U64:
@@ -2141,10 +2233,12 @@ U32U64 IREmitter::FPSqrt(const U32U64& a) {
     }
 }
 
-U32U64 IREmitter::FPSub(const U32U64& a, const U32U64& b) {
+U16U32U64 IREmitter::FPSub(const U16U32U64& a, const U16U32U64& b) {
     ASSERT(a.GetType() == b.GetType());
 
     switch (a.GetType()) {
+    case Type::U16:
+        return Inst<U16>(Opcode::FPSub16, a, b);
     case Type::U32:
         return Inst<U32>(Opcode::FPSub32, a, b);
     case Type::U64:
@@ -2372,6 +2466,8 @@ U128 IREmitter::FPVectorAbs(size_t esize, const U128& a) {
 
 U128 IREmitter::FPVectorAdd(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorAdd16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorAdd32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2382,6 +2478,8 @@ U128 IREmitter::FPVectorAdd(size_t esize, const U128& a, const U128& b, bool fpc
 
 U128 IREmitter::FPVectorDiv(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorDiv16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorDiv32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2426,6 +2524,8 @@ U128 IREmitter::FPVectorFromUnsignedFixed(size_t esize, const U128& a, size_t fb
 
 U128 IREmitter::FPVectorGreater(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorGreater16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorGreater32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2436,6 +2536,8 @@ U128 IREmitter::FPVectorGreater(size_t esize, const U128& a, const U128& b, bool
 
 U128 IREmitter::FPVectorGreaterEqual(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorGreaterEqual16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorGreaterEqual32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2446,6 +2548,8 @@ U128 IREmitter::FPVectorGreaterEqual(size_t esize, const U128& a, const U128& b,
 
 U128 IREmitter::FPVectorMax(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorMax16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorMax32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2456,6 +2560,8 @@ U128 IREmitter::FPVectorMax(size_t esize, const U128& a, const U128& b, bool fpc
 
 U128 IREmitter::FPVectorMin(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorMin16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorMin32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2466,6 +2572,8 @@ U128 IREmitter::FPVectorMin(size_t esize, const U128& a, const U128& b, bool fpc
 
 U128 IREmitter::FPVectorMul(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorMul16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorMul32, a, b, Imm1(fpcr_controlled));
     case 64:
@@ -2593,6 +2701,8 @@ U128 IREmitter::FPVectorRSqrtStepFused(size_t esize, const U128& a, const U128&
 
 U128 IREmitter::FPVectorSqrt(size_t esize, const U128& a, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorSqrt16, a, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorSqrt32, a, Imm1(fpcr_controlled));
     case 64:
@@ -2603,6 +2713,8 @@ U128 IREmitter::FPVectorSqrt(size_t esize, const U128& a, bool fpcr_controlled)
 
 U128 IREmitter::FPVectorSub(size_t esize, const U128& a, const U128& b, bool fpcr_controlled) {
     switch (esize) {
+    case 16:
+        return Inst<U128>(Opcode::FPVectorSub16, a, b, Imm1(fpcr_controlled));
     case 32:
         return Inst<U128>(Opcode::FPVectorSub32, a, b, Imm1(fpcr_controlled));
     case 64:
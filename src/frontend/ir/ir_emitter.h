@@ -220,7 +220,14 @@ public:
     U128 AESInverseMixColumns(const U128& a);
     U128 AESMixColumns(const U128& a);
 
-    U8 SM4AccessSubstitutionBox(const U8& a);
+    U128 SHA1HashUpdateChoose(const U128& x, const U128& y, const U128& w);
+    U128 SHA1HashUpdateMajority(const U128& x, const U128& y, const U128& w);
+    U128 SHA1HashUpdateParity(const U128& x, const U128& y, const U128& w);
+    U128 SHA256Hash(const U128& x, const U128& y, const U128& w, bool part1);
+    U128 SHA256MessageSchedule0(const U128& x, const U128& y);
+    U128 SHA256MessageSchedule1(const U128& x, const U128& y, const U128& z);
+
+    U128 SM4AccessSubstitutionBox(const U128& a);
 
     UAny VectorGetElement(size_t esize, const U128& a, size_t index);
     U128 VectorSetElement(size_t esize, const U128& a, size_t index, const UAny& elem);
@@ -229,6 +236,7 @@ public:
     U128 VectorAnd(const U128& a, const U128& b);
     U128 VectorArithmeticShiftRight(size_t esize, const U128& a, u8 shift_amount);
     U128 VectorArithmeticVShift(size_t esize, const U128& a, const U128& b);
+    U128 VectorBitwiseSelect(const U128& mask, const U128& a, const U128& b);
     U128 VectorBroadcast(size_t esize, const UAny& a);
     U128 VectorBroadcastLower(size_t esize, const UAny& a);
     U128 VectorCountLeadingZeros(size_t esize, const U128& a);
@@ -296,6 +304,9 @@ public:
     U128 VectorSignedSaturatedNarrowToSigned(size_t original_esize, const U128& a);
     U128 VectorSignedSaturatedNarrowToUnsigned(size_t original_esize, const U128& a);
     U128 VectorSignedSaturatedNeg(size_t esize, const U128& a);
+    U128 VectorSignedSaturatedRoundingDoublingMulAdd(size_t esize, const U128& addend, const U128& a, const U128& b);
+    U128 VectorSignedSaturatedRoundingDoublingMulSub(size_t esize, const U128& minuend, const U128& a, const U128& b);
+    U128 VectorSignedSaturatedRoundingShiftLeft(size_t esize, const U128& a, const U128& b);
     U128 VectorSignedSaturatedShiftLeft(size_t esize, const U128& a, const U128& b);
     U128 VectorSignedSaturatedShiftLeftUnsigned(size_t esize, const U128& a, const U128& b);
     U128 VectorSub(size_t esize, const U128& a, const U128& b);
@@ -309,20 +320,21 @@ public:
     U128 VectorUnsignedRecipSqrtEstimate(const U128& a);
     U128 VectorUnsignedSaturatedAccumulateSigned(size_t esize, const U128& a, const U128& b);
     U128 VectorUnsignedSaturatedNarrow(size_t esize, const U128& a);
+    U128 VectorUnsignedSaturatedRoundingShiftLeft(size_t esize, const U128& a, const U128& b);
     U128 VectorUnsignedSaturatedShiftLeft(size_t esize, const U128& a, const U128& b);
     U128 VectorZeroExtend(size_t original_esize, const U128& a);
     U128 VectorZeroUpper(const U128& a);
     U128 ZeroVector();
 
     U16U32U64 FPAbs(const U16U32U64& a);
-    U32U64 FPAdd(const U32U64& a, const U32U64& b);
+    U16U32U64 FPAdd(const U16U32U64& a, const U16U32U64& b);
     NZCV FPCompare(const U32U64& a, const U32U64& b, bool exc_on_qnan);
-    U32U64 FPDiv(const U32U64& a, const U32U64& b);
-    U32U64 FPMax(const U32U64& a, const U32U64& b);
-    U32U64 FPMaxNumeric(const U32U64& a, const U32U64& b);
-    U32U64 FPMin(const U32U64& a, const U32U64& b);
-    U32U64 FPMinNumeric(const U32U64& a, const U32U64& b);
-    U32U64 FPMul(const U32U64& a, const U32U64& b);
+    U16U32U64 FPDiv(const U16U32U64& a, const U16U32U64& b);
+    U16U32U64 FPMax(const U16U32U64& a, const U16U32U64& b);
+    U16U32U64 FPMaxNumeric(const U16U32U64& a, const U16U32U64& b);
+    U16U32U64 FPMin(const U16U32U64& a, const U16U32U64& b);
+    U16U32U64 FPMinNumeric(const U16U32U64& a, const U16U32U64& b);
+    U16U32U64 FPMul(const U16U32U64& a, const U16U32U64& b);
     U16U32U64 FPMulAdd(const U16U32U64& addend, const U16U32U64& op1, const U16U32U64& op2);
     U32U64 FPMulX(const U32U64& a, const U32U64& b);
     U16U32U64 FPNeg(const U16U32U64& a);
@@ -332,8 +344,8 @@ public:
     U16U32U64 FPRoundInt(const U16U32U64& a, FP::RoundingMode rounding, bool exact);
     U16U32U64 FPRSqrtEstimate(const U16U32U64& a);
     U16U32U64 FPRSqrtStepFused(const U16U32U64& a, const U16U32U64& b);
-    U32U64 FPSqrt(const U32U64& a);
-    U32U64 FPSub(const U32U64& a, const U32U64& b);
+    U16U32U64 FPSqrt(const U16U32U64& a);
+    U16U32U64 FPSub(const U16U32U64& a, const U16U32U64& b);
     U16 FPDoubleToHalf(const U64& a, FP::RoundingMode rounding);
     U32 FPDoubleToSingle(const U64& a, FP::RoundingMode rounding);
     U64 FPHalfToDouble(const U16& a, FP::RoundingMode rounding);
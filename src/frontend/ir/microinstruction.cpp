@@ -135,12 +135,30 @@ bool Inst::IsExclusiveMemoryWrite() const {
     }
 }
 
+bool Inst::IsAtomicMemoryReadModifyWrite() const {
+    switch (op) {
+    case Opcode::A64AtomicMemoryOperation8:
+    case Opcode::A64AtomicMemoryOperation16:
+    case Opcode::A64AtomicMemoryOperation32:
+    case Opcode::A64AtomicMemoryOperation64:
+    case Opcode::A64CompareAndSwapMemory8:
+    case Opcode::A64CompareAndSwapMemory16:
+    case Opcode::A64CompareAndSwapMemory32:
+    case Opcode::A64CompareAndSwapMemory64:
+    case Opcode::A64CompareAndSwapMemory128:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
 bool Inst::IsMemoryRead() const {
-    return IsSharedMemoryRead() || IsExclusiveMemoryRead();
+    return IsSharedMemoryRead() || IsExclusiveMemoryRead() || IsAtomicMemoryReadModifyWrite();
 }
 
 bool Inst::IsMemoryWrite() const {
-    return IsSharedMemoryWrite() || IsExclusiveMemoryWrite();
+    return IsSharedMemoryWrite() || IsExclusiveMemoryWrite() || IsAtomicMemoryReadModifyWrite();
 }
 
 bool Inst::IsMemoryReadOrWrite() const {
@@ -179,6 +197,7 @@ bool Inst::WritesToCPSR() const {
     case Opcode::A32OrQFlag:
     case Opcode::A32SetGEFlags:
     case Opcode::A32SetGEFlagsCompressed:
+    case Opcode::A32SetITState:
     case Opcode::A64SetNZCVRaw:
     case Opcode::A64SetNZCV:
         return true;
@@ -287,20 +306,27 @@ bool Inst::WritesToFPSRCumulativeExceptionBits() const {
 
 bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     switch (op) {
+    case Opcode::FPAdd16:
     case Opcode::FPAdd32:
     case Opcode::FPAdd64:
     case Opcode::FPCompare32:
     case Opcode::FPCompare64:
+    case Opcode::FPDiv16:
     case Opcode::FPDiv32:
     case Opcode::FPDiv64:
+    case Opcode::FPMax16:
     case Opcode::FPMax32:
     case Opcode::FPMax64:
+    case Opcode::FPMaxNumeric16:
     case Opcode::FPMaxNumeric32:
     case Opcode::FPMaxNumeric64:
+    case Opcode::FPMin16:
     case Opcode::FPMin32:
     case Opcode::FPMin64:
+    case Opcode::FPMinNumeric16:
     case Opcode::FPMinNumeric32:
     case Opcode::FPMinNumeric64:
+    case Opcode::FPMul16:
     case Opcode::FPMul32:
     case Opcode::FPMul64:
     case Opcode::FPMulAdd16:
@@ -324,8 +350,10 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPRSqrtStepFused16:
     case Opcode::FPRSqrtStepFused32:
     case Opcode::FPRSqrtStepFused64:
+    case Opcode::FPSqrt16:
     case Opcode::FPSqrt32:
     case Opcode::FPSqrt64:
+    case Opcode::FPSub16:
     case Opcode::FPSub32:
     case Opcode::FPSub64:
     case Opcode::FPHalfToDouble:
@@ -354,8 +382,10 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPFixedS32ToDouble:
     case Opcode::FPFixedS64ToDouble:
     case Opcode::FPFixedS64ToSingle:
+    case Opcode::FPVectorAdd16:
     case Opcode::FPVectorAdd32:
     case Opcode::FPVectorAdd64:
+    case Opcode::FPVectorDiv16:
     case Opcode::FPVectorDiv32:
     case Opcode::FPVectorDiv64:
     case Opcode::FPVectorEqual16:
@@ -365,10 +395,19 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPVectorFromSignedFixed64:
     case Opcode::FPVectorFromUnsignedFixed32:
     case Opcode::FPVectorFromUnsignedFixed64:
+    case Opcode::FPVectorGreater16:
     case Opcode::FPVectorGreater32:
     case Opcode::FPVectorGreater64:
+    case Opcode::FPVectorGreaterEqual16:
     case Opcode::FPVectorGreaterEqual32:
     case Opcode::FPVectorGreaterEqual64:
+    case Opcode::FPVectorMax16:
+    case Opcode::FPVectorMax32:
+    case Opcode::FPVectorMax64:
+    case Opcode::FPVectorMin16:
+    case Opcode::FPVectorMin32:
+    case Opcode::FPVectorMin64:
+    case Opcode::FPVectorMul16:
     case Opcode::FPVectorMul32:
     case Opcode::FPVectorMul64:
     case Opcode::FPVectorMulAdd16:
@@ -393,8 +432,10 @@ bool Inst::ReadsFromAndWritesToFPSRCumulativeExceptionBits() const {
     case Opcode::FPVectorRSqrtStepFused16:
     case Opcode::FPVectorRSqrtStepFused32:
     case Opcode::FPVectorRSqrtStepFused64:
+    case Opcode::FPVectorSqrt16:
     case Opcode::FPVectorSqrt32:
     case Opcode::FPVectorSqrt64:
+    case Opcode::FPVectorSub16:
     case Opcode::FPVectorSub32:
     case Opcode::FPVectorSub64:
     case Opcode::FPVectorToSignedFixed16:
@@ -443,6 +484,14 @@ bool Inst::WritesToFPSRCumulativeSaturationBit() const {
     case Opcode::VectorSignedSaturatedNeg16:
     case Opcode::VectorSignedSaturatedNeg32:
     case Opcode::VectorSignedSaturatedNeg64:
+    case Opcode::VectorSignedSaturatedRoundingDoublingMulAdd16:
+    case Opcode::VectorSignedSaturatedRoundingDoublingMulAdd32:
+    case Opcode::VectorSignedSaturatedRoundingDoublingMulSub16:
+    case Opcode::VectorSignedSaturatedRoundingDoublingMulSub32:
+    case Opcode::VectorSignedSaturatedRoundingShiftLeft8:
+    case Opcode::VectorSignedSaturatedRoundingShiftLeft16:
+    case Opcode::VectorSignedSaturatedRoundingShiftLeft32:
+    case Opcode::VectorSignedSaturatedRoundingShiftLeft64:
     case Opcode::VectorSignedSaturatedShiftLeft8:
     case Opcode::VectorSignedSaturatedShiftLeft16:
     case Opcode::VectorSignedSaturatedShiftLeft32:
@@ -466,6 +515,10 @@ bool Inst::WritesToFPSRCumulativeSaturationBit() const {
     case Opcode::VectorUnsignedSaturatedNarrow16:
     case Opcode::VectorUnsignedSaturatedNarrow32:
     case Opcode::VectorUnsignedSaturatedNarrow64:
+    case Opcode::VectorUnsignedSaturatedRoundingShiftLeft8:
+    case Opcode::VectorUnsignedSaturatedRoundingShiftLeft16:
+    case Opcode::VectorUnsignedSaturatedRoundingShiftLeft32:
+    case Opcode::VectorUnsignedSaturatedRoundingShiftLeft64:
     case Opcode::VectorUnsignedSaturatedShiftLeft8:
     case Opcode::VectorUnsignedSaturatedShiftLeft16:
     case Opcode::VectorUnsignedSaturatedShiftLeft32:
@@ -48,6 +48,8 @@ public:
     bool IsExclusiveMemoryRead() const;
     /// Determines whether or not this instruction performs an atomic memory write.
     bool IsExclusiveMemoryWrite() const;
+    /// Determines whether or not this instruction performs an atomic read-modify-write of memory.
+    bool IsAtomicMemoryReadModifyWrite() const;
 
     /// Determines whether or not this instruction performs any kind of memory read.
     bool IsMemoryRead() const;
@@ -0,0 +1,450 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+
+#include "common/assert.h"
+#include "common/variant_util.h"
+#include "frontend/A32/types.h"
+#include "frontend/A64/types.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/cond.h"
+#include "frontend/ir/microinstruction.h"
+#include "frontend/ir/opcodes.h"
+#include "frontend/ir/serialization.h"
+#include "frontend/ir/type.h"
+
+namespace Dynarmic::IR {
+
+namespace {
+
+/// Tags for the kinds of argument that can appear in a serialized instruction.
+enum class ArgKind : u8 {
+    Void,
+    Inst,
+    A32Reg,
+    A32ExtReg,
+    A64Reg,
+    A64Vec,
+    U1,
+    U8,
+    U16,
+    U32,
+    U64,
+    CoprocInfo,
+    Cond,
+};
+
+/// Tags for terminals. These match the order of alternatives in IR::Terminal.
+enum class TermKind : u8 {
+    Invalid,
+    Interpret,
+    ReturnToDispatch,
+    LinkBlock,
+    LinkBlockFast,
+    PopRSBHint,
+    FastDispatchHint,
+    If,
+    CheckBit,
+    CheckHalt,
+};
+
+class Writer {
+public:
+    template <typename T>
+    void Write(T value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const size_t offset = data.size();
+        data.resize(offset + sizeof(T));
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    std::vector<u8> data;
+};
+
+class Reader {
+public:
+    explicit Reader(const std::vector<u8>& data) : data(data) {}
+
+    template <typename T>
+    bool Read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (data.size() - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    bool AtEnd() const {
+        return offset == data.size();
+    }
+
+private:
+    const std::vector<u8>& data;
+    size_t offset = 0;
+};
+
+void WriteTerminal(Writer& w, const Terminal& terminal) {
+    Common::VisitVariant<void>(terminal, [&w](const auto& t) {
+        using T = std::decay_t<decltype(t)>;
+        if constexpr (std::is_same_v<T, Term::Invalid>) {
+            w.Write(TermKind::Invalid);
+        } else if constexpr (std::is_same_v<T, Term::Interpret>) {
+            w.Write(TermKind::Interpret);
+            w.Write(t.next.Value());
+            w.Write(static_cast<u64>(t.num_instructions));
+        } else if constexpr (std::is_same_v<T, Term::ReturnToDispatch>) {
+            w.Write(TermKind::ReturnToDispatch);
+        } else if constexpr (std::is_same_v<T, Term::LinkBlock>) {
+            w.Write(TermKind::LinkBlock);
+            w.Write(t.next.Value());
+        } else if constexpr (std::is_same_v<T, Term::LinkBlockFast>) {
+            w.Write(TermKind::LinkBlockFast);
+            w.Write(t.next.Value());
+        } else if constexpr (std::is_same_v<T, Term::PopRSBHint>) {
+            w.Write(TermKind::PopRSBHint);
+        } else if constexpr (std::is_same_v<T, Term::FastDispatchHint>) {
+            w.Write(TermKind::FastDispatchHint);
+        } else if constexpr (std::is_same_v<T, Term::If>) {
+            w.Write(TermKind::If);
+            w.Write(t.if_);
+            WriteTerminal(w, t.then_);
+            WriteTerminal(w, t.else_);
+        } else if constexpr (std::is_same_v<T, Term::CheckBit>) {
+            w.Write(TermKind::CheckBit);
+            WriteTerminal(w, t.then_);
+            WriteTerminal(w, t.else_);
+        } else if constexpr (std::is_same_v<T, Term::CheckHalt>) {
+            w.Write(TermKind::CheckHalt);
+            WriteTerminal(w, t.else_);
+        } else {
+            static_assert(!std::is_same_v<T, T>, "Unhandled terminal");
+        }
+    });
+}
+
+std::optional<Terminal> ReadTerminal(Reader& r, size_t depth = 0) {
+    // Terminals produced by the translators are shallow; this only guards against malformed data.
+    if (depth > 64) {
+        return std::nullopt;
+    }
+
+    TermKind kind;
+    if (!r.Read(kind)) {
+        return std::nullopt;
+    }
+
+    const auto read_location = [&r]() -> std::optional<LocationDescriptor> {
+        u64 value;
+        if (!r.Read(value)) {
+            return std::nullopt;
+        }
+        return LocationDescriptor{value};
+    };
+
+    switch (kind) {
+    case TermKind::Invalid:
+        return Term::Invalid{};
+    case TermKind::Interpret: {
+        const auto next = read_location();
+        u64 num_instructions;
+        if (!next || !r.Read(num_instructions)) {
+            return std::nullopt;
+        }
+        Term::Interpret result{*next};
+        result.num_instructions = static_cast<size_t>(num_instructions);
+        return result;
+    }
+    case TermKind::ReturnToDispatch:
+        return Term::ReturnToDispatch{};
+    case TermKind::LinkBlock:
+        if (const auto next = read_location()) {
+            return Term::LinkBlock{*next};
+        }
+        return std::nullopt;
+    case TermKind::LinkBlockFast:
+        if (const auto next = read_location()) {
+            return Term::LinkBlockFast{*next};
+        }
+        return std::nullopt;
+    case TermKind::PopRSBHint:
+        return Term::PopRSBHint{};
+    case TermKind::FastDispatchHint:
+        return Term::FastDispatchHint{};
+    case TermKind::If: {
+        Cond cond;
+        if (!r.Read(cond)) {
+            return std::nullopt;
+        }
+        auto then_ = ReadTerminal(r, depth + 1);
+        auto else_ = then_ ? ReadTerminal(r, depth + 1) : std::nullopt;
+        if (!else_) {
+            return std::nullopt;
+        }
+        return Term::If{cond, std::move(*then_), std::move(*else_)};
+    }
+    case TermKind::CheckBit: {
+        auto then_ = ReadTerminal(r, depth + 1);
+        auto else_ = then_ ? ReadTerminal(r, depth + 1) : std::nullopt;
+        if (!else_) {
+            return std::nullopt;
+        }
+        return Term::CheckBit{std::move(*then_), std::move(*else_)};
+    }
+    case TermKind::CheckHalt: {
+        auto else_ = ReadTerminal(r, depth + 1);
+        if (!else_) {
+            return std::nullopt;
+        }
+        return Term::CheckHalt{std::move(*else_)};
+    }
+    }
+
+    return std::nullopt;
+}
+
+void WriteArg(Writer& w, const Value& arg, const std::unordered_map<const Inst*, u32>& inst_indices) {
+    if (arg.IsEmpty()) {
+        w.Write(ArgKind::Void);
+        return;
+    }
+
+    if (arg.IsIdentity() || !arg.IsImmediate()) {
+        const auto iter = inst_indices.find(arg.GetInst());
+        ASSERT_MSG(iter != inst_indices.end(), "Argument refers to an instruction outside of this block");
+        w.Write(ArgKind::Inst);
+        w.Write(iter->second);
+        return;
+    }
+
+    switch (arg.GetType()) {
+    case Type::A32Reg:
+        w.Write(ArgKind::A32Reg);
+        w.Write(arg.GetA32RegRef());
+        return;
+    case Type::A32ExtReg:
+        w.Write(ArgKind::A32ExtReg);
+        w.Write(arg.GetA32ExtRegRef());
+        return;
+    case Type::A64Reg:
+        w.Write(ArgKind::A64Reg);
+        w.Write(arg.GetA64RegRef());
+        return;
+    case Type::A64Vec:
+        w.Write(ArgKind::A64Vec);
+        w.Write(arg.GetA64VecRef());
+        return;
+    case Type::U1:
+        w.Write(ArgKind::U1);
+        w.Write(static_cast<u8>(arg.GetU1()));
+        return;
+    case Type::U8:
+        w.Write(ArgKind::U8);
+        w.Write(arg.GetU8());
+        return;
+    case Type::U16:
+        w.Write(ArgKind::U16);
+        w.Write(arg.GetU16());
+        return;
+    case Type::U32:
+        w.Write(ArgKind::U32);
+        w.Write(arg.GetU32());
+        return;
+    case Type::U64:
+        w.Write(ArgKind::U64);
+        w.Write(arg.GetU64());
+        return;
+    case Type::CoprocInfo:
+        w.Write(ArgKind::CoprocInfo);
+        w.Write(arg.GetCoprocInfo());
+        return;
+    case Type::Cond:
+        w.Write(ArgKind::Cond);
+        w.Write(arg.GetCond());
+        return;
+    default:
+        ASSERT_FALSE("Unserializable immediate of type {}", arg.GetType());
+    }
+}
+
+template <typename T>
+std::optional<Value> ReadImmediate(Reader& r) {
+    T value;
+    if (!r.Read(value)) {
+        return std::nullopt;
+    }
+    return Value{value};
+}
+
+std::optional<Value> ReadArg(Reader& r, const std::vector<Inst*>& insts) {
+    ArgKind kind;
+    if (!r.Read(kind)) {
+        return std::nullopt;
+    }
+
+    switch (kind) {
+    case ArgKind::Void:
+        return Value{};
+    case ArgKind::Inst: {
+        u32 index;
+        if (!r.Read(index) || index >= insts.size()) {
+            return std::nullopt;
+        }
+        return Value{insts[index]};
+    }
+    case ArgKind::A32Reg:
+        return ReadImmediate<A32::Reg>(r);
+    case ArgKind::A32ExtReg:
+        return ReadImmediate<A32::ExtReg>(r);
+    case ArgKind::A64Reg:
+        return ReadImmediate<A64::Reg>(r);
+    case ArgKind::A64Vec:
+        return ReadImmediate<A64::Vec>(r);
+    case ArgKind::U1:
+        if (const auto value = ReadImmediate<u8>(r)) {
+            return Value{value->GetU8() != 0};
+        }
+        return std::nullopt;
+    case ArgKind::U8:
+        return ReadImmediate<u8>(r);
+    case ArgKind::U16:
+        return ReadImmediate<u16>(r);
+    case ArgKind::U32:
+        return ReadImmediate<u32>(r);
+    case ArgKind::U64:
+        return ReadImmediate<u64>(r);
+    case ArgKind::CoprocInfo:
+        return ReadImmediate<Value::CoprocessorInfo>(r);
+    case ArgKind::Cond:
+        return ReadImmediate<Cond>(r);
+    }
+
+    return std::nullopt;
+}
+
+} // anonymous namespace
+
+std::vector<u8> SerializeBlock(const Block& block) {
+    Writer w;
+
+    w.Write(block.Location().Value());
+    w.Write(block.EndLocation().Value());
+
+    const auto code_ranges = block.CodeRanges();
+    w.Write(static_cast<u32>(code_ranges.size()));
+    for (const auto& [start, end] : code_ranges) {
+        w.Write(start.Value());
+        w.Write(end.Value());
+    }
+
+    w.Write(block.GetCondition());
+    w.Write(static_cast<u8>(block.HasConditionFailedLocation()));
+    if (block.HasConditionFailedLocation()) {
+        w.Write(block.ConditionFailedLocation().Value());
+    }
+    w.Write(static_cast<u64>(block.ConditionFailedCycleCount()));
+    w.Write(static_cast<u64>(block.CycleCount()));
+
+    std::unordered_map<const Inst*, u32> inst_indices;
+    w.Write(static_cast<u32>(block.size()));
+    for (const Inst& inst : block) {
+        w.Write(inst.GetOpcode());
+        for (size_t i = 0; i < inst.NumArgs(); i++) {
+            WriteArg(w, inst.GetArg(i), inst_indices);
+        }
+        inst_indices.emplace(&inst, static_cast<u32>(inst_indices.size()));
+    }
+
+    WriteTerminal(w, block.GetTerminal());
+
+    return std::move(w.data);
+}
+
+std::optional<Block> DeserializeBlock(const std::vector<u8>& data) {
+    Reader r{data};
+
+    u64 location, end_location;
+    u32 code_range_count;
+    if (!r.Read(location) || !r.Read(end_location) || !r.Read(code_range_count)) {
+        return std::nullopt;
+    }
+
+    Block block{LocationDescriptor{location}};
+    block.SetEndLocation(LocationDescriptor{end_location});
+
+    // A single range is implied by the locations above.
+    for (u32 i = 0; i < code_range_count; i++) {
+        u64 start, end;
+        if (!r.Read(start) || !r.Read(end)) {
+            return std::nullopt;
+        }
+        if (code_range_count > 1) {
+            block.AddCodeRange(LocationDescriptor{start}, LocationDescriptor{end});
+        }
+    }
+
+    Cond cond;
+    u8 has_cond_failed;
+    if (!r.Read(cond) || !r.Read(has_cond_failed)) {
+        return std::nullopt;
+    }
+    block.SetCondition(cond);
+
+    if (has_cond_failed) {
+        u64 cond_failed;
+        if (!r.Read(cond_failed)) {
+            return std::nullopt;
+        }
+        block.SetConditionFailedLocation(LocationDescriptor{cond_failed});
+    }
+
+    u64 cond_failed_cycle_count, cycle_count;
+    u32 inst_count;
+    if (!r.Read(cond_failed_cycle_count) || !r.Read(cycle_count) || !r.Read(inst_count)) {
+        return std::nullopt;
+    }
+    block.ConditionFailedCycleCount() = static_cast<size_t>(cond_failed_cycle_count);
+    block.CycleCount() = static_cast<size_t>(cycle_count);
+
+    std::vector<Inst*> insts;
+    insts.reserve(inst_count);
+    for (u32 i = 0; i < inst_count; i++) {
+        Opcode opcode;
+        if (!r.Read(opcode) || static_cast<size_t>(opcode) >= OpcodeCount) {
+            return std::nullopt;
+        }
+
+        std::vector<Value> args(GetNumArgsOf(opcode));
+        for (size_t arg_index = 0; arg_index < args.size(); arg_index++) {
+            const auto arg = ReadArg(r, insts);
+            if (!arg) {
+                return std::nullopt;
+            }
+            const Type expected_type = GetArgTypeOf(opcode, arg_index);
+            if (arg->IsEmpty() ? expected_type != Type::Opaque : !AreTypesCompatible(arg->GetType(), expected_type)) {
+                return std::nullopt;
+            }
+            args[arg_index] = *arg;
+        }
+
+        block.AppendNewInst(opcode, args);
+        Inst& inst = block.back();
+        insts.push_back(&inst);
+    }
+
+    auto terminal = ReadTerminal(r);
+    if (!terminal || !r.AtEnd()) {
+        return std::nullopt;
+    }
+    block.SetTerminal(std::move(*terminal));
+
+    return block;
+}
+
+} // namespace Dynarmic::IR
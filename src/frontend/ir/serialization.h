@@ -0,0 +1,29 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Dynarmic::IR {
+
+class Block;
+
+/**
+ * Serializes a basic block into a host-specific binary representation.
+ * The representation is only intended to be read back by the same build of dynarmic.
+ */
+std::vector<u8> SerializeBlock(const Block& block);
+
+/**
+ * Reconstructs a basic block from the output of SerializeBlock.
+ * @returns std::nullopt if data is malformed.
+ */
+std::optional<Block> DeserializeBlock(const std::vector<u8>& data);
+
+} // namespace Dynarmic::IR
@@ -116,6 +116,10 @@ void FoldAdd(IR::Inst& inst, bool is_32_bit) {
 // 5. x & y -> x (where y has all bits set to 1)
 //
 void FoldAND(IR::Inst& inst, bool is_32_bit) {
+    if (inst.HasAssociatedPseudoOperation()) {
+        return;
+    }
+
     if (FoldCommutative(inst, is_32_bit, [](u64 a, u64 b) { return a & b; })) {
         const auto rhs = inst.GetArg(1);
         if (rhs.IsZero()) {
@@ -184,6 +188,10 @@ void FoldDivide(IR::Inst& inst, bool is_32_bit, bool is_signed) {
 // 3. 0 ^ y -> y
 //
 void FoldEOR(IR::Inst& inst, bool is_32_bit) {
+    if (inst.HasAssociatedPseudoOperation()) {
+        return;
+    }
+
     if (FoldCommutative(inst, is_32_bit, [](u64 a, u64 b) { return a ^ b; })) {
         const auto rhs = inst.GetArg(1);
         if (rhs.IsZero()) {
@@ -265,7 +273,7 @@ void FoldMultiply(IR::Inst& inst, bool is_32_bit) {
 void FoldNOT(IR::Inst& inst, bool is_32_bit) {
     const auto operand = inst.GetArg(0);
 
-    if (!operand.IsImmediate()) {
+    if (!operand.IsImmediate() || inst.HasAssociatedPseudoOperation()) {
         return;
     }
 
@@ -280,6 +288,10 @@ void FoldNOT(IR::Inst& inst, bool is_32_bit) {
 // 3. 0 | y -> y
 //
 void FoldOR(IR::Inst& inst, bool is_32_bit) {
+    if (inst.HasAssociatedPseudoOperation()) {
+        return;
+    }
+
     if (FoldCommutative(inst, is_32_bit, [](u64 a, u64 b) { return a | b; })) {
         const auto rhs = inst.GetArg(1);
         if (rhs.IsZero()) {
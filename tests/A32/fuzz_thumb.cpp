@@ -39,13 +39,16 @@ static A32::UserConfig GetUserConfig(ThumbTestEnv* testenv) {
 
 using WriteRecords = std::map<u32, u8>;
 
+/// Generates 16-bit or 32-bit Thumb instructions depending on the length of the format.
+/// 32-bit instructions are returned with the first halfword in the upper 16 bits.
 struct ThumbInstGen final {
 public:
-    ThumbInstGen(const char* format, std::function<bool(u16)> is_valid = [](u16){ return true; }) : is_valid(is_valid) {
-        REQUIRE(strlen(format) == 16);
+    ThumbInstGen(const char* format, std::function<bool(u32)> is_valid = [](u32){ return true; }) : is_valid(is_valid) {
+        const size_t format_len = strlen(format);
+        REQUIRE((format_len == 16 || format_len == 32));
 
-        for (int i = 0; i < 16; i++) {
-            const u16 bit = 1 << (15 - i);
+        for (size_t i = 0; i < format_len; i++) {
+            const u32 bit = 1U << (format_len - 1 - i);
             switch (format[i]) {
             case '0':
                 mask |= bit;
@@ -59,12 +62,14 @@ public:
                 break;
             }
         }
+
+        max_value = format_len == 16 ? 0xFFFF : 0xFFFFFFFF;
     }
-    u16 Generate() const {
-        u16 inst;
+    u32 Generate() const {
+        u32 inst;
 
         do {
-            const u16 random = RandInt<u16>(0, 0xFFFF);
+            const u32 random = RandInt<u32>(0, max_value);
             inst = bits | (random & ~mask);
         } while (!is_valid(inst));
 
@@ -73,11 +78,21 @@ public:
         return inst;
     }
 private:
-    u16 bits = 0;
-    u16 mask = 0;
-    std::function<bool(u16)> is_valid;
+    u32 bits = 0;
+    u32 mask = 0;
+    u32 max_value = 0;
+    std::function<bool(u32)> is_valid;
 };
 
+/// Thumb32 encodings treat R13 and R15 as UNPREDICTABLE for most operands (BadReg in the ARM ARM).
+static bool BadReg(u32 reg) {
+    return reg == 13 || reg == 15;
+}
+
+static bool IsThumb32Prefix(u16 first_halfword) {
+    return (first_halfword & 0xF800) >= 0xE800;
+}
+
 static bool DoesBehaviorMatch(const A32Unicorn<ThumbTestEnv>& uni, const A32::Jit& jit,
                               const WriteRecords& interp_write_records, const WriteRecords& jit_write_records) {
     const auto interp_regs = uni.GetRegisters();
@@ -127,8 +142,13 @@ static void RunInstance(size_t run_number, ThumbTestEnv& test_env, A32Unicorn<Th
         printf("Failed at execution number %zu\n", run_number);
 
         printf("\nInstruction Listing: \n");
-        for (size_t i = 0; i < instruction_count; i++) {
-            printf("%04x %s\n", test_env.code_mem[i], A32::DisassembleThumb16(test_env.code_mem[i]).c_str());
+        for (size_t i = 0, offset = 0; i < instruction_count; i++) {
+            const u16 first_halfword = test_env.code_mem[offset++];
+            if (IsThumb32Prefix(first_halfword)) {
+                printf("%04x %04x\n", first_halfword, test_env.code_mem[offset++]);
+            } else {
+                printf("%04x %s\n", first_halfword, A32::DisassembleThumb16(first_halfword).c_str());
+            }
         }
 
         printf("\nInitial Register Listing: \n");
@@ -158,8 +178,8 @@ static void RunInstance(size_t run_number, ThumbTestEnv& test_env, A32Unicorn<Th
         cpsr.T(true);
 
         size_t num_insts = 0;
+        A32::LocationDescriptor descriptor = {0, cpsr, A32::FPSCR{}};
         while (num_insts < instructions_to_execute_count) {
-            A32::LocationDescriptor descriptor = {u32(num_insts * 4), cpsr, A32::FPSCR{}};
             IR::Block ir_block = A32::Translate(descriptor, [&test_env](u32 vaddr) { return test_env.MemoryReadCode(vaddr); }, {});
             Optimization::A32GetSetElimination(ir_block);
             Optimization::DeadCodeElimination(ir_block);
@@ -170,6 +190,7 @@ static void RunInstance(size_t run_number, ThumbTestEnv& test_env, A32Unicorn<Th
             printf("\n\nIR:\n%s", IR::DumpBlock(ir_block).c_str());
             printf("\n\nx86_64:\n%s", jit.Disassemble().c_str());
             num_insts += ir_block.CycleCount();
+            descriptor = A32::LocationDescriptor{ir_block.EndLocation()};
         }
 
 #ifdef _MSC_VER
@@ -179,13 +200,9 @@ static void RunInstance(size_t run_number, ThumbTestEnv& test_env, A32Unicorn<Th
     }
 }
 
-void FuzzJitThumb(const size_t instruction_count, const size_t instructions_to_execute_count, const size_t run_count, const std::function<u16()> instruction_generator) {
+void FuzzJitThumb(const size_t instruction_count, const size_t instructions_to_execute_count, const size_t run_count, const std::function<u32()> instruction_generator) {
     ThumbTestEnv test_env;
 
-    // Prepare memory.
-    test_env.code_mem.resize(instruction_count + 1);
-    test_env.code_mem.back() = 0xE7FE; // b +#0
-
     // Prepare test subjects
     A32Unicorn uni{test_env};
     A32::Jit jit{GetUserConfig(&test_env)};
@@ -195,7 +212,16 @@ void FuzzJitThumb(const size_t instruction_count, const size_t instructions_to_e
         std::generate_n(initial_regs.begin(), initial_regs.size() - 1, []{ return RandInt<u32>(0, 0xFFFFFFFF); });
         initial_regs[15] = 0;
 
-        std::generate_n(test_env.code_mem.begin(), instruction_count, instruction_generator);
+        // Prepare memory.
+        test_env.code_mem.clear();
+        for (size_t i = 0; i < instruction_count; i++) {
+            const u32 inst = instruction_generator();
+            if (inst > 0xFFFF) {
+                test_env.code_mem.push_back(static_cast<u16>(inst >> 16));
+            }
+            test_env.code_mem.push_back(static_cast<u16>(inst));
+        }
+        test_env.code_mem.push_back(0xE7FE); // b +#0
 
         RunInstance(run_number, test_env, uni, jit, initial_regs, instruction_count, instructions_to_execute_count);
     }
@@ -246,7 +272,7 @@ TEST_CASE("Fuzz Thumb instructions set 1", "[JitX64][Thumb]") {
 #endif
     };
 
-    const auto instruction_select = [&]() -> u16 {
+    const auto instruction_select = [&]() -> u32 {
         size_t inst_index = RandInt<size_t>(0, instructions.size() - 1);
 
         return instructions[inst_index].Generate();
@@ -294,6 +320,15 @@ TEST_CASE("Fuzz Thumb instructions set 2 (affects PC)", "[JitX64][Thumb]") {
                      }),
         ThumbInstGen("1011o0i1iiiiinnn"), // CBZ/CBNZ
         ThumbInstGen("10110110011x0xxx"), // CPS
+        ThumbInstGen("11110xxxxxxxxxxx10x1xxxxxxxxxxxx"), // B.W
+        ThumbInstGen("11110xccccxxxxxx10x0xxxxxxxxxxxx",  // B<cond>.W
+                     [](u32 inst){
+                         const u32 c = Common::Bits<22, 25>(inst);
+                         return c < 0b1110; // Conditions 1110 and 1111 encode other instructions.
+                     }),
+        ThumbInstGen("11110xxxxxxxxxxx11x1xxxxxxxxxxxx"), // BL
+        // BLX (imm) is not tested here as it switches to ARM state
+        // and executes whatever happens to be at the target.
 
         // TODO: We currently have no control over the generated
         //       values when creating new pages, so we can't
@@ -303,7 +338,7 @@ TEST_CASE("Fuzz Thumb instructions set 2 (affects PC)", "[JitX64][Thumb]") {
 #endif
     };
 
-    const auto instruction_select = [&]() -> u16 {
+    const auto instruction_select = [&]() -> u32 {
         size_t inst_index = RandInt<size_t>(0, instructions.size() - 1);
 
         return instructions[inst_index].Generate();
@@ -312,6 +347,193 @@ TEST_CASE("Fuzz Thumb instructions set 2 (affects PC)", "[JitX64][Thumb]") {
     FuzzJitThumb(1, 1, 10000, instruction_select);
 }
 
+TEST_CASE("Fuzz Thumb32 instructions", "[JitX64][Thumb]") {
+    const auto is_valid_data_processing = [](u32 inst) {
+        const u32 op = Common::Bits<21, 24>(inst);
+        const u32 n = Common::Bits<16, 19>(inst);
+        const bool is_mov_or_mvn = op == 0b0010 || op == 0b0011;
+        const bool is_valid_op = op <= 0b0100 || op == 0b1000 || op == 0b1010 || op == 0b1011 || op == 0b1101 || op == 0b1110;
+        return is_valid_op && !BadReg(Common::Bits<8, 11>(inst)) && (!BadReg(n) || (n == 15 && is_mov_or_mvn));
+    };
+
+    const std::array instructions = {
+        ThumbInstGen("1110101ooooxnnnn0xxxddddxxxxmmmm",  // Data processing (shifted register)
+                     [=](u32 inst) {
+                         return is_valid_data_processing(inst) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("11110x0ooooxnnnn0xxxddddxxxxxxxx",  // Data processing (modified immediate)
+                     [=](u32 inst) {
+                         // imm12<11:10> == '00' with imm12<9:8> != '00' and imm8 == 0 is UNPREDICTABLE.
+                         const bool is_replicated = !Common::Bit<26>(inst) && !Common::Bit<14>(inst);
+                         const bool is_bad_imm = is_replicated && Common::Bits<12, 13>(inst) != 0 && Common::Bits<0, 7>(inst) == 0;
+                         return is_valid_data_processing(inst) && !is_bad_imm;
+                     }),
+        ThumbInstGen("11110x10x0x0nnnn0xxxddddxxxxxxxx",  // ADDW/SUBW/ADR
+                     [](u32 inst) {
+                         return Common::Bit<23>(inst) == Common::Bit<21>(inst) &&
+                                !BadReg(Common::Bits<8, 11>(inst)) && Common::Bits<16, 19>(inst) != 13;
+                     }),
+        ThumbInstGen("11110x10x100xxxx0xxxddddxxxxxxxx",  // MOVW/MOVT
+                     [](u32 inst) { return !BadReg(Common::Bits<8, 11>(inst)); }),
+        ThumbInstGen("11110011x0x0nnnn0xxxddddxx0xxxxx",  // SSAT/USAT/SSAT16/USAT16
+                     [](u32 inst) {
+                         const bool is_sat16 = Common::Bit<21>(inst) && Common::Bits<12, 14>(inst) == 0 && Common::Bits<6, 7>(inst) == 0;
+                         return (!is_sat16 || !Common::Bit<4>(inst)) &&
+                                !BadReg(Common::Bits<8, 11>(inst)) && !BadReg(Common::Bits<16, 19>(inst));
+                     }),
+        ThumbInstGen("11110011x100nnnn0xxxddddxx0xxxxx",  // SBFX/UBFX
+                     [](u32 inst) {
+                         const u32 lsb = (Common::Bits<12, 14>(inst) << 2) | Common::Bits<6, 7>(inst);
+                         const u32 widthm1 = Common::Bits<0, 4>(inst);
+                         return lsb + widthm1 <= 31 &&
+                                !BadReg(Common::Bits<8, 11>(inst)) && !BadReg(Common::Bits<16, 19>(inst));
+                     }),
+        ThumbInstGen("111100110110nnnn0xxxddddxx0xxxxx",  // BFI/BFC
+                     [](u32 inst) {
+                         const u32 lsb = (Common::Bits<12, 14>(inst) << 2) | Common::Bits<6, 7>(inst);
+                         const u32 msb = Common::Bits<0, 4>(inst);
+                         return msb >= lsb && !BadReg(Common::Bits<8, 11>(inst)) && Common::Bits<16, 19>(inst) != 13;
+                     }),
+        ThumbInstGen("111110100ooxnnnn1111dddd0000mmmm",  // LSL/LSR/ASR/ROR (register)
+                     [](u32 inst) {
+                         return !BadReg(Common::Bits<16, 19>(inst)) && !BadReg(Common::Bits<8, 11>(inst)) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("111110100ooonnnn1111dddd10xxmmmm",  // SXT/UXT with optional accumulate
+                     [](u32 inst) {
+                         return Common::Bits<20, 22>(inst) < 0b110 && Common::Bits<16, 19>(inst) != 13 &&
+                                !BadReg(Common::Bits<8, 11>(inst)) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("111110101ooonnnn1111dddd0ooommmm",  // Parallel addition and subtraction
+                     [](u32 inst) {
+                         const u32 op1 = Common::Bits<20, 22>(inst);
+                         const u32 op2 = Common::Bits<4, 6>(inst);
+                         return op1 != 0b011 && op1 != 0b111 && op2 != 0b011 && op2 != 0b111 &&
+                                !BadReg(Common::Bits<16, 19>(inst)) && !BadReg(Common::Bits<8, 11>(inst)) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("111110101ooonnnn1111dddd10oommmm",  // QADD/REV/RBIT/SEL/CLZ and friends
+                     [](u32 inst) {
+                         const u32 op1 = Common::Bits<20, 22>(inst);
+                         const u32 op2 = Common::Bits<4, 5>(inst);
+                         const u32 n = Common::Bits<16, 19>(inst);
+                         const u32 m = Common::Bits<0, 3>(inst);
+                         if (op1 > 0b011 || (op1 >= 0b010 && op2 != 0)) {
+                             return false;
+                         }
+                         // The single operand instructions encode Rm twice; differing copies are UNPREDICTABLE.
+                         if ((op1 == 0b001 || op1 == 0b011) && n != m) {
+                             return false;
+                         }
+                         return !BadReg(n) && !BadReg(Common::Bits<8, 11>(inst)) && !BadReg(m);
+                     }),
+        ThumbInstGen("111110110ooonnnnaaaadddd00xxmmmm",  // 32-bit multiplies and USAD8
+                     [](u32 inst) {
+                         const u32 op1 = Common::Bits<20, 22>(inst);
+                         const u32 op2 = Common::Bits<4, 5>(inst);
+                         const u32 a = Common::Bits<12, 15>(inst);
+                         const bool is_valid_op2 = op1 == 0b001 ? true
+                                                 : op1 == 0b111 ? op2 == 0b00
+                                                 : op2 <= 0b01;
+                         // MLS and SMMLS have no non-accumulating form.
+                         const bool requires_a = (op1 == 0b000 && op2 == 0b01) || op1 == 0b110;
+                         return is_valid_op2 && (!BadReg(a) || (a == 15 && !requires_a)) &&
+                                !BadReg(Common::Bits<16, 19>(inst)) && !BadReg(Common::Bits<8, 11>(inst)) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("111110111xx0nnnnllllhhhh0000mmmm",  // SMULL/UMULL/SMLAL/UMLAL
+                     [](u32 inst) {
+                         const u32 lo = Common::Bits<12, 15>(inst);
+                         const u32 hi = Common::Bits<8, 11>(inst);
+                         return lo != hi && !BadReg(lo) && !BadReg(hi) &&
+                                !BadReg(Common::Bits<16, 19>(inst)) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("11111011110xnnnnllllhhhh1xxxmmmm",  // SMLALxy/SMLALD/SMLSLD
+                     [](u32 inst) {
+                         const u32 lo = Common::Bits<12, 15>(inst);
+                         const u32 hi = Common::Bits<8, 11>(inst);
+                         const u32 op1 = Common::Bit<20>(inst);
+                         const u32 op2 = Common::Bits<5, 6>(inst);
+                         const bool is_valid_op = op1 == 0 ? op2 != 0b11 : op2 == 0b10;
+                         return is_valid_op && lo != hi && !BadReg(lo) && !BadReg(hi) &&
+                                !BadReg(Common::Bits<16, 19>(inst)) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("111110111110nnnnllllhhhh0110mmmm",  // UMAAL
+                     [](u32 inst) {
+                         const u32 lo = Common::Bits<12, 15>(inst);
+                         const u32 hi = Common::Bits<8, 11>(inst);
+                         return lo != hi && !BadReg(lo) && !BadReg(hi) &&
+                                !BadReg(Common::Bits<16, 19>(inst)) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("1111101110x1nnnn1111dddd1111mmmm",  // SDIV/UDIV
+                     [](u32 inst) {
+                         return !BadReg(Common::Bits<16, 19>(inst)) && !BadReg(Common::Bits<8, 11>(inst)) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("111110001ooxnnnnttttxxxxxxxxxxxx",  // LDR(B/H)/STR(B/H) (imm12)
+                     [](u32 inst) {
+                         return Common::Bits<21, 22>(inst) != 0b11 && Common::Bits<16, 19>(inst) != 15 && !BadReg(Common::Bits<12, 15>(inst));
+                     }),
+        ThumbInstGen("111110000ooxnnnntttt1puwxxxxxxxx",  // LDR(B/H)/STR(B/H) (imm8)
+                     [](u32 inst) {
+                         const u32 n = Common::Bits<16, 19>(inst);
+                         const u32 t = Common::Bits<12, 15>(inst);
+                         const bool p = Common::Bit<10>(inst);
+                         const bool w = Common::Bit<8>(inst);
+                         return Common::Bits<21, 22>(inst) != 0b11 && (p || w) && !(w && n == t) && n != 15 && !BadReg(t);
+                     }),
+        ThumbInstGen("111110000ooxnnnntttt000000xxmmmm",  // LDR(B/H)/STR(B/H) (register)
+                     [](u32 inst) {
+                         return Common::Bits<21, 22>(inst) != 0b11 && Common::Bits<16, 19>(inst) != 15 &&
+                                !BadReg(Common::Bits<12, 15>(inst)) && !BadReg(Common::Bits<0, 3>(inst));
+                     }),
+        ThumbInstGen("1111100110x1nnnnttttxxxxxxxxxxxx",  // LDRSB/LDRSH (imm12)
+                     [](u32 inst) {
+                         return Common::Bits<16, 19>(inst) != 15 && !BadReg(Common::Bits<12, 15>(inst));
+                     }),
+        ThumbInstGen("1111100100x1nnnntttt1puwxxxxxxxx",  // LDRSB/LDRSH (imm8)
+                     [](u32 inst) {
+                         const u32 n = Common::Bits<16, 19>(inst);
+                         const u32 t = Common::Bits<12, 15>(inst);
+                         const bool p = Common::Bit<10>(inst);
+                         const bool w = Common::Bit<8>(inst);
+                         return (p || w) && !(w && n == t) && n != 15 && !BadReg(t);
+                     }),
+        ThumbInstGen("1110100pu1wlnnnnttttssssxxxxxxxx",  // LDRD/STRD (imm)
+                     [](u32 inst) {
+                         const u32 n = Common::Bits<16, 19>(inst);
+                         const u32 t = Common::Bits<12, 15>(inst);
+                         const u32 t2 = Common::Bits<8, 11>(inst);
+                         const bool p = Common::Bit<24>(inst);
+                         const bool w = Common::Bit<21>(inst);
+                         const bool l = Common::Bit<20>(inst);
+                         return (p || w) && !(w && (n == t || n == t2)) && !(l && t == t2) &&
+                                n != 15 && !BadReg(t) && !BadReg(t2);
+                     }),
+        ThumbInstGen("1110100xx0wxnnnn0x0xxxxxxxxxxxxx",  // LDMIA/LDMDB/STMIA/STMDB
+                     [](u32 inst) {
+                         // Loading PC is covered by the directed tests, as it branches to
+                         // whatever value happens to be in memory.
+                         const u32 mode = Common::Bits<23, 24>(inst);
+                         const u32 n = Common::Bits<16, 19>(inst);
+                         const u32 reg_list = Common::Bits<0, 15>(inst);
+                         const bool w = Common::Bit<21>(inst);
+                         return (mode == 0b01 || mode == 0b10) && n != 15 && Common::BitCount(reg_list) >= 2 &&
+                                !(w && Common::Bit(n, reg_list));
+                     }),
+    };
+
+    const auto instruction_select = [&]() -> u32 {
+        size_t inst_index = RandInt<size_t>(0, instructions.size() - 1);
+
+        return instructions[inst_index].Generate();
+    };
+
+    SECTION("single instructions") {
+        FuzzJitThumb(1, 2, 10000, instruction_select);
+    }
+
+    SECTION("short blocks") {
+        FuzzJitThumb(5, 6, 3000, instruction_select);
+    }
+}
+
 TEST_CASE("Verify fix for off by one error in MemoryRead32 worked", "[Thumb]") {
     ThumbTestEnv test_env;
 
@@ -3,8 +3,12 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <memory>
+#include <vector>
+
 #include <catch.hpp>
 #include <dynarmic/A32/a32.h>
+#include <dynarmic/exclusive_monitor.h>
 
 #include "A32/testenv.h"
 #include "frontend/A32/location_descriptor.h"
@@ -505,3 +509,108 @@ TEST_CASE("arm: vcvt.s16.f64", "[arm][A32]") {
     REQUIRE(jit.ExtRegs()[16] == 0xffff8000);
     REQUIRE(jit.ExtRegs()[17] == 0xffffffff);
 }
+
+TEST_CASE("arm: ldrex/strex via page table", "[arm][A32]") {
+    ArmTestEnv test_env;
+    ExclusiveMonitor monitor{1};
+    std::vector<u8> page(1 << A32::UserConfig::PAGE_BITS);
+    auto page_table = std::make_unique<std::array<std::uint8_t*, A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+    (*page_table)[1] = page.data();
+
+    A32::UserConfig config = GetUserConfig(&test_env);
+    config.global_monitor = &monitor;
+    config.page_table = page_table.get();
+    A32::Jit jit{config};
+    test_env.code_mem = {
+        0xe1910f9f, // ldrex r0, [r1]
+        0xe2800001, // add r0, r0, #1
+        0xe1812f90, // strex r2, r0, [r1]
+        0xe1813f90, // strex r3, r0, [r1]
+        0xeafffffe, // b +#0
+    };
+
+    page[4] = 0x41;
+    jit.Regs()[1] = 0x1004;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x42);
+    REQUIRE(jit.Regs()[2] == 0);
+    REQUIRE(jit.Regs()[3] == 1);
+    REQUIRE(page[4] == 0x42);
+}
+
+TEST_CASE("arm: ChangeProcessorID keeps inlined exclusive accesses", "[arm][A32]") {
+    ArmTestEnv test_env;
+    ExclusiveMonitor monitor{2};
+    std::vector<u8> page(1 << A32::UserConfig::PAGE_BITS);
+    auto page_table = std::make_unique<std::array<std::uint8_t*, A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+    (*page_table)[1] = page.data();
+
+    A32::UserConfig config = GetUserConfig(&test_env);
+    config.global_monitor = &monitor;
+    config.processor_id = 0;
+    config.page_table = page_table.get();
+    A32::Jit jit{config};
+    test_env.code_mem = {
+        0xe1910f9f, // ldrex r0, [r1]
+        0xeafffffe, // b +#0
+        0xe1812f90, // strex r2, r0, [r1]
+        0xeafffffe, // b +#0
+    };
+
+    // Loads a reservation, lets another agent clear the given processor's reservation, then stores.
+    const auto load_and_store_exclusive = [&](size_t cleared_processor) {
+        jit.Regs()[1] = 0x1004;
+        jit.Regs()[2] = 0xff;
+        jit.Regs()[15] = 0;
+        jit.SetCpsr(0x000001d0); // User-mode
+        test_env.ticks_left = 2;
+        jit.Run();
+
+        monitor.ClearProcessor(cleared_processor);
+
+        jit.Regs()[15] = 8;
+        test_env.ticks_left = 2;
+        jit.Run();
+        return jit.Regs()[2];
+    };
+
+    REQUIRE(load_and_store_exclusive(1) == 0);
+    REQUIRE(load_and_store_exclusive(0) == 1);
+
+    // Retranslating the store after this point would observe a different instruction.
+    test_env.code_mem[2] = 0xe3a02007; // mov r2, #7
+
+    jit.ChangeProcessorID(1);
+
+    REQUIRE(load_and_store_exclusive(0) == 0);
+    REQUIRE(load_and_store_exclusive(1) == 1);
+}
+
+TEST_CASE("arm: Background compilation", "[arm][A32]") {
+    constexpr u32 iterations = 10000;
+
+    ArmTestEnv test_env;
+    A32::UserConfig config = GetUserConfig(&test_env);
+    config.background_compilation = true;
+    A32::Jit jit{config};
+    test_env.code_mem = {
+        0xe2511001, // subs r1, r1, #1
+        0xe2800001, // add r0, r0, #1
+        0x1afffffc, // bne #-16
+        0xeafffffe, // b +#0
+    };
+
+    jit.Regs()[1] = iterations;
+    jit.SetCpsr(0x000001d0); // User-mode
+
+    test_env.ticks_left = 3 * iterations + 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == iterations);
+    REQUIRE(jit.Regs()[1] == 0);
+    REQUIRE(jit.Regs()[15] == 12);
+}
@@ -3,9 +3,15 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <array>
+#include <memory>
+#include <numeric>
+#include <vector>
+
 #include <catch.hpp>
 
 #include <dynarmic/A32/a32.h>
+#include <dynarmic/exclusive_monitor.h>
 
 #include "common/common_types.h"
 #include "testenv.h"
@@ -157,3 +163,422 @@ TEST_CASE("thumb: bl -#42", "[thumb]") {
     REQUIRE(jit.Regs()[15] == 0xFFFFFFD6);
     REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
 }
+
+TEST_CASE("thumb: itte eq", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0x2805, // cmp r0, #5
+        0xBF06, // itte eq
+        0x2101, // moveq r1, #1
+        0x1C52, // addeq r2, r2, #1
+        0x2102, // movne r1, #2
+        0xE7FE, // b +#0
+    };
+
+    SECTION("condition passed") {
+        jit.Regs()[0] = 5;
+        jit.Regs()[2] = 10;
+        jit.Regs()[15] = 0; // PC = 0
+        jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+        test_env.ticks_left = 6;
+        jit.Run();
+
+        REQUIRE(jit.Regs()[1] == 1);
+        REQUIRE(jit.Regs()[2] == 11);
+        REQUIRE(jit.Regs()[15] == 10);
+        REQUIRE(jit.Cpsr() == 0x60000030); // Z, C flags, Thumb, User-mode
+    }
+
+    SECTION("condition failed") {
+        jit.Regs()[0] = 4;
+        jit.Regs()[2] = 10;
+        jit.Regs()[15] = 0; // PC = 0
+        jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+        test_env.ticks_left = 6;
+        jit.Run();
+
+        REQUIRE(jit.Regs()[1] == 2);
+        REQUIRE(jit.Regs()[2] == 10);
+        REQUIRE(jit.Regs()[15] == 10);
+        REQUIRE(jit.Cpsr() == 0x80000030); // N flag, Thumb, User-mode
+    }
+}
+
+TEST_CASE("thumb: Step itte eq", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xBF06, // itte eq
+        0x2101, // moveq r1, #1
+        0x1C52, // addeq r2, r2, #1
+        0x2102, // movne r1, #2
+        0xE7FE, // b +#0
+    };
+
+    jit.Regs()[2] = 10;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x40000030); // Z flag, Thumb, User-mode
+
+    jit.Step();
+    REQUIRE(jit.Regs()[15] == 2);
+    REQUIRE(jit.Cpsr() == 0x44000430); // Z flag, ITSTATE = 0b00000110, Thumb, User-mode
+
+    jit.Step();
+    REQUIRE(jit.Regs()[1] == 1);
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x40000C30); // Z flag, ITSTATE = 0b00001100, Thumb, User-mode
+
+    jit.Step();
+    REQUIRE(jit.Regs()[2] == 11);
+    REQUIRE(jit.Regs()[15] == 6);
+    REQUIRE(jit.Cpsr() == 0x40001830); // Z flag, ITSTATE = 0b00011000, Thumb, User-mode
+
+    jit.Step();
+    REQUIRE(jit.Regs()[1] == 1);
+    REQUIRE(jit.Regs()[15] == 8);
+    REQUIRE(jit.Cpsr() == 0x40000030); // Z flag, Thumb, User-mode
+}
+
+TEST_CASE("thumb: add.w, orn, ubfx", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF104, 0x13FF, // add.w r3, r4, #0x00FF00FF
+        0xEA64, 0x1503, // orn r5, r4, r3, lsl #4
+        0xF3C1, 0x1007, // ubfx r0, r1, #4, #8
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 0x12345678;
+    jit.Regs()[4] = 0x01000100;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x67);
+    REQUIRE(jit.Regs()[3] == 0x01FF01FF);
+    REQUIRE(jit.Regs()[5] == 0xE10FE10F);
+    REQUIRE(jit.Regs()[15] == 12);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: strd, ldr.w", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xE96D, 0x0102, // strd r0, r1, [sp, #-8]!
+        0xF857, 0x6021, // ldr.w r6, [r7, r1, lsl #2]
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[0] = 0x11223344;
+    jit.Regs()[1] = 2;
+    jit.Regs()[7] = 0x2000;
+    jit.Regs()[13] = 0x1000;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 2;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[6] == 0x0B0A0908);
+    REQUIRE(jit.Regs()[13] == 0x0FF8);
+    REQUIRE(jit.Regs()[15] == 8);
+    REQUIRE(test_env.MemoryRead32(0x0FF8) == 0x11223344);
+    REQUIRE(test_env.MemoryRead32(0x0FFC) == 2);
+}
+
+TEST_CASE("thumb: tbb [pc, r0]", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xE8DF, 0xF000, // tbb [pc, r0]
+        0x0302,         // (table)
+        0xE7FE,         // b +#0
+        0xE7FE,         // b +#0
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[0] = 1;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 1;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[15] == 10);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: bl into a thumb subroutine and bx lr", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF000, 0xF802, // bl +#4
+        0xE7FE,         // b +#0
+        0xE7FE,         // b +#0
+        0x3001,         // adds r0, #1
+        0x4770,         // bx lr
+    };
+
+    jit.Regs()[0] = 0;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 1);
+    REQUIRE(jit.Regs()[14] == 5);
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: blx into an arm subroutine and bx lr", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF000, 0xE802, // blx +#4
+        0xE7FE,         // b +#0
+        0xE7FE,         // b +#0
+        0x0002, 0xE280, // (arm) add r0, r0, #2
+        0xFF1E, 0xE12F, // (arm) bx lr
+    };
+
+    jit.Regs()[0] = 1;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 3);
+    REQUIRE(jit.Regs()[14] == 5);
+    REQUIRE(jit.Regs()[15] == 4);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: movw and movt", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF245, 0x6078, // movw r0, #0x5678
+        0xF2C1, 0x2034, // movt r0, #0x1234
+        0xF6CA, 0x31CD, // movt r1, #0xABCD
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[0] = 0xFFFFFFFF;
+    jit.Regs()[1] = 0x11112222;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x12345678);
+    REQUIRE(jit.Regs()[1] == 0xABCD2222);
+    REQUIRE(jit.Regs()[15] == 12);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: push.w and pop.w with pc", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xE92D, 0x4010, // push.w {r4, lr}
+        0xF04F, 0x0455, // mov.w r4, #0x55
+        0xE8BD, 0x8010, // pop.w {r4, pc}
+        0xE7FE,         // b +#0
+        0xE7FE,         // b +#0
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[4] = 0xAA;
+    jit.Regs()[13] = 0x1000;
+    jit.Regs()[14] = 0x11;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[4] == 0xAA);
+    REQUIRE(jit.Regs()[13] == 0x1000);
+    REQUIRE(jit.Regs()[15] == 0x10);
+    REQUIRE(test_env.MemoryRead32(0x0FF8) == 0xAA);
+    REQUIRE(test_env.MemoryRead32(0x0FFC) == 0x11);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: stmdb and ldm.w with pc interworking to arm", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xE921, 0x000C, // stmdb r1!, {r2, r3}
+        0xE891, 0x8008, // ldm.w r1, {r3, pc}
+    };
+    test_env.code_mem.resize(0x40 / sizeof(u16), 0xE7FE); // b +#0
+    test_env.code_mem.push_back(0xFFFE);
+    test_env.code_mem.push_back(0xEAFF); // (arm) b +#0
+
+    jit.Regs()[1] = 0x2000;
+    jit.Regs()[2] = 0x41;
+    jit.Regs()[3] = 0x40;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 2;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[1] == 0x1FF8);
+    REQUIRE(jit.Regs()[3] == 0x41);
+    REQUIRE(jit.Regs()[15] == 0x40);
+    REQUIRE(test_env.MemoryRead32(0x1FF8) == 0x41);
+    REQUIRE(test_env.MemoryRead32(0x1FFC) == 0x40);
+    REQUIRE(jit.Cpsr() == 0x00000010); // Arm, User-mode
+}
+
+TEST_CASE("thumb: ldrex and strex", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::ExclusiveMonitor monitor{1};
+    std::vector<u8> page(1 << Dynarmic::A32::UserConfig::PAGE_BITS);
+    auto page_table = std::make_unique<std::array<std::uint8_t*, Dynarmic::A32::UserConfig::NUM_PAGE_TABLE_ENTRIES>>();
+    (*page_table)[1] = page.data();
+
+    Dynarmic::A32::UserConfig config = GetUserConfig(&test_env);
+    config.global_monitor = &monitor;
+    config.page_table = page_table.get();
+    Dynarmic::A32::Jit jit{config};
+    test_env.code_mem = {
+        0xE851, 0x0F00, // ldrex r0, [r1]
+        0xE841, 0x3200, // strex r2, r3, [r1]
+        0xE841, 0x5400, // strex r4, r5, [r1]
+        0xE8D1, 0x677F, // ldrexd r6, r7, [r1]
+        0xE8C1, 0x2378, // strexd r8, r2, r3, [r1]
+        0xE7FE,         // b +#0
+    };
+
+    std::iota(page.begin(), page.begin() + 8, u8(0));
+    jit.Regs()[1] = 0x1000;
+    jit.Regs()[3] = 0xDEADBEEF;
+    jit.Regs()[5] = 0x12345678;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x03020100);
+    REQUIRE(jit.Regs()[2] == 0);
+    REQUIRE(jit.Regs()[4] == 1);
+    REQUIRE(jit.Regs()[6] == 0xDEADBEEF);
+    REQUIRE(jit.Regs()[7] == 0x07060504);
+    REQUIRE(jit.Regs()[8] == 0);
+    REQUIRE(jit.Regs()[15] == 20);
+    REQUIRE(page[0] == 0x00);
+    REQUIRE(page[3] == 0x00);
+    REQUIRE(page[4] == 0xEF);
+    REQUIRE(page[7] == 0xDE);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: mla mls smull umlal smlabt sdiv udiv", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xFB01, 0x3002, // mla r0, r1, r2, r3
+        0xFB01, 0x3412, // mls r4, r1, r2, r3
+        0xFB81, 0x5602, // smull r5, r6, r1, r2
+        0xFBE1, 0x7802, // umlal r7, r8, r1, r2
+        0xFB11, 0x3912, // smlabt r9, r1, r2, r3
+        0xFB93, 0xFAF2, // sdiv r10, r3, r2
+        0xFBB3, 0xFBF2, // udiv r11, r3, r2
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 0xFFFFFFFE;
+    jit.Regs()[2] = 0x00030005;
+    jit.Regs()[3] = 0x80000010;
+    jit.Regs()[7] = 0x00000010;
+    jit.Regs()[8] = 0x00000001;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 7;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x7FFA0006);
+    REQUIRE(jit.Regs()[4] == 0x8006001A);
+    REQUIRE(jit.Regs()[5] == 0xFFF9FFF6);
+    REQUIRE(jit.Regs()[6] == 0xFFFFFFFF);
+    REQUIRE(jit.Regs()[7] == 0xFFFA0006);
+    REQUIRE(jit.Regs()[8] == 0x00030005);
+    REQUIRE(jit.Regs()[9] == 0x8000000A);
+    REQUIRE(jit.Regs()[10] == 0xFFFFD556);
+    REQUIRE(jit.Regs()[11] == 0x00002AAA);
+    REQUIRE(jit.Regs()[15] == 28);
+    REQUIRE(jit.Cpsr() == 0x00000030); // Thumb, User-mode
+}
+
+TEST_CASE("thumb: sadd16 uqsub8 shadd8 usub8 sel", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xFA91, 0xF002, // sadd16 r0, r1, r2
+        0xFAC1, 0xF352, // uqsub8 r3, r1, r2
+        0xFA81, 0xF422, // shadd8 r4, r1, r2
+        0xFAC2, 0xF641, // usub8 r6, r2, r1
+        0xFAA1, 0xF582, // sel r5, r1, r2
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 0x7FF070FE;
+    jit.Regs()[2] = 0x00208003;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0x8010F101);
+    REQUIRE(jit.Regs()[3] == 0x7FD000FB);
+    REQUIRE(jit.Regs()[4] == 0x3F08F800);
+    REQUIRE(jit.Regs()[5] == 0x00207003);
+    REQUIRE(jit.Regs()[6] == 0x81301005);
+    REQUIRE(jit.Regs()[15] == 20);
+    REQUIRE(jit.Cpsr() == 0x00020030); // GE = 0b0010, Thumb, User-mode
+}
+
+TEST_CASE("thumb: ssat usat ssat16 qadd", "[thumb]") {
+    ThumbTestEnv test_env;
+    Dynarmic::A32::Jit jit{GetUserConfig(&test_env)};
+    test_env.code_mem = {
+        0xF301, 0x0007, // ssat r0, #8, r1
+        0xF381, 0x1208, // usat r2, #8, r1, lsl #4
+        0xF321, 0x0303, // ssat16 r3, #4, r1
+        0xFA86, 0xF485, // qadd r4, r5, r6
+        0xE7FE,         // b +#0
+    };
+
+    jit.Regs()[1] = 0xFFFD0123;
+    jit.Regs()[5] = 0x7FFFFFF0;
+    jit.Regs()[6] = 0x00000100;
+    jit.Regs()[15] = 0; // PC = 0
+    jit.SetCpsr(0x00000030); // Thumb, User-mode
+
+    test_env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.Regs()[0] == 0xFFFFFF80);
+    REQUIRE(jit.Regs()[2] == 0);
+    REQUIRE(jit.Regs()[3] == 0xFFFD0007);
+    REQUIRE(jit.Regs()[4] == 0x7FFFFFFF);
+    REQUIRE(jit.Regs()[15] == 16);
+    REQUIRE(jit.Cpsr() == 0x08000030); // Q, Thumb, User-mode
+}
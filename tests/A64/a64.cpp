@@ -3,15 +3,74 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 #include <catch.hpp>
+#include <fmt/format.h>
 
 #include <dynarmic/exclusive_monitor.h>
+#include <dynarmic/shared_code_cache.h>
+#include <dynarmic/translation_cache.h>
 
 #include "common/fp/fpsr.h"
+#include "common/scope_exit.h"
 #include "testenv.h"
 
 using namespace Dynarmic;
 
+// Runs body as a loop of the given number of iterations, counted down in X28, and returns the time taken in
+// milliseconds. One untimed iteration is run first so that translation is not measured.
+static double MeasureLoop(A64TestEnv& env, A64::Jit& jit, const std::vector<u32>& body, size_t iterations) {
+    jit.ClearCache();
+    env.code_mem = body;
+    env.code_mem.emplace_back(0xd100079c); // SUB X28, X28, #1
+    env.code_mem.emplace_back(0xb500001c | ((static_cast<u32>(-static_cast<s32>(body.size() + 1)) & 0x7FFFF) << 5)); // CBNZ X28, #0
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const auto run = [&](size_t count) {
+        jit.SetRegister(28, count);
+        jit.SetPC(0);
+        env.ticks_left = count * (body.size() + 2) + 1;
+        jit.Run();
+    };
+
+    run(1);
+    const auto start = std::chrono::steady_clock::now();
+    run(iterations);
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Returns the average time in nanoseconds taken by each instance of instruction, which must have Rd and Rn
+// set to zero. It is repeated in eight interleaved dependency chains through V0-V7 (or X0-X7) so that
+// neither latency nor dead code elimination dominates the measurement.
+static double MeasureInstruction(A64TestEnv& env, A64::Jit& jit, u32 instruction) {
+    constexpr size_t chains = 8;
+    constexpr size_t chain_length = 4;
+    constexpr size_t iterations = 100000;
+
+    std::vector<u32> body;
+    for (size_t i = 0; i < chain_length; i++) {
+        for (u32 reg = 0; reg < chains; reg++) {
+            body.emplace_back(instruction | reg << 5 | reg);
+        }
+    }
+
+    const double ms = MeasureLoop(env, jit, body, iterations);
+    return ms * 1e6 / (body.size() * iterations);
+}
+
 TEST_CASE("A64: ADD", "[a64]") {
     A64TestEnv env;
     A64::Jit jit{A64::UserConfig{&env}};
@@ -450,6 +509,59 @@ TEST_CASE("A64: FMADD (0x80800000)", "[a64]") {
     REQUIRE(jit.GetVector(25) == Vector{0x80000000, 0});
 }
 
+TEST_CASE("A64: FMADD (tiny before rounding)", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x1f020c20); // FMADD S0, S1, S2, S3
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(1, {0x3f000831, 0});
+    jit.SetVector(2, {0x80ffef9f, 0});
+    jit.SetVector(3, {0x00000000, 0});
+
+    env.ticks_left = 2;
+    jit.Run();
+
+    // Rounds to the smallest normal number, but is tiny before rounding
+    REQUIRE(jit.GetVector(0) == Vector{0x80800000, 0});
+    REQUIRE(FP::FPSR{jit.GetFpsr()}.UFC() == true);
+
+    jit.SetPC(0);
+    jit.SetFpcr(0x01000000); // FZ
+    jit.SetFpsr(0);
+
+    env.ticks_left = 2;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0x80000000, 0});
+    REQUIRE(FP::FPSR{jit.GetFpsr()}.UFC() == true);
+}
+
+TEST_CASE("A64: FMADD FMLA throughput", "[.][a64][bench]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    // The lanes of V0-V7 keep their initial values: FMLA adds on their product with zero, and FMADD multiplies them
+    // by one and adds zero.
+    const auto measure = [&](const char* name, u32 instruction, u64 lanes, u64 multiplier) {
+        for (size_t i = 0; i < 8; i++) {
+            jit.SetVector(i, {lanes, lanes});
+        }
+        jit.SetVector(30, {multiplier, multiplier});
+        jit.SetVector(31, {0, 0});
+        fmt::print("{}: {:.2f} ns\n", name, MeasureInstruction(env, jit, instruction));
+    };
+
+    measure("FMLA.4S", 0x4e3ecc00, 0x3f8000003f800000, 0);
+    measure("FMLA.4S (smallest normal result)", 0x4e3ecc00, 0x0080000000800000, 0);
+    measure("FMLA.8H", 0x4e5e0c00, 0x3c003c003c003c00, 0);
+    measure("FMLA.8H (smallest normal result)", 0x4e5e0c00, 0x0400040004000400, 0);
+    measure("FMADD (single precision)", 0x1f1e7c00, 0x3f800000, 0x3f800000);
+    measure("FMADD (half precision)", 0x1fde7c00, 0x3c00, 0x3c00);
+}
+
 TEST_CASE("A64: FNEG failed to zero upper", "[a64]") {
     A64TestEnv env;
     A64::Jit jit{A64::UserConfig{&env}};
@@ -469,6 +581,32 @@ TEST_CASE("A64: FNEG failed to zero upper", "[a64]") {
     REQUIRE(FP::FPSR{jit.GetFpsr()}.QC() == false);
 }
 
+TEST_CASE("A64: FRINTA FCVTAS FCVTXN (ties away and round to odd)", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x1e264020); // FRINTA S0, S1
+    env.code_mem.emplace_back(0x1e240022); // FCVTAS W2, S1
+    env.code_mem.emplace_back(0x9e640083); // FCVTAS X3, D4
+    env.code_mem.emplace_back(0x7e6168c5); // FCVTXN S5, D6
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(1, {0xc0200000, 0});             // -2.5f
+    jit.SetVector(4, {0x4004000000000000, 0});     // 2.5
+    jit.SetVector(6, {0x3ff0000004000000, 0});     // 1 + 2^-30
+    jit.SetFpcr(0x00c00000);                       // Round towards zero
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0xc0400000, 0});
+    REQUIRE(jit.GetRegister(2) == 0xfffffffd);
+    REQUIRE(jit.GetRegister(3) == 3);
+    REQUIRE(jit.GetVector(5) == Vector{0x3f800001, 0});
+    REQUIRE(FP::FPSR{jit.GetFpsr()}.IXC() == true);
+}
+
 TEST_CASE("A64: FRSQRTS", "[a64]") {
     A64TestEnv env;
     A64::Jit jit{A64::UserConfig{&env}};
@@ -491,6 +629,97 @@ TEST_CASE("A64: FRSQRTS", "[a64]") {
     REQUIRE(jit.GetVector(13) == Vector{0xff7fffff, 0});
 }
 
+TEST_CASE("A64: FADD.4S (NaN propagation)", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4e22d420); // FADD.4S V0, V1, V2
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(1, {0x7fc000027f800001, 0x7f8000003f800000});
+    jit.SetVector(2, {0xff8000047fc00003, 0xff80000040000000});
+
+    env.ticks_left = 2;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0xffc000047fc00001, 0x7fc0000040400000});
+}
+
+TEST_CASE("A64: FADD FMAX FMINNM FCMGT FSQRT (half precision)", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4e421420); // FADD.8H V0, V1, V2
+    env.code_mem.emplace_back(0x4e423423); // FMAX.8H V3, V1, V2
+    env.code_mem.emplace_back(0x4ec20424); // FMINNM.8H V4, V1, V2
+    env.code_mem.emplace_back(0x6ec22425); // FCMGT.8H V5, V1, V2
+    env.code_mem.emplace_back(0x1ee1c0e6); // FSQRT H6, H7
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(1, {0x7bff000180003c00, 0x04003555c0007e00});
+    jit.SetVector(2, {0x7bff000100004000, 0x84003555bc003c00});
+    jit.SetVector(7, {0x0000000000004400, 0});
+
+    env.ticks_left = 6;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0x7c00000200004200, 0x00003955c2007e00});
+    REQUIRE(jit.GetVector(3) == Vector{0x7bff000100004000, 0x04003555bc007e00});
+    REQUIRE(jit.GetVector(4) == Vector{0x7bff000180003c00, 0x84003555c0003c00});
+    REQUIRE(jit.GetVector(5) == Vector{0x0000000000000000, 0xffff000000000000});
+    REQUIRE(jit.GetVector(6) == Vector{0x0000000000004000, 0});
+
+    const FP::FPSR fpsr{jit.GetFpsr()};
+    REQUIRE(fpsr.IOC() == true);  // FCMGT signals on quiet NaN
+    REQUIRE(fpsr.OFC() == true);
+    REQUIRE(fpsr.IXC() == true);
+    REQUIRE(fpsr.UFC() == false);
+    REQUIRE(fpsr.DZC() == false);
+}
+
+TEST_CASE("A64: FCMGE FCVTZS FADDP FMUL (half precision scalar and by element)", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x7e422420); // FCMGE H0, H1, H2
+    env.code_mem.emplace_back(0x7ec22c23); // FACGT H3, H1, H2
+    env.code_mem.emplace_back(0x7ec21424); // FABD H4, H1, H2
+    env.code_mem.emplace_back(0x5ef8e825); // FCMLT H5, H1, #0.0
+    env.code_mem.emplace_back(0x5ef9b826); // FCVTZS H6, H1
+    env.code_mem.emplace_back(0x7e79c827); // FCVTAU H7, H1
+    env.code_mem.emplace_back(0x5e79b828); // FCVTMS H8, H1
+    env.code_mem.emplace_back(0x5e30c949); // FMAXNMP H9, V10.2H
+    env.code_mem.emplace_back(0x5e30d94b); // FADDP H11, V10.2H
+    env.code_mem.emplace_back(0x5eb0f94c); // FMINP H12, V10.2H
+    env.code_mem.emplace_back(0x5f12982d); // FMUL H13, H1, V2.H[5]
+    env.code_mem.emplace_back(0x4f12914e); // FMUL.8H V14, V10, V2.H[1]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    // The upper lanes of V1 hold signalling NaNs, which must not affect the scalar forms.
+    jit.SetPC(0);
+    jit.SetVector(1, {0x7d007d007d00c100, 0x7d007d007d007d00});
+    jit.SetVector(2, {0x0000000042004000, 0x0000000038000000});
+    jit.SetVector(10, {0x50005000b8003c00, 0x5000500050005000});
+
+    env.ticks_left = 13;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0x0000, 0});
+    REQUIRE(jit.GetVector(3) == Vector{0xffff, 0});
+    REQUIRE(jit.GetVector(4) == Vector{0x4480, 0});
+    REQUIRE(jit.GetVector(5) == Vector{0xffff, 0});
+    REQUIRE(jit.GetVector(6) == Vector{0xfffe, 0});
+    REQUIRE(jit.GetVector(7) == Vector{0x0000, 0});
+    REQUIRE(jit.GetVector(8) == Vector{0xfffd, 0});
+    REQUIRE(jit.GetVector(9) == Vector{0x3c00, 0});
+    REQUIRE(jit.GetVector(11) == Vector{0x3800, 0});
+    REQUIRE(jit.GetVector(12) == Vector{0xb800, 0});
+    REQUIRE(jit.GetVector(13) == Vector{0xbd00, 0});
+    REQUIRE(jit.GetVector(14) == Vector{0x56005600be004200, 0x5600560056005600});
+}
+
 TEST_CASE("A64: SQDMULH.8H (saturate)", "[a64]") {
     A64TestEnv env;
     A64::Jit jit{A64::UserConfig{&env}};
@@ -533,6 +762,418 @@ TEST_CASE("A64: SQDMULH.4S (saturate)", "[a64]") {
     REQUIRE(FP::FPSR{jit.GetFpsr()}.QC() == true);
 }
 
+TEST_CASE("A64: SSHL.16B", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4e224420); // SSHL.16B V0, V1, V2
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    // Make sure that out of range and negative shift amounts are tested
+
+    jit.SetPC(0);
+    jit.SetVector(1, {0x80FF7F01C0407F80, 0x0123456789ABCDEF});
+    jit.SetVector(2, {0x0107F9F8FF0201F0, 0x8008FC04807F0003});
+
+    env.ticks_left = 2;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0x00800000E000FEFF, 0x00000470FF00CD78});
+}
+
+TEST_CASE("A64: SRSHL.2D and URSHL.4S", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4ee25420); // SRSHL.2D V0, V1, V2
+    env.code_mem.emplace_back(0x6ea45473); // URSHL.4S V19, V3, V4
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(1, {0x8000000000000001, 0x7FFFFFFFFFFFFFFF});
+    jit.SetVector(2, {0x00000000000000C1, 0x00000000000000FF});
+    jit.SetVector(3, {0x0000000180000000, 0xFFFFFFFF00001234});
+    jit.SetVector(4, {0x000000E0000000FF, 0x000000E1000000F4});
+
+    env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0xFFFFFFFFFFFFFFFF, 0x4000000000000000});
+    REQUIRE(jit.GetVector(19) == Vector{0x0000000040000000, 0x0000000200000001});
+}
+
+TEST_CASE("A64: Vector shift, pairwise and count throughput", "[.][a64][bench]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    for (size_t i = 0; i < 8; i++) {
+        jit.SetVector(i, {0x80FF7F01C0407F80 + i, 0x0123456789ABCDEF - i});
+    }
+    jit.SetVector(30, {0x0107F9F8FF0201F0, 0x8008FC04807F0003});
+
+    // Vd = op(Vd, V30)
+    const std::vector<std::pair<const char*, u32>> instructions{
+        {"ADD.4S (reference)", 0x4ebe8400},
+        {"SRSHL.16B (C++ fallback)", 0x4e3e5400},
+        {"USHL.16B", 0x6e3e4400},
+        {"SSHL.16B", 0x4e3e4400},
+        {"USHL.8H", 0x6e7e4400},
+        {"SSHL.8H", 0x4e7e4400},
+        {"SSHL.2D", 0x4efe4400},
+        {"SRSHL.8H", 0x4e7e5400},
+        {"URSHL.4S", 0x6ebe5400},
+        {"SRSHL.2D", 0x4efe5400},
+        {"SMAXP.16B", 0x4e3ea400},
+        {"UMINP.8H", 0x6e7eac00},
+        {"CLZ.4S", 0x6ea04800},
+        {"CNT.16B", 0x4e205800},
+    };
+
+    for (const auto& [name, instruction] : instructions) {
+        fmt::print("{}: {:.2f} ns\n", name, MeasureInstruction(env, jit, instruction));
+    }
+}
+
+TEST_CASE("A64: SQRSHL.8H (saturate)", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4e625c20); // SQRSHL.8H V0, V1, V2
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    // Make sure that rounding right shifts, saturating left shifts and out of range shifts are tested
+
+    jit.SetPC(0);
+    jit.SetVector(1, {0x7FFF400080000003, 0x1234C0000005FFFF});
+    jit.SetVector(2, {0x00000001FFF1FFFF, 0x00800002FFFE000E});
+    jit.SetFpsr(0);
+
+    env.ticks_left = 2;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0x7FFF7FFFFFFF0002, 0x000080000001C000});
+    REQUIRE(FP::FPSR{jit.GetFpsr()}.QC() == true);
+}
+
+TEST_CASE("A64: SQRDMLAH.4S and SQDMLAL.4S (saturate)", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x6e858483); // SQRDMLAH.4S V3, V4, V5
+    env.code_mem.emplace_back(0x0e6890e6); // SQDMLAL.4S V6, V7.4H, V8.4H
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(3, {0x000000107FFFFFFF, 0x0000000080000000});
+    jit.SetVector(4, {0x400000007FFFFFFF, 0x0001000080000000});
+    jit.SetVector(5, {0x000000047FFFFFFF, 0x0000400000000001});
+    jit.SetVector(6, {0x0000006400000000, 0xFFFF00007FFFFFFF});
+    jit.SetVector(7, {0x80007FFF00038000, 0xDEADBEEFDEADBEEF});
+    jit.SetVector(8, {0x7FFF7FFFFFFE8000, 0x0123456789ABCDEF});
+    jit.SetFpsr(0);
+
+    env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(3) == Vector{0x000000127FFFFFFF, 0x0000000180000000});
+    REQUIRE(jit.GetVector(6) == Vector{0x000000587FFFFFFF, 0x800000007FFFFFFF});
+    REQUIRE(FP::FPSR{jit.GetFpsr()}.QC() == true);
+}
+
+TEST_CASE("A64: BSL BIT BIF", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x6e621c20); // BSL.16B V0, V1, V2
+    env.code_mem.emplace_back(0x6ea51c83); // BIT.16B V3, V4, V5
+    env.code_mem.emplace_back(0x6ee81ce6); // BIF.16B V6, V7, V8
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(0, {0xFF00FF00F0F0F0F0, 0x0123456789ABCDEF});
+    jit.SetVector(1, {0x1111111111111111, 0xFFFFFFFFFFFFFFFF});
+    jit.SetVector(2, {0x2222222222222222, 0x0000000000000000});
+    jit.SetVector(3, {0xAAAAAAAAAAAAAAAA, 0x0000000000000000});
+    jit.SetVector(4, {0x5555555555555555, 0xFFFFFFFFFFFFFFFF});
+    jit.SetVector(5, {0x00000000FFFFFFFF, 0x0F0F0F0F0F0F0F0F});
+    jit.SetVector(6, {0x1234567812345678, 0xFFFFFFFFFFFFFFFF});
+    jit.SetVector(7, {0x8765432187654321, 0x0000000000000000});
+    jit.SetVector(8, {0xFFFF0000FFFF0000, 0x00000000FFFFFFFF});
+
+    env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0x1122112212121212, 0x0123456789ABCDEF});
+    REQUIRE(jit.GetVector(3) == Vector{0xAAAAAAAA55555555, 0x0F0F0F0F0F0F0F0F});
+    REQUIRE(jit.GetVector(6) == Vector{0x1234432112344321, 0x00000000FFFFFFFF});
+}
+
+TEST_CASE("A64: TBL TBX", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4e044020); // TBL.16B V0, {V1, V2, V3}, V4
+    env.code_mem.emplace_back(0x4e0a70c5); // TBX.16B V5, {V6, V7, V8, V9}, V10
+    env.code_mem.emplace_back(0x4f00e66b); // MOVI.16B V11, #0x13
+    env.code_mem.emplace_back(0x4e0b202c); // TBL.16B V12, {V1, V2}, V11
+    env.code_mem.emplace_back(0x0e04502d); // TBX.8B V13, {V1, V2, V3}, V4
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(1, {0x8786858483828180, 0x8F8E8D8C8B8A8988});
+    jit.SetVector(2, {0x9796959493929190, 0x9F9E9D9C9B9A9998});
+    jit.SetVector(3, {0xA7A6A5A4A3A2A1A0, 0xAFAEADACABAAA9A8});
+    jit.SetVector(4, {0x1A05FF302F221100, 0x802E1F200F401329});
+    jit.SetVector(5, {0x5555555555555555, 0x5555555555555555});
+    jit.SetVector(6, {0xC7C6C5C4C3C2C1C0, 0xCFCECDCCCBCAC9C8});
+    jit.SetVector(7, {0xD7D6D5D4D3D2D1D0, 0xDFDEDDDCDBDAD9D8});
+    jit.SetVector(8, {0xE7E6E5E4E3E2E1E0, 0xEFEEEDECEBEAE9E8});
+    jit.SetVector(9, {0xF7F6F5F4F3F2F1F0, 0xFFFEFDFCFBFAF9F8});
+    jit.SetVector(10, {0x0E31FF2510403F00, 0x3F2B02803A1C2041});
+    jit.SetVector(13, {0x6666666666666666, 0x7777777777777777});
+
+    env.ticks_left = 6;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0x9A850000AFA29180, 0x00AE9FA08F0093A9});
+    REQUIRE(jit.GetVector(5) == Vector{0xCEF155E5D055FFC0, 0xFFEBC255FADCE055});
+    REQUIRE(jit.GetVector(12) == Vector{0x9393939393939393, 0x9393939393939393});
+    REQUIRE(jit.GetVector(13) == Vector{0x9A856666AFA29180, 0x0000000000000000});
+}
+
+TEST_CASE("A64: TBL TBX throughput", "[.][a64][bench]") {
+    constexpr size_t iterations = 100000;
+
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    // A 64-byte substitution table in V16-V19, as used by base64 and similar codecs
+    for (size_t reg = 0; reg < 4; reg++) {
+        Vector table{};
+        for (size_t i = 0; i < 16; i++) {
+            const u64 entry = ((reg * 16 + i) * 37 + 11) % 64;
+            table[i / 8] |= entry << (i % 8 * 8);
+        }
+        jit.SetVector(16 + reg, table);
+    }
+
+    // Eight interleaved chains through V0-V7. Vd is the index vector, or with a constant index, the table.
+    const auto measure = [&](const char* name, std::vector<u32> body, u32 instruction, bool constant_index) {
+        const size_t prologue_size = body.size();
+        for (size_t i = 0; i < 4; i++) {
+            for (u32 reg = 0; reg < 8; reg++) {
+                body.emplace_back(instruction | (constant_index ? reg << 5 : reg << 16) | reg);
+            }
+        }
+        for (size_t i = 0; i < 8; i++) {
+            jit.SetVector(i, {0x3F2A15001B0C3927 + i, 0x0137220E2D341806 + i});
+        }
+        const double ms = MeasureLoop(env, jit, body, iterations);
+        fmt::print("{}: {:.2f} ns\n", name, ms * 1e6 / ((body.size() - prologue_size) * iterations));
+    };
+
+    measure("TBL (1 register)", {}, 0x4e000200, false);
+    measure("TBL (2 registers)", {}, 0x4e002200, false);
+    measure("TBL (3 registers)", {}, 0x4e004200, false);
+    measure("TBL (4 registers)", {}, 0x4e006200, false);
+    measure("TBX (4 registers)", {}, 0x4e007200, false);
+    measure("TBL (constant index)", {0x4f00e4a8}, 0x4e080000, true); // MOVI V8.16B, #5; TBL Vd.16B, {Vd.16B}, V8.16B
+}
+
+TEST_CASE("A64: SHA1C SHA256H SHA256SU1 SM4E", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x5e020020); // SHA1C Q0, S1, V2.4S
+    env.code_mem.emplace_back(0x5e0b4149); // SHA256H Q9, Q10, V11.4S
+    env.code_mem.emplace_back(0x5e136251); // SHA256SU1 V17.4S, V18.4S, V19.4S
+    env.code_mem.emplace_back(0xcec086b4); // SM4E V20.4S, V21.4S
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(0, {0x2245bd5fbb686f68, 0x22eb92502318fa4e});
+    jit.SetVector(1, {0x7382d1e77ae6459a, 0x0561d8057935c08e});
+    jit.SetVector(2, {0x59d47572ecfc6738, 0xe94ec2d2b9936849});
+    jit.SetVector(9, {0x797efaca4dbd97e3, 0x451ac15e436fcbe8});
+    jit.SetVector(10, {0x493a09523afa6fcf, 0xbfbddc1f91c5bf67});
+    jit.SetVector(11, {0x7547a68cfdd04144, 0x4e6240030eecc15b});
+    jit.SetVector(17, {0x30bb3e55b6d6c3ee, 0x98d462c4ea0c48bc});
+    jit.SetVector(18, {0xe36f837b19707512, 0x5edfffb0a1180e13});
+    jit.SetVector(19, {0x09d7152814d89685, 0x48840c169f64a1fc});
+    jit.SetVector(20, {0xe2a351c63e427c90, 0x4303ac94ba574d30});
+    jit.SetVector(21, {0x853e8231c1113570, 0x04ff591b35f3337d});
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0x12b85ec807cea107, 0xfde6d50dbe0ee381});
+    REQUIRE(jit.GetVector(9) == Vector{0xc9e669a07740cea0, 0xe2b36940a3d33a35});
+    REQUIRE(jit.GetVector(17) == Vector{0x596f18b95f2c4cdf, 0x1d0ad5a5f8cfd7cc});
+    REQUIRE(jit.GetVector(20) == Vector{0xe0dc8ed8f44ff838, 0x463805c8a743ada4});
+}
+
+TEST_CASE("A64: SHA1C SHA256H throughput against scalar expansion", "[.][a64][bench]") {
+    constexpr size_t iterations = 1000000;
+
+    const auto umov = [](size_t d, size_t n, size_t i) -> u32 { return 0x0e003c00 | static_cast<u32>(((i << 3) | 4) << 16 | n << 5 | d); };
+    const auto ins = [](size_t d, size_t i, size_t n) -> u32 { return 0x4e001c00 | static_cast<u32>(((i << 3) | 4) << 16 | n << 5 | d); };
+    const auto three = [](u32 opcode) {
+        return [opcode](size_t d, size_t n, size_t m) -> u32 { return opcode | static_cast<u32>(m << 16 | n << 5 | d); };
+    };
+    const auto eor = three(0x4a000000);
+    const auto and_ = three(0x0a000000);
+    const auto orr = three(0x2a000000);
+    const auto add = three(0x0b000000);
+    const auto ror = [](size_t d, size_t n, size_t amount) -> u32 { return 0x13800000 | static_cast<u32>(n << 16 | amount << 10 | n << 5 | d); };
+    const auto rotate_words_up = [](size_t v) -> u32 { return 0x6e006000 | static_cast<u32>(v << 16 | v << 5 | v); }; // EXT Vv.16B, Vv.16B, Vv.16B, #12
+
+    // These mirror, operation for operation, the scalar IR sequences SHA1C and SHA256H used to be expanded into.
+    // x is in V0, y in W20 (SHA1C) or a copy of V1 in V3 (SHA256H), and w in V2.
+    std::vector<u32> sha1c_expansion{umov(20, 1, 0)};
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t e = 0; e < 4; e++) {
+            sha1c_expansion.emplace_back(umov(4 + e, 0, e));
+        }
+        sha1c_expansion.insert(sha1c_expansion.end(), {
+            eor(12, 6, 7), and_(12, 12, 5), eor(12, 12, 7),
+            umov(15, 2, i), ror(16, 4, 27),
+            add(20, 20, 16), add(20, 20, 12), add(20, 20, 15),
+            ror(17, 5, 2), ins(0, 1, 17),
+            rotate_words_up(0), ins(0, 0, 20),
+            orr(20, 31, 7),
+        });
+    }
+
+    std::vector<u32> sha256h_expansion{0x4ea11c23}; // MOV V3.16B, V1.16B
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t e = 0; e < 4; e++) {
+            sha256h_expansion.emplace_back(umov(4 + e, 0, e));
+            sha256h_expansion.emplace_back(umov(8 + e, 3, e));
+        }
+        sha256h_expansion.insert(sha256h_expansion.end(), {
+            eor(12, 9, 10), and_(12, 12, 8), eor(12, 12, 10),
+            and_(13, 4, 5), orr(14, 4, 5), and_(14, 14, 6), orr(13, 13, 14),
+            umov(15, 2, i),
+            ror(16, 8, 6), ror(17, 8, 11), ror(19, 8, 25), eor(17, 17, 19), eor(16, 16, 17),
+            add(12, 12, 15), add(12, 16, 12), add(12, 11, 12),
+            ror(16, 4, 2), ror(17, 4, 13), ror(19, 4, 22), eor(17, 17, 19), eor(16, 16, 17),
+            add(13, 16, 13), add(13, 12, 13),
+            add(14, 12, 7),
+            rotate_words_up(0), rotate_words_up(3),
+            ins(0, 0, 13), ins(3, 0, 14),
+        });
+    }
+
+    const auto measure = [&](const std::vector<u32>& body, Vector& result) {
+        A64TestEnv env;
+        A64::Jit jit{A64::UserConfig{&env}};
+        jit.SetVector(0, {0x2245bd5fbb686f68, 0x22eb92502318fa4e});
+        jit.SetVector(1, {0x7382d1e77ae6459a, 0x0561d8057935c08e});
+        jit.SetVector(2, {0x59d47572ecfc6738, 0xe94ec2d2b9936849});
+        const double ms = MeasureLoop(env, jit, body, iterations);
+        result = jit.GetVector(0);
+        return ms;
+    };
+
+    const auto compare = [&](const char* name, u32 instruction, const std::vector<u32>& expansion) {
+        Vector expected, actual;
+        const double expansion_ms = measure(expansion, expected);
+        const double instruction_ms = measure({instruction}, actual);
+        REQUIRE(actual == expected);
+        fmt::print("{}: scalar expansion {:.1f} ms, dedicated IR operation {:.1f} ms ({:.2f}x)\n",
+                   name, expansion_ms, instruction_ms, expansion_ms / instruction_ms);
+    };
+
+    compare("SHA1C", 0x5e020020, sha1c_expansion);   // SHA1C Q0, S1, V2.4S
+    compare("SHA256H", 0x5e024020, sha256h_expansion); // SHA256H Q0, Q1, V2.4S
+}
+
+TEST_CASE("A64: AESE AESD AESMC AESIMC CRC32X CRC32CB", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x4e284820); // AESE V0.16B, V1.16B
+    env.code_mem.emplace_back(0x4e285862); // AESD V2.16B, V3.16B
+    env.code_mem.emplace_back(0x4e2868a4); // AESMC V4.16B, V5.16B
+    env.code_mem.emplace_back(0x4e2878e6); // AESIMC V6.16B, V7.16B
+    env.code_mem.emplace_back(0x9ad34e51); // CRC32X W17, W18, X19
+    env.code_mem.emplace_back(0x1ad652b4); // CRC32CB W20, W21, W22
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(0, {0x2245bd5fbb686f68, 0x22eb92502318fa4e});
+    jit.SetVector(1, {0x7382d1e77ae6459a, 0x0561d8057935c08e});
+    jit.SetVector(2, {0x59d47572ecfc6738, 0xe94ec2d2b9936849});
+    jit.SetVector(3, {0x797efaca4dbd97e3, 0x451ac15e436fcbe8});
+    jit.SetVector(5, {0x493a09523afa6fcf, 0xbfbddc1f91c5bf67});
+    jit.SetVector(7, {0x7547a68cfdd04144, 0x4e6240030eecc15b});
+    jit.SetRegister(18, 0x1d0ad5a5);
+    jit.SetRegister(19, 0x98d462c4ea0c48bc);
+    jit.SetRegister(21, 0xc1113570);
+    jit.SetRegister(22, 0x3e427c90);
+
+    env.ticks_left = 7;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(0) == Vector{0x787e806cccd85089, 0xbec6e5fcd119d6ba});
+    REQUIRE(jit.GetVector(2) == Vector{0x14fd179a5455d59f, 0xf16271f0aaf873f1});
+    REQUIRE(jit.GetVector(4) == Vector{0x57f447ccab013ef4, 0x2578df43eae1c740});
+    REQUIRE(jit.GetVector(6) == Vector{0x25fac601219fcd5b, 0xd69f0620204c1f0b});
+    REQUIRE(jit.GetRegister(17) == 0x685a2fde);
+    REQUIRE(jit.GetRegister(20) == 0xe3f1b92f);
+}
+
+TEST_CASE("A64: AES and CRC32 throughput", "[.][a64][bench]") {
+    constexpr size_t iterations = 10000000;
+
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    jit.SetVector(0, {0x2245bd5fbb686f68, 0x22eb92502318fa4e});
+    jit.SetVector(1, {0x7382d1e77ae6459a, 0x0561d8057935c08e});
+    jit.SetRegister(0, 0x1d0ad5a5);
+    jit.SetRegister(1, 0x98d462c4ea0c48bc);
+
+    // Each loop iteration is one link of a dependency chain through V0 or W0.
+    const auto measure = [&](const char* name, const std::vector<u32>& body) {
+        const double ms = MeasureLoop(env, jit, body, iterations);
+        fmt::print("{}: {:.1f} ms for {} iterations ({:.2f} ns each)\n", name, ms, iterations, ms * 1e6 / iterations);
+    };
+
+    measure("AESE+AESMC", {0x4e284820, 0x4e286800});   // AESE V0.16B, V1.16B; AESMC V0.16B, V0.16B
+    measure("AESD+AESIMC", {0x4e285820, 0x4e287800});  // AESD V0.16B, V1.16B; AESIMC V0.16B, V0.16B
+    measure("CRC32B", {0x1ac14000});                   // CRC32B W0, W0, W1
+    measure("CRC32X", {0x9ac14c00});                   // CRC32X W0, W0, X1
+    measure("CRC32CX", {0x9ac15c00});                  // CRC32CX W0, W0, X1
+}
+
+TEST_CASE("A64: UQADD.2D UQSUB.4S SQSUB.2D (saturate)", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x6eeb0d49); // UQADD.2D V9, V10, V11
+    env.code_mem.emplace_back(0x6eae2dac); // UQSUB.4S V12, V13, V14
+    env.code_mem.emplace_back(0x4ef12e0f); // SQSUB.2D V15, V16, V17
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetPC(0);
+    jit.SetVector(10, {0xFFFFFFFFFFFFFFF0, 0x7FFFFFFFFFFFFFFF});
+    jit.SetVector(11, {0x0000000000000010, 0x0000000000000001});
+    jit.SetVector(13, {0x0000000500000010, 0x8000000000000000});
+    jit.SetVector(14, {0x0000000600000001, 0x7FFFFFFF00000000});
+    jit.SetVector(16, {0x8000000000000000, 0x7FFFFFFFFFFFFFFE});
+    jit.SetVector(17, {0x0000000000000001, 0xFFFFFFFFFFFFFFFF});
+    jit.SetFpsr(0);
+
+    env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.GetVector(9) == Vector{0xFFFFFFFFFFFFFFFF, 0x8000000000000000});
+    REQUIRE(jit.GetVector(12) == Vector{0x000000000000000F, 0x0000000100000000});
+    REQUIRE(jit.GetVector(15) == Vector{0x8000000000000000, 0x7FFFFFFFFFFFFFFF});
+    REQUIRE(FP::FPSR{jit.GetFpsr()}.QC() == true);
+}
+
 TEST_CASE("A64: This is an infinite loop if fast dispatch is enabled", "[a64]") {
     A64TestEnv env;
     A64::UserConfig conf{&env};
@@ -634,3 +1275,925 @@ TEST_CASE("A64: Optimization failure when folding ADD", "[a64]") {
     REQUIRE(jit.GetPstate() == 0x20000000);
     REQUIRE(jit.GetVector(30) == Vector{0xf7f6f5f4, 0});
 }
+
+TEST_CASE("A64: Fastmem loads and stores (mirrored arena)", "[a64]") {
+    A64TestEnv env;
+    std::vector<u8> arena(1 << 16);
+    for (size_t i = 0; i < arena.size(); i++) {
+        arena[i] = static_cast<u8>(i);
+    }
+
+    A64::UserConfig conf{&env};
+    conf.fastmem_pointer = arena.data();
+    conf.fastmem_address_space_bits = 16;
+    conf.silently_mirror_fastmem = true;
+    A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xf9400020); // LDR X0, [X1]
+    env.code_mem.emplace_back(0xf9000420); // STR X0, [X1, #8]
+    env.code_mem.emplace_back(0x3dc00420); // LDR Q0, [X1, #16]
+    env.code_mem.emplace_back(0x3d800820); // STR Q0, [X1, #32]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(1, 0x1234'0000'0100);
+    jit.SetPC(0);
+
+    env.ticks_left = 5;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x0706050403020100);
+    REQUIRE(jit.GetVector(0) == Vector{0x1716151413121110, 0x1f1e1d1c1b1a1918});
+    REQUIRE(env.modified_memory.empty());
+    for (size_t i = 0; i < 8; i++) {
+        REQUIRE(arena[0x108 + i] == i);
+    }
+    for (size_t i = 0; i < 16; i++) {
+        REQUIRE(arena[0x120 + i] == 0x10 + i);
+    }
+}
+
+TEST_CASE("A64: Fastmem falls back to callbacks outside of arena", "[a64]") {
+    A64TestEnv env;
+    std::vector<u8> arena(1 << 16);
+
+    A64::UserConfig conf{&env};
+    conf.fastmem_pointer = arena.data();
+    conf.fastmem_address_space_bits = 16;
+    conf.silently_mirror_fastmem = false;
+    A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xf9400020); // LDR X0, [X1]
+    env.code_mem.emplace_back(0xf9000440); // STR X0, [X2, #8]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(1, 0x10000);
+    jit.SetRegister(2, 0x100);
+    jit.SetPC(0);
+
+    env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x0706050403020100);
+    for (size_t i = 0; i < 8; i++) {
+        REQUIRE(arena[0x108 + i] == i);
+    }
+}
+
+#ifndef _WIN32
+TEST_CASE("A64: Fastmem faults fall back to callbacks", "[a64]") {
+    constexpr size_t arena_size = 1 << 16;
+    constexpr size_t protected_page = 0x2000;
+
+    void* const arena = mmap(nullptr, arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(arena != MAP_FAILED);
+    SCOPE_EXIT { munmap(arena, arena_size); };
+    std::memset(arena, 0xEE, arena_size);
+    REQUIRE(mprotect(static_cast<u8*>(arena) + protected_page, 0x1000, PROT_NONE) == 0);
+
+    for (const bool recompile : {false, true}) {
+        A64TestEnv env;
+        A64::UserConfig conf{&env};
+        conf.fastmem_pointer = arena;
+        conf.fastmem_address_space_bits = 16;
+        conf.silently_mirror_fastmem = false;
+        conf.recompile_on_fastmem_failure = recompile;
+        A64::Jit jit{conf};
+
+        env.code_mem.emplace_back(0xf9400020); // LDR X0, [X1]
+        env.code_mem.emplace_back(0xf9000420); // STR X0, [X1, #8]
+        env.code_mem.emplace_back(0x14000000); // B .
+
+        for (size_t run = 0; run < 2; run++) {
+            env.modified_memory.clear();
+            jit.SetRegister(0, 0);
+            jit.SetRegister(1, protected_page + 0x100);
+            jit.SetPC(0);
+
+            env.ticks_left = 3;
+            jit.Run();
+
+            // Accesses to the protected page are served by the memory callbacks.
+            REQUIRE(jit.GetRegister(0) == 0x0706050403020100);
+            REQUIRE(env.modified_memory.size() == 8);
+            for (size_t i = 0; i < 8; i++) {
+                REQUIRE(env.modified_memory[protected_page + 0x108 + i] == i);
+            }
+        }
+
+        // A faulting block is only emitted again, without fastmem, if recompile_on_fastmem_failure is set.
+        REQUIRE(jit.GetCodeCacheStatistics().emitted_blocks == (recompile ? 2 : 1));
+    }
+}
+#endif
+
+TEST_CASE("A64: Exclusive loads and stores via page table", "[a64]") {
+    A64TestEnv env;
+    ExclusiveMonitor monitor{1};
+    std::vector<u8> page(4096);
+    std::vector<void*> page_table(16, nullptr);
+    page_table[1] = page.data();
+
+    A64::UserConfig conf{&env};
+    conf.global_monitor = &monitor;
+    conf.page_table = page_table.data();
+    conf.page_table_address_space_bits = 16;
+    A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xc85f7c20); // LDXR X0, [X1]
+    env.code_mem.emplace_back(0x91000400); // ADD X0, X0, #1
+    env.code_mem.emplace_back(0xc8027c20); // STXR W2, X0, [X1]
+    env.code_mem.emplace_back(0xc8037c20); // STXR W3, X0, [X1]
+    env.code_mem.emplace_back(0x885f7ca4); // LDXR W4, [X5]
+    env.code_mem.emplace_back(0x88067ca4); // STXR W6, W4, [X5]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    page[8] = 0x41;
+    jit.SetRegister(1, 0x1008);
+    jit.SetRegister(5, 0x3010);
+    jit.SetPC(0);
+
+    env.ticks_left = 7;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 0x42);
+    REQUIRE(jit.GetRegister(2) == 0);
+    REQUIRE(jit.GetRegister(3) == 1);
+    REQUIRE(page[8] == 0x42);
+
+    // Unmapped pages fall back to the memory callbacks.
+    REQUIRE(jit.GetRegister(4) == 0x13121110);
+    REQUIRE(jit.GetRegister(6) == 0);
+    REQUIRE(env.MemoryRead32(0x3010) == 0x13121110);
+    REQUIRE(env.modified_memory.size() == 4);
+}
+
+TEST_CASE("A64: Exclusive store fails after another processor's exclusive store", "[a64]") {
+    ExclusiveMonitor monitor{2};
+    std::vector<u8> arena(1 << 16);
+
+    const auto make_config = [&](A64TestEnv& env, size_t processor_id) {
+        A64::UserConfig conf{&env};
+        conf.global_monitor = &monitor;
+        conf.processor_id = processor_id;
+        conf.fastmem_pointer = arena.data();
+        conf.fastmem_address_space_bits = 16;
+        return conf;
+    };
+
+    A64TestEnv env0;
+    A64::Jit jit0{make_config(env0, 0)};
+    env0.code_mem.emplace_back(0xc85f7c20); // LDXR X0, [X1]
+    env0.code_mem.emplace_back(0x14000000); // B .
+    env0.code_mem.emplace_back(0xc8027c20); // STXR W2, X0, [X1]
+    env0.code_mem.emplace_back(0x14000000); // B .
+
+    A64TestEnv env1;
+    A64::Jit jit1{make_config(env1, 1)};
+    env1.code_mem.emplace_back(0xc85f7c20); // LDXR X0, [X1]
+    env1.code_mem.emplace_back(0x91000400); // ADD X0, X0, #1
+    env1.code_mem.emplace_back(0xc8027c20); // STXR W2, X0, [X1]
+    env1.code_mem.emplace_back(0x14000000); // B .
+
+    jit0.SetRegister(1, 0x200);
+    jit0.SetRegister(0, 0x1234);
+    jit0.SetPC(0);
+    env0.ticks_left = 2;
+    jit0.Run();
+
+    jit1.SetRegister(1, 0x200);
+    jit1.SetPC(0);
+    env1.ticks_left = 4;
+    jit1.Run();
+
+    REQUIRE(jit1.GetRegister(2) == 0);
+    REQUIRE(arena[0x200] == 1);
+
+    jit0.SetPC(8);
+    env0.ticks_left = 2;
+    jit0.Run();
+
+    REQUIRE(jit0.GetRegister(2) == 1);
+    REQUIRE(arena[0x200] == 1);
+    REQUIRE(env0.modified_memory.empty());
+    REQUIRE(env1.modified_memory.empty());
+}
+
+TEST_CASE("A64: ChangeProcessorID keeps inlined exclusive accesses", "[a64]") {
+    struct CountingTestEnv final : public A64TestEnv {
+        size_t code_reads = 0;
+
+        std::uint32_t MemoryReadCode(u64 vaddr) override {
+            code_reads++;
+            return A64TestEnv::MemoryReadCode(vaddr);
+        }
+    };
+
+    CountingTestEnv env;
+    ExclusiveMonitor monitor{2};
+    std::vector<u8> arena(1 << 16);
+
+    A64::UserConfig conf{&env};
+    conf.global_monitor = &monitor;
+    conf.processor_id = 0;
+    conf.fastmem_pointer = arena.data();
+    conf.fastmem_address_space_bits = 16;
+    A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xc85f7c20); // LDXR X0, [X1]
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0xc8027c20); // STXR W2, X0, [X1]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    // Loads a reservation, lets another agent clear the given processor's reservation, then stores.
+    const auto load_and_store_exclusive = [&](size_t cleared_processor) {
+        jit.SetRegister(1, 0x200);
+        jit.SetRegister(2, 0xff);
+        jit.SetPC(0);
+        env.ticks_left = 2;
+        jit.Run();
+
+        monitor.ClearProcessor(cleared_processor);
+
+        jit.SetPC(8);
+        env.ticks_left = 2;
+        jit.Run();
+        return jit.GetRegister(2);
+    };
+
+    REQUIRE(load_and_store_exclusive(1) == 0);
+    REQUIRE(load_and_store_exclusive(0) == 1);
+    const size_t code_reads = env.code_reads;
+
+    jit.ChangeProcessorID(1);
+
+    REQUIRE(load_and_store_exclusive(0) == 0);
+    REQUIRE(load_and_store_exclusive(1) == 1);
+    REQUIRE(env.code_reads == code_reads);
+    REQUIRE(env.modified_memory.empty());
+}
+
+TEST_CASE("A64: Atomic memory operations agree across memory access paths", "[a64]") {
+    const std::array<u32, 19> program{
+        0xf8220020, // LDADD X2, X0, [X1]
+        0xb8238024, // SWP W3, W4, [X1]
+        0x38254026, // LDSMAXB W5, W6, [X1]
+        0x78271028, // LDCLRH W7, W8, [X1]
+        0xc8a97c2a, // CAS X9, X10, [X1]
+        0xc8a97c2a, // CAS X9, X10, [X1]
+        0x082e7c30, // CASP W14, W15, W16, W17, [X1]
+        0x082e7c30, // CASP W14, W15, W16, W17, [X1]
+        0xf8327033, // LDUMIN X18, X19, [X1]
+        0xb8f42035, // LDEORAL W20, W21, [X1]
+        0xf8bfc036, // LDAPR X22, [X1]
+        0xf822303f, // STSET X2, [X1]
+        0x482e7c30, // CASP X14, X15, X16, X17, [X1]
+        0x482e7c30, // CASP X14, X15, X16, X17, [X1]
+        0xf8bfc037, // LDAPR X23, [X1]
+        0x38237038, // LDUMINB W3, W24, [X1]
+        0xf8e28039, // SWPAL X2, X25, [X1]
+        0xf8bfc03a, // LDAPR X26, [X1]
+        0x14000000, // B .
+    };
+
+    struct Result {
+        std::array<u64, 27> regs;
+        u64 memory_lo;
+        u64 memory_hi;
+    };
+
+    const auto run = [&](A64TestEnv& env, A64::UserConfig conf, const std::function<u64(u64)>& read_memory) {
+        A64::Jit jit{conf};
+        env.code_mem.assign(program.begin(), program.end());
+
+        jit.SetRegister(1, 0x1100);
+        jit.SetRegister(2, 0x1111);
+        jit.SetRegister(3, 0xAABBCCDD);
+        jit.SetRegister(5, 0x7F);
+        jit.SetRegister(7, 0xFF00);
+        jit.SetRegister(9, 0);
+        jit.SetRegister(10, 0x0123456789ABCDEF);
+        jit.SetRegister(14, 0);
+        jit.SetRegister(15, 0);
+        jit.SetRegister(16, 0xCAFEBABE);
+        jit.SetRegister(17, 0xDEADBEEF);
+        jit.SetRegister(18, 0x100);
+        jit.SetRegister(20, 0xFFFF);
+        jit.SetPC(0);
+
+        env.ticks_left = program.size();
+        jit.Run();
+
+        Result result;
+        for (size_t i = 0; i < result.regs.size(); i++) {
+            result.regs[i] = jit.GetRegister(i);
+        }
+        result.memory_lo = read_memory(0x1100);
+        result.memory_hi = read_memory(0x1108);
+        return result;
+    };
+
+    const auto read_u64 = [](const u8* ptr) {
+        u64 value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return value;
+    };
+
+    A64TestEnv callback_env;
+    const Result via_callbacks = run(callback_env, A64::UserConfig{&callback_env}, [&](u64 vaddr) { return callback_env.MemoryRead64(vaddr); });
+
+    A64TestEnv page_table_env;
+    std::vector<u8> page(4096);
+    for (size_t i = 0; i < page.size(); i++) {
+        page[i] = static_cast<u8>(i);
+    }
+    std::vector<void*> page_table(16, nullptr);
+    page_table[1] = page.data();
+    A64::UserConfig page_table_conf{&page_table_env};
+    page_table_conf.page_table = page_table.data();
+    page_table_conf.page_table_address_space_bits = 16;
+    const Result via_page_table = run(page_table_env, page_table_conf, [&](u64 vaddr) { return read_u64(&page[vaddr - 0x1000]); });
+
+    A64TestEnv fastmem_env;
+    std::vector<u8> arena(1 << 16);
+    for (size_t i = 0; i < arena.size(); i++) {
+        arena[i] = static_cast<u8>(i);
+    }
+    ExclusiveMonitor monitor{1};
+    A64::UserConfig fastmem_conf{&fastmem_env};
+    fastmem_conf.global_monitor = &monitor;
+    fastmem_conf.fastmem_pointer = arena.data();
+    fastmem_conf.fastmem_address_space_bits = 16;
+    const Result via_fastmem = run(fastmem_env, fastmem_conf, [&](u64 vaddr) { return read_u64(&arena[vaddr]); });
+
+    REQUIRE(via_callbacks.regs[0] == 0x0706050403020100);
+    REQUIRE(via_callbacks.regs[4] == 0x03021211);
+    REQUIRE(via_callbacks.regs[6] == 0xDD);
+    REQUIRE(via_callbacks.regs[8] == 0xCC7F);
+    REQUIRE(via_callbacks.regs[9] == 0x07060504AABB007F);
+    REQUIRE(via_callbacks.regs[14] == 0xFFFF);
+    REQUIRE(via_callbacks.regs[15] == 0x0F0E0D0C0B0A0908);
+    REQUIRE(via_callbacks.regs[19] == 0xDEADBEEFCAFEBABE);
+    REQUIRE(via_callbacks.regs[21] == 0x100);
+    REQUIRE(via_callbacks.regs[22] == 0xFEFF);
+    REQUIRE(via_callbacks.regs[23] == 0xCAFEBABE);
+    REQUIRE(via_callbacks.regs[24] == 0xBE);
+    REQUIRE(via_callbacks.regs[25] == 0xCAFEBABE);
+    REQUIRE(via_callbacks.regs[26] == 0x1111);
+    REQUIRE(via_callbacks.memory_lo == 0x1111);
+    REQUIRE(via_callbacks.memory_hi == 0xDEADBEEF);
+
+    for (const Result* result : {&via_page_table, &via_fastmem}) {
+        REQUIRE(result->regs == via_callbacks.regs);
+        REQUIRE(result->memory_lo == via_callbacks.memory_lo);
+        REQUIRE(result->memory_hi == via_callbacks.memory_hi);
+    }
+    REQUIRE(page_table_env.modified_memory.empty());
+    REQUIRE(fastmem_env.modified_memory.empty());
+}
+
+TEST_CASE("A64: LDADD is atomic across processors", "[a64]") {
+    constexpr u64 iterations = 100000;
+    std::vector<u8> arena(1 << 16);
+
+    const auto run = [&] {
+        A64TestEnv env;
+        A64::UserConfig conf{&env};
+        conf.fastmem_pointer = arena.data();
+        conf.fastmem_address_space_bits = 16;
+        A64::Jit jit{conf};
+
+        env.code_mem.emplace_back(0xf8220020); // LDADD X2, X0, [X1]
+        env.code_mem.emplace_back(0xf1000463); // SUBS X3, X3, #1
+        env.code_mem.emplace_back(0x54ffffc1); // B.NE #-8
+        env.code_mem.emplace_back(0x14000000); // B .
+
+        jit.SetRegister(1, 0x400);
+        jit.SetRegister(2, 3);
+        jit.SetRegister(3, iterations);
+        jit.SetPC(0);
+
+        env.ticks_left = 3 * iterations + 1;
+        jit.Run();
+    };
+
+    std::thread thread0{run};
+    std::thread thread1{run};
+    thread0.join();
+    thread1.join();
+
+    u64 total;
+    std::memcpy(&total, &arena[0x400], sizeof(total));
+    REQUIRE(total == 2 * 3 * iterations);
+}
+
+TEST_CASE("A64: Background compilation", "[a64]") {
+    constexpr u64 iterations = 10000;
+
+    A64TestEnv env;
+    A64::UserConfig conf{&env};
+    conf.background_compilation = true;
+    A64::Jit jit{conf};
+
+    env.code_mem.emplace_back(0xd1000421); // SUB X1, X1, #1
+    env.code_mem.emplace_back(0x91000400); // ADD X0, X0, #1
+    env.code_mem.emplace_back(0xb5ffffc1); // CBNZ X1, #-8
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const auto run = [&] {
+        jit.SetRegister(0, 0);
+        jit.SetRegister(1, iterations);
+        jit.SetPC(0);
+
+        env.ticks_left = 3 * iterations + 1;
+        jit.Run();
+    };
+
+    run();
+    REQUIRE(jit.GetRegister(0) == iterations);
+    REQUIRE(jit.GetRegister(1) == 0);
+    REQUIRE(jit.GetPC() == 12);
+
+    env.code_mem[1] = 0x91000800; // ADD X0, X0, #2
+    jit.InvalidateCacheRange(4, 4);
+
+    run();
+    REQUIRE(jit.GetRegister(0) == 2 * iterations);
+    REQUIRE(jit.GetRegister(1) == 0);
+    REQUIRE(jit.GetPC() == 12);
+}
+
+TEST_CASE("A64: Background compilation only requests block entries", "[a64]") {
+    // Every translation of a block containing the final ADD reads it.
+    struct CountingTestEnv final : public A64TestEnv {
+        std::atomic<size_t> final_add_reads = 0;
+
+        std::uint32_t MemoryReadCode(u64 vaddr) override {
+            if (vaddr == 60) {
+                final_add_reads++;
+            }
+            return A64TestEnv::MemoryReadCode(vaddr);
+        }
+    };
+
+    CountingTestEnv env;
+    {
+        A64::UserConfig conf{&env};
+        conf.background_compilation = true;
+        A64::Jit jit{conf};
+
+        for (size_t i = 0; i < 16; i++) {
+            env.code_mem.emplace_back(0x91000400); // ADD X0, X0, #1
+        }
+        env.code_mem.emplace_back(0x14000000); // B .
+
+        jit.SetPC(0);
+        env.ticks_left = 20;
+        jit.Run();
+        REQUIRE(jit.GetRegister(0) == 16);
+    }
+
+    // Straight-line code is stepped through without requesting a block at every instruction:
+    // the final ADD is read once by the translation of the block at 0 and once when it is stepped.
+    REQUIRE(env.final_add_reads <= 2);
+}
+
+TEST_CASE("A64: Shared code cache", "[a64]") {
+    A64TestEnv env;
+    ExclusiveMonitor monitor{2};
+    SharedCodeCache shared_code_cache;
+
+    A64::UserConfig conf{&env};
+    conf.global_monitor = &monitor;
+    conf.shared_code_cache = &shared_code_cache;
+    conf.processor_id = 0;
+    A64::Jit jit0{conf};
+    conf.processor_id = 1;
+    A64::Jit jit1{conf};
+
+    env.code_mem.emplace_back(0xc85f7c20); // LDXR X0, [X1]
+    env.code_mem.emplace_back(0x91000400); // ADD X0, X0, #1
+    env.code_mem.emplace_back(0xc8027c20); // STXR W2, X0, [X1]
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    const auto run = [&env](A64::Jit& jit) {
+        jit.SetRegister(1, 0x100);
+        jit.SetRegister(2, 0xFF);
+        jit.SetPC(0);
+        env.ticks_left = 4;
+        jit.Run();
+    };
+
+    run(jit0);
+    REQUIRE(jit0.GetRegister(2) == 0);
+    REQUIRE(env.MemoryRead64(0x100) == 0x0706050403020101);
+
+    // The second Jit executes the code compiled by the first, so this modification is not
+    // observed until the cache is invalidated.
+    env.code_mem[1] = 0x91000800; // ADD X0, X0, #2
+    run(jit1);
+    REQUIRE(jit1.GetRegister(2) == 0);
+    REQUIRE(env.MemoryRead64(0x100) == 0x0706050403020102);
+
+    // Invalidation requested through either Jit applies to both.
+    jit0.InvalidateCacheRange(4, 4);
+    run(jit1);
+    REQUIRE(jit1.GetRegister(2) == 0);
+    REQUIRE(env.MemoryRead64(0x100) == 0x0706050403020104);
+}
+
+TEST_CASE("A64: Shared code cache executes concurrently", "[a64]") {
+    // Jits sharing a code cache share their callbacks, which must be thread-safe.
+    struct ConcurrentTestEnv final : public A64TestEnv {
+        std::atomic<size_t> svc_calls = 0;
+        std::atomic<bool> rendezvous_failed = false;
+
+        // Waits until both Jits are executing at the same time.
+        void CallSVC(std::uint32_t) override {
+            svc_calls++;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (svc_calls < 2) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    rendezvous_failed = true;
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        void AddTicks(std::uint64_t) override {}
+        std::uint64_t GetTicksRemaining() override { return 1'000'000; }
+    };
+
+    ConcurrentTestEnv env;
+    ExclusiveMonitor monitor{2};
+    SharedCodeCache shared_code_cache;
+
+    env.code_mem.emplace_back(0xd4000001); // SVC #0
+    env.code_mem.emplace_back(0x91000400); // ADD X0, X0, #1
+    env.code_mem.emplace_back(0xeb01001f); // CMP X0, X1
+    env.code_mem.emplace_back(0x54ffffc1); // B.NE -8
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    A64::UserConfig conf{&env};
+    conf.global_monitor = &monitor;
+    conf.shared_code_cache = &shared_code_cache;
+    conf.processor_id = 0;
+    A64::Jit jit0{conf};
+    conf.processor_id = 1;
+    A64::Jit jit1{conf};
+
+    constexpr size_t rounds = 100;
+    constexpr u64 iterations = 10000;
+    std::atomic<size_t> incorrect_results = 0;
+
+    const auto execute = [&](A64::Jit& jit) {
+        jit.SetPC(0);
+        for (size_t round = 0; round < rounds; round++) {
+            jit.SetRegister(0, 0);
+            jit.SetRegister(1, iterations);
+            // Execution halts early when the shared code cache is invalidated.
+            do {
+                jit.Run();
+            } while (jit.GetPC() != 16);
+            if (jit.GetRegister(0) != iterations) {
+                incorrect_results++;
+            }
+            jit.SetPC(4);
+        }
+    };
+
+    std::thread thread0{execute, std::ref(jit0)};
+    std::thread thread1{execute, std::ref(jit1)};
+
+    // Invalidate code while both Jits are executing it.
+    while (env.svc_calls < 2 && !env.rendezvous_failed) {
+        std::this_thread::yield();
+    }
+    for (size_t i = 0; i < 100; i++) {
+        if (i % 10 == 0) {
+            jit1.ClearCache();
+        } else {
+            jit0.InvalidateCacheRange(8, 4);
+        }
+        std::this_thread::yield();
+    }
+
+    thread0.join();
+    thread1.join();
+
+    REQUIRE(!env.rendezvous_failed);
+    REQUIRE(incorrect_results == 0);
+    REQUIRE(jit0.GetRegister(0) == iterations);
+    REQUIRE(jit1.GetRegister(0) == iterations);
+}
+
+TEST_CASE("A64: Invalidation of code reached through a followed branch", "[a64]") {
+    A64TestEnv env;
+    A64::Jit jit{A64::UserConfig{&env}};
+
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0x91000800); // ADD X0, X0, #2
+    env.code_mem.emplace_back(0x14000000); // B .
+    env.code_mem.emplace_back(0xd2800020); // MOV X0, #1       <- entry
+    env.code_mem.emplace_back(0x17fffffd); // B 0x4
+
+    jit.SetPC(12);
+    env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 3);
+    REQUIRE(jit.GetPC() == 8);
+
+    env.code_mem[1] = 0x91001400; // ADD X0, X0, #5
+    jit.InvalidateCacheRange(4, 4);
+
+    jit.SetPC(12);
+    env.ticks_left = 4;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 6);
+    REQUIRE(jit.GetPC() == 8);
+}
+
+TEST_CASE("A64: Code cache segment eviction", "[a64]") {
+    A64TestEnv env;
+    SharedCodeCache shared_code_cache;
+    A64::UserConfig conf{&env};
+    conf.code_cache_size = 16 * 1024 * 1024;
+    conf.far_code_offset = 8 * 1024 * 1024;
+    conf.constant_pool_size = 1 * 1024 * 1024;
+    // Each branch below must end its block.
+    conf.optimizations &= ~OptimizationFlag::BranchFollowing;
+
+    SECTION("Private code cache") {}
+    SECTION("Shared code cache") {
+        conf.shared_code_cache = &shared_code_cache;
+    }
+
+    A64::Jit jit{conf};
+
+    // Enough distinct blocks to fill the code cache several times over.
+    constexpr size_t block_count = 40000;
+    for (size_t i = 0; i < block_count; i++) {
+        env.code_mem.emplace_back(0x91000400); // ADD X0, X0, #1
+        env.code_mem.emplace_back(0x14000001); // B .+4
+    }
+    env.code_mem.emplace_back(0x17ffffff - 2 * block_count + 1); // B <start>
+
+    jit.SetRegister(0, 0);
+    jit.SetPC(0);
+    env.ticks_left = 2 * (2 * block_count + 1);
+    // With a shared code cache, execution halts to evict a segment.
+    while (env.ticks_left > 0) {
+        jit.Run();
+    }
+
+    REQUIRE(jit.GetRegister(0) == 2 * block_count);
+
+    const CodeCacheStatistics statistics = jit.GetCodeCacheStatistics();
+    REQUIRE(statistics.evicted_segments > 0);
+    REQUIRE(statistics.evicted_blocks > 0);
+    REQUIRE(statistics.cache_clears == 0);
+    REQUIRE(statistics.resident_blocks == statistics.emitted_blocks - statistics.evicted_blocks);
+}
+
+TEST_CASE("A64: Pinned registers", "[a64]") {
+    struct PinnedRegistersTestEnv final : public A64TestEnv {
+        A64::Jit* jit = nullptr;
+        u64 x1_at_svc = 0;
+
+        void CallSVC(std::uint32_t) override {
+            x1_at_svc = jit->GetRegister(1);
+            jit->SetRegister(3, 100);
+        }
+    };
+
+    PinnedRegistersTestEnv env;
+    A64::UserConfig conf{&env};
+    conf.pinned_gpr_mask = 0b111111;
+    A64::Jit jit{conf};
+    env.jit = &jit;
+
+    env.code_mem.emplace_back(0x91000400); // ADD X0, X0, #1
+    env.code_mem.emplace_back(0x8b000021); // ADD X1, X1, X0
+    env.code_mem.emplace_back(0xd1000442); // SUB X2, X2, #1
+    env.code_mem.emplace_back(0xb5ffffa2); // CBNZ X2, 0
+    env.code_mem.emplace_back(0xd4000001); // SVC #0
+    env.code_mem.emplace_back(0x8b010063); // ADD X3, X3, X1
+    env.code_mem.emplace_back(0x11000404); // ADD W4, W0, #1
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    jit.SetRegister(2, 10);
+    jit.SetRegister(4, 0xFFFF'FFFF'FFFF'FFFF);
+    jit.SetPC(0);
+    env.ticks_left = 50;
+    jit.Run();
+
+    REQUIRE(env.x1_at_svc == 55);
+    REQUIRE(jit.GetRegister(0) == 10);
+    REQUIRE(jit.GetRegister(1) == 55);
+    REQUIRE(jit.GetRegister(2) == 0);
+    REQUIRE(jit.GetRegister(3) == 155);
+    REQUIRE(jit.GetRegister(4) == 11);
+    REQUIRE(jit.GetPC() == 28);
+
+    // Registers changed between runs are picked up on entry.
+    jit.SetRegister(0, 1000);
+    jit.SetPC(20);
+    env.ticks_left = 3;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(3) == 210);
+    REQUIRE(jit.GetRegister(4) == 1001);
+    REQUIRE(jit.GetPC() == 28);
+}
+
+TEST_CASE("A64: Register allocation lookahead", "[a64]") {
+    // Long-lived vector values exceed the number of host XMM registers, and general-purpose
+    // values are live across the host calls made by memory accesses.
+    const std::vector<u32> corpus{
+        0x4ea08600, 0x4ea18621, 0x4ea28642, 0x4ea38663, // ADD V0.4S, V16.4S, V0.4S ...
+        0x4ea48684, 0x4ea586a5, 0x4ea686c6, 0x4ea786e7,
+        0x4ea88708, 0x4ea98729, 0x4eaa874a, 0x4eab876b,
+        0x4eac878c, 0x4ead87ad, 0x4eae87ce, 0x4eaf87ef, // ... ADD V15.4S, V31.4S, V15.4S
+        0x4eb09c10, 0x4eb19c31, 0x4eb29c52, 0x4eb39c73, // MUL V16.4S, V0.4S, V16.4S ...
+        0x4eb49c94, 0x4eb59cb5, 0x4eb69cd6, 0x4eb79cf7,
+        0x4eb89d18, 0x4eb99d39, 0x4eba9d5a, 0x4ebb9d7b,
+        0x4ebc9d9c, 0x4ebd9dbd, 0x4ebe9dde, 0x4ebf9dff, // ... MUL V31.4S, V15.4S, V31.4S
+        0x8b000208, 0x8b010229, 0x8b02024a, 0x8b03026b, // ADD X8, X16, X0 ...
+        0x8b04028c, 0x8b0502ad, 0x8b0602ce, 0x8b0702ef, // ... ADD X15, X23, X7
+        0xf94003c0, 0xf94007c1, 0xf9400bc2, 0xf9400fc3, // LDR X0, [X30] ...
+        0xf94013c4, 0xf94017c5, 0xf9401bc6, 0xf9401fc7, // ... LDR X7, [X30, #56]
+        0xca000110, 0xca010131, 0xca020152, 0xca030173, // EOR X16, X8, X0 ...
+        0xca040194, 0xca0501b5, 0xca0601d6, 0xca0701f7, // ... EOR X23, X15, X7
+        0x14000000,                                     // B .
+    };
+
+    const auto run = [&](bool lookahead) {
+        A64TestEnv env;
+        A64::UserConfig conf{&env};
+        if (!lookahead) {
+            conf.optimizations &= ~OptimizationFlag::RegAllocLookahead;
+        }
+        A64::Jit jit{conf};
+
+        env.code_mem = corpus;
+        for (size_t i = 0; i < 31; i++) {
+            jit.SetRegister(i, 0x0123'4567'89AB'CDEF * (i + 1));
+        }
+        for (size_t i = 0; i < 32; i++) {
+            jit.SetVector(i, {0x0F1E'2D3C'4B5A'6978 * (i + 1), 0x8796'A5B4'C3D2'E1F0 * (i + 1)});
+        }
+        jit.SetPC(0);
+        env.ticks_left = corpus.size();
+        jit.Run();
+
+        return std::make_tuple(jit.GetRegisters(), jit.GetVectors(), jit.GetPC(), jit.GetCodeCacheStatistics());
+    };
+
+    const auto [regs_without, vecs_without, pc_without, statistics_without] = run(false);
+    const auto [regs_with, vecs_with, pc_with, statistics_with] = run(true);
+
+    REQUIRE(regs_with == regs_without);
+    REQUIRE(vecs_with == vecs_without);
+    REQUIRE(pc_with == pc_without);
+
+    INFO("Spills: " << statistics_without.register_spills << " -> " << statistics_with.register_spills);
+    INFO("Code size: " << statistics_without.emitted_code_size << " -> " << statistics_with.emitted_code_size);
+    REQUIRE(statistics_with.register_spills < statistics_without.register_spills);
+    REQUIRE(statistics_with.emitted_code_size < statistics_without.emitted_code_size);
+}
+
+TEST_CASE("A64: Flags held in host flags", "[a64]") {
+    const std::vector<std::pair<u64, u64>> operands{
+        {1, 1},
+        {1, 2},
+        {2, 1},
+        {0xFFFF'FFFF'FFFF'FFFF, 1},
+        {0x8000'0000'0000'0000, 1},
+        {0x7FFF'FFFF'FFFF'FFFF, 0xFFFF'FFFF'FFFF'FFFF},
+    };
+
+    const auto run = [&](u32 cond, bool host_flags) {
+        A64TestEnv env;
+        A64::UserConfig conf{&env};
+        if (!host_flags) {
+            conf.optimizations &= ~OptimizationFlag::HostFlags;
+        }
+        A64::Jit jit{conf};
+
+        env.code_mem = {
+            0xeb01001f,                // CMP X0, X1
+            0x9a840062 | (cond << 12), // CSEL X2, X3, X4, <cond>
+            0x9a810007 | (cond << 12), // CSEL X7, X0, X1, <cond>
+            0x54000080 | cond,         // B.<cond> #16
+            0xab01001f,                // CMN X0, X1
+            0x9a040065,                // ADC X5, X3, X4
+            0x14000000,                // B .
+            0xd2800026,                // MOV X6, #1
+            0x14000000,                // B .
+        };
+
+        std::vector<std::tuple<std::array<u64, 31>, u32, u64>> results;
+        for (const auto& [a, b] : operands) {
+            jit.SetRegisters({});
+            jit.SetRegister(0, a);
+            jit.SetRegister(1, b);
+            jit.SetRegister(3, 0x1111'1111'1111'1111);
+            jit.SetRegister(4, 0x2222'2222'2222'2222);
+            jit.SetPC(0);
+            env.ticks_left = 10;
+            jit.Run();
+            results.emplace_back(jit.GetRegisters(), jit.GetPstate(), jit.GetPC());
+        }
+
+        return std::make_pair(results, jit.GetCodeCacheStatistics().emitted_code_size);
+    };
+
+    size_t code_size_without = 0;
+    size_t code_size_with = 0;
+    for (u32 cond = 0; cond < 15; cond++) {
+        INFO("Condition " << cond);
+
+        const auto [results_without, size_without] = run(cond, false);
+        const auto [results_with, size_with] = run(cond, true);
+        REQUIRE(results_with == results_without);
+
+        code_size_without += size_without;
+        code_size_with += size_with;
+    }
+
+    INFO("Code size: " << code_size_without << " -> " << code_size_with);
+    REQUIRE(code_size_with < code_size_without);
+}
+
+TEST_CASE("A64: Tiered compilation", "[a64]") {
+    A64TestEnv env;
+    A64::UserConfig conf{&env};
+    conf.tiering_threshold = 10;
+    A64::Jit jit{conf};
+
+    env.code_mem = {
+        0x91000400, // ADD X0, X0, #1
+        0xf101901f, // CMP X0, #100
+        0x54ffffc1, // B.NE #-8
+        0x14000000, // B .
+    };
+
+    jit.SetPC(0);
+    env.ticks_left = 1000;
+    jit.Run();
+
+    REQUIRE(jit.GetRegister(0) == 100);
+    REQUIRE(jit.GetPC() == 12);
+
+    // Both blocks are executed more than tiering_threshold times, so each is emitted twice.
+    const CodeCacheStatistics statistics = jit.GetCodeCacheStatistics();
+    REQUIRE(statistics.promoted_blocks == 2);
+    REQUIRE(statistics.emitted_blocks == 4);
+    REQUIRE(statistics.resident_blocks == 2);
+}
+
+TEST_CASE("A64: Tiered compilation with a translation cache", "[a64]") {
+    TranslationCache cache;
+
+    A64TestEnv env;
+    A64::UserConfig conf{&env};
+    conf.tiering_threshold = 10;
+    conf.translation_cache = &cache;
+
+    env.code_mem = {
+        0x91000400, // ADD X0, X0, #1
+        0xf101901f, // CMP X0, #100
+        0x54ffffc1, // B.NE #-8
+        0x14000000, // B .
+    };
+
+    const auto run = [&](A64::Jit& jit, u64 x0, u64 ticks) {
+        jit.SetRegister(0, x0);
+        jit.SetPC(0);
+        env.ticks_left = ticks;
+        jit.Run();
+        REQUIRE(jit.GetRegister(0) == 100);
+    };
+
+    // Both blocks stay below the threshold, then are invalidated.
+    A64::Jit jit{conf};
+    run(jit, 95, 5 * 3 + 1);
+    jit.InvalidateCacheRange(0, 16);
+
+    // Another Jit promotes both blocks, which stores them in the translation cache.
+    {
+        A64::Jit other_jit{conf};
+        run(other_jit, 0, 1000);
+        REQUIRE(other_jit.GetCodeCacheStatistics().promoted_blocks == 2);
+    }
+
+    // Blocks found in the translation cache are not compiled as first tier blocks, and invalidated
+    // first tier blocks are not counted as promoted.
+    run(jit, 0, 1000);
+    const CodeCacheStatistics statistics = jit.GetCodeCacheStatistics();
+    REQUIRE(statistics.promoted_blocks == 0);
+    REQUIRE(statistics.emitted_blocks == 4);
+    REQUIRE(statistics.resident_blocks == 2);
+}
@@ -3,20 +3,110 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <array>
+#include <chrono>
 #include <cstring>
 #include <iostream>
 #include <iomanip>
 
 #include <catch.hpp>
+#include <fmt/format.h>
 
 #include <dynarmic/A32/config.h>
 #include "common/assert.h"
+#include "frontend/A32/decoder/arm.h"
 #include "frontend/A32/decoder/asimd.h"
+#include "frontend/A32/decoder/thumb16.h"
+#include "frontend/A32/decoder/thumb32.h"
+#include "frontend/A32/decoder/vfp.h"
 #include "frontend/A32/translate/impl/translate_arm.h"
+#include "frontend/A32/translate/impl/translate_thumb.h"
 #include "frontend/ir/opcodes.h"
+#include "rand_int.h"
 
 using namespace Dynarmic;
 
+namespace {
+
+// Instruction words assembled from a mix of integer, VFP and ASIMD code.
+constexpr std::array<u32, 78> arm_corpus{
+    0xE92D41F0, 0xE1A04000, 0xE5940008, 0xE3500000, 0x0A0A0A0A, 0xE0841100, 0xE5312004, 0xE4842004,
+    0xE2500001, 0x1A0A0A0A, 0xE7D43005, 0xE1C630B2, 0xE1C720D0, 0xE0000291, 0xE0203291, 0xE0810392,
+    0xE20000FF, 0xE18111A2, 0xE0222473, 0xE3C3300F, 0xE1E00001, 0xE3010234, 0xE3450678, 0xE6EF1070,
+    0xE6BF2071, 0xE16F3F12, 0xE6BF0F30, 0xE7E71250, 0xEB0A0A0A, 0xE12FFF33, 0xE12FFF1E, 0xE1910F9F,
+    0xE1812F90, 0xF57FF05B, 0xE3100001, 0xE1310002, 0xE3730004, 0xE0A00001, 0xE0C11002, 0xE2622000,
+    0xE8B0000E, 0xE92D0003, 0xE1020051, 0xE1600281, 0xE6E80011, 0xE6810FB2, 0xE6510F92, 0xE8BD81F0,
+    0xED900B00, 0xED811A01, 0xEE300A81, 0xEE210B02, 0xEE000A81, 0xEEBD0AC0, 0xEEB40B41, 0xEEF1FA10,
+    0xEE100A10, 0xEEB70A00, 0xED2D8B04, 0xECBD8B04, 0xEEB10BC1, 0xEE800A81, 0xF2220844, 0xF3020D54,
+    0xF4200A8D, 0xF401270F, 0xEEA00B10, 0xF2800050, 0xF3020154, 0xF3BD0052, 0xF3880A12, 0xF2B20444,
+    0xF3B10903, 0xF3A20144, 0xF3220854, 0xF2210B12, 0xF2120054, 0xF3B80042,
+};
+
+// Thumb instructions; 32-bit instructions have their first halfword in the upper half.
+// ASIMD instructions are omitted as they are converted to their ARM encoding before decoding.
+constexpr std::array<u32, 65> thumb_corpus{
+    0xB5F0, 0x4604, 0x68A0, 0x2800, 0x1C49, 0x1AD2, 0x0088, 0x684A,
+    0x6062, 0x5D63, 0x8073, 0x200A, 0x4008, 0x4311, 0x405A, 0x4348,
+    0xA804, 0xB082, 0x9801, 0x9102, 0xB2C1, 0xB20A, 0xBA00, 0x4770,
+    0x4798, 0x4680, 0x4440, 0x4208, 0xB108, 0xBF08, 0x2001, 0xC80E, 0xC10C,
+    0xBDF0, 0xF5013080, 0xEBA20183, 0xF8D10400, 0xF8432D08, 0xE9D72302, 0xE96D2302, 0xFB01F002,
+    0xFB013002, 0xFBA20103, 0xFB91F0F2, 0xFBB1F0F2, 0xF2412034, 0xF2C56078, 0xF3C01107, 0xF360110B,
+    0xFAB2F382, 0xF00100FF, 0xEA4101D2, 0xFA01F002, 0xFA5FF180, 0xE8510F00, 0xE8410200, 0xF3BF8F5B,
+    0xF00AD00A, 0xF00A900A, 0xE8DFF000, 0xE92D43F0, 0xE8BD83F0, 0xED900B00, 0xEE300A81, 0xEE210B02,
+};
+
+template <typename MatcherT>
+const MatcherT* LinearFind(const std::vector<MatcherT>& list, typename MatcherT::opcode_type instruction) {
+    const auto iter = std::find_if(list.begin(), list.end(), [instruction](const auto& matcher) { return matcher.Matches(instruction); });
+    return iter != list.end() ? &*iter : nullptr;
+}
+
+template <typename LookupTableT>
+const auto* LookupFind(const LookupTableT& table, typename LookupTableT::opcode_type instruction) {
+    const auto result = table.Find(instruction);
+    return result ? &result->get() : nullptr;
+}
+
+template <typename LookupTableT>
+void CheckLookupTableAgainstLinearSearch(const LookupTableT& table) {
+    using opcode_type = typename LookupTableT::opcode_type;
+
+    const auto& list = table.Matchers();
+    const auto check = [&](opcode_type instruction) {
+        if (LookupFind(table, instruction) != LinearFind(list, instruction)) {
+            INFO("Instruction: " << std::hex << std::setfill('0') << std::setw(8) << instruction);
+            FAIL("Lookup table and linear search disagree");
+        }
+    };
+
+    for (const auto& matcher : list) {
+        for (size_t i = 0; i < 16; i++) {
+            const auto fill = static_cast<opcode_type>(RandInt<u32>(0, 0xFFFFFFFF));
+            check(static_cast<opcode_type>(matcher.GetExpected() | (fill & ~matcher.GetMask())));
+        }
+    }
+    for (size_t i = 0; i < 100000; i++) {
+        check(static_cast<opcode_type>(RandInt<u32>(0, 0xFFFFFFFF)));
+    }
+}
+
+template <typename F>
+double MeasureDecodeRate(size_t iterations, size_t corpus_size, F&& decode_corpus) {
+    const auto start = std::chrono::steady_clock::now();
+    size_t checksum = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        checksum += decode_corpus();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    REQUIRE(checksum == iterations * corpus_size);
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(iterations * corpus_size) / seconds / 1e6;
+}
+
+} // anonymous namespace
+
 TEST_CASE("ASIMD Decoder: Ensure table order correctness", "[decode][a32]") {
     const auto table = A32::GetASIMDDecodeTable<A32::ArmTranslatorVisitor>();
 
@@ -73,3 +163,87 @@ TEST_CASE("ASIMD Decoder: Ensure table order correctness", "[decode][a32]") {
         } while (x != 0);
     }
 }
+
+TEST_CASE("A32 Decoders: Lookup tables agree with linear search", "[decode][a32]") {
+    SECTION("ARM") {
+        CheckLookupTableAgainstLinearSearch(A32::ArmLookupTable<A32::ArmTranslatorVisitor>{A32::GetArmDecodeTable<A32::ArmTranslatorVisitor>()});
+    }
+
+    SECTION("VFP") {
+        auto [unconditional, conditional] = A32::GetVFPDecodeTables<A32::ArmTranslatorVisitor>();
+        CheckLookupTableAgainstLinearSearch(A32::VFPLookupTable<A32::ArmTranslatorVisitor>{std::move(unconditional)});
+        CheckLookupTableAgainstLinearSearch(A32::VFPLookupTable<A32::ArmTranslatorVisitor>{std::move(conditional)});
+    }
+
+    SECTION("ASIMD") {
+        CheckLookupTableAgainstLinearSearch(A32::ASIMDLookupTable<A32::ArmTranslatorVisitor>{A32::GetASIMDDecodeTable<A32::ArmTranslatorVisitor>()});
+    }
+
+    SECTION("Thumb16") {
+        CheckLookupTableAgainstLinearSearch(A32::Thumb16LookupTable<A32::ThumbTranslatorVisitor>{A32::GetThumb16DecodeTable<A32::ThumbTranslatorVisitor>()});
+    }
+
+    SECTION("Thumb32") {
+        CheckLookupTableAgainstLinearSearch(A32::Thumb32LookupTable<A32::ThumbTranslatorVisitor>{A32::GetThumb32DecodeTable<A32::ThumbTranslatorVisitor>()});
+    }
+}
+
+TEST_CASE("A32 Decoders: Throughput benchmark", "[.][decode][a32][bench]") {
+    using ArmV = A32::ArmTranslatorVisitor;
+    using ThumbV = A32::ThumbTranslatorVisitor;
+
+    constexpr size_t iterations = 20000;
+
+    const auto arm_list = A32::GetArmDecodeTable<ArmV>();
+    const auto asimd_list = A32::GetASIMDDecodeTable<ArmV>();
+    const auto vfp_lists = A32::GetVFPDecodeTables<ArmV>();
+    const auto thumb16_list = A32::GetThumb16DecodeTable<ThumbV>();
+    const auto thumb32_list = A32::GetThumb32DecodeTable<ThumbV>();
+
+    const auto linear_vfp = [&](u32 instruction) {
+        const bool is_unconditional = (instruction & 0xF0000000) == 0xF0000000;
+        return LinearFind(is_unconditional ? vfp_lists.unconditional : vfp_lists.conditional, instruction) != nullptr;
+    };
+
+    // Decoders are tried in the same order as the translators try them.
+    const double arm_linear = MeasureDecodeRate(iterations, arm_corpus.size(), [&] {
+        size_t decoded = 0;
+        for (const u32 instruction : arm_corpus) {
+            decoded += linear_vfp(instruction) || LinearFind(asimd_list, instruction) || LinearFind(arm_list, instruction);
+        }
+        return decoded;
+    });
+    const double arm_lookup = MeasureDecodeRate(iterations, arm_corpus.size(), [&] {
+        size_t decoded = 0;
+        for (const u32 instruction : arm_corpus) {
+            decoded += A32::DecodeVFP<ArmV>(instruction) || A32::DecodeASIMD<ArmV>(instruction) || A32::DecodeArm<ArmV>(instruction);
+        }
+        return decoded;
+    });
+
+    const double thumb_linear = MeasureDecodeRate(iterations, thumb_corpus.size(), [&] {
+        size_t decoded = 0;
+        for (const u32 instruction : thumb_corpus) {
+            if (instruction <= 0xFFFF) {
+                decoded += LinearFind(thumb16_list, static_cast<u16>(instruction)) != nullptr;
+            } else {
+                decoded += linear_vfp(instruction) || LinearFind(thumb32_list, instruction);
+            }
+        }
+        return decoded;
+    });
+    const double thumb_lookup = MeasureDecodeRate(iterations, thumb_corpus.size(), [&] {
+        size_t decoded = 0;
+        for (const u32 instruction : thumb_corpus) {
+            if (instruction <= 0xFFFF) {
+                decoded += A32::DecodeThumb16<ThumbV>(static_cast<u16>(instruction)).has_value();
+            } else {
+                decoded += A32::DecodeVFP<ArmV>(instruction) || A32::DecodeThumb32<ThumbV>(instruction);
+            }
+        }
+        return decoded;
+    });
+
+    fmt::print("ARM:   linear search {:.1f} Minst/s, lookup table {:.1f} Minst/s ({:.2f}x)\n", arm_linear, arm_lookup, arm_lookup / arm_linear);
+    fmt::print("Thumb: linear search {:.1f} Minst/s, lookup table {:.1f} Minst/s ({:.2f}x)\n", thumb_linear, thumb_lookup, thumb_lookup / thumb_linear);
+}
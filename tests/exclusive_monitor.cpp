@@ -0,0 +1,183 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+#include <fmt/format.h>
+
+#include <dynarmic/exclusive_monitor.h>
+
+#include "common/common_types.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+/// The previous implementation of the global monitor, kept for comparison:
+/// every exclusive access is serialised behind one spinlock and every store
+/// scans all processors.
+class GlobalLockExclusiveMonitor {
+public:
+    explicit GlobalLockExclusiveMonitor(size_t processor_count)
+        : exclusive_addresses(processor_count, INVALID_EXCLUSIVE_ADDRESS), exclusive_values(processor_count) {}
+
+    template <typename T, typename Function>
+    T ReadAndMark(size_t processor_id, VAddr address, Function op) {
+        Lock();
+        exclusive_addresses[processor_id] = address;
+        const T value = op();
+        std::memcpy(exclusive_values[processor_id].data(), &value, sizeof(T));
+        Unlock();
+        return value;
+    }
+
+    template <typename T, typename Function>
+    bool DoExclusiveOperation(size_t processor_id, VAddr address, Function op) {
+        Lock();
+        if (exclusive_addresses[processor_id] != address) {
+            Unlock();
+            return false;
+        }
+        for (VAddr& other_address : exclusive_addresses) {
+            if (other_address == address) {
+                other_address = INVALID_EXCLUSIVE_ADDRESS;
+            }
+        }
+
+        T saved_value;
+        std::memcpy(&saved_value, exclusive_values[processor_id].data(), sizeof(T));
+        const bool result = op(saved_value);
+
+        Unlock();
+        return result;
+    }
+
+private:
+    void Lock() {
+        while (is_locked.test_and_set(std::memory_order_acquire)) {}
+    }
+
+    void Unlock() {
+        is_locked.clear(std::memory_order_release);
+    }
+
+    static constexpr VAddr INVALID_EXCLUSIVE_ADDRESS = 0xDEAD'DEAD'DEAD'DEADull;
+    std::atomic_flag is_locked = ATOMIC_FLAG_INIT;
+    std::vector<VAddr> exclusive_addresses;
+    std::vector<Vector> exclusive_values;
+};
+
+/// Emulates `ldxr; add; stxr; cbnz` retry loops on a set of shared counters.
+/// Each thread increments counters[(thread + i) % counter_count] iterations times.
+template <typename Monitor>
+void IncrementCounters(Monitor& monitor, std::vector<std::atomic<u64>>& counters, size_t thread_count, size_t iterations) {
+    std::vector<std::thread> threads;
+    for (size_t processor_id = 0; processor_id < thread_count; processor_id++) {
+        threads.emplace_back([&, processor_id] {
+            for (size_t i = 0; i < iterations; i++) {
+                const size_t index = (processor_id + i) % counters.size();
+                const VAddr vaddr = 0x1000 + index * 0x40;
+                std::atomic<u64>& counter = counters[index];
+
+                while (true) {
+                    const u64 value = monitor.template ReadAndMark<u64>(processor_id, vaddr, [&] { return counter.load(); });
+                    // A plain store, as a guest stxr does: lost increments can only be prevented by the monitor.
+                    const bool stored = monitor.template DoExclusiveOperation<u64>(processor_id, vaddr, [&](u64) {
+                        counter.store(value + 1);
+                        return true;
+                    });
+                    if (stored) {
+                        break;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+template <typename Monitor>
+double MeasureContention(size_t thread_count, size_t counter_count, size_t iterations) {
+    Monitor monitor{thread_count};
+    std::vector<std::atomic<u64>> counters(counter_count);
+
+    const auto start = std::chrono::steady_clock::now();
+    IncrementCounters(monitor, counters, thread_count, iterations);
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // anonymous namespace
+
+TEST_CASE("ExclusiveMonitor: Store clears other processors' reservations", "[exclusive_monitor]") {
+    ExclusiveMonitor monitor{3};
+    u64 memory = 0;
+
+    const auto read = [&](size_t processor_id, VAddr vaddr) {
+        return monitor.ReadAndMark<u64>(processor_id, vaddr, [&] { return memory; });
+    };
+    const auto write = [&](size_t processor_id, VAddr vaddr, u64 value) {
+        return monitor.DoExclusiveOperation<u64>(processor_id, vaddr, [&](u64) { memory = value; return true; });
+    };
+
+    read(0, 0x1000);
+    read(1, 0x1000);
+    read(2, 0x2000);
+
+    REQUIRE(write(1, 0x1000, 1));
+    REQUIRE(!write(0, 0x1000, 2));
+    REQUIRE(!write(1, 0x1000, 3));
+    REQUIRE(write(2, 0x2000, 4));
+    REQUIRE(memory == 4);
+
+    read(0, 0x1000);
+    monitor.ClearProcessor(0);
+    REQUIRE(!write(0, 0x1000, 5));
+
+    read(0, 0x1000);
+    REQUIRE(!write(0, 0x1008, 6));
+    REQUIRE(write(0, 0x1000, 7));
+    REQUIRE(memory == 7);
+}
+
+TEST_CASE("ExclusiveMonitor: Concurrent exclusive increments are not lost", "[exclusive_monitor]") {
+    constexpr size_t thread_count = 4;
+    constexpr size_t iterations = 20000;
+
+    for (size_t counter_count : {size_t(1), size_t(3), size_t(64)}) {
+        ExclusiveMonitor monitor{thread_count};
+        std::vector<std::atomic<u64>> counters(counter_count);
+
+        IncrementCounters(monitor, counters, thread_count, iterations);
+
+        u64 total = 0;
+        for (const auto& counter : counters) {
+            total += counter.load();
+        }
+        REQUIRE(total == thread_count * iterations);
+    }
+}
+
+TEST_CASE("ExclusiveMonitor: Contention benchmark", "[.][exclusive_monitor][bench]") {
+    constexpr size_t iterations = 200000;
+    const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+
+    for (size_t thread_count = 2; thread_count <= std::min<size_t>(max_threads, 8); thread_count *= 2) {
+        for (size_t counter_count : {size_t(1), thread_count, 64 * thread_count}) {
+            const double global_lock_ms = MeasureContention<GlobalLockExclusiveMonitor>(thread_count, counter_count, iterations);
+            const double sharded_ms = MeasureContention<ExclusiveMonitor>(thread_count, counter_count, iterations);
+            fmt::print("threads={} addresses={}: global lock {:.1f} ms, sharded {:.1f} ms ({:.2f}x)\n",
+                       thread_count, counter_count, global_lock_ms, sharded_ms, global_lock_ms / sharded_ms);
+        }
+    }
+}
@@ -3,5 +3,6 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#define CATCH_CONFIG_NO_POSIX_SIGNALS  // Don't clobber the JIT's own SIGSEGV handler (used by fastmem)
 #define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
 #include <catch.hpp>
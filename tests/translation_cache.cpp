@@ -0,0 +1,261 @@
+/* This file is part of the dynarmic project.
+ * Copyright (c) 2020 MerryMage
+ * SPDX-License-Identifier: 0BSD
+ */
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <catch.hpp>
+#include <fmt/format.h>
+
+#include <dynarmic/translation_cache.h>
+
+#include "A32/testenv.h"
+#include "A64/testenv.h"
+#include "common/common_types.h"
+#include "frontend/A32/location_descriptor.h"
+#include "frontend/A32/translate/translate.h"
+#include "frontend/A64/location_descriptor.h"
+#include "frontend/A64/translate/translate.h"
+#include "frontend/ir/basic_block.h"
+#include "frontend/ir/serialization.h"
+#include "ir_opt/passes.h"
+#include "rand_int.h"
+
+using namespace Dynarmic;
+
+namespace {
+
+void CheckRoundTrip(const IR::Block& block) {
+    const auto data = IR::SerializeBlock(block);
+    const auto restored = IR::DeserializeBlock(data);
+    REQUIRE(restored);
+    REQUIRE(IR::SerializeBlock(*restored) == data);
+}
+
+std::string TemporaryCachePath() {
+    return (std::filesystem::temp_directory_path() / fmt::format("dynarmic_translation_cache_{}.bin", RandInt<u32>(0, 0xFFFFFFFF))).string();
+}
+
+void RunA64Program(A64TestEnv& env, A64::Jit& jit) {
+    jit.SetRegister(0, 1);
+    jit.SetRegister(1, 2);
+    jit.SetPC(0);
+    env.ticks_left = 4;
+    jit.Run();
+}
+
+} // anonymous namespace
+
+TEST_CASE("TranslationCache: IR survives serialization", "[translation_cache]") {
+    SECTION("A64") {
+        for (size_t i = 0; i < 2000; i++) {
+            const u32 instruction = RandInt<u32>(0, 0xFFFFFFFF);
+            const auto get_code = [instruction](u64 vaddr) { return vaddr == 0 ? instruction : 0x14000000; };
+
+            IR::Block block = A64::Translate(A64::LocationDescriptor{0, {}}, get_code, {});
+            Optimization::A64GetSetElimination(block);
+            Optimization::ConstantPropagation(block);
+            Optimization::DeadCodeElimination(block);
+            CheckRoundTrip(block);
+        }
+    }
+
+    SECTION("A32") {
+        // The A32 translator asserts on some UNPREDICTABLE encodings, so restrict the random
+        // instructions to data-processing and load/store forms that do not involve the PC.
+        const auto random_arm_instruction = [] {
+            const u32 op = RandInt<u32>(0, 3) << 25;
+            const u32 rn = RandInt<u32>(0, 14) << 16;
+            const u32 rd = RandInt<u32>(0, 14) << 12;
+            const u32 rm = RandInt<u32>(0, 14);
+            return 0xE0000000 | op | rn | rd | rm | (RandInt<u32>(0, 0xFFFFFFFF) & 0x01F00FF0);
+        };
+
+        for (size_t i = 0; i < 2000; i++) {
+            const u32 instruction = random_arm_instruction();
+            const auto get_code = [instruction](u32 vaddr) { return vaddr == 0 ? instruction : 0xEAFFFFFE; };
+
+            IR::Block block = A32::Translate(A32::LocationDescriptor{0, A32::PSR{}, {}}, get_code, {});
+            Optimization::A32GetSetElimination(block);
+            Optimization::DeadCodeElimination(block);
+            CheckRoundTrip(block);
+        }
+    }
+}
+
+TEST_CASE("TranslationCache: Flag-setting logical operations with trivial operands survive serialization", "[translation_cache]") {
+    const std::array<u32, 2> instructions{
+        0xea3f03a5, // BICS X5, X29, XZR
+        0x6a1f0020, // ANDS W0, W1, WZR
+    };
+
+    for (const u32 instruction : instructions) {
+        const auto get_code = [instruction](u64 vaddr) { return vaddr == 0 ? instruction : 0x14000000; };
+
+        IR::Block block = A64::Translate(A64::LocationDescriptor{0, {}}, get_code, {});
+        Optimization::A64GetSetElimination(block);
+        Optimization::ConstantPropagation(block);
+        Optimization::DeadCodeElimination(block);
+        CheckRoundTrip(block);
+    }
+}
+
+TEST_CASE("TranslationCache: Malformed data is rejected", "[translation_cache]") {
+    const auto get_code = [](u64 vaddr) { return vaddr == 0 ? 0x8b020020 : 0x14000000; }; // ADD X0, X1, X2
+    const IR::Block block = A64::Translate(A64::LocationDescriptor{0, {}}, get_code, {});
+    const auto data = IR::SerializeBlock(block);
+
+    for (size_t size = 0; size < data.size(); size++) {
+        REQUIRE(!IR::DeserializeBlock(std::vector<u8>(data.begin(), data.begin() + size)));
+    }
+}
+
+TEST_CASE("TranslationCache: Blocks are shared between Jits", "[translation_cache]") {
+    TranslationCache cache;
+
+    A64TestEnv env;
+    env.code_mem.emplace_back(0x8b010000); // ADD X0, X0, X1
+    env.code_mem.emplace_back(0x8b010000); // ADD X0, X0, X1
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    A64::UserConfig conf{&env};
+    conf.translation_cache = &cache;
+
+    {
+        A64::Jit jit{conf};
+        RunA64Program(env, jit);
+        REQUIRE(jit.GetRegister(0) == 5);
+    }
+    const size_t size = cache.Size();
+    REQUIRE(size > 0);
+
+    SECTION("Unchanged code") {
+        A64::Jit jit{conf};
+        RunA64Program(env, jit);
+        REQUIRE(jit.GetRegister(0) == 5);
+        REQUIRE(cache.Size() == size);
+    }
+
+    SECTION("Guest code modified without invalidation") {
+        env.code_mem[1] = 0xcb010000; // SUB X0, X0, X1
+
+        A64::Jit jit{conf};
+        RunA64Program(env, jit);
+        REQUIRE(jit.GetRegister(0) == 1);
+    }
+
+    SECTION("InvalidateCacheRange") {
+        A64::Jit jit{conf};
+        jit.InvalidateCacheRange(4, 4);
+        REQUIRE(cache.Size() < size);
+
+        env.code_mem[1] = 0xcb010000; // SUB X0, X0, X1
+        RunA64Program(env, jit);
+        REQUIRE(jit.GetRegister(0) == 1);
+    }
+
+    SECTION("Different configuration") {
+        conf.define_unpredictable_behaviour = true;
+
+        A64::Jit jit{conf};
+        RunA64Program(env, jit);
+        REQUIRE(jit.GetRegister(0) == 5);
+        REQUIRE(cache.Size() > size);
+    }
+}
+
+TEST_CASE("TranslationCache: Entries are validated against the code that was translated", "[translation_cache]") {
+    // Models another thread modifying guest code while a block is being translated.
+    class ModifyingEnv final : public A64TestEnv {
+    public:
+        std::uint32_t MemoryReadCode(u64 vaddr) override {
+            const std::uint32_t word = A64TestEnv::MemoryReadCode(vaddr);
+            if (vaddr == 4) {
+                code_mem[1] = 0xcb010000; // SUB X0, X0, X1
+            }
+            return word;
+        }
+    };
+
+    TranslationCache cache;
+
+    ModifyingEnv env;
+    env.code_mem.emplace_back(0x8b010000); // ADD X0, X0, X1
+    env.code_mem.emplace_back(0x8b010000); // ADD X0, X0, X1
+    env.code_mem.emplace_back(0x14000000); // B .
+
+    A64::UserConfig conf{&env};
+    conf.translation_cache = &cache;
+
+    {
+        A64::Jit jit{conf};
+        RunA64Program(env, jit);
+        REQUIRE(jit.GetRegister(0) == 5);
+    }
+
+    // The cached block was translated from the ADD, so it must not be used for the SUB now in memory.
+    A64::Jit jit{conf};
+    RunA64Program(env, jit);
+    REQUIRE(jit.GetRegister(0) == 1);
+}
+
+TEST_CASE("TranslationCache: Save and load", "[translation_cache]") {
+    const std::string path = TemporaryCachePath();
+
+    ArmTestEnv env;
+    env.code_mem = {
+        0xe0800001, // add r0, r0, r1
+        0xe0800001, // add r0, r0, r1
+        0xeafffffe, // b +#0
+    };
+
+    const auto run = [&env](TranslationCache& cache) {
+        A32::UserConfig conf;
+        conf.callbacks = &env;
+        conf.translation_cache = &cache;
+
+        A32::Jit jit{conf};
+        jit.Regs()[0] = 1;
+        jit.Regs()[1] = 2;
+        jit.Regs()[15] = 0;
+        jit.SetCpsr(0x000001d0); // User-mode
+        env.ticks_left = 4;
+        jit.Run();
+        return jit.Regs()[0];
+    };
+
+    {
+        TranslationCache cache;
+        REQUIRE(run(cache) == 5);
+        REQUIRE(cache.Size() > 0);
+        REQUIRE(cache.Save(path));
+    }
+
+    {
+        TranslationCache cache;
+        REQUIRE(cache.Load(path));
+        REQUIRE(cache.Size() > 0);
+        REQUIRE(run(cache) == 5);
+
+        env.code_mem[1] = 0xe0400001; // sub r0, r0, r1
+        REQUIRE(run(cache) == 1);
+    }
+
+    {
+        std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+        file.seekp(8);
+        file.put('\xFF');
+    }
+
+    {
+        TranslationCache cache;
+        REQUIRE(!cache.Load(path));
+        REQUIRE(cache.Size() == 0);
+    }
+
+    std::filesystem::remove(path);
+}